@@ -33,8 +33,17 @@
 #include "cflow_constants.h"
 #include "axe_transform.h"
 #include "axe_reg_alloc.h"
+#include "axe_reg_coloring.h"
+#include "axe_spill_opt.h"
+#include "axe_coalesce.h"
+#include "axe_const_prop.h"
+#include "axe_ssa.h"
+#include "axe_cse.h"
+#include "axe_dce.h"
+#include "axe_loop_opt.h"
 #include "reg_alloc_constants.h"
 #include "axe_io_manager.h"
+#include "axe_stats.h"
 #ifndef NDEBUG
 #  include "axe_debug.h"
 #endif
@@ -87,6 +96,9 @@ t_cflow_Graph *graph;      /* An instance of a control flow graph. This instance
                             * will be generated starting from `program' and will
                             * be used during the register allocation process */
 
+t_ssa_form *ssa;           /* The SSA form of the temporary registers of
+                            * `graph', used by the optimizations */
+
 t_reg_allocator *RA;       /* Register allocator. It implements the "Linear
                             * scan" algorithm */
 
@@ -133,6 +145,8 @@ extern void yyerror(const char*);
 %token <label> IF
 %token <label> ELSE
 %token <intval> TYPE
+/* identifiers are interned in `program->strings' by the scanner, thus the
+ * semantic value of an IDENTIFIER must never be freed */
 %token <svalue> IDENTIFIER
 %token <intval> NUMBER
 
@@ -271,13 +285,6 @@ assign_statement : IDENTIFIER LSQUARE exp RSQUARE ASSIGN exp
                 * that holds an integer value. That value will be
                 * used as an index for the array $1 */
                storeArrayElement(program, $1, $3, $6);
-
-               /* free the memory associated with the IDENTIFIER.
-                * The use of the free instruction is required
-                * because of the value associated with IDENTIFIER.
-                * The value of IDENTIFIER is a string created
-                * by a call to the function `strdup' (see Acse.lex) */
-               free($1);
             }
             | IDENTIFIER ASSIGN exp
             {
@@ -306,9 +313,6 @@ assign_statement : IDENTIFIER LSQUARE exp RSQUARE ASSIGN exp
                                       REG_0,
                                       $3.value,
                                       CG_DIRECT_ALL);
-
-               /* free the memory associated with the IDENTIFIER */
-               free($1);
             }
 ;
             
@@ -344,14 +348,8 @@ if_stmt  :  IF
                }
                LPAR exp RPAR
                {
-                     if ($4.expression_type == IMMEDIATE)
-                         gen_load_immediate(program, $4.value);
-                     else
-                         gen_andb_instruction(program, $4.value,
-                             $4.value, $4.value, CG_DIRECT_ALL);
-
                      /* if `exp' returns FALSE, jump to the label $1 */
-                     gen_beq_instruction (program, $1, 0);
+                     gen_condition_branch(program, $4, 0, $1);
                }
                code_block { $$ = $1; }
 ;
@@ -361,18 +359,11 @@ while_statement  : WHILE
                      /* initialize the value of the non-terminal */
                      $1 = create_while_statement();
 
-                     /* reserve and fix a new label */
-                     $1.label_condition
-                           = assignNewLabel(program);
+                     /* remember where the loop condition begins */
+                     $1.condition = getInstrInsertionPoint(program);
                   }
                   LPAR exp RPAR
                   {
-                     if ($4.expression_type == IMMEDIATE)
-                        gen_load_immediate(program, $4.value);
-                     else
-                         gen_andb_instruction(program, $4.value,
-                             $4.value, $4.value, CG_DIRECT_ALL);
-
                      /* reserve a new label. This new label will point
                       * to the first instruction after the while code
                       * block */
@@ -380,13 +371,27 @@ while_statement  : WHILE
 
                      /* if `exp' returns FALSE, jump to the label 
                       * $1.label_end */
-                     gen_beq_instruction (program, $1.label_end, 0);
+                     $1.branch_end = gen_condition_branch
+                           (program, $4, 0, $1.label_end);
+
+                     /* reserve and fix a new label for the loop body */
+                     $1.label_body = assignNewLabel(program);
                   }
                   code_block
                   {
-                     /* jump to the beginning of the loop */
-                     gen_bt_instruction
-                           (program, $1.label_condition, 0);
+                     t_list *first;
+
+                     /* the condition is evaluated again at the end of the
+                      * loop, and if `exp' returns TRUE jump back to the
+                      * label $1.label_body: each iteration executes a
+                      * single branch. The condition before the loop only
+                      * skips the loop when it is not verified at all. */
+                     if ($1.condition == NULL)
+                        first = program->instructions;
+                     else
+                        first = LNEXT($1.condition);
+                     gen_loop_condition_copy(program, LDATA(first),
+                           $1.branch_end, $1.label_body);
 
                      /* fix the label `label_end' */
                      assignLabel(program, $1.label_end);
@@ -404,14 +409,8 @@ do_while_statement  : DO
                      }
                      code_block WHILE LPAR exp RPAR
                      {
-                           if ($6.expression_type == IMMEDIATE)
-                               gen_load_immediate(program, $6.value);
-                           else
-                               gen_andb_instruction(program, $6.value,
-                                   $6.value, $6.value, CG_DIRECT_ALL);
-
                            /* if `exp' returns TRUE, jump to the label $1 */
-                           gen_bne_instruction (program, $1, 0);
+                           gen_condition_branch(program, $6, 1, $1);
                      }
 ;
 
@@ -436,9 +435,6 @@ read_statement : READ LPAR IDENTIFIER RPAR
 
                /* insert a read instruction */
                gen_read_instruction (program, location);
-
-               /* free the memory associated with the IDENTIFIER */
-               free($3);
             }
 ;
             
@@ -471,8 +467,6 @@ exp: NUMBER      { $$ = create_expression ($1, IMMEDIATE); }
                      gen_addi_instruction(program, expValReg, variableReg, 0);
                      /* return that register as the expression value */
                      $$ = create_expression(expValReg, REGISTER);
-                     /* free the memory associated with the IDENTIFIER */
-                     free($1);
    }
    | IDENTIFIER LSQUARE exp RSQUARE {
                      int reg;
@@ -483,34 +477,8 @@ exp: NUMBER      { $$ = create_expression ($1, IMMEDIATE); }
 
                      /* create a new expression */
                      $$ = create_expression (reg, REGISTER);
-
-                     /* free the memory associated with the IDENTIFIER */
-                     free($1);
-   }
-   | NOT_OP exp {
-               if ($2.expression_type == IMMEDIATE)
-               {
-                  /* IMMEDIATE (constant) expression: compute the value at
-                   * compile-time and place the result in a new IMMEDIATE
-                   * expression */
-                  $$ = create_expression(!($2.value), IMMEDIATE);
-               }
-               else
-               {
-                  /* REGISTER expression: generate the code that will compute
-                   * the result at compile time */
-
-                  /* Reserve a new register for the result */
-                  int output_register = getNewRegister(program);
-
-                  /* Generate a NOTL instruction which will store the negated
-                   * logic value into the register we reserved */
-                  gen_notl_instruction(program, output_register, $2.value);
-                  
-                  /* Return a REGISTER expression with the result register */
-                  $$ = create_expression(output_register, REGISTER);
-               }
    }
+   | NOT_OP exp { $$ = handle_logical_not(program, $2); }
    | exp AND_OP exp { $$ = handle_bin_numeric_op(program, $1, $3, ANDB); }
    | exp OR_OP exp  { $$ = handle_bin_numeric_op(program, $1, $3, ORB); }
    | exp PLUS exp   { $$ = handle_bin_numeric_op(program, $1, $3, ADD); }
@@ -525,8 +493,10 @@ exp: NUMBER      { $$ = create_expression ($1, IMMEDIATE); }
    | exp GTEQ exp   { $$ = handle_binary_comparison(program, $1, $3, _GTEQ_); }
    | exp SHL_OP exp { $$ = handle_bin_numeric_op(program, $1, $3, SHL); }
    | exp SHR_OP exp { $$ = handle_bin_numeric_op(program, $1, $3, SHR); }
-   | exp ANDAND exp { $$ = handle_bin_numeric_op(program, $1, $3, ANDL); }
-   | exp OROR exp   { $$ = handle_bin_numeric_op(program, $1, $3, ORL); }
+   | exp ANDAND { $<list>$ = getInstrInsertionPoint(program); } exp
+                    { $$ = handle_logical_op(program, $1, $4, $<list>3, ANDL); }
+   | exp OROR { $<list>$ = getInstrInsertionPoint(program); } exp
+                    { $$ = handle_logical_op(program, $1, $4, $<list>3, ORL); }
    | LPAR exp RPAR  { $$ = $2; }
    | MINUS exp {
                   if ($2.expression_type == IMMEDIATE)
@@ -539,8 +509,7 @@ exp: NUMBER      { $$ = create_expression ($1, IMMEDIATE); }
                      t_axe_expression exp_r0;
 
                      /* create an expression for register REG_0 */
-                     exp_r0.value = REG_0;
-                     exp_r0.expression_type = REGISTER;
+                     exp_r0 = create_expression(REG_0, REGISTER);
                      
                      $$ = handle_bin_numeric_op
                            (program, exp_r0, $2, SUB);
@@ -558,7 +527,11 @@ int main (int argc, char **argv)
    init_compiler(argc, argv);
    
    /* start the parsing procedure */
+   beginPhase("parsing");
    yyparse();
+   endPhase();
+   setStatistic("instructions.parsed", program->numInstructions);
+   setStatistic("temporaries", program->current_register);
    
 #ifndef NDEBUG
    fprintf(stdout, "Parsing process completed. \n");
@@ -572,14 +545,72 @@ int main (int argc, char **argv)
     * transformations that follow. */
    line_num = -1;
 
+   /* propagate the constants and remove the code which is never
+    * executed, before the code is specialized for the target */
+   beginPhase("constant propagation");
+   graph = createFlowGraph(program->instructions);
+   checkConsistency();
+   propagateConstants(program, graph);
+   endPhase();
+
+   /* the optimizations of the temporaries work on the SSA form */
+   beginPhase("ssa construction");
+   ssa = buildSSAForm(program, graph);
+   endPhase();
+   setStatistic("ssa.phis", ssa->numPhis);
+   setStatistic("ssa.renamed", ssa->numRenamed);
+
+   /* reuse the values already computed inside each basic block */
+   beginPhase("common subexpressions");
+   eliminateCommonSubexpressions(ssa);
+   endPhase();
+
+   beginPhase("ssa destruction");
+   destroySSAForm(ssa);
+   ssa = NULL;
+   endPhase();
+
+   /* compute the values which do not change inside a loop only once,
+    * before entering it */
+   beginPhase("loop invariants");
+   hoistLoopInvariants(program, graph);
+   endPhase();
+
+   /* advance the addresses of the array elements together with the loop
+    * indices, instead of computing them from scratch */
+   beginPhase("induction variables");
+   reduceInductionVariables(program, graph);
+   endPhase();
+
+   beginPhase("dead code elimination");
+   eliminateDeadCode(graph);
+   updateProgramInfos(program, graph);
+   finalizeGraph(graph);
+   graph = NULL;
+   endPhase();
+   setStatistic("instructions.optimized", program->numInstructions);
+
+   beginPhase("target transformations");
    doTargetSpecificTransformations(program);
+   endPhase();
+   setStatistic("instructions.transformed", program->numInstructions);
    
 #ifndef NDEBUG
    fprintf(stdout, "Creating a control flow graph. \n");
 #endif
 
    /* create the control flow graph */
+   beginPhase("control flow graph");
    graph = createFlowGraph(program->instructions);
+   endPhase();
+   checkConsistency();
+   setStatistic("cfg.blocks", getLength(graph->blocks));
+   setStatistic("cfg.variables", graph->numVariables);
+
+   /* remove the instructions made dead by the target transformations */
+   beginPhase("dead code elimination");
+   eliminateDeadCode(graph);
+   endPhase();
    checkConsistency();
 
 #ifndef NDEBUG
@@ -595,12 +626,30 @@ int main (int argc, char **argv)
       
    /* update the control flow graph by inserting load and stores inside
    * every basic block */
+   beginPhase("loads and stores");
    graph = insertLoadAndStoreInstr(program, graph);
+   endPhase();
 
 #ifndef NDEBUG
    fprintf(stdout, "Executing a liveness analysis on the intermediate code \n");
 #endif
+   beginPhase("liveness");
    performLivenessAnalysis(graph);
+   endPhase();
+   checkConsistency();
+   setStatistic("liveness.iterations", graph->livenessIterations);
+
+   /* find the loops, to estimate how often each block is executed */
+   beginPhase("loops");
+   computeLoopDepths(graph);
+   endPhase();
+   checkConsistency();
+   setStatistic("cfg.loops", graph->numLoops);
+
+   /* merge the variables related by a copy, and remove the copies */
+   beginPhase("copy coalescing");
+   coalesceCopies(graph);
+   endPhase();
    checkConsistency();
 
 #ifndef NDEBUG
@@ -612,10 +661,23 @@ int main (int argc, char **argv)
 #endif
    /* initialize the register allocator by using the control flow
     * informations stored into the control flow graph */
+   beginPhase("live intervals");
    RA = initializeRegAlloc(graph);
+   endPhase();
+   setStatistic("ra.intervals", VSIZE(RA->live_intervals));
       
-   /* execute the linear scan algorithm */
-   execute_linear_scan(RA);
+   /* execute the register allocation algorithm */
+   if (file_infos->reg_alloc_algorithm == RA_GRAPH_COLORING) {
+      beginPhase("graph coloring");
+      execute_graph_coloring(RA, graph);
+   } else {
+      beginPhase("linear scan");
+      execute_linear_scan(RA);
+   }
+   endPhase();
+   setStatistic("ra.spills", countSpilledVariables(RA));
+   setStatistic("ra.splits", RA->numSplits);
+   setStatistic("ra.split_variables", VSIZE(RA->splitVariables));
       
 #ifndef NDEBUG
    printRegAllocInfos(RA, file_infos->reg_alloc_output);
@@ -626,18 +688,34 @@ int main (int argc, char **argv)
 #endif
    /* apply changes to the program informations by using the informations
    * of the register allocation process */
+   beginPhase("materialization");
    materializeRegisterAllocation(program, graph, RA);
+   endPhase();
+
+#ifndef NDEBUG
+   fprintf(stdout, "Optimizing the spill code. \n");
+#endif
+   /* remove the redundant loads and stores of the variables kept in memory */
+   beginPhase("spill code optimization");
+   optimizeSpillCode(program, graph);
    updateProgramInfos(program, graph);
+   endPhase();
+   setStatistic("instructions.final", program->numInstructions);
 
 #ifndef NDEBUG
    fprintf(stdout, "Writing the assembly file... \n");
 #endif
+   beginPhase("assembly output");
    writeAssembly(program, file_infos->output_file_name);
+   endPhase();
       
 #ifndef NDEBUG
    fprintf(stdout, "Assembly written on file \"%s\".\n", file_infos->output_file_name);
 #endif
    
+   /* write the statistics requested on the command line */
+   writeCompilationStats();
+
    /* shutdown the compiler */
    shutdownCompiler(0);
 
@@ -94,6 +94,12 @@ char *translateLabel(t_axe_label *label, char *dest, int bufSize)
    return dest;
 }
 
+/* the labels with a pointer type mark the memory which holds an address */
+int isPointerLabel(t_axe_label *label)
+{
+   return label != NULL && label->type >= 0 && (label->type & PTR_TYPE_FLAG);
+}
+
 char *translateLabelOrAddress(t_axe_address *address, char *dest, int bufSize)
 {
    if (address->type == ADDRESS_TYPE) {
@@ -215,11 +221,18 @@ int translateAMD64_acseLOAD_acseSTORE(t_program_infos *p, t_axe_instruction *ins
    char address[80];
    translateLabelOrAddress(instr->address, address, 80);
    const char *reg = translateAMD64_regName(instr->reg_1->ID);
+   const char *size = "dword";
+
+   /* the spill slots of the addresses are 64 bit wide */
+   if (isPointerLabel(instr->address->labelID)) {
+      reg = translateAMD64_regName_64bit(instr->reg_1->ID);
+      size = "qword";
+   }
 
    if (instr->opcode == STORE) {
-      fprintf(fp, "\tmov dword [%s], %s\n", address, reg);
+      fprintf(fp, "\tmov %s [%s], %s\n", size, address, reg);
    } else {
-      fprintf(fp, "\tmov %s, dword [%s]\n", reg, address);
+      fprintf(fp, "\tmov %s, %s [%s]\n", reg, size, address);
    }
 
    return 1;
@@ -533,7 +546,7 @@ int translateDataObject(t_axe_data *current_data, FILE *fp)
 
    /* print the directive identifier */
    if (current_data->directiveType == DIR_WORD) {
-      if (fprintf(fp, "dd ") < 0)
+      if (fprintf(fp, isPointerLabel(current_data->labelID) ? "dq " : "dd ") < 0)
          return 0;
 
    } else if (current_data->directiveType == DIR_SPACE) {
@@ -620,7 +633,7 @@ void writeAssembly(t_program_infos *program, char *output_file)
    fprintf(stdout, "\n\n*******************************************\n");
    fprintf(stdout, "INITIALIZING OUTPUT FILE: %s. \n", output_file);
    fprintf(stdout, "CODE SEGMENT has a size of %d instructions \n"
-         , getLength(program->instructions));
+         , program->numInstructions);
    fprintf(stdout, "DATA SEGMENT has a size of %d elements \n"
          , getLength(program->data));
    fprintf(stdout, "NUMBER OF LABELS : %d. \n"
@@ -282,7 +282,7 @@ void insertRegisterAllocationConstraints(t_program_infos *program)
          int rimm = getNewRegister(program);
          moveLabel(gen_addi_instruction(program, rimm, REG_0, inst->immediate), inst);
          inst->opcode = DIV;
-         RS2(inst) = alloc_register(rimm, INTEGER_TYPE, 0);
+         RS2(inst) = alloc_register(program->arena, rimm, INTEGER_TYPE, 0);
          popInstrInsertionPoint(program);
       }
 
@@ -365,7 +365,7 @@ void fixFlagUsers(t_program_infos *program)
             if (!needsSettingFlags)
                continue;
 
-            t_list *instLnk = findElement(program->instructions, reachDef->node->instr);
+            t_list *instLnk = getInstructionLink(reachDef->node->instr);
             assert(instLnk && "instruction is in the CFG but not in the program");
             pushInstrInsertionPoint(program, instLnk);
             if (!R_IND(dstReg)) {
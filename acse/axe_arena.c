@@ -0,0 +1,190 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_arena.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "axe_arena.h"
+
+/* default size of the memory blocks requested to the system */
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+/* alignment of every allocation. Must be a power of two. */
+#define ARENA_ALIGNMENT 16
+
+#define ARENA_ALIGN(size) \
+      (((size) + ARENA_ALIGNMENT - 1) & ~((size_t)ARENA_ALIGNMENT - 1))
+
+/* a block of memory from which the allocations are carved. The memory
+ * handed out follows the header. */
+typedef struct t_arena_chunk
+{
+   struct t_arena_chunk *next;   /* the previously allocated chunk */
+   size_t size;                  /* usable size of the chunk */
+   size_t used;                  /* number of bytes already handed out */
+}t_arena_chunk;
+
+#define ARENA_CHUNK_HEADER ARENA_ALIGN(sizeof(t_arena_chunk))
+
+struct t_arena
+{
+   const char *name;             /* name shown in the statistics */
+   t_arena_chunk *chunks;        /* list of chunks, the current one first */
+   int numChunks;                /* number of chunks allocated */
+   int numAllocations;           /* number of calls to `arenaAlloc' */
+   size_t bytesAllocated;        /* bytes requested by the allocations */
+   size_t bytesReserved;         /* bytes requested to the system */
+};
+
+static t_arena_chunk *allocChunk(t_arena *arena, size_t size);
+
+/* number of allocations performed by all the arenas */
+static long totalAllocations = 0;
+
+
+t_arena *initialize_arena(const char *name)
+{
+   t_arena *result;
+
+   result = (t_arena *) malloc(sizeof(t_arena));
+   if (result == NULL)
+      return NULL;
+
+   result->name = name;
+   result->chunks = NULL;
+   result->numChunks = 0;
+   result->numAllocations = 0;
+   result->bytesAllocated = 0;
+   result->bytesReserved = 0;
+
+   return result;
+}
+
+void finalize_arena(t_arena *arena)
+{
+   t_arena_chunk *chunk;
+   t_arena_chunk *next;
+
+   if (arena == NULL)
+      return;
+
+   for (chunk = arena->chunks; chunk != NULL; chunk = next) {
+      next = chunk->next;
+      free(chunk);
+   }
+   free(arena);
+}
+
+/* allocate a new chunk with at least `size' usable bytes, and make it
+ * the current chunk of the arena if it can hold other allocations */
+t_arena_chunk *allocChunk(t_arena *arena, size_t size)
+{
+   t_arena_chunk *chunk;
+
+   if (size < ARENA_CHUNK_SIZE - ARENA_CHUNK_HEADER)
+      size = ARENA_CHUNK_SIZE - ARENA_CHUNK_HEADER;
+
+   chunk = (t_arena_chunk *) malloc(ARENA_CHUNK_HEADER + size);
+   if (chunk == NULL)
+      return NULL;
+
+   chunk->size = size;
+   chunk->used = 0;
+
+   /* a chunk made for a single big allocation is put behind the current
+    * chunk, so that the space left in the current chunk is not lost */
+   if (arena->chunks != NULL && size > ARENA_CHUNK_SIZE - ARENA_CHUNK_HEADER) {
+      chunk->next = arena->chunks->next;
+      arena->chunks->next = chunk;
+   } else {
+      chunk->next = arena->chunks;
+      arena->chunks = chunk;
+   }
+   arena->numChunks++;
+   arena->bytesReserved += ARENA_CHUNK_HEADER + size;
+
+   return chunk;
+}
+
+void *arenaAlloc(t_arena *arena, size_t size)
+{
+   t_arena_chunk *chunk;
+   void *result;
+
+   if (arena == NULL)
+      return NULL;
+
+   size = ARENA_ALIGN(size);
+   chunk = arena->chunks;
+   if (chunk == NULL || chunk->size - chunk->used < size) {
+      chunk = allocChunk(arena, size);
+      if (chunk == NULL)
+         return NULL;
+   }
+
+   result = (char *)chunk + ARENA_CHUNK_HEADER + chunk->used;
+   chunk->used += size;
+   arena->numAllocations++;
+   totalAllocations++;
+   arena->bytesAllocated += size;
+
+   return result;
+}
+
+void *arenaCalloc(t_arena *arena, size_t size)
+{
+   void *result;
+
+   result = arenaAlloc(arena, size);
+   if (result != NULL)
+      memset(result, 0, size);
+   return result;
+}
+
+char *arenaStrdup(t_arena *arena, const char *str)
+{
+   size_t length;
+   char *result;
+
+   length = strlen(str) + 1;
+   result = (char *) arenaAlloc(arena, length);
+   if (result != NULL)
+      memcpy(result, str, length);
+   return result;
+}
+
+void printArenaStats(t_arena *arena, FILE *fout)
+{
+   if (arena == NULL)
+      return;
+   if (fout == NULL)
+      return;
+
+   fprintf(fout, "ARENA %s : %d allocations, %lu bytes allocated, "
+         "%lu bytes reserved in %d chunks \n", arena->name
+         , arena->numAllocations, (unsigned long)arena->bytesAllocated
+         , (unsigned long)arena->bytesReserved, arena->numChunks);
+   fflush(fout);
+}
+
+int getArenaAllocations(t_arena *arena)
+{
+   if (arena == NULL)
+      return 0;
+   return arena->numAllocations;
+}
+
+size_t getArenaBytesAllocated(t_arena *arena)
+{
+   if (arena == NULL)
+      return 0;
+   return arena->bytesAllocated;
+}
+
+long getTotalArenaAllocations(void)
+{
+   return totalAllocations;
+}
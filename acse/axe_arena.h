@@ -0,0 +1,55 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_arena.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * A region (arena) allocator. Objects allocated from an arena cannot be
+ * released individually: all of them are released together when the arena
+ * is finalized. Each arena keeps track of the number of allocations and of
+ * the amount of memory it handed out, for instrumentation purposes.
+ */
+
+#ifndef _AXE_ARENA_H
+#define _AXE_ARENA_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+struct t_arena;
+
+/* Typedef for the struct t_arena */
+typedef struct t_arena t_arena;
+
+/* create a new empty arena. `name' is used only when printing the
+ * statistics and must stay valid for the lifetime of the arena.
+ * Returns NULL if out of memory. */
+extern t_arena *initialize_arena(const char *name);
+
+/* free all the memory allocated from the arena, and the arena itself */
+extern void finalize_arena(t_arena *arena);
+
+/* Allocate `size' bytes from the arena. The memory is not initialized and is
+ * suitably aligned for any type. Returns NULL if out of memory. */
+extern void *arenaAlloc(t_arena *arena, size_t size);
+
+/* Like `arenaAlloc', but the memory is initialized to zero */
+extern void *arenaCalloc(t_arena *arena, size_t size);
+
+/* Duplicate a string in the arena. Returns NULL if out of memory. */
+extern char *arenaStrdup(t_arena *arena, const char *str);
+
+/* print the number of allocations and the memory usage of the arena */
+extern void printArenaStats(t_arena *arena, FILE *fout);
+
+/* get the number of allocations performed by the arena */
+extern int getArenaAllocations(t_arena *arena);
+
+/* get the number of bytes handed out by the arena */
+extern size_t getArenaBytesAllocated(t_arena *arena);
+
+/* get the number of allocations performed by all the arenas (including the
+ * ones already finalized) since the start of the program */
+extern long getTotalArenaAllocations(void);
+
+#endif
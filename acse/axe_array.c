@@ -63,7 +63,7 @@ int loadArrayElement(t_program_infos *program
 int loadArrayAddress(t_program_infos *program
             , char *ID, t_axe_expression index)
 {
-   int mova_register;
+   int mova_register, address_register;
    t_axe_label *label;
 
    /* preconditions */
@@ -84,8 +84,10 @@ int loadArrayAddress(t_program_infos *program
    /* get a new register */
    mova_register = getNewRegister(program);
 
-   /* generate the MOVA instruction */
+   /* generate the MOVA instruction. The base address is kept in its own
+    * register, so that it can be recomputed instead of being spilled */
    gen_mova_instruction(program, mova_register, label, 0);
+   address_register = mova_register;
 
    /* We are making the following assumption:
     * the type can only be an INTEGER_TYPE */
@@ -95,7 +97,8 @@ int loadArrayAddress(t_program_infos *program
    {
       if (index.value != 0)
       {
-         gen_addi_instruction (program, mova_register
+         address_register = getNewRegister(program);
+         gen_addi_instruction (program, address_register
                      , mova_register, index.value * sizeofElem);
       }
    }
@@ -109,11 +112,12 @@ int loadArrayAddress(t_program_infos *program
          gen_muli_instruction(program, idxReg, index.value, sizeofElem);
       }
       
-      gen_add_instruction(program, mova_register, mova_register
+      address_register = getNewRegister(program);
+      gen_add_instruction(program, address_register, mova_register
                , idxReg, CG_DIRECT_ALL);
    }
 
    /* return the identifier of the register that contains
     * the value of the array slot */
-   return mova_register;
+   return address_register;
 }
@@ -9,6 +9,7 @@
  */
 
 #include <assert.h>
+#include <string.h>
 #include "axe_labels.h"
 #include "axe_cflow_graph.h"
 #include "cflow_constants.h"
@@ -24,358 +25,532 @@ static t_cflow_var * allocVariable(t_cflow_Graph *graph, int identifier,
 static int isEndingNode(t_axe_instruction *instr);
 static int isStartingNode(t_axe_instruction *instr);
 static void updateFlowGraph(t_cflow_Graph *graph);
-static t_basic_block * searchLabel(t_cflow_Graph *graph, t_axe_label *label);
+static void connectBlocks(t_cflow_Graph *graph, t_hashmap *labels);
+static t_hashmap * mapLabelsToBlocks(t_cflow_Graph *graph);
 static void setDefUses(t_cflow_Graph *graph, t_cflow_Node *node);
-static int performLivenessIteration(t_cflow_Graph *graph);
-static int performLivenessOnBlock(t_basic_block *current_block, t_list *out);
-static t_list * addVariableToSet(t_list *set
-               , t_cflow_var *element, int *modified);
-static int compare_CFLOW_Variables (void *a, void *b);
-static t_list * computeLiveOutVars(t_cflow_Graph *graph,t_basic_block *block);
-
+static int isLivenessVariable(t_cflow_var *var);
+static void computeGenKillSets(t_basic_block *bblock
+      , t_bitset *gen, t_bitset *kill);
+static t_list * bitsetToListOfVariables(t_cflow_Graph *graph, t_bitset *set);
+static int varsByIDSlot(int identifier);
+static t_basic_block ** reversePostorder(t_cflow_Graph *graph
+      , int *numReachable);
+static t_basic_block * intersectDominators(t_basic_block *a
+      , t_basic_block *b);
+
+
+/* returns zero for the variables which are never considered live */
+int isLivenessVariable(t_cflow_var *var)
+{
+   if (var == NULL)
+      return 0;
+#if CFLOW_ALWAYS_LIVEIN_R0 == (1)
+   if (var->ID == REG_0)
+      return 0;
+#endif
+   return 1;
+}
 
-void performLivenessAnalysis(t_cflow_Graph *graph)
+/* compute the set of variables used by the block before being defined
+ * (gen) and the set of variables defined by the block (kill) */
+void computeGenKillSets(t_basic_block *bblock, t_bitset *gen, t_bitset *kill)
 {
-   int modified;
+   t_list *current_element;
+   t_cflow_Node *current_node;
+   int i;
 
-   do
+   for (current_element = bblock->nodes; current_element != NULL
+         ; current_element = LNEXT(current_element))
    {
-      modified = performLivenessIteration(graph);
-   }while(modified);
+      current_node = (t_cflow_Node *) LDATA(current_element);
+      assert(current_node != NULL);
+
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         t_cflow_var *use = current_node->uses[i];
+         if (isLivenessVariable(use) && !isInBitset(kill, use->index))
+            addToBitset(gen, use->index);
+      }
+      for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+         t_cflow_var *def = current_node->defs[i];
+         if (isLivenessVariable(def))
+            addToBitset(kill, def->index);
+      }
+   }
 }
 
-t_list * computeLiveOutVars(t_cflow_Graph *graph, t_basic_block *block)
+void computeLiveINVarsOfNode(t_cflow_Node *node, t_bitset *live)
 {
-   t_list *current_elem;
-   t_basic_block *current_succ;
-   t_list *result;
-   t_list *liveINVars;
+   int i;
 
-   /* preconditions */
-   if (block == NULL)
-      return NULL;
+   /* live_in = uses + (live_out - defs) */
+   for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+      if (isLivenessVariable(node->defs[i]))
+         removeFromBitset(live, node->defs[i]->index);
+   }
+   for (i = 0; i < CFLOW_MAX_USES; i++) {
+      if (isLivenessVariable(node->uses[i]) && node->uses[i]->index < live->size)
+         addToBitset(live, node->uses[i]->index);
+   }
+}
+
+void performLivenessAnalysis(t_cflow_Graph *graph)
+{
+   t_basic_block **blocks;
+   t_bitset **gen;
+   t_bitset **kill;
+   t_bitset *temp;
+   t_list *current_element;
+   int numBlocks;
+   int modified;
+   int i;
 
+   /* test the preconditions */
    if (graph == NULL) {
       cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
-      return NULL;
+      return;
    }
-   
-   /* initialize `current_elem' */
-   current_elem = block->succ;
 
-   /* initialize `result' */
-   result = NULL;
-   while(current_elem != NULL)
-   {
-      current_succ = (t_basic_block *) LDATA(current_elem);
-      assert(current_succ != NULL);
+   /* test if `graph->endingBlock' is valid */
+   if (graph->endingBlock == NULL) {
+      cflow_errorcode = CFLOW_INVALID_BBLOCK;
+      return;
+   }
 
-      if (current_succ != graph->endingBlock)
-      {
-         liveINVars = getLiveINVars(current_succ);
-         
-         /* update the value of `result' */
-         result = addListToSet(result
-               , liveINVars, NULL, NULL);
+   numBlocks = getLength(graph->blocks);
+   blocks = malloc(sizeof(t_basic_block *) * (numBlocks + 1));
+   gen = malloc(sizeof(t_bitset *) * (numBlocks + 1));
+   kill = malloc(sizeof(t_bitset *) * (numBlocks + 1));
+   temp = allocBitset(graph->numVariables);
+   if (blocks == NULL || gen == NULL || kill == NULL) {
+      cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+      free(blocks);
+      free(gen);
+      free(kill);
+      freeBitset(temp);
+      return;
+   }
+
+   /* initialize the liveness sets of every basic block, and compute
+    * the local informations of each block */
+   i = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *current_bblock = (t_basic_block *) LDATA(current_element);
+      assert(current_bblock != NULL);
 
-         /* free the temporary list of live intervals */
-         freeList(liveINVars);
+      if (current_bblock->nodes == NULL) {
+         cflow_errorcode = CFLOW_INVALID_BBLOCK;
+         numBlocks = i;
+         break;
       }
-      
-      current_elem = LNEXT(current_elem);
+
+      freeBitset(current_bblock->liveIn);
+      freeBitset(current_bblock->liveOut);
+      current_bblock->liveIn = allocBitset(graph->numVariables);
+      current_bblock->liveOut = allocBitset(graph->numVariables);
+
+      blocks[i] = current_bblock;
+      gen[i] = allocBitset(graph->numVariables);
+      kill[i] = allocBitset(graph->numVariables);
+      computeGenKillSets(current_bblock, gen[i], kill[i]);
+      i++;
    }
 
-   /* postconditions */
-   return result;
-}
+   /* iterate until a fixed point is reached. Visiting the blocks backwards
+    * makes the analysis converge in a few iterations. */
+   graph->livenessIterations = 0;
+   do
+   {
+      modified = 0;
+      graph->livenessIterations++;
 
-t_list * getLiveOUTVars(t_basic_block *bblock)
-{
-   t_list *last_Element;
-   t_cflow_Node *lastNode;
-   
-   if (bblock == NULL)
-      return NULL;
+      for (i = numBlocks - 1; i >= 0 && cflow_errorcode == CFLOW_OK; i--)
+      {
+         t_basic_block *current_bblock = blocks[i];
 
-   if (bblock->nodes == NULL)
-      return NULL;
+         /* live_out = union of the live_in sets of the successors */
+         for (current_element = current_bblock->succ; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            t_basic_block *current_succ = LDATA(current_element);
+            assert(current_succ != NULL);
 
-   
-   last_Element = getLastElement(bblock->nodes);
-   lastNode = (t_cflow_Node *) LDATA(last_Element);
-   assert(lastNode != NULL);
+            if (current_succ != graph->endingBlock)
+               unionBitsets(current_bblock->liveOut, current_succ->liveIn);
+         }
 
-   /* return a copy of the list of variables live in
-    * input to the current basic block */
-   return cloneList(lastNode->out);
+         /* live_in = gen + (live_out - kill) */
+         copyBitset(temp, current_bblock->liveOut);
+         subtractBitsets(temp, kill[i]);
+         unionBitsets(temp, gen[i]);
+         if (unionBitsets(current_bblock->liveIn, temp))
+            modified = 1;
+      }
+   }while(modified && cflow_errorcode == CFLOW_OK);
+
+   for (i = 0; i < numBlocks; i++) {
+      freeBitset(gen[i]);
+      freeBitset(kill[i]);
+   }
+   free(blocks);
+   free(gen);
+   free(kill);
+   freeBitset(temp);
 }
 
-t_list * getLiveINVars(t_basic_block *bblock)
+/* Returns the blocks reachable from the starting block in reverse
+ * postorder, and sets their `rpoNumber'. */
+t_basic_block ** reversePostorder(t_cflow_Graph *graph, int *numReachable)
 {
-   t_cflow_Node *firstNode;
-   
-   if (bblock == NULL)
-      return NULL;
+   t_basic_block **order, **stack;
+   t_list **nextSucc;
+   t_list *current_element;
+   int numBlocks, top, count;
 
-   if (bblock->nodes == NULL)
+   numBlocks = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      block->rpoNumber = -1;
+      block->idom = NULL;
+      numBlocks++;
+   }
+
+   order = malloc(sizeof(t_basic_block *) * (numBlocks + 1));
+   stack = malloc(sizeof(t_basic_block *) * (numBlocks + 1));
+   nextSucc = malloc(sizeof(t_list *) * (numBlocks + 1));
+   if (order == NULL || stack == NULL || nextSucc == NULL) {
+      free(order);
+      free(stack);
+      free(nextSucc);
+      cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+      *numReachable = 0;
       return NULL;
+   }
 
-   firstNode = (t_cflow_Node *) LDATA(bblock->nodes);
-   assert(firstNode != NULL);
+   /* iterative depth first visit. A block is marked as visited (with
+    * rpoNumber == -2) when it is pushed on the stack. */
+   count = 0;
+   top = 0;
+   if (graph->startingBlock != NULL) {
+      stack[0] = graph->startingBlock;
+      nextSucc[0] = graph->startingBlock->succ;
+      graph->startingBlock->rpoNumber = -2;
+      top = 1;
+   }
+   while (top > 0)
+   {
+      t_basic_block *succ = NULL;
 
-   /* return a copy of the list of variables live in
-    * input to the current basic block */
-   return cloneList(firstNode->in);
-}
+      while (nextSucc[top - 1] != NULL) {
+         succ = (t_basic_block *) LDATA(nextSucc[top - 1]);
+         nextSucc[top - 1] = LNEXT(nextSucc[top - 1]);
+         /* the ending block is not part of the list of blocks */
+         if (succ != graph->endingBlock && succ->rpoNumber == -1)
+            break;
+         succ = NULL;
+      }
 
-t_list * addVariableToSet(t_list *set
-               , t_cflow_var *element, int *modified)
-{
-   /* test the preconditions */
-   if (element == NULL)
-      return set;
+      if (succ != NULL) {
+         succ->rpoNumber = -2;
+         stack[top] = succ;
+         nextSucc[top] = succ->succ;
+         top++;
+      } else {
+         /* all the successors have been visited */
+         order[count++] = stack[--top];
+      }
+   }
 
-   if (CustomfindElement(set, element
-            , compare_CFLOW_Variables) == NULL)
-   {
-      set = addElement(set, element, -1);
-      if (modified != NULL)
-         (* modified) = 1;
+   /* reverse the postorder */
+   for (top = 0; top < count / 2; top++) {
+      t_basic_block *tmp = order[top];
+      order[top] = order[count - 1 - top];
+      order[count - 1 - top] = tmp;
    }
+   for (top = 0; top < count; top++)
+      order[top]->rpoNumber = top;
 
-   /* postconditions */
-   return set;
+   free(stack);
+   free(nextSucc);
+   *numReachable = count;
+   return order;
 }
 
-t_list * addVariables(t_list *set, t_list *elements, int *modified)
+/* Returns the nearest common dominator of `a' and `b' */
+t_basic_block * intersectDominators(t_basic_block *a, t_basic_block *b)
 {
-   /* test the preconditions */
-   if (set == NULL || elements == NULL)
-      return set;
-
-   /* update the set of variables */
-   set = addListToSet(set, elements
-         , compare_CFLOW_Variables, modified);
-   
-   /* postconditions: return the new list of variables */
-   return set;
+   while (a != b) {
+      while (a->rpoNumber > b->rpoNumber)
+         a = a->idom;
+      while (b->rpoNumber > a->rpoNumber)
+         b = b->idom;
+   }
+   return a;
 }
 
-int compare_CFLOW_Variables (void *a, void *b)
+void computeDominators(t_cflow_Graph *graph)
 {
-   t_cflow_var *varA;
-   t_cflow_var *varB;
+   t_basic_block **order;
+   t_list *current_pred;
+   int numReachable, changed, i;
 
-   if (a == NULL)
-   {
-      if (b == NULL)
-         return 1;
-      return 0;
+   if (graph == NULL) {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return;
    }
 
-   if (b == NULL)
-      return 0;
+   order = reversePostorder(graph, &numReachable);
+   if (order == NULL)
+      return;
+   if (numReachable == 0) {
+      free(order);
+      return;
+   }
+
+   /* during the computation the starting block is its own dominator */
+   order[0]->idom = order[0];
+   do
+   {
+      changed = 0;
+      for (i = 1; i < numReachable; i++)
+      {
+         t_basic_block *newIdom = NULL;
 
-   varA = (t_cflow_var *) a;
-   varB = (t_cflow_var *) b;
+         for (current_pred = order[i]->pred; current_pred != NULL
+               ; current_pred = LNEXT(current_pred))
+         {
+            t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+            if (pred->idom == NULL)
+               continue;
+            if (newIdom == NULL)
+               newIdom = pred;
+            else
+               newIdom = intersectDominators(pred, newIdom);
+         }
+         if (order[i]->idom != newIdom) {
+            order[i]->idom = newIdom;
+            changed = 1;
+         }
+      }
+   } while (changed);
+   order[0]->idom = NULL;
 
-   return (varA->ID == varB->ID);
+   free(order);
 }
 
-int performLivenessOnBlock(t_basic_block *bblock, t_list *out)
+int dominates(t_basic_block *a, t_basic_block *b)
 {
-   t_list *current_element;
-   t_list *cloned_list;
-   t_cflow_Node *next_node;
-   t_cflow_Node *current_node;
-   int modified;
-   int i, def_i, use_i;
+   if (a->rpoNumber < 0 || b->rpoNumber < 0)
+      return 0;
+   while (b != NULL && b->rpoNumber > a->rpoNumber)
+      b = b->idom;
+   return b == a;
+}
 
-   /* initialize the local variables */
-   modified = 0;
+void computeDominanceFrontiers(t_cflow_Graph *graph)
+{
+   t_list *current_element, *current_pred;
 
-   if (bblock == NULL || bblock->nodes == NULL) {
-      cflow_errorcode = CFLOW_INVALID_BBLOCK;
-      return modified;
+   if (graph == NULL) {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return;
    }
 
-   current_element = getLastElement(bblock->nodes);
-   current_node = (t_cflow_Node *) LDATA(current_element);
-   assert(current_node != NULL);
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      freeList(block->domFrontier);
+      block->domFrontier = NULL;
+   }
 
-   /* update the out set */
-   current_node->out = addListToSet
-         (current_node->out, out, NULL, &modified);
+   /* a join point is in the frontier of each block which dominates one of
+    * its predecessors, up to (and excluding) its immediate dominator */
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
 
-   /* update the in list */
-   cloned_list = cloneList(current_node->out);
-   
-   for (i=0; i<CFLOW_MAX_USES; i++) {
-#if CFLOW_ALWAYS_LIVEIN_R0 == (1)
-      if ((current_node->uses)[i] != NULL && (current_node->uses)[i]->ID != REG_0)
-         cloned_list = addVariableToSet
-               (cloned_list, (current_node->uses)[i], NULL);
-#else
-      if ((current_node->uses)[i] != NULL)
-         cloned_list = addVariableToSet
-               (cloned_list, (current_node->uses)[i], NULL);
-#endif
-   }
+      /* the starting block is also reached from the entry of the
+       * program */
+      if (block->rpoNumber < 0 || (getLength(block->pred) < 2
+            && !(block == graph->startingBlock && block->pred != NULL)))
+         continue;
 
-   for (def_i = 0; def_i < CFLOW_MAX_DEFS; def_i++) {
-      int found = 0;
-      #if CFLOW_ALWAYS_LIVEIN_R0 == (1)
-         if (!(current_node->defs)[def_i] || (current_node->defs)[def_i]->ID == REG_0)
-            continue;
-      #else
-         if (!(current_node->defs)[def_i])
-            continue;
-      #endif
+      for (current_pred = block->pred; current_pred != NULL
+            ; current_pred = LNEXT(current_pred))
+      {
+         t_basic_block *runner = (t_basic_block *) LDATA(current_pred);
 
-      for (use_i = 0; use_i < CFLOW_MAX_USES && !found; use_i++) {
-         if ((current_node->uses)[use_i]) {
-            if ((current_node->uses)[use_i]->ID == (current_node->defs)[def_i]->ID)
-               found = 1;
+         if (runner->rpoNumber < 0)
+            continue;
+         while (runner != NULL && runner != block->idom) {
+            if (findElement(runner->domFrontier, block) == NULL)
+               runner->domFrontier = addLast(runner->domFrontier, block);
+            runner = runner->idom;
          }
       }
+   }
+}
+
+void computeLoopDepths(t_cflow_Graph *graph)
+{
+   t_list *current_element, *current_pred;
+   t_basic_block **worklist;
+   int *visited;
+   int numBlocks, top, depth, isLoop;
+
+   if (graph == NULL) {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return;
+   }
+
+   computeDominators(graph);
+   if (cflow_errorcode != CFLOW_OK)
+      return;
 
-      if (!found)
-         cloned_list = removeElement(cloned_list, current_node->defs[def_i]);
+   numBlocks = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      block->loopDepth = 0;
+      numBlocks++;
+   }
+   graph->numLoops = 0;
+
+   /* `visited' holds, for each reachable block, the rpoNumber + 1 of the
+    * header of the last loop found to contain it */
+   worklist = malloc(sizeof(t_basic_block *) * (numBlocks + 1));
+   visited = calloc(numBlocks + 1, sizeof(int));
+   if (worklist == NULL || visited == NULL) {
+      free(worklist);
+      free(visited);
+      cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+      return;
    }
-   
-   current_node->in = addListToSet
-         (current_node->in, cloned_list, NULL, &modified);
 
-   /* remove the cloned list */
-   freeList(cloned_list);
-   
-   /* set the new value of next_node */
-   next_node = current_node;
-   current_element = LPREV(current_element);
-   while (current_element != NULL)
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
    {
-      /* take a new node */
-      current_node = (t_cflow_Node *) LDATA(current_element);
-      assert(current_node != NULL);
+      t_basic_block *header = (t_basic_block *) LDATA(current_element);
+      int mark = header->rpoNumber + 1;
 
-      /* clone the `in' list of the next_node */
-      cloned_list = cloneList(next_node->in);
-      
-      /* update the out list */
-      current_node->out = addListToSet
-            (current_node->out, cloned_list, NULL, &modified);
-      
-      /* remove the cloned list */
-      freeList(cloned_list);
+      if (header->rpoNumber < 0)
+         continue;
 
-      /* clone the `in' list of the next_node */
-      cloned_list = cloneList(current_node->out);
-      
-      /* update the in list */
-      for (i=0; i<CFLOW_MAX_USES; i++) {
-#if CFLOW_ALWAYS_LIVEIN_R0 == (1)
-         if ((current_node->uses)[i] != NULL && (current_node->uses)[i]->ID != REG_0)
-            cloned_list = addVariableToSet
-                  (cloned_list, (current_node->uses)[i], NULL);
-#else
-         if ((current_node->uses)[i] != NULL)
-            cloned_list = addVariableToSet
-                  (cloned_list, (current_node->uses)[i], NULL);
-#endif
+      /* the sources of the back edges towards `header' (the edges whose
+       * destination dominates their source) are in the loop; the loop
+       * contains all the blocks which reach them without passing through
+       * the header */
+      top = 0;
+      isLoop = 0;
+      visited[header->rpoNumber] = mark;
+      for (current_pred = header->pred; current_pred != NULL
+            ; current_pred = LNEXT(current_pred))
+      {
+         t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+         if (!dominates(header, pred))
+            continue;
+         isLoop = 1;
+         if (visited[pred->rpoNumber] != mark) {
+            visited[pred->rpoNumber] = mark;
+            pred->loopDepth++;
+            worklist[top++] = pred;
+         }
       }
-      
-      for (def_i = 0; def_i < CFLOW_MAX_DEFS; def_i++) {
-         int found = 0;
-         #if CFLOW_ALWAYS_LIVEIN_R0 == (1)
-            if (!(current_node->defs)[def_i] || (current_node->defs)[def_i]->ID == REG_0)
-               continue;
-         #else
-            if (!(current_node->defs)[def_i])
-               continue;
-         #endif
+      if (!isLoop)
+         continue;
+      header->loopDepth++;
+      graph->numLoops++;
 
-         for (use_i = 0; use_i < CFLOW_MAX_USES && !found; use_i++) {
-            if ((current_node->uses)[use_i]) {
-               if ((current_node->uses)[use_i]->ID == (current_node->defs)[def_i]->ID)
-                  found = 1;
-            }
+      while (top > 0)
+      {
+         t_basic_block *block = worklist[--top];
+         for (current_pred = block->pred; current_pred != NULL
+               ; current_pred = LNEXT(current_pred))
+         {
+            t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+            if (pred->rpoNumber < 0 || visited[pred->rpoNumber] == mark)
+               continue;
+            visited[pred->rpoNumber] = mark;
+            pred->loopDepth++;
+            worklist[top++] = pred;
          }
-
-         if (!found)
-            cloned_list = removeElement(cloned_list, current_node->defs[def_i]);
       }
+   }
 
-      current_node->in = addListToSet
-            (current_node->in, cloned_list, NULL, &modified);
-
-      /* remove the cloned list */
-      freeList(cloned_list);
-      
-      /* update the loop control informations */
-      current_element = LPREV(current_element);
-      next_node = current_node;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      block->frequency = 1.0;
+      for (depth = 0; depth < block->loopDepth; depth++)
+         block->frequency *= LOOP_FREQUENCY_FACTOR;
    }
 
-   /* return the `modified' value */
-   return modified;
+   free(visited);
+   free(worklist);
 }
 
-int performLivenessIteration(t_cflow_Graph *graph)
+/* create a list of the variables contained in a liveness set */
+t_list * bitsetToListOfVariables(t_cflow_Graph *graph, t_bitset *set)
 {
-   int modified;
-   t_list *current_element;
-   t_basic_block *current_bblock;
-
-   /* initialize the value of the local variable `modified' */
-   modified = 0;
+   t_list *result = NULL;
+   t_list *last = NULL;
+   int i;
 
-   /* test the preconditions */
-   if (graph == NULL) {
-      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
-      return modified;
-   }
+   if (set == NULL)
+      return NULL;
 
-   /* test if `graph->endingBlock' is valid */
-   if (graph->endingBlock == NULL) {
-      cflow_errorcode = CFLOW_INVALID_BBLOCK;
-      return modified;
+   for (i = nextInBitset(set, 0); i >= 0; i = nextInBitset(set, i + 1)) {
+      last = addAfter(last, graph->variables[i]);
+      if (result == NULL)
+         result = last;
    }
 
-   /* retrieve the last basic block in the list */
-   current_element = getLastElement(graph->blocks);
-   
-   while(current_element != NULL)
-   {
-      t_list *live_out_vars;
-      
-      current_bblock = (t_basic_block *) LDATA(current_element);
-      assert(current_bblock != NULL);
+   return result;
+}
 
-      /* retrieve the variables that will be live out from this block */
-      live_out_vars = computeLiveOutVars(graph, current_bblock);
+t_list * getLiveOUTVars(t_cflow_Graph *graph, t_basic_block *bblock)
+{
+   if (graph == NULL || bblock == NULL)
+      return NULL;
 
-      /* test if an error occurred */
-      if (cflow_errorcode != CFLOW_OK)
-         return modified;
+   /* return a list of the variables live in
+    * output from the current basic block */
+   return bitsetToListOfVariables(graph, bblock->liveOut);
+}
 
-      /* retrieve the liveness informations for the current bblock */
-      if (performLivenessOnBlock(current_bblock, live_out_vars))
-         modified = 1;
+t_list * getLiveINVars(t_cflow_Graph *graph, t_basic_block *bblock)
+{
+   if (graph == NULL || bblock == NULL)
+      return NULL;
 
-      /* remove the list `out' */
-      freeList(live_out_vars);
+   /* return a list of the variables live in
+    * input to the current basic block */
+   return bitsetToListOfVariables(graph, bblock->liveIn);
+}
 
-      /* test if an error occurred */
-      if (cflow_errorcode != CFLOW_OK) {
-         return modified;
-      }
+/* Position of the variable with the given identifier in `varsByID'.
+ * Maps negative identifiers to odd slots and the others to even slots. */
+int varsByIDSlot(int identifier)
+{
+   if (identifier >= 0)
+      return identifier * 2;
+   return -identifier * 2 - 1;
+}
 
-      /* retrieve the previous element in the list */
-      current_element = LPREV(current_element);
-   }
+t_cflow_var * getCflowVariable(t_cflow_Graph *graph, int ID)
+{
+   int slot = varsByIDSlot(ID);
 
-   /* return 1 if another liveness iteration is required */
-   return modified;
+   if (graph == NULL || slot >= graph->maxVarsByID)
+      return NULL;
+   return graph->varsByID[slot];
 }
 
 /* Alloc a new control flow graph variable object. If a variable object
@@ -385,7 +560,7 @@ t_cflow_var * allocVariable (t_cflow_Graph *graph, int identifier,
       t_list *mcRegs, int type)
 {
    t_cflow_var * result;
-   t_list *elementFound;
+   int slot;
 
    if (graph == NULL)
    {
@@ -393,33 +568,56 @@ t_cflow_var * allocVariable (t_cflow_Graph *graph, int identifier,
       return NULL;
    }
 
-   /* alloc memory for a variable information */
-   result = malloc(sizeof(t_cflow_var));
-   if (result == NULL) {
-      cflow_errorcode = CFLOW_OUT_OF_MEMORY;
-      return NULL;
-   }
-
-   /* update the value of result */
-   result->ID = identifier;
-   result->mcRegWhitelist = NULL;
-   result->type = INFERRED_TYPE;
-   
    /* test if a variable with the same identifier was already present */
-   elementFound = CustomfindElement
-         (graph->cflow_variables, result, compare_CFLOW_Variables);
+   result = getCflowVariable(graph, identifier);
    
-   if (elementFound == NULL)
+   if (result == NULL)
    {
+      /* alloc memory for a variable information */
+      result = arenaAlloc(graph->arena, sizeof(t_cflow_var));
+      if (result == NULL) {
+         cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+         return NULL;
+      }
+
+      /* update the value of result */
+      result->ID = identifier;
+      result->mcRegWhitelist = NULL;
+      result->type = INFERRED_TYPE;
+      result->index = graph->numVariables;
+
       /* update the set of variables */
-      graph->cflow_variables = addElement(graph->cflow_variables, result, -1);
-   }
-   else
-   {
-      free(result);
-      result = (t_cflow_var *) LDATA(elementFound);
-      assert(result != NULL);
-      assert(result->ID == identifier);
+      if (graph->numVariables == graph->maxVariables) {
+         int newMax = graph->maxVariables ? graph->maxVariables * 2 : 64;
+         t_cflow_var **newVariables = realloc(graph->variables
+               , sizeof(t_cflow_var *) * newMax);
+         if (newVariables == NULL) {
+            cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+            return NULL;
+         }
+         graph->variables = newVariables;
+         graph->maxVariables = newMax;
+      }
+      graph->variables[graph->numVariables++] = result;
+
+      /* update the lookup table */
+      slot = varsByIDSlot(identifier);
+      if (slot >= graph->maxVarsByID) {
+         int newMax = graph->maxVarsByID ? graph->maxVarsByID : 64;
+         t_cflow_var **newVarsByID;
+         while (newMax <= slot)
+            newMax *= 2;
+         newVarsByID = realloc(graph->varsByID, sizeof(t_cflow_var *) * newMax);
+         if (newVarsByID == NULL) {
+            cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+            return NULL;
+         }
+         memset(newVarsByID + graph->maxVarsByID, 0
+               , sizeof(t_cflow_var *) * (newMax - graph->maxVarsByID));
+         graph->varsByID = newVarsByID;
+         graph->maxVarsByID = newMax;
+      }
+      graph->varsByID[slot] = result;
    }
 
    /* copy the machine register allocation constraint, or compute the
@@ -531,7 +729,7 @@ void setDefUses(t_cflow_Graph *graph, t_cflow_Node *node)
       case SEQ: case SGE: case SGT: case SLE: case SLT: case SNE: 
          node->defs[1] = varPSW;
       case BHI: case BLS: case BCC: case BCS: case BNE: case BEQ: case BVC:
-      case BVS: case BPL: case BMI: case BGE: case BLT: case BLE:
+      case BVS: case BPL: case BMI: case BGE: case BLT: case BGT: case BLE:
          node->uses[0] = varPSW;
          break;
    }
@@ -558,25 +756,16 @@ void setDefUses(t_cflow_Graph *graph, t_cflow_Node *node)
       instr->reg_3->type = varSource2->type;
 }
 
-/* look up for a label inside the graph */
-t_basic_block * searchLabel(t_cflow_Graph *graph, t_axe_label *label)
+/* returns a map from the identifiers of the labels to the basic blocks
+ * which start with them */
+t_hashmap * mapLabelsToBlocks(t_cflow_Graph *graph)
 {
+   t_hashmap *result;
    t_list *current_element;
    t_basic_block *bblock;
    t_cflow_Node *current_node;
-   
-   /* preconditions: graph should not be a NULL pointer */
-   if (graph == NULL){
-      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
-      return NULL;
-   }
 
-   /* test if we haven't to search for a label */
-   if (label == NULL)
-      return NULL;
-   
-   /* initialize `bblock' */
-   bblock = NULL;
+   result = allocHashMap(NULL, NULL);
    
    current_element = graph->blocks;
    while(current_element != NULL)
@@ -585,24 +774,20 @@ t_basic_block * searchLabel(t_cflow_Graph *graph, t_axe_label *label)
       assert(bblock != NULL);
       assert(bblock->nodes != NULL);
 
-      /* retrieve the first node of the basic block */
+      /* only the first node of a basic block can hold a label */
       current_node = (t_cflow_Node *) LDATA(bblock->nodes);
       assert(current_node != NULL);
-
-      /* if the first node holds a label information, we
-       * have to verify if we have found the right label */
       if ((current_node->instr)->labelID != NULL)
       {
-         if (compareLabels((current_node->instr)->labelID, label))
-            /* we found the correct basic block */
-            break;
+         putInHashMap(result
+               , INTDATA((current_node->instr)->labelID->labelID), bblock);
       }
 
       /* retrieve the next element */
       current_element = LNEXT(current_element);
    }
 
-   return bblock;
+   return result;
 }
 
 /* test if the current instruction `instr' is a labelled instruction */
@@ -673,12 +858,26 @@ t_cflow_Graph * allocGraph()
    /* initialize `result' */
    result->startingBlock = NULL;
    result->blocks = NULL;
-   result->cflow_variables = NULL;
-   result->endingBlock = allocBasicBlock();
+   result->lastBlock = NULL;
+   result->variables = NULL;
+   result->numVariables = 0;
+   result->maxVariables = 0;
+   result->varsByID = NULL;
+   result->maxVarsByID = 0;
+   result->livenessIterations = 0;
+   result->numLoops = 0;
+   result->arena = initialize_arena("control flow graph");
+   if (result->arena == NULL) {
+      cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+      free(result);
+      return NULL;
+   }
+   result->endingBlock = allocBasicBlock(result);
 
    /* test if an error occurred */
    if (result->endingBlock == NULL) {
       cflow_errorcode = CFLOW_OUT_OF_MEMORY;
+      finalize_arena(result->arena);
       free(result);
       return NULL;
    }
@@ -692,6 +891,7 @@ void finalizeGraph(t_cflow_Graph *graph)
 {
    t_list *current_element;
    t_basic_block *current_block;
+   int i;
 
    if (graph == NULL)
       return;
@@ -712,37 +912,28 @@ void finalizeGraph(t_cflow_Graph *graph)
       freeList(graph->blocks);
    if (graph->endingBlock != NULL)
       finalizeBasicBlock(graph->endingBlock);
-   if (graph->cflow_variables != NULL)
-   {
-      t_list *current_element;
-      t_cflow_var *current_variable;
-
-      current_element = graph->cflow_variables;
-      while (current_element != NULL)
-      {
-         current_variable = (t_cflow_var *) LDATA(current_element);
-
-         if (current_variable != NULL) {
-            freeList(current_variable->mcRegWhitelist);
-            free(current_variable);
-         }
-
-         /* retrieve the next variable in the list */
-         current_element = LNEXT(current_element);
-      }
-
-      freeList(graph->cflow_variables);
-   }
+   for (i = 0; i < graph->numVariables; i++)
+      freeList(graph->variables[i]->mcRegWhitelist);
+   free(graph->variables);
+   free(graph->varsByID);
 
+   /* release the nodes, the basic blocks and the variables */
+   finalize_arena(graph->arena);
    free(graph);
 }
 
 /* allocate memory for a basic block */
-t_basic_block * allocBasicBlock()
+t_basic_block * allocBasicBlock(t_cflow_Graph *graph)
 {
    t_basic_block *result;
    
-   result = malloc(sizeof(t_basic_block));
+   if (graph == NULL)
+   {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return NULL;
+   }
+
+   result = arenaAlloc(graph->arena, sizeof(t_basic_block));
    if (result == NULL)
    {
       cflow_errorcode = CFLOW_OUT_OF_MEMORY;
@@ -753,6 +944,14 @@ t_basic_block * allocBasicBlock()
    result->pred = NULL;
    result->succ = NULL;
    result->nodes = NULL;
+   result->lastNode = NULL;
+   result->liveIn = NULL;
+   result->liveOut = NULL;
+   result->idom = NULL;
+   result->rpoNumber = -1;
+   result->domFrontier = NULL;
+   result->loopDepth = 0;
+   result->frequency = 1.0;
 
    return result;
 }
@@ -787,25 +986,20 @@ void finalizeBasicBlock(t_basic_block *block)
    }
 
    freeList(block->nodes);
+   freeList(block->domFrontier);
+   freeBitset(block->liveIn);
+   freeBitset(block->liveOut);
    
-   /* free the memory associated with this basic block */
-   free(block);
+   /* the memory of the basic block itself belongs to the arena of the
+    * graph */
 }
 
 /* free the memory associated with a node of the graph */
 void finalizeNode(t_cflow_Node *node)
 {
-   if (node == NULL)
-      return;
-
-   /* free the two lists `in' and `out' */
-   if (node->in != NULL)
-      freeList(node->in);
-   if (node->out != NULL)
-      freeList(node->out);
-
-   /* free the current node */
-   free(node);
+   /* nothing to do: the memory of the node belongs to the arena
+    * of the graph */
+   (void)node;
 }
 
 t_cflow_Node * allocNode
@@ -827,7 +1021,7 @@ t_cflow_Node * allocNode
    }
 
    /* create a new instance of type `t_cflow_node' */
-   result = malloc(sizeof(t_cflow_Node));
+   result = arenaAlloc(graph->arena, sizeof(t_cflow_Node));
 
    /* test if an error occurred */
    if (result == NULL) {
@@ -841,6 +1035,7 @@ t_cflow_Node * allocNode
    for (i=0; i<CFLOW_MAX_USES; i++)
       result->uses[i] = NULL;
    result->instr = instr;
+   result->link = NULL;
 
    /* set the def-uses for the current node */
    setDefUses(graph, result);
@@ -851,11 +1046,6 @@ t_cflow_Node * allocNode
       return NULL;
    }
 
-   /* set the list of variables that are live in
-    * and live out from the current node */
-   result->in = NULL;
-   result->out = NULL;
-   
    /* return the node */
    return result;
 }
@@ -906,6 +1096,23 @@ void setSucc(t_basic_block *block, t_basic_block *succ)
    }
 }
 
+void removeEdge(t_basic_block *block, t_basic_block *succ)
+{
+   /* preconditions */
+   if (block == NULL) {
+      cflow_errorcode = CFLOW_BBLOCK_UNDEFINED;
+      return;
+   }
+
+   if (succ == NULL) {
+      cflow_errorcode = CFLOW_INVALID_BBLOCK;
+      return;
+   }
+
+   block->succ = removeElement(block->succ, succ);
+   succ->pred = removeElement(succ->pred, block);
+}
+
 void insertBlock(t_cflow_Graph *graph, t_basic_block *block)
 {
    /* preconditions */
@@ -921,27 +1128,87 @@ void insertBlock(t_cflow_Graph *graph, t_basic_block *block)
       return;
    }
 
+   /* add the block at the end of the graph */
+   graph->lastBlock = addAfter(graph->lastBlock, block);
+   if (graph->blocks == NULL)
+      graph->blocks = graph->lastBlock;
+
+   /* test if this is the first basic block for the program */
+   if (graph->startingBlock == NULL)
+      graph->startingBlock = block;
+}
+
+void insertBlockAfter(t_cflow_Graph *graph, t_basic_block *after
+      , t_basic_block *block)
+{
+   t_list *position;
+
+   /* preconditions */
+   if (graph == NULL)
+   {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return;
+   }
+
+   position = after != NULL ? findElement(graph->blocks, after) : NULL;
+   if (block == NULL || (after != NULL && position == NULL))
+   {
+      cflow_errorcode = CFLOW_INVALID_BBLOCK;
+      return;
+   }
+
    if (findElement(graph->blocks, block) != NULL)
    {
       cflow_errorcode = CFLOW_BBLOCK_ALREADY_INSERTED;
       return;
    }
 
-   /* add the current node to the basic block */
-   graph->blocks = addElement(graph->blocks, block, -1);
-
-   /* test if this is the first basic block for the program */
-   if (graph->startingBlock == NULL)
+   if (after == NULL) {
+      graph->blocks = addFirst(graph->blocks, block);
       graph->startingBlock = block;
+      if (graph->lastBlock == NULL)
+         graph->lastBlock = graph->blocks;
+   } else {
+      position = addAfter(position, block);
+      if (LNEXT(position) == NULL)
+         graph->lastBlock = position;
+   }
+}
+
+/* remove a block which is not reached by any other block */
+void removeBlock(t_cflow_Graph *graph, t_basic_block *block)
+{
+   t_list *position;
+
+   /* preconditions */
+   if (graph == NULL)
+   {
+      cflow_errorcode = CFLOW_GRAPH_UNDEFINED;
+      return;
+   }
+
+   position = block != NULL ? findElement(graph->blocks, block) : NULL;
+   if (position == NULL || block == graph->startingBlock)
+   {
+      cflow_errorcode = CFLOW_INVALID_BBLOCK;
+      return;
+   }
+
+   while (block->pred != NULL)
+      removeEdge((t_basic_block *) LDATA(block->pred), block);
+   while (block->succ != NULL)
+      removeEdge(block, (t_basic_block *) LDATA(block->succ));
+
+   if (position == graph->lastBlock)
+      graph->lastBlock = LPREV(position);
+   graph->blocks = removeElementLink(graph->blocks, position);
+   finalizeBasicBlock(block);
 }
 
 /* insert a new node without updating the dataflow informations */
 void insertNodeBefore(t_basic_block *block
       , t_cflow_Node *before_node, t_cflow_Node *new_node)
 {
-   int before_node_posn;
-   t_list *before_node_elem;
-   
    /* preconditions */
    if (block == NULL)
    {
@@ -951,40 +1218,29 @@ void insertNodeBefore(t_basic_block *block
    
    if (  (new_node == NULL)
          || (new_node->instr == NULL)
-         || (before_node == NULL) )
+         || (before_node == NULL)
+         || (before_node->link == NULL) )
    {
       cflow_errorcode = CFLOW_INVALID_NODE;
       return;
    }
 
-   before_node_elem = findElement(block->nodes, before_node);
-   if (before_node_elem == NULL)
-   {
-      cflow_errorcode = CFLOW_INVALID_NODE;
-      return;
-   }
-   
-   if (findElement(block->nodes, new_node) != NULL)
+   if (new_node->link != NULL)
    {
       cflow_errorcode = CFLOW_NODE_ALREADY_INSERTED;
       return;
    }
 
-   /* get the position of the before node */
-   before_node_posn = getPosition(block->nodes, before_node_elem);
-   assert(before_node_posn != -1);
-
    /* add the current node to the basic block */
-   block->nodes = addElement(block->nodes, new_node, before_node_posn);
+   new_node->link = addBefore(before_node->link, new_node);
+   if (before_node->link == block->nodes)
+      block->nodes = new_node->link;
 }
 
 /* insert a new node without updating the dataflow informations */
 void insertNodeAfter(t_basic_block *block
       , t_cflow_Node *after_node, t_cflow_Node *new_node)
 {
-   int after_node_posn;
-   t_list *after_node_elem;
-   
    /* preconditions */
    if (block == NULL)
    {
@@ -994,31 +1250,104 @@ void insertNodeAfter(t_basic_block *block
    
    if (  (new_node == NULL)
          || (new_node->instr == NULL)
-         || (after_node == NULL) )
+         || (after_node == NULL)
+         || (after_node->link == NULL) )
    {
       cflow_errorcode = CFLOW_INVALID_NODE;
       return;
    }
 
-   after_node_elem = findElement(block->nodes, after_node);
-   if (after_node_elem == NULL)
+   if (new_node->link != NULL)
+   {
+      cflow_errorcode = CFLOW_NODE_ALREADY_INSERTED;
+      return;
+   }
+
+   /* add the current node to the basic block */
+   new_node->link = addAfter(after_node->link, new_node);
+   if (after_node->link == block->lastNode)
+      block->lastNode = new_node->link;
+}
+
+/* remove a node without updating the dataflow informations */
+void removeNodeFromBlock(t_basic_block *block, t_cflow_Node *node)
+{
+   t_list *node_elem;
+   t_axe_instruction *instr, *next;
+   int i;
+
+   /* preconditions */
+   if (block == NULL)
+   {
+      cflow_errorcode = CFLOW_INVALID_BBLOCK;
+      return;
+   }
+
+   node_elem = node != NULL ? node->link : NULL;
+   if (node_elem == NULL)
    {
       cflow_errorcode = CFLOW_INVALID_NODE;
       return;
    }
-   
-   if (findElement(block->nodes, new_node) != NULL)
+   instr = node->instr;
+
+   /* a basic block is never empty: the last instruction becomes a NOP,
+    * which keeps its label and comment */
+   if (LNEXT(node_elem) == NULL && LPREV(node_elem) == NULL)
    {
-      cflow_errorcode = CFLOW_NODE_ALREADY_INSERTED;
+      free_Instruction(instr);
+      instr->opcode = NOP;
+      instr->reg_1 = NULL;
+      instr->reg_2 = NULL;
+      instr->reg_3 = NULL;
+      instr->immediate = 0;
+      instr->address = NULL;
+      instr->mcFlags = 0;
+      for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         node->defs[i] = NULL;
+      for (i = 0; i < CFLOW_MAX_USES; i++)
+         node->uses[i] = NULL;
       return;
    }
 
-   /* get the position of the after node */
-   after_node_posn = getPosition(block->nodes, after_node_elem);
-   assert(after_node_posn != -1);
+   /* only the first instruction of a block can have a label: it is moved
+    * to the next instruction */
+   if (LNEXT(node_elem) != NULL)
+   {
+      next = ((t_cflow_Node *) LDATA(LNEXT(node_elem)))->instr;
+      if (instr->labelID != NULL) {
+         assert(next->labelID == NULL);
+         next->labelID = instr->labelID;
+      }
+      if (next->user_comment == NULL)
+         next->user_comment = instr->user_comment;
+   }
+   else
+      assert(instr->labelID == NULL);
+
+   if (node_elem == block->lastNode)
+      block->lastNode = LPREV(node_elem);
+   block->nodes = removeElementLink(block->nodes, node_elem);
+   node->link = NULL;
+   finalizeNode(node);
+   free_Instruction(instr);
+}
 
-   /* add the current node to the basic block */
-   block->nodes = addElement(block->nodes, new_node, (after_node_posn + 1));
+void updateNodeDefUses(t_cflow_Graph *graph, t_cflow_Node *node)
+{
+   int i;
+
+   /* preconditions */
+   if (node == NULL) {
+      cflow_errorcode = CFLOW_INVALID_NODE;
+      return;
+   }
+
+   for (i = 0; i < CFLOW_MAX_DEFS; i++)
+      node->defs[i] = NULL;
+   for (i = 0; i < CFLOW_MAX_USES; i++)
+      node->uses[i] = NULL;
+   setDefUses(graph, node);
 }
 
 void insertNode(t_basic_block *block, t_cflow_Node *node)
@@ -1036,14 +1365,17 @@ void insertNode(t_basic_block *block, t_cflow_Node *node)
       return;
    }
 
-   if (findElement(block->nodes, node) != NULL)
+   if (node->link != NULL)
    {
       cflow_errorcode = CFLOW_NODE_ALREADY_INSERTED;
       return;
    }
 
-   /* add the current node to the basic block */
-   block->nodes = addElement(block->nodes, node, -1);
+   /* add the current node at the end of the basic block */
+   block->lastNode = addAfter(block->lastNode, node);
+   node->link = block->lastNode;
+   if (block->nodes == NULL)
+      block->nodes = block->lastNode;
 }
 
 t_cflow_Graph * createFlowGraph(t_list *instructions)
@@ -1101,7 +1433,7 @@ t_cflow_Graph * createFlowGraph(t_list *instructions)
       if (startingNode || bblock == NULL)
       {
          /* alloc a new basic block */
-         bblock = allocBasicBlock();
+         bblock = allocBasicBlock(result);
          if (bblock == NULL) {
             finalizeGraph(result);
             finalizeNode(current_node);
@@ -1159,8 +1491,7 @@ t_cflow_Graph * createFlowGraph(t_list *instructions)
 
 void updateFlowGraph(t_cflow_Graph *graph)
 {
-   t_list *current_element;
-   t_basic_block *current_block;
+   t_hashmap *labels;
    
    /* preconditions: graph should not be a NULL pointer */
    if (graph == NULL){
@@ -1168,6 +1499,18 @@ void updateFlowGraph(t_cflow_Graph *graph)
       return;
    }
 
+   /* the jumps are resolved with a single pass over the blocks */
+   labels = mapLabelsToBlocks(graph);
+   connectBlocks(graph, labels);
+   freeHashMap(labels);
+}
+
+/* adds to the graph the edges of the jumps and of the fallthroughs */
+void connectBlocks(t_cflow_Graph *graph, t_hashmap *labels)
+{
+   t_list *current_element;
+   t_basic_block *current_block;
+
    current_element = graph->blocks;
    while(current_element != NULL)
    {
@@ -1182,7 +1525,7 @@ void updateFlowGraph(t_cflow_Graph *graph)
       assert(current_block->nodes != NULL);
 
       /* get the last node of the basic block */
-      last_element = getLastElement(current_block->nodes);
+      last_element = current_block->lastNode;
       assert(last_element != NULL);
       
       last_node = (t_cflow_Node *) LDATA(last_element);
@@ -1207,8 +1550,8 @@ void updateFlowGraph(t_cflow_Graph *graph)
                return;
             }
          
-            jumpBlock = searchLabel(graph
-                  , (last_instruction->address)->labelID);
+            jumpBlock = lookupHashMap(labels
+                  , INTDATA((last_instruction->address)->labelID->labelID));
             if (jumpBlock == NULL) {
                cflow_errorcode = CFLOW_INVALID_LABEL_FOUND;
                return;
@@ -1255,20 +1598,21 @@ void updateFlowGraph(t_cflow_Graph *graph)
 }
 
 void reachingDefinitionsOfVarsInBB(t_cflow_Graph *graph, t_basic_block *bb, 
-      t_list *start, t_list **pRes, t_list **pNotReached, t_list **pVisitedBBs)
+      t_list *start, t_list **pRes, t_small_vector *notReached,
+      t_hashset *visitedBBs)
 {
-   if (findElement(*pVisitedBBs, bb))
+   if (isInHashSet(visitedBBs, bb))
       return;
 
    t_list *cur = start;
-   while (cur != NULL && *pNotReached != NULL) {
+   while (cur != NULL && SVSIZE(notReached) > 0) {
       t_cflow_Node *node = LDATA(cur);
       for (int i=0; i<CFLOW_MAX_DEFS; i++) {
          if (node->defs[i] == NULL)
             continue;
-         t_list *foundUse = findElement(*pNotReached, node->defs[i]);
-         if (foundUse) {
-            *pNotReached = removeElementLink(*pNotReached, foundUse);
+         int foundUse = findInSmallVector(notReached, node->defs[i]);
+         if (foundUse >= 0) {
+            removeFromSmallVectorAt(notReached, foundUse);
             t_cflow_reach_def *rdef = calloc(sizeof(t_cflow_reach_def), 1);
             rdef->node = node;
             rdef->var = node->defs[i];
@@ -1278,18 +1622,20 @@ void reachingDefinitionsOfVarsInBB(t_cflow_Graph *graph, t_basic_block *bb,
       cur = LPREV(cur);
    }
 
-   *pVisitedBBs = addElement(*pVisitedBBs, bb, 0);
+   addToHashSet(visitedBBs, bb);
 
-   if (*pNotReached == NULL)
+   if (SVSIZE(notReached) == 0)
       return;
 
    t_list *prevBBLnk = bb->pred;
    for (; prevBBLnk != NULL; prevBBLnk = LNEXT(prevBBLnk)) {
-      t_list *notReachedB = cloneList(*pNotReached);
+      t_small_vector notReachedB;
       t_basic_block *prevBB = LDATA(prevBBLnk);
+      initSmallVector(&notReachedB);
+      copySmallVector(&notReachedB, notReached);
       reachingDefinitionsOfVarsInBB(graph, prevBB, 
-            getLastElement(prevBB->nodes), pRes, &notReachedB, pVisitedBBs);
-      freeList(notReachedB);
+            getLastElement(prevBB->nodes), pRes, &notReachedB, visitedBBs);
+      finalizeSmallVector(&notReachedB);
    }
 }
 
@@ -1297,18 +1643,19 @@ t_list *reachingDefinitionsOfNode(t_cflow_Graph *graph, t_basic_block *bb,
       t_cflow_Node *node)
 {
    t_list *res = NULL;
-   t_list *visitedBBs = NULL;
+   t_hashset *visitedBBs = allocHashSet(NULL, NULL);
 
-   t_list *notReached = NULL;
+   t_small_vector notReached;
+   initSmallVector(&notReached);
    for (int i=0; i<CFLOW_MAX_USES; i++) {
       if (node->uses[i] == NULL)
          continue;
-      notReached = addElement(notReached, node->uses[i], 0);
+      addToSmallVector(&notReached, node->uses[i]);
    }
 
    t_list *start;
    if (bb) {
-      start = findElement(bb->nodes, node);
+      start = node->link;
    } else {
       t_list *bbLnk = graph->blocks;
       for (; bbLnk != NULL; bbLnk = LNEXT(bbLnk)) {
@@ -1320,10 +1667,10 @@ t_list *reachingDefinitionsOfNode(t_cflow_Graph *graph, t_basic_block *bb,
    }
    assert(start && "node not found in cfg");
    reachingDefinitionsOfVarsInBB(graph, bb, LPREV(start), 
-      &res, &notReached, &visitedBBs);
+      &res, &notReached, visitedBBs);
 
-   freeList(notReached);
-   freeList(visitedBBs);
+   finalizeSmallVector(&notReached);
+   freeHashSet(visitedBBs);
    return res;
 }
 
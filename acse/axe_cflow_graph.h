@@ -15,6 +15,7 @@
 #include "cflow_constants.h"
 #include "axe_struct.h"
 #include "collections.h"
+#include "axe_arena.h"
 
 extern int cflow_errorcode;
 
@@ -26,6 +27,8 @@ typedef struct t_cflow_var
               * variables which are not part of the code */
    int type;
    t_list *mcRegWhitelist;
+   int index;  /* dense index of the variable inside the graph. It is the
+                * position of the variable in the liveness bit sets. */
 } t_cflow_var;
 
 /* A Node exists only in a basic block. It defines a list of
@@ -37,8 +40,9 @@ typedef struct t_cflow_Node
    t_cflow_var *uses[CFLOW_MAX_USES];  /* set of variables that will be used by this node */
    t_axe_instruction *instr;  /* a pointer to the instruction associated
                                * with this node */
-   t_list *in;             /* variables that are live-in the current node */
-   t_list *out;            /* variables that are live-out the current node */
+   t_list *link;              /* the position of the node in the list of
+                               * its basic block; NULL if the node does not
+                               * belong to a block */
 } t_cflow_Node;
 
 /* an ordered list of nodes with only one predecessor and one successor */
@@ -47,6 +51,18 @@ typedef struct t_basic_block
    t_list *pred;  /* predecessors : a list of basic blocks */
    t_list *succ;  /* successors : a list of basic blocks */
    t_list *nodes; /* an ordered list of instructions */
+   t_list *lastNode;    /* the last link of `nodes' */
+   t_bitset *liveIn;    /* variables live at the beginning of the block */
+   t_bitset *liveOut;   /* variables live at the end of the block */
+   struct t_basic_block *idom; /* immediate dominator; NULL for the starting
+                         * block and for the unreachable blocks */
+   int rpoNumber;       /* position of the block in reverse postorder, or -1
+                         * if the block is unreachable */
+   t_list *domFrontier; /* dominance frontier: the blocks where the
+                         * dominance of this block ends */
+   int loopDepth;       /* number of loops containing the block */
+   double frequency;    /* estimate of the number of executions of the
+                         * block for each execution of the program */
 } t_basic_block;
 
 /* a control flow graph */
@@ -55,7 +71,20 @@ typedef struct t_cflow_Graph
    t_basic_block *startingBlock; /* the starting basic block of code */
    t_basic_block *endingBlock;   /* the last block of the graph */
    t_list *blocks;               /* an ordered list of all the basic blocks */
-   t_list *cflow_variables;      /* a list of all the variable identifiers */
+   t_list *lastBlock;            /* the last link of `blocks' */
+   t_cflow_var **variables;      /* all the variables, indexed by their
+                                  * `index' field */
+   int numVariables;             /* number of variables in the graph */
+   int maxVariables;             /* allocated size of `variables' */
+   t_cflow_var **varsByID;       /* lookup table from variable identifiers
+                                  * to variables */
+   int maxVarsByID;              /* allocated size of `varsByID' */
+   int livenessIterations;       /* number of iterations performed by the
+                                  * last liveness analysis */
+   int numLoops;                 /* number of natural loops, computed by
+                                  * `computeLoopDepths' */
+   t_arena *arena;               /* memory of the nodes, of the basic blocks
+                                  * and of the variables */
 } t_cflow_Graph;
 
 typedef struct {
@@ -68,7 +97,7 @@ typedef struct {
  * of basic blocks, instruction nodes and flow graphs */
 extern t_cflow_Node *allocNode(t_cflow_Graph *graph, t_axe_instruction *instr);
 extern void finalizeNode(t_cflow_Node *node);
-extern t_basic_block *allocBasicBlock();
+extern t_basic_block *allocBasicBlock(t_cflow_Graph *graph);
 extern void finalizeBasicBlock(t_basic_block *block);
 extern t_cflow_Graph *allocGraph();
 extern void finalizeGraph(t_cflow_Graph *graph);
@@ -76,21 +105,78 @@ extern void finalizeGraph(t_cflow_Graph *graph);
 /* working with basic blocks */
 extern void setPred(t_basic_block *block, t_basic_block *pred);
 extern void setSucc(t_basic_block *block, t_basic_block *succ);
+extern void removeEdge(t_basic_block *block, t_basic_block *succ);
+/* Insert `node', which must not belong to any block, in constant time:
+ * at the end of `block', or before or after a node of `block'. */
 extern void insertNode(t_basic_block *block, t_cflow_Node *node);
 extern void insertNodeBefore(
       t_basic_block *block, t_cflow_Node *before_node, t_cflow_Node *new_node);
 extern void insertNodeAfter(
       t_basic_block *block, t_cflow_Node *after_node, t_cflow_Node *new_node);
-extern t_list *getLiveINVars(t_basic_block *bblock);
-extern t_list *getLiveOUTVars(t_basic_block *bblock);
+/* Removes `node' from `block' in constant time, and frees its instruction.
+ * The label of the instruction is moved to the next one; the last node of
+ * a block is replaced by a NOP instead. */
+extern void removeNodeFromBlock(t_basic_block *block, t_cflow_Node *node);
+/* Recomputes the variables defined and used by `node' after its instruction
+ * has been modified. The dataflow informations are not updated. */
+extern void updateNodeDefUses(t_cflow_Graph *graph, t_cflow_Node *node);
+
+/* Returns a list of the variables (t_cflow_var) live at the beginning or
+ * at the end of the given basic block. The list must be freed by the caller.
+ * Valid only after a call to `performLivenessAnalysis'. */
+extern t_list *getLiveINVars(t_cflow_Graph *graph, t_basic_block *bblock);
+extern t_list *getLiveOUTVars(t_cflow_Graph *graph, t_basic_block *bblock);
 
 /* working with the control flow graph */
+/* Appends `block' to the graph in constant time. The block must not belong
+ * to the graph. */
 extern void insertBlock(t_cflow_Graph *graph, t_basic_block *block);
+/* Inserts `block' in the graph, in the position that follows `after'. If
+ * `after' is NULL, `block' becomes the starting block of the graph. */
+extern void insertBlockAfter(t_cflow_Graph *graph, t_basic_block *after
+      , t_basic_block *block);
+/* Removes `block' and all its edges from the graph, and frees it. The
+ * starting block cannot be removed. */
+extern void removeBlock(t_cflow_Graph *graph, t_basic_block *block);
 extern t_cflow_Graph *createFlowGraph(t_list *instructions);
 
+/* returns the variable of the graph with the given identifier, or NULL if
+ * no instruction in the graph references it */
+extern t_cflow_var *getCflowVariable(t_cflow_Graph *graph, int ID);
+
 /* dataflow analysis */
+
+/* Computes the set of variables live at the beginning and at the end of
+ * each basic block (fields `liveIn' and `liveOut' of t_basic_block). Liveness
+ * sets are bit sets, indexed by the `index' field of each variable. */
 extern void performLivenessAnalysis(t_cflow_Graph *graph);
 
+/* Liveness transfer function: given in `live' the set of variables live at
+ * the end of `node', updates it to the set of variables live at its
+ * beginning. The liveness of each node of a block is computed by applying
+ * this function backwards starting from the `liveOut' set of the block. */
+extern void computeLiveINVarsOfNode(t_cflow_Node *node, t_bitset *live);
+
+/* Computes the immediate dominator of each basic block (fields `idom' and
+ * `rpoNumber' of t_basic_block), with the algorithm of Cooper, Harvey and
+ * Kennedy. */
+extern void computeDominators(t_cflow_Graph *graph);
+
+/* Returns non-zero if the block `a' dominates the block `b'. Valid only
+ * after a call to `computeDominators'. */
+extern int dominates(t_basic_block *a, t_basic_block *b);
+
+/* Computes the dominance frontier of each basic block (field `domFrontier'
+ * of t_basic_block). Valid only after a call to `computeDominators'. */
+extern void computeDominanceFrontiers(t_cflow_Graph *graph);
+
+/* Finds the natural loops of the graph and computes the loop nesting depth
+ * and the estimated execution frequency of each basic block (fields
+ * `loopDepth' and `frequency' of t_basic_block). The loops with the same
+ * header are considered as a single loop; each loop is assumed to iterate
+ * LOOP_FREQUENCY_FACTOR times. The dominators are computed as well. */
+extern void computeLoopDepths(t_cflow_Graph *graph);
+
 /* reaching definitions */
 t_list *reachingDefinitionsOfNode(t_cflow_Graph *graph, t_basic_block *bb, 
       t_cflow_Node *node);
@@ -0,0 +1,381 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_coalesce.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include "axe_coalesce.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+
+extern int cflow_errorcode;
+
+/* a copy which may be removed */
+typedef struct t_coalescing_move
+{
+   t_basic_block *block;
+   t_cflow_Node *node;
+   int dest;               /* the destination and the source of the copy, */
+   int src;                /* as positions in `vars' */
+   double frequency;       /* estimated frequency of the block */
+   int position;           /* order of the copy in the code */
+}t_coalescing_move;
+
+typedef struct t_coalescing
+{
+   t_cflow_Graph *graph;
+   int *related;           /* for each variable index, its position in
+                            * `vars', or -1 if it is not the source or the
+                            * destination of a copy */
+   t_cflow_var **vars;     /* the variables related by a copy */
+   int numVars;
+   int *parent;            /* the variables merged together form a tree */
+   int *nextMember;        /* circular list of the variables merged
+                            * together */
+   t_vector **adjacent;    /* for each variable of `vars', the variables
+                            * it interferes with (positions in `vars') */
+   t_coalescing_move *moves;
+   int numMoves;
+}t_coalescing;
+
+static int getCopySource(t_axe_instruction *instr);
+static int isCoalescable(t_cflow_var *var);
+static int addRelatedVariable(t_coalescing *co, t_cflow_var *var);
+static void findMoves(t_coalescing *co);
+static void buildInterferences(t_coalescing *co);
+static int compareMoves(const void *a, const void *b);
+static int findRoot(t_coalescing *co, int var);
+static int interferes(t_coalescing *co, int a, int b);
+static void mergeVariables(t_coalescing *co, int a, int b);
+static void renameVariables(t_coalescing *co);
+
+
+/* Returns the identifier of the register copied by `instr', or REG_INVALID
+ * if `instr' is not a copy between registers */
+int getCopySource(t_axe_instruction *instr)
+{
+   t_axe_register *dest, *src;
+
+   if (instr->reg_1 == NULL || instr->reg_1->indirect)
+      return REG_INVALID;
+
+   /* ADDI Rd Rs #0 is the copy used by the frontend to read a variable */
+   if (instr->opcode == ADDI && instr->immediate == 0
+         && instr->reg_2 != NULL && !instr->reg_2->indirect)
+      return instr->reg_2->ID;
+
+   if (!isMoveInstruction(instr, &dest, &src, NULL, NULL) || src == NULL
+         || src->indirect)
+      return REG_INVALID;
+   return src->ID;
+}
+
+/* Returns non-zero if `var' can be merged with another variable */
+int isCoalescable(t_cflow_var *var)
+{
+   return var != NULL && var->ID > REG_0 && var->mcRegWhitelist == NULL;
+}
+
+/* Returns the position of `var' in the variables related by a copy, adding
+ * it if needed */
+int addRelatedVariable(t_coalescing *co, t_cflow_var *var)
+{
+   if (co->related[var->index] < 0) {
+      co->related[var->index] = co->numVars;
+      co->vars[co->numVars++] = var;
+   }
+   return co->related[var->index];
+}
+
+/* Find the copies which may be removed: the ones between variables without
+ * register constraints, which do not define flags needed later */
+void findMoves(t_coalescing *co)
+{
+   t_list *current_bb_element, *current_nd_element;
+   t_bitset *live;
+   int position = 0;
+   int pswIndex = -1;
+   int i;
+
+   for (i = 0; i < co->graph->numVariables; i++) {
+      if (co->graph->variables[i]->ID == VAR_PSW)
+         pswIndex = i;
+   }
+
+   live = allocBitset(co->graph->numVariables);
+   current_bb_element = co->graph->blocks;
+   for (; current_bb_element != NULL
+         ; current_bb_element = LNEXT(current_bb_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+      copyBitset(live, block->liveOut);
+      current_nd_element = getLastElement(block->nodes);
+      for (; current_nd_element != NULL
+            ; current_nd_element = LPREV(current_nd_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_nd_element);
+         t_cflow_var *dest, *src;
+         int srcID;
+
+         srcID = getCopySource(node->instr);
+         if (srcID != REG_INVALID
+               && (pswIndex < 0 || !isInBitset(live, pswIndex)))
+         {
+            dest = getCflowVariable(co->graph, node->instr->reg_1->ID);
+            src = getCflowVariable(co->graph, srcID);
+            if (isCoalescable(dest) && isCoalescable(src)
+                  && dest->type == src->type)
+            {
+               t_coalescing_move *move = &co->moves[co->numMoves++];
+               move->block = block;
+               move->node = node;
+               move->dest = addRelatedVariable(co, dest);
+               move->src = addRelatedVariable(co, src);
+               move->frequency = block->frequency;
+               move->position = position;
+            }
+         }
+
+         computeLiveINVarsOfNode(node, live);
+         position++;
+      }
+   }
+   freeBitset(live);
+}
+
+/*
+ * Two variables interfere if one of them is defined where the other one
+ * is live, except when the definition is a copy of the other variable:
+ * after the copy, both variables hold the same value.
+ */
+void buildInterferences(t_coalescing *co)
+{
+   t_list *current_bb_element, *current_nd_element;
+   t_bitset *live;
+   int i, j, v, w;
+
+   live = allocBitset(co->graph->numVariables);
+   current_bb_element = co->graph->blocks;
+   for (; current_bb_element != NULL
+         ; current_bb_element = LNEXT(current_bb_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+      copyBitset(live, block->liveOut);
+      current_nd_element = getLastElement(block->nodes);
+      for (; current_nd_element != NULL
+            ; current_nd_element = LPREV(current_nd_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_nd_element);
+         int srcID = getCopySource(node->instr);
+
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            if (node->defs[i] == NULL)
+               continue;
+            v = co->related[node->defs[i]->index];
+            if (v < 0)
+               continue;
+
+            for (j = nextInBitset(live, 0); j >= 0
+                  ; j = nextInBitset(live, j + 1))
+            {
+               w = co->related[j];
+               if (w < 0 || w == v || co->vars[w]->ID == srcID)
+                  continue;
+               addToVector(co->adjacent[v], INTDATA(w));
+               addToVector(co->adjacent[w], INTDATA(v));
+            }
+         }
+
+         computeLiveINVarsOfNode(node, live);
+      }
+   }
+   freeBitset(live);
+}
+
+/* Orders the copies from the most frequently executed to the least */
+int compareMoves(const void *a, const void *b)
+{
+   const t_coalescing_move *moveA = (const t_coalescing_move *) a;
+   const t_coalescing_move *moveB = (const t_coalescing_move *) b;
+
+   if (moveA->frequency != moveB->frequency)
+      return moveA->frequency < moveB->frequency ? 1 : -1;
+   return moveA->position - moveB->position;
+}
+
+/* Returns the variable which represents the ones merged with `var' */
+int findRoot(t_coalescing *co, int var)
+{
+   int root = var;
+
+   while (co->parent[root] != root)
+      root = co->parent[root];
+   /* shorten the path for the next searches */
+   while (co->parent[var] != root) {
+      int next = co->parent[var];
+      co->parent[var] = root;
+      var = next;
+   }
+   return root;
+}
+
+/* Returns non-zero if any of the variables merged into `a' interferes with
+ * any of the variables merged into `b' */
+int interferes(t_coalescing *co, int a, int b)
+{
+   int member = a;
+   int i;
+
+   do {
+      t_vector *adjacent = co->adjacent[member];
+      for (i = 0; i < VSIZE(adjacent); i++) {
+         if (findRoot(co, VINTDATA(adjacent, i)) == b)
+            return 1;
+      }
+      member = co->nextMember[member];
+   } while (member != a);
+   return 0;
+}
+
+/* Merge the variables of `a' into the ones of `b' */
+void mergeVariables(t_coalescing *co, int a, int b)
+{
+   int next = co->nextMember[a];
+
+   co->parent[a] = b;
+   co->nextMember[a] = co->nextMember[b];
+   co->nextMember[b] = next;
+}
+
+/* Replace each variable with the one it has been merged into */
+void renameVariables(t_coalescing *co)
+{
+   t_list *current_bb_element, *current_nd_element;
+   t_axe_register *regs[3];
+   t_cflow_var *var;
+   int i, r;
+
+   current_bb_element = co->graph->blocks;
+   for (; current_bb_element != NULL
+         ; current_bb_element = LNEXT(current_bb_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+      current_nd_element = block->nodes;
+      for (; current_nd_element != NULL
+            ; current_nd_element = LNEXT(current_nd_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_nd_element);
+
+         regs[0] = node->instr->reg_1;
+         regs[1] = node->instr->reg_2;
+         regs[2] = node->instr->reg_3;
+         for (i = 0; i < 3; i++)
+         {
+            if (regs[i] == NULL)
+               continue;
+            var = getCflowVariable(co->graph, regs[i]->ID);
+            if (var == NULL || co->related[var->index] < 0)
+               continue;
+            r = findRoot(co, co->related[var->index]);
+            regs[i]->ID = co->vars[r]->ID;
+         }
+
+         for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+            var = node->defs[i];
+            if (var != NULL && co->related[var->index] >= 0)
+               node->defs[i] = co->vars[findRoot(co
+                     , co->related[var->index])];
+         }
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            var = node->uses[i];
+            if (var != NULL && co->related[var->index] >= 0)
+               node->uses[i] = co->vars[findRoot(co
+                     , co->related[var->index])];
+         }
+      }
+   }
+}
+
+int coalesceCopies(t_cflow_Graph *graph)
+{
+   t_coalescing co;
+   int numNodes, removed, i;
+   t_list *current_element;
+
+   assert(graph != NULL);
+
+   numNodes = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+      numNodes += getLength(((t_basic_block *) LDATA(current_element))->nodes);
+
+   co.graph = graph;
+   co.related = malloc(sizeof(int) * (graph->numVariables + 1));
+   co.vars = malloc(sizeof(t_cflow_var *) * (graph->numVariables + 1));
+   co.moves = malloc(sizeof(t_coalescing_move) * (numNodes + 1));
+   if (co.related == NULL || co.vars == NULL || co.moves == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < graph->numVariables; i++)
+      co.related[i] = -1;
+   co.numVars = 0;
+   co.numMoves = 0;
+
+   findMoves(&co);
+
+   co.parent = malloc(sizeof(int) * (co.numVars + 1));
+   co.nextMember = malloc(sizeof(int) * (co.numVars + 1));
+   co.adjacent = malloc(sizeof(t_vector *) * (co.numVars + 1));
+   if (co.parent == NULL || co.nextMember == NULL || co.adjacent == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < co.numVars; i++) {
+      co.parent[i] = i;
+      co.nextMember[i] = i;
+      co.adjacent[i] = allocVector(0);
+   }
+
+   buildInterferences(&co);
+
+   /* the copies in the innermost loops are removed first */
+   qsort(co.moves, co.numMoves, sizeof(t_coalescing_move), compareMoves);
+   removed = 0;
+   for (i = 0; i < co.numMoves; i++)
+   {
+      t_coalescing_move *move = &co.moves[i];
+      int dest = findRoot(&co, move->dest);
+      int src = findRoot(&co, move->src);
+
+      if (dest != src) {
+         if (interferes(&co, dest, src))
+            continue;
+         mergeVariables(&co, dest, src);
+      }
+      removeNodeFromBlock(move->block, move->node);
+      if (cflow_errorcode != CFLOW_OK)
+         notifyError(AXE_OUT_OF_MEMORY);
+      removed++;
+   }
+
+   renameVariables(&co);
+   performLivenessAnalysis(graph);
+
+   for (i = 0; i < co.numVars; i++)
+      freeVector(co.adjacent[i]);
+   free(co.adjacent);
+   free(co.nextMember);
+   free(co.parent);
+   free(co.moves);
+   free(co.vars);
+   free(co.related);
+
+   setStatistic("coalesce.removed_copies", removed);
+   return removed;
+}
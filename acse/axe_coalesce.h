@@ -0,0 +1,27 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_coalesce.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Coalescing of the copies between variables, performed on the control flow
+ * graph before the register allocation. The frontend copies a variable into
+ * a new register each time it is read, and copies the value of each
+ * assignment into the register of the variable; the target transformations
+ * may add more copies. The source and the destination of a copy are merged
+ * into a single variable when they do not interfere, and the copy is
+ * removed.
+ */
+
+#ifndef _AXE_COALESCE_H
+#define _AXE_COALESCE_H
+
+#include "axe_cflow_graph.h"
+
+/* Merge the variables related by a copy which do not interfere, and remove
+ * the copies between them. The liveness analysis and `computeLoopDepths'
+ * must have been performed on `graph'; the liveness informations are
+ * updated. Returns the number of copies removed. */
+extern int coalesceCopies(t_cflow_Graph *graph);
+
+#endif
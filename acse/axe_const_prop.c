@@ -0,0 +1,883 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_const_prop.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include "axe_const_prop.h"
+#include "axe_def_use.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_labels.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+#include "symbol_table.h"
+
+/* states of a value */
+#define CP_UNDEFINED 0  /* the definition of the value has not been reached */
+#define CP_CONSTANT 1   /* the value is always the same */
+#define CP_VARYING 2    /* the value is not known */
+
+/* the flags held by the value of the PSW */
+#define CP_FLAG_C 1
+#define CP_FLAG_V 2
+#define CP_FLAG_Z 4
+#define CP_FLAG_N 8
+
+/* a sign bit, as computed by the MACE simulator */
+#define MSB(x) (((unsigned)(x) >> 31) & 1)
+
+/* the outcome of a branch whose flags have not been computed yet */
+#define CP_BRANCH_UNDEFINED -2
+
+typedef struct t_cp_value
+{
+   int state;
+   int value;     /* for the PSW, a combination of the CP_FLAG_* bits */
+}t_cp_value;
+
+typedef struct t_const_prop
+{
+   t_program_infos *program;
+   t_cflow_Graph *graph;
+   t_def_use *du;             /* the def-use chains of `graph' */
+   t_basic_block **targets;   /* for each block ending with a branch, the
+                               * block at the destination of the branch */
+   int pswIndex;              /* index of the PSW in the graph, or -1 */
+   int *executable;           /* non-zero for the edges which can be
+                               * followed */
+   int *executed;             /* non-zero for the blocks which can be
+                               * executed */
+   t_cp_value *values;        /* the state of each value of `du' */
+   int *pendingValues;        /* the values which changed, whose users
+                               * must be evaluated again */
+   int numPendingValues;
+   int *queuedValues;         /* non-zero for the values in
+                               * `pendingValues' */
+   int *pendingEdges;         /* the edges which have become executable,
+                               * whose destination must be evaluated */
+   int numPendingEdges;
+   int *uses;                 /* number of uses of each value which are
+                               * kept in the code */
+}t_const_prop;
+
+static void checkCflowError(void);
+static void setConstant(t_cp_value *value, int constant);
+static int isConstant(t_cp_value value, int constant);
+static int computeFlags(int result, int overflow, int carry);
+static int testCondition(int opcode, int flags);
+static t_cp_value getValue(t_const_prop *cp, int value);
+static t_cp_value getOperand(t_const_prop *cp, int node
+      , t_axe_register *reg);
+static void evaluateInstruction(t_const_prop *cp, int node
+      , t_cp_value *result, t_cp_value *flags);
+static int evaluateBranch(t_const_prop *cp, int block);
+static int isFeasibleSuccessor(t_const_prop *cp, int block
+      , t_basic_block *succ, int outcome);
+static void initializeValues(t_const_prop *cp);
+static void setValue(t_const_prop *cp, int value, t_cp_value newValue);
+static void visitNode(t_const_prop *cp, int node);
+static void visitPhi(t_const_prop *cp, int phi);
+static void addFeasibleEdges(t_const_prop *cp, int block);
+static void propagate(t_const_prop *cp);
+static int foldOperands(t_const_prop *cp, int node);
+static int resolveBranch(t_const_prop *cp, int block);
+static void removeNode(t_const_prop *cp, int node);
+static void countUses(t_const_prop *cp, int node, int delta);
+static void countAllUses(t_const_prop *cp);
+static void replaceConstantDefinitions(t_const_prop *cp, int block
+      , int *folded, int *removed);
+
+void checkCflowError(void)
+{
+   if (cflow_errorcode != CFLOW_OK)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+}
+
+void setConstant(t_cp_value *value, int constant)
+{
+   value->state = CP_CONSTANT;
+   value->value = constant;
+}
+
+int isConstant(t_cp_value value, int constant)
+{
+   return value.state == CP_CONSTANT && value.value == constant;
+}
+
+/* Returns the flags set by an instruction of the MACE machine which
+ * computes `result' */
+int computeFlags(int result, int overflow, int carry)
+{
+   return (result < 0 ? CP_FLAG_N : 0) | (result == 0 ? CP_FLAG_Z : 0)
+         | (overflow ? CP_FLAG_V : 0) | (carry ? CP_FLAG_C : 0);
+}
+
+/* Returns the value written by the Scc instruction `opcode', or non-zero if
+ * the branch `opcode' is taken, given the value of the flags */
+int testCondition(int opcode, int flags)
+{
+   int n = !!(flags & CP_FLAG_N);
+   int z = !!(flags & CP_FLAG_Z);
+   int v = !!(flags & CP_FLAG_V);
+   int c = !!(flags & CP_FLAG_C);
+
+   switch (opcode)
+   {
+      case BT : return 1;
+      case BF : return 0;
+      case BHI : return !(c || z);
+      case BLS : return c || z;
+      case BCC : return !c;
+      case BCS : return c;
+      case SNE : case BNE : return !z;
+      case SEQ : case BEQ : return z;
+      case BVC : return !v;
+      case BVS : return v;
+      case BPL : return !n;
+      case BMI : return n;
+      case SGE : case BGE : return !(n ^ v);
+      case SLT : case BLT : return n ^ v;
+      case SGT : case BGT : return !(z || (n ^ v));
+      case SLE : case BLE : return z || (n ^ v);
+   }
+   assert(0 && "not a condition");
+   return 0;
+}
+
+/* Returns the state of the value number `value' */
+t_cp_value getValue(t_const_prop *cp, int value)
+{
+   t_cp_value result;
+
+   if (value != DU_NO_VALUE)
+      return cp->values[value];
+   result.state = CP_VARYING;
+   result.value = 0;
+   return result;
+}
+
+/* Returns the value of a source operand of `node' */
+t_cp_value getOperand(t_const_prop *cp, int node, t_axe_register *reg)
+{
+   t_cp_value result;
+   t_cflow_var *var;
+
+   if (reg != NULL && !reg->indirect && reg->ID == REG_0) {
+      setConstant(&result, 0);
+      return result;
+   }
+   if (reg == NULL || reg->indirect
+         || (var = getCflowVariable(cp->graph, reg->ID)) == NULL)
+      return getValue(cp, DU_NO_VALUE);
+   return getValue(cp, getReachingValue(cp->du, node, var->index));
+}
+
+/*
+ * Computes the value written to the destination register by `node', and
+ * the value of the flags after it, following the semantics of the MACE
+ * machine. The flags are computed only by the instructions whose effect on
+ * them is the same on every target.
+ */
+void evaluateInstruction(t_const_prop *cp, int node
+      , t_cp_value *result, t_cp_value *flags)
+{
+   t_axe_instruction *instr = cp->du->nodes[node].node->instr;
+   t_cp_value a, b;
+   int opcode = instr->opcode;
+   int r, overflow, carry;
+   long long product;
+
+   result->state = CP_VARYING;
+   result->value = 0;
+   flags->state = CP_VARYING;
+   flags->value = 0;
+
+   switch (opcode)
+   {
+      case SEQ : case SGE : case SGT : case SLE : case SLT : case SNE :
+         if (cp->pswIndex < 0)
+            return;
+         a = getValue(cp, getReachingValue(cp->du, node, cp->pswIndex));
+         if (a.state != CP_CONSTANT) {
+            result->state = flags->state = a.state;
+            return;
+         }
+         r = testCondition(opcode, a.value);
+         setConstant(result, r);
+         setConstant(flags, computeFlags(r, 0, 0));
+         return;
+      case NOTL : case NOTB :
+         a = getOperand(cp, node, instr->reg_2);
+         if (a.state != CP_CONSTANT) {
+            result->state = flags->state = a.state;
+            return;
+         }
+         r = opcode == NOTL ? !a.value : ~a.value;
+         setConstant(result, r);
+         setConstant(flags, computeFlags(r, 0, 0));
+         return;
+   }
+
+   if (isImmediateArgumentInstrOpcode(opcode)) {
+      a = getOperand(cp, node, instr->reg_2);
+      setConstant(&b, instr->immediate);
+      opcode = switchOpcodeImmediateForm(opcode);
+   } else if (opcode >= ADD && opcode <= NEG) {
+      a = getOperand(cp, node, instr->reg_2);
+      b = getOperand(cp, node, instr->reg_3);
+   } else
+      return;
+
+   /* operations whose result does not depend on the other operand */
+   if (((opcode == MUL || opcode == ANDB || opcode == ANDL)
+            && (isConstant(a, 0) || isConstant(b, 0)))
+         || (opcode == ORL && ((a.state == CP_CONSTANT && a.value != 0)
+            || (b.state == CP_CONSTANT && b.value != 0))))
+   {
+      r = opcode == ORL;
+      setConstant(result, r);
+      /* the flags set by the multiplication depend on the target */
+      if (opcode != MUL)
+         setConstant(flags, computeFlags(r, 0, 0));
+      return;
+   }
+
+   if (a.state == CP_VARYING || b.state == CP_VARYING)
+      return;
+   if (a.state == CP_UNDEFINED || b.state == CP_UNDEFINED) {
+      result->state = flags->state = CP_UNDEFINED;
+      return;
+   }
+
+   overflow = carry = 0;
+   switch (opcode)
+   {
+      case ADD :
+         r = (int)((unsigned)a.value + (unsigned)b.value);
+         overflow = (r >= 0) != (a.value >= 0)
+               && (a.value >= 0) == (b.value >= 0);
+         carry = MSB(r) < MSB(a.value) + MSB(b.value);
+         break;
+      case NEG :
+         a.value = 0;
+         /* fall through */
+      case SUB :
+         r = (int)((unsigned)a.value - (unsigned)b.value);
+         overflow = (r >= 0) != (a.value >= 0)
+               && (a.value >= 0) != (b.value >= 0);
+         carry = (int)MSB(r) > (int)MSB(a.value) - (int)MSB(b.value);
+         break;
+      case ANDL : r = a.value && b.value; break;
+      case ORL : r = a.value || b.value; break;
+      case EORL : r = !a.value != !b.value; break;
+      case ANDB : r = a.value & b.value; break;
+      case ORB : r = a.value | b.value; break;
+      case EORB : r = a.value ^ b.value; break;
+      case MUL :
+         product = (long long)a.value * (long long)b.value;
+         overflow = product < INT_MIN || product > INT_MAX;
+         r = (int)(unsigned)(product & UINT_MAX);
+         break;
+      case DIV :
+         /* the division by zero is left to the program */
+         if (b.value == 0)
+            return;
+         if (a.value == INT_MIN && b.value == -1) {
+            r = INT_MIN;
+            overflow = 1;
+         } else
+            r = a.value / b.value;
+         break;
+      case SHL :
+         if (b.value < 0 || b.value > 31)
+            return;
+         r = (int)((unsigned)a.value << b.value);
+         carry = b.value > 0 && (((unsigned)a.value >> (32 - b.value)) & 1);
+         break;
+      case SHR :
+         if (b.value < 0 || b.value > 31)
+            return;
+         r = a.value < 0 ? ~(~a.value >> b.value) : a.value >> b.value;
+         carry = b.value > 0 && ((a.value >> (b.value - 1)) & 1);
+         break;
+      default :
+         return;
+   }
+
+   setConstant(result, r);
+   /* the flags set by the multiplication, the division and the shifts
+    * are not the same on every target */
+   if (opcode != MUL && opcode != DIV && opcode != SHL && opcode != SHR)
+      setConstant(flags, computeFlags(r, overflow, carry));
+}
+
+/* Returns 1 if the branch at the end of the block number `block' is always
+ * taken, 0 if it is never taken, -1 if it is not known or there is no
+ * branch, CP_BRANCH_UNDEFINED if the flags it tests have not been computed
+ * yet */
+int evaluateBranch(t_const_prop *cp, int block)
+{
+   t_axe_instruction *instr;
+   t_cp_value flags;
+   int last;
+
+   last = cp->du->firstNode[block + 1] - 1;
+   if (cp->du->nodes[last].node == NULL)
+      return -1;
+   instr = cp->du->nodes[last].node->instr;
+   if (!isJumpInstruction(instr))
+      return -1;
+   if (isUnconditionalJump(instr))
+      return testCondition(instr->opcode, 0);
+   if (cp->pswIndex < 0)
+      return -1;
+   flags = getValue(cp, getReachingValue(cp->du, last, cp->pswIndex));
+   if (flags.state == CP_UNDEFINED)
+      return CP_BRANCH_UNDEFINED;
+   if (flags.state != CP_CONSTANT)
+      return -1;
+   return testCondition(instr->opcode, flags.value);
+}
+
+/* Returns non-zero if `succ' is executed after the block number `block',
+ * given the outcome of the branch at the end of the block */
+int isFeasibleSuccessor(t_const_prop *cp, int block
+      , t_basic_block *succ, int outcome)
+{
+   t_basic_block *fallThrough;
+
+   if (outcome < 0)
+      return 1;
+   if (outcome > 0)
+      return succ == cp->targets[block];
+   fallThrough = block + 1 < cp->du->numBlocks
+         ? cp->du->blocks[block + 1] : NULL;
+   return succ == fallThrough;
+}
+
+/* At the beginning of the program the scalar variables hold their initial
+ * value; nothing is known about the other registers. The values computed
+ * by the code are not known to be reached yet. */
+void initializeValues(t_const_prop *cp)
+{
+   t_def_use *du = cp->du;
+   t_list *current_element;
+   t_axe_variable *variable;
+   t_cflow_var *var;
+   int location, sy_errorcode;
+   int i;
+
+   cp->values = calloc(du->numValues + 1, sizeof(t_cp_value));
+   if (cp->values == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < du->numVars; i++)
+      cp->values[du->entryBase + i].state = CP_VARYING;
+
+   current_element = cp->program->variables;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      variable = (t_axe_variable *) LDATA(current_element);
+      if (variable->isArray)
+         continue;
+
+      location = getLocation(cp->program->sy_table, variable->ID
+            , &sy_errorcode);
+      if (location == SY_LOCATION_UNSPECIFIED)
+         continue;
+      var = getCflowVariable(cp->graph, location);
+      if (var != NULL && var->index < du->numVars)
+         setConstant(&cp->values[du->entryBase + var->index]
+               , variable->init_val);
+   }
+}
+
+/* Lowers the value number `value' to `newValue', and schedules a new
+ * visit of its users if it changed */
+void setValue(t_const_prop *cp, int value, t_cp_value newValue)
+{
+   t_cp_value *old = &cp->values[value];
+
+   if (old->state == CP_VARYING || newValue.state == CP_UNDEFINED)
+      return;
+   if (old->state == CP_CONSTANT) {
+      if (newValue.state == CP_CONSTANT && newValue.value == old->value)
+         return;
+      old->state = CP_VARYING;
+   } else
+      *old = newValue;
+
+   if (!cp->queuedValues[value]) {
+      cp->queuedValues[value] = 1;
+      cp->pendingValues[cp->numPendingValues++] = value;
+   }
+}
+
+void visitNode(t_const_prop *cp, int node)
+{
+   t_cp_value result, flags;
+
+   evaluateInstruction(cp, node, &result, &flags);
+   setValue(cp, DU_RESULT_VALUE(node), result);
+   setValue(cp, DU_FLAGS_VALUE(node), flags);
+}
+
+/* The value of a phi is the meet of the values coming from the edges which
+ * can be followed */
+void visitPhi(t_const_prop *cp, int phi)
+{
+   t_def_use *du = cp->du;
+   int block = du->phis[phi].block;
+   t_cp_value result, arg;
+   int slot;
+
+   result.state = CP_UNDEFINED;
+   result.value = 0;
+   for (slot = 0; slot < DU_NUM_IN_EDGES(du, block); slot++)
+   {
+      if (!cp->executable[du->inEdges[du->firstInEdge[block] + slot]])
+         continue;
+
+      arg = getValue(cp, du->phiArgs[du->phis[phi].firstArg + slot]);
+      if (arg.state == CP_UNDEFINED || result.state == CP_VARYING)
+         continue;
+      if (result.state == CP_UNDEFINED)
+         result = arg;
+      else if (arg.state == CP_VARYING || arg.value != result.value)
+         result.state = CP_VARYING;
+   }
+   setValue(cp, du->phiBase + phi, result);
+}
+
+/* Schedule the edges leaving the block number `block' which can be
+ * followed, given what is known about its branch */
+void addFeasibleEdges(t_const_prop *cp, int block)
+{
+   t_def_use *du = cp->du;
+   int outcome, e;
+
+   outcome = evaluateBranch(cp, block);
+   if (outcome == CP_BRANCH_UNDEFINED)
+      return;
+
+   for (e = du->firstOutEdge[block]; e < du->firstOutEdge[block + 1]; e++)
+   {
+      if (cp->executable[e] || !isFeasibleSuccessor(cp, block
+            , du->blocks[du->edgeTo[e]], outcome))
+         continue;
+      cp->executable[e] = 1;
+      cp->pendingEdges[cp->numPendingEdges++] = e;
+   }
+}
+
+/*
+ * Compute the values starting from the beginning of the program. An edge
+ * of the graph is followed only when the branch at its source can take it,
+ * and the instructions of a block are evaluated only when an edge reaching
+ * it is followed. When a value changes, only the phis and the instructions
+ * which read it are evaluated again.
+ */
+void propagate(t_const_prop *cp)
+{
+   t_def_use *du = cp->du;
+   int block, value, i, j, k;
+
+   cp->pendingValues = malloc(sizeof(int) * (du->numValues + 1));
+   cp->queuedValues = calloc(du->numValues + 1, sizeof(int));
+   cp->pendingEdges = malloc(sizeof(int) * (du->numEdges + 1));
+   cp->executable = calloc(du->numEdges + 1, sizeof(int));
+   cp->executed = calloc(du->numBlocks + 1, sizeof(int));
+   if (cp->pendingValues == NULL || cp->queuedValues == NULL
+         || cp->pendingEdges == NULL || cp->executable == NULL
+         || cp->executed == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   cp->numPendingValues = 0;
+   cp->executable[0] = 1;
+   cp->pendingEdges[0] = 0;
+   cp->numPendingEdges = 1;
+
+   while (cp->numPendingEdges > 0 || cp->numPendingValues > 0)
+   {
+      if (cp->numPendingEdges > 0)
+      {
+         block = du->edgeTo[cp->pendingEdges[--cp->numPendingEdges]];
+         for (j = du->firstPhi[block]; j < du->firstPhi[block + 1]; j++)
+            visitPhi(cp, j);
+         if (cp->executed[block])
+            continue;
+
+         cp->executed[block] = 1;
+         for (k = du->firstNode[block]; k < du->firstNode[block + 1]; k++)
+            visitNode(cp, k);
+         addFeasibleEdges(cp, block);
+         continue;
+      }
+
+      value = cp->pendingValues[--cp->numPendingValues];
+      cp->queuedValues[value] = 0;
+      for (i = du->firstUser[value]; i < du->firstUser[value + 1]; i++)
+      {
+         k = du->users[i];
+         if (k < 0) {
+            if (cp->executed[du->phis[-k - 1].block])
+               visitPhi(cp, -k - 1);
+            continue;
+         }
+
+         block = du->nodes[k].block;
+         if (!cp->executed[block])
+            continue;
+         visitNode(cp, k);
+         if (k == du->firstNode[block + 1] - 1)
+            addFeasibleEdges(cp, block);
+      }
+   }
+
+   free(cp->pendingEdges);
+   free(cp->queuedValues);
+   free(cp->pendingValues);
+}
+
+/* Replaces the source registers of `node' whose value is known with an
+ * immediate. Returns non-zero if the instruction has been changed. */
+int foldOperands(t_const_prop *cp, int node)
+{
+   t_axe_instruction *instr = cp->du->nodes[node].node->instr;
+   t_cp_value a, b;
+   t_axe_register *reg;
+
+   if (!(instr->opcode >= ADD && instr->opcode <= ROTR)
+         || instr->opcode == NEG || instr->opcode == SPCL
+         || instr->opcode == ROTL || instr->opcode == ROTR)
+      return 0;
+   if (instr->reg_1 == NULL || instr->reg_1->indirect
+         || instr->reg_1->mcRegWhitelist != NULL)
+      return 0;
+
+   a = getOperand(cp, node, instr->reg_2);
+   b = getOperand(cp, node, instr->reg_3);
+
+   /* the first operand of a commutative operation can be swapped with the
+    * second one */
+   if (b.state != CP_CONSTANT && a.state == CP_CONSTANT
+         && instr->reg_2->ID != REG_0 && !instr->reg_3->indirect)
+   {
+      switch (instr->opcode)
+      {
+         case ADD : case MUL : case ANDL : case ORL : case EORL :
+         case ANDB : case ORB : case EORB :
+            reg = instr->reg_2;
+            instr->reg_2 = instr->reg_3;
+            instr->reg_3 = reg;
+            b = a;
+            break;
+      }
+   }
+
+   if (b.state != CP_CONSTANT)
+      return 0;
+   if (instr->opcode == DIV && b.value == 0)
+      return 0;
+   if ((instr->opcode == SHL || instr->opcode == SHR)
+         && (b.value < 0 || b.value > 31))
+      return 0;
+
+   instr->opcode = switchOpcodeImmediateForm(instr->opcode);
+   instr->immediate = b.value;
+   instr->reg_3 = NULL;
+   updateNodeDefUses(cp->graph, cp->du->nodes[node].node);
+   checkCflowError();
+   return 1;
+}
+
+/* Replaces the branch at the end of the block number `block' with an
+ * unconditional jump, or removes it, if its outcome is known. The edge
+ * which is never followed is removed. Returns non-zero if the branch has
+ * been changed. */
+int resolveBranch(t_const_prop *cp, int block)
+{
+   t_def_use *du = cp->du;
+   t_basic_block *target, *fallThrough;
+   t_cflow_Node *last;
+   int outcome;
+
+   outcome = evaluateBranch(cp, block);
+   last = du->nodes[du->firstNode[block + 1] - 1].node;
+   if (outcome < 0 || last->instr->opcode == BT)
+      return 0;
+
+   target = cp->targets[block];
+   fallThrough = block + 1 < du->numBlocks
+         ? du->blocks[block + 1] : cp->graph->endingBlock;
+   if (target != fallThrough)
+      removeEdge(du->blocks[block], outcome ? fallThrough : target);
+
+   if (outcome) {
+      last->instr->opcode = BT;
+      updateNodeDefUses(cp->graph, last);
+      checkCflowError();
+   } else
+      removeNode(cp, du->firstNode[block + 1] - 1);
+   return 1;
+}
+
+void removeNode(t_const_prop *cp, int node)
+{
+   t_du_node *dnode = &cp->du->nodes[node];
+
+   removeNodeFromBlock(cp->du->blocks[dnode->block], dnode->node);
+   checkCflowError();
+   dnode->node = NULL;
+}
+
+/* Adds `delta' to the number of uses of the values read by `node' */
+void countUses(t_const_prop *cp, int node, int delta)
+{
+   t_cflow_Node *cnode = cp->du->nodes[node].node;
+   int i, value;
+
+   for (i = 0; i < CFLOW_MAX_USES; i++)
+   {
+      if (cnode->uses[i] == NULL)
+         continue;
+      value = getReachingValue(cp->du, node, cnode->uses[i]->index);
+      if (value != DU_NO_VALUE)
+         cp->uses[value] += delta;
+   }
+}
+
+/* Count the uses of each value by the instructions left in the code, and
+ * by the phis whose value is used */
+void countAllUses(t_const_prop *cp)
+{
+   t_def_use *du = cp->du;
+   int *livePhis, *worklist;
+   int numPending, block, slot, value, j, k;
+
+   cp->uses = calloc(du->numValues + 1, sizeof(int));
+   livePhis = calloc(du->numPhis + 1, sizeof(int));
+   worklist = malloc(sizeof(int) * (du->numPhis + 1));
+   if (cp->uses == NULL || livePhis == NULL || worklist == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (k = 0; k < du->numNodes; k++) {
+      if (du->nodes[k].node != NULL && cp->executed[du->nodes[k].block])
+         countUses(cp, k, 1);
+   }
+
+   numPending = 0;
+   for (j = 0; j < du->numPhis; j++) {
+      if (cp->executed[du->phis[j].block] && cp->uses[du->phiBase + j] > 0) {
+         livePhis[j] = 1;
+         worklist[numPending++] = j;
+      }
+   }
+   while (numPending > 0)
+   {
+      j = worklist[--numPending];
+      block = du->phis[j].block;
+      for (slot = 0; slot < DU_NUM_IN_EDGES(du, block); slot++)
+      {
+         if (!cp->executable[du->inEdges[du->firstInEdge[block] + slot]])
+            continue;
+
+         value = du->phiArgs[du->phis[j].firstArg + slot];
+         cp->uses[value]++;
+         if (value >= du->phiBase && !livePhis[value - du->phiBase]) {
+            livePhis[value - du->phiBase] = 1;
+            worklist[numPending++] = value - du->phiBase;
+         }
+      }
+   }
+
+   free(worklist);
+   free(livePhis);
+}
+
+/*
+ * Replaces the instructions of the block number `block' whose result is
+ * known with a constant load, and removes them when their result is not
+ * used. The flags set by a constant load depend only on the constant: the
+ * instruction is replaced only if the flags it sets are not used, or are
+ * the same.
+ */
+void replaceConstantDefinitions(t_const_prop *cp, int block
+      , int *folded, int *removed)
+{
+   t_def_use *du = cp->du;
+   t_cp_value result, flags;
+   int k, destLive, flagsLive, sameFlags;
+
+   for (k = du->firstNode[block + 1] - 1; k >= du->firstNode[block]; k--)
+   {
+      t_cflow_Node *node = du->nodes[k].node;
+      t_axe_instruction *instr;
+
+      if (node == NULL)
+         continue;
+      instr = node->instr;
+      result = cp->values[DU_RESULT_VALUE(k)];
+      flags = cp->values[DU_FLAGS_VALUE(k)];
+
+      if (result.state != CP_CONSTANT || node->defs[0] == NULL
+            || instr->reg_1 == NULL || instr->reg_1->indirect
+            || instr->reg_1->ID == REG_0
+            || instr->reg_1->mcRegWhitelist != NULL)
+         continue;
+
+      /* every instruction with a known result also sets the flags */
+      destLive = cp->uses[DU_RESULT_VALUE(k)] > 0;
+      flagsLive = cp->uses[DU_FLAGS_VALUE(k)] > 0;
+      sameFlags = flags.state == CP_CONSTANT
+            && !(flags.value & (CP_FLAG_V | CP_FLAG_C));
+
+      if (!destLive && !flagsLive) {
+         countUses(cp, k, -1);
+         removeNode(cp, k);
+         (*removed)++;
+         continue;
+      }
+
+      if ((!flagsLive || sameFlags) && !(instr->opcode == ADDI
+            && instr->reg_2->ID == REG_0 && !instr->reg_2->indirect
+            && instr->immediate == result.value))
+      {
+         countUses(cp, k, -1);
+         instr->opcode = ADDI;
+         if (instr->reg_2 == NULL)
+            instr->reg_2 = alloc_register(cp->program->arena
+                  , REG_0, INFERRED_TYPE, 0);
+         if (instr->reg_2 == NULL)
+            notifyError(AXE_OUT_OF_MEMORY);
+         instr->reg_2->ID = REG_0;
+         instr->reg_2->indirect = 0;
+         instr->reg_3 = NULL;
+         instr->address = NULL;
+         instr->immediate = result.value;
+         updateNodeDefUses(cp->graph, node);
+         checkCflowError();
+         (*folded)++;
+      }
+   }
+}
+
+void propagateConstants(t_program_infos *program, t_cflow_Graph *graph)
+{
+   t_const_prop cp;
+   t_def_use *du;
+   t_axe_instruction *last;
+   t_list *current_element;
+   int foldedOperands, resolved, removedBlocks, folded, removed;
+   int i, k, prev;
+
+   assert(program != NULL);
+   assert(graph != NULL);
+
+   /* connect each use to the definitions reaching it */
+   du = buildDefUseChains(graph);
+   cp.program = program;
+   cp.graph = graph;
+   cp.du = du;
+   cp.targets = calloc(du->numBlocks + 1, sizeof(t_basic_block *));
+   if (cp.targets == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   cp.pswIndex = -1;
+   for (i = 0; i < graph->numVariables; i++) {
+      if (graph->variables[i]->ID == VAR_PSW)
+         cp.pswIndex = i;
+   }
+
+   /* find the destination of the branches */
+   for (i = 0; i < du->numBlocks; i++)
+   {
+      last = ((t_cflow_Node *) LDATA(du->blocks[i]->lastNode))->instr;
+      if (!isJumpInstruction(last))
+         continue;
+      current_element = du->blocks[i]->succ;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *succ = (t_basic_block *) LDATA(current_element);
+         t_axe_instruction *first;
+
+         if (succ->nodes == NULL)
+            continue;
+         first = ((t_cflow_Node *) LDATA(succ->nodes))->instr;
+         if (first->labelID != NULL
+               && compareLabels(first->labelID, last->address->labelID))
+            cp.targets[i] = succ;
+      }
+   }
+
+   initializeValues(&cp);
+   propagate(&cp);
+
+   /* rewrite the instructions of the blocks which can be executed */
+   foldedOperands = resolved = 0;
+   for (k = 0; k < du->numNodes; k++) {
+      if (cp.executed[du->nodes[k].block])
+         foldedOperands += foldOperands(&cp, k);
+   }
+   for (i = 0; i < du->numBlocks; i++) {
+      if (cp.executed[i])
+         resolved += resolveBranch(&cp, i);
+   }
+
+   /* remove the code which is never executed */
+   removedBlocks = 0;
+   for (i = 0; i < du->numBlocks; i++)
+   {
+      if (cp.executed[i])
+         continue;
+      removeBlock(graph, du->blocks[i]);
+      checkCflowError();
+      removedBlocks++;
+   }
+
+   /* remove the jumps to the block that follows, which were jumping
+    * over the code which has been removed */
+   removed = 0;
+   prev = -1;
+   for (i = 0; i < du->numBlocks; i++)
+   {
+      if (!cp.executed[i])
+         continue;
+      k = prev >= 0 ? du->firstNode[prev + 1] - 1 : -1;
+      if (k >= 0 && cp.targets[prev] == du->blocks[i]
+            && du->nodes[k].node != NULL
+            && du->nodes[k].node->instr->opcode == BT)
+      {
+         removeNode(&cp, k);
+         removed++;
+      }
+      prev = i;
+   }
+
+   /* visit the code backwards, so that the instructions whose result was
+    * used only by a removed one are removed too */
+   countAllUses(&cp);
+   folded = 0;
+   for (i = du->numBlocks - 1; i >= 0; i--)
+   {
+      if (cp.executed[i])
+         replaceConstantDefinitions(&cp, i, &folded, &removed);
+   }
+
+   free(cp.uses);
+   free(cp.executed);
+   free(cp.executable);
+   free(cp.values);
+   free(cp.targets);
+   freeDefUseChains(du);
+
+   setStatistic("constprop.folded_operands", foldedOperands);
+   setStatistic("constprop.folded_instructions", folded);
+   setStatistic("constprop.removed_instructions", removed);
+   setStatistic("constprop.resolved_branches", resolved);
+   setStatistic("constprop.removed_blocks", removedBlocks);
+}
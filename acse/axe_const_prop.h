@@ -0,0 +1,33 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_const_prop.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Sparse conditional constant propagation, performed on the control flow
+ * graph of the code produced by the frontend, before the target
+ * transformations. Each use of a register or of the flags is connected to
+ * the definition reaching it, placing phis at the dominance frontiers as
+ * in the SSA form; the values are then propagated along these def-use
+ * chains, and along the edges of the graph which can be followed: a branch
+ * whose condition is known makes the other successor unreachable, unless
+ * it is reached in another way. The operands whose value is known are
+ * folded into immediates, the instructions whose result is known become
+ * constant loads or are removed when their result is unused, the branches
+ * whose condition is known are resolved and the code which is never
+ * executed is removed.
+ */
+
+#ifndef _AXE_CONST_PROP_H
+#define _AXE_CONST_PROP_H
+
+#include "axe_engine.h"
+#include "axe_cflow_graph.h"
+
+/* Propagate the constants in `graph', which is the control flow graph of
+ * the code of `program'. The scalar variables are assumed to hold their
+ * initial value at the beginning of the program. The dominators and the
+ * liveness informations of `graph' are not valid after the call. */
+extern void propagateConstants(t_program_infos *program, t_cflow_Graph *graph);
+
+#endif
@@ -0,0 +1,505 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_cse.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "axe_cse.h"
+#include "axe_arena.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+
+/* what an expression of the table computes */
+#define CSE_RESULT 0    /* the value written to the destination register */
+#define CSE_FLAGS 1     /* the value of the flags after the instruction */
+
+/* the operands of the expressions which are not used */
+#define CSE_NO_OPERAND -1
+
+/* An expression computed by an instruction. The register operands are
+ * identified by their value number: two expressions with the same key
+ * compute the same value. */
+typedef struct t_cse_expr
+{
+   int kind;            /* CSE_RESULT or CSE_FLAGS */
+   int opcode;
+   int operands[2];     /* the value numbers of the register operands,
+                         * times two, plus one for the operands read from
+                         * memory; CSE_NO_OPERAND if not used */
+   int immediate;
+   int addressType;     /* for MOVA and LOAD, the type of the address */
+   int address;         /* the label identifier or the address */
+   int memory;          /* the version of the memory, for the expressions
+                         * which read it; CSE_NO_OPERAND otherwise */
+   int value;           /* the value number of the expression */
+}t_cse_expr;
+
+typedef struct t_cse
+{
+   t_ssa_form *ssa;
+   t_cflow_Graph *graph;
+   t_arena *arena;         /* the memory of the expressions */
+   t_hashmap *table;       /* the expressions computed in the current block
+                            * (the keys and the values are the same
+                            * t_cse_expr) */
+   int numRegisters;
+   int *values;            /* the value number of each register in the
+                            * current block; zero if not yet known */
+   int *replacements;      /* for each register whose definition has been
+                            * removed, the register which holds its value;
+                            * REG_INVALID for the others */
+   int *holders;           /* for each value number, a register in SSA
+                            * form which holds it, or REG_INVALID */
+   int numValues;
+   int maxValues;          /* number of elements of `holders' */
+   int flags;              /* the value number of the flags */
+   int memory;             /* the version of the memory, incremented by
+                            * each store */
+}t_cse;
+
+static unsigned int hashExpression(void *key);
+static int compareExpressions(void *keyA, void *keyB);
+static int newValue(t_cse *cse);
+static int resolveRegister(t_cse *cse, int ID);
+static int getRegisterValue(t_cse *cse, int ID);
+static int getOperand(t_cse *cse, t_axe_register *reg);
+static t_axe_register *getCopySource(t_axe_instruction *instr);
+static int isConstantLoad(t_axe_instruction *instr);
+static int writesMemory(t_axe_instruction *instr);
+static int buildExpression(t_cse *cse, t_axe_instruction *instr, int kind
+      , t_cse_expr *expr);
+static int lookupExpression(t_cse *cse, t_cse_expr *expr, int *found);
+static int *computeFlagsLiveness(t_cse *cse, t_basic_block *block);
+static int numberBlock(t_cse *cse, t_basic_block *block);
+static void replaceRegisters(t_cse *cse);
+
+
+unsigned int hashExpression(void *key)
+{
+   t_cse_expr *expr = (t_cse_expr *) key;
+   unsigned int hash;
+
+   hash = (unsigned int)expr->kind * 31 + (unsigned int)expr->opcode;
+   hash = hash * 31 + (unsigned int)expr->operands[0];
+   hash = hash * 31 + (unsigned int)expr->operands[1];
+   hash = hash * 31 + (unsigned int)expr->immediate;
+   hash = hash * 31 + (unsigned int)expr->address;
+   hash = hash * 31 + (unsigned int)expr->memory;
+   return hash;
+}
+
+int compareExpressions(void *keyA, void *keyB)
+{
+   t_cse_expr *a = (t_cse_expr *) keyA;
+   t_cse_expr *b = (t_cse_expr *) keyB;
+
+   return a->kind == b->kind && a->opcode == b->opcode
+         && a->operands[0] == b->operands[0]
+         && a->operands[1] == b->operands[1]
+         && a->immediate == b->immediate
+         && a->addressType == b->addressType && a->address == b->address
+         && a->memory == b->memory;
+}
+
+/* Returns a new value number, held by no register */
+int newValue(t_cse *cse)
+{
+   if (cse->numValues + 1 >= cse->maxValues)
+   {
+      cse->maxValues = cse->maxValues * 2 + 16;
+      cse->holders = realloc(cse->holders, sizeof(int) * cse->maxValues);
+      if (cse->holders == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+   }
+   cse->numValues++;
+   cse->holders[cse->numValues] = REG_INVALID;
+   return cse->numValues;
+}
+
+/* Returns the register which replaces the register `ID' */
+int resolveRegister(t_cse *cse, int ID)
+{
+   while (ID >= 0 && ID < cse->numRegisters
+         && cse->replacements[ID] != REG_INVALID)
+      ID = cse->replacements[ID];
+   return ID;
+}
+
+/* Returns the value number of the register `ID' in the current block */
+int getRegisterValue(t_cse *cse, int ID)
+{
+   ID = resolveRegister(cse, ID);
+   if (ID < 0 || ID >= cse->numRegisters)
+      return newValue(cse);
+   if (cse->values[ID] == 0)
+      cse->values[ID] = newValue(cse);
+   return cse->values[ID];
+}
+
+int getOperand(t_cse *cse, t_axe_register *reg)
+{
+   if (reg == NULL)
+      return CSE_NO_OPERAND;
+   return getRegisterValue(cse, reg->ID) * 2 + (reg->indirect ? 1 : 0);
+}
+
+/* Returns the register copied by `instr', or NULL if `instr' is not a copy
+ * between two registers */
+t_axe_register *getCopySource(t_axe_instruction *instr)
+{
+   t_axe_register *source;
+
+   if ((instr->opcode == ADDI || instr->opcode == SUBI)
+         && instr->immediate == 0)
+      source = instr->reg_2;
+   else if (instr->opcode == ADD && instr->reg_2->ID == REG_0)
+      source = instr->reg_3;
+   else if (instr->opcode == ADD && instr->reg_3->ID == REG_0)
+      source = instr->reg_2;
+   else
+      return NULL;
+
+   if (source->indirect || instr->reg_2->indirect
+         || (instr->reg_3 != NULL && instr->reg_3->indirect))
+      return NULL;
+   return source;
+}
+
+/* Returns non-zero if `instr' loads a constant in a register. The constants
+ * are not worth keeping in a register for longer. */
+int isConstantLoad(t_axe_instruction *instr)
+{
+   return isImmediateArgumentInstrOpcode(instr->opcode)
+         && instr->reg_2->ID == REG_0 && !instr->reg_2->indirect;
+}
+
+/* Returns non-zero if `instr' may modify the memory */
+int writesMemory(t_axe_instruction *instr)
+{
+   if (instr->opcode == STORE || instr->opcode == JSR)
+      return 1;
+   return instr->reg_1 != NULL && instr->reg_1->indirect
+         && instr->opcode != AXE_WRITE;
+}
+
+/*
+ * Fill `expr' with the expression computed by `instr': its result if `kind'
+ * is CSE_RESULT, or the value of the flags if `kind' is CSE_FLAGS. Returns
+ * zero if the value cannot be described by an expression (e.g. a value
+ * read from the input).
+ */
+int buildExpression(t_cse *cse, t_axe_instruction *instr, int kind
+      , t_cse_expr *expr)
+{
+   int opcode = instr->opcode;
+   int swap;
+
+   memset(expr, 0, sizeof(t_cse_expr));
+   expr->kind = kind;
+   expr->opcode = opcode;
+   expr->operands[0] = expr->operands[1] = CSE_NO_OPERAND;
+   expr->memory = CSE_NO_OPERAND;
+
+   switch (opcode)
+   {
+      case LOAD :
+         /* a load is a MOVA which also depends on the memory */
+         expr->memory = cse->memory;
+         /* fall through */
+      case MOVA :
+         if (kind != CSE_RESULT || instr->address == NULL)
+            return 0;
+         expr->addressType = instr->address->type;
+         if (instr->address->type == LABEL_TYPE)
+            expr->address = (int)instr->address->labelID->labelID;
+         else
+            expr->address = instr->address->addr;
+         return 1;
+      case SEQ : case SGE : case SGT : case SLE : case SLT : case SNE :
+         expr->operands[0] = cse->flags;
+         return 1;
+   }
+
+   if (isImmediateArgumentInstrOpcode(opcode) || opcode == NOTL
+         || opcode == NOTB)
+   {
+      expr->operands[0] = getOperand(cse, instr->reg_2);
+      expr->immediate = instr->immediate;
+   }
+   else if (opcode >= ADD && opcode <= NEG)
+   {
+      expr->operands[0] = getOperand(cse, instr->reg_2);
+      expr->operands[1] = getOperand(cse, instr->reg_3);
+      switch (opcode)
+      {
+         case ADD : case MUL : case ANDL : case ORL : case EORL :
+         case ANDB : case ORB : case EORB :
+            swap = expr->operands[0];
+            if (swap > expr->operands[1]) {
+               expr->operands[0] = expr->operands[1];
+               expr->operands[1] = swap;
+            }
+            break;
+      }
+   }
+   else
+      return 0;
+
+   if ((expr->operands[0] != CSE_NO_OPERAND && (expr->operands[0] & 1))
+         || (expr->operands[1] != CSE_NO_OPERAND && (expr->operands[1] & 1)))
+      expr->memory = cse->memory;
+   return 1;
+}
+
+/* Returns the value number of `expr', adding it to the table if it has not
+ * been computed yet. `*found' is set to non-zero if it has. */
+int lookupExpression(t_cse *cse, t_cse_expr *expr, int *found)
+{
+   t_cse_expr *stored;
+
+   stored = (t_cse_expr *) lookupHashMap(cse->table, expr);
+   *found = stored != NULL;
+   if (stored != NULL)
+      return stored->value;
+
+   stored = arenaAlloc(cse->arena, sizeof(t_cse_expr));
+   if (stored == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   *stored = *expr;
+   stored->value = newValue(cse);
+   putInHashMap(cse->table, stored, stored);
+   return stored->value;
+}
+
+/* Returns, for each node of `block', non-zero if the flags are live after
+ * the node */
+int *computeFlagsLiveness(t_cse *cse, t_basic_block *block)
+{
+   t_list *current_element;
+   int *flagsLive;
+   int i, j, live;
+
+   flagsLive = malloc(sizeof(int) * (getLength(block->nodes) + 1));
+   if (flagsLive == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   live = 0;
+   for (i = 0; block->liveOut != NULL && i < cse->graph->numVariables; i++)
+   {
+      if (cse->graph->variables[i]->ID == VAR_PSW)
+         live = isInBitset(block->liveOut, i);
+   }
+
+   i = getLength(block->nodes);
+   current_element = getLastElement(block->nodes);
+   for (; current_element != NULL; current_element = LPREV(current_element))
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+      flagsLive[--i] = live;
+      for (j = 0; j < CFLOW_MAX_DEFS; j++) {
+         if (node->defs[j] != NULL && node->defs[j]->ID == VAR_PSW)
+            live = 0;
+      }
+      for (j = 0; j < CFLOW_MAX_USES; j++) {
+         if (node->uses[j] != NULL && node->uses[j]->ID == VAR_PSW)
+            live = 1;
+      }
+   }
+   return flagsLive;
+}
+
+/*
+ * Number the values computed by the instructions of `block', and remove
+ * the instructions whose result is already held by a register. An
+ * instruction whose flags are used is kept: its result becomes unused, and
+ * the instruction is removed by the next call if the users of the flags are
+ * removed too. Returns the number of removed instructions.
+ */
+int numberBlock(t_cse *cse, t_basic_block *block)
+{
+   t_list *current_element, *next_element;
+   t_cse_expr expr;
+   t_axe_register *dest, *source;
+   t_ssa_def *def;
+   int *flagsLive;
+   int i, value, found, removed;
+
+   /* the values of the registers are known only inside the block */
+   memset(cse->values, 0, sizeof(int) * cse->numRegisters);
+   clearHashMap(cse->table);
+   cse->numValues = 0;
+   cse->memory = 0;
+   cse->flags = newValue(cse);
+
+   flagsLive = computeFlagsLiveness(cse, block);
+   removed = 0;
+   i = 0;
+   current_element = block->nodes;
+   for (; current_element != NULL; current_element = next_element, i++)
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+      t_axe_instruction *instr = node->instr;
+
+      next_element = LNEXT(current_element);
+
+      dest = NULL;
+      value = 0;
+      if (node->defs[0] != NULL && node->defs[0]->ID != REG_0)
+      {
+         dest = instr->reg_1;
+         source = getCopySource(instr);
+         if (source != NULL)
+            value = getRegisterValue(cse, source->ID);
+         else if (buildExpression(cse, instr, CSE_RESULT, &expr))
+         {
+            value = lookupExpression(cse, &expr, &found);
+            def = getSSADefinition(cse->ssa, dest->ID);
+
+            /* the value is already held by a register in SSA form */
+            if (found && cse->holders[value] != REG_INVALID
+                  && def != NULL && dest->mcRegWhitelist == NULL
+                  && !isConstantLoad(instr) && !flagsLive[i])
+            {
+               cse->replacements[dest->ID] = cse->holders[value];
+               def->block = NULL;
+               def->node = NULL;
+               removeNodeFromBlock(block, node);
+               if (cflow_errorcode != CFLOW_OK)
+                  notifyError(AXE_INVALID_CFLOW_GRAPH);
+               removed++;
+               continue;
+            }
+         }
+         else
+            value = newValue(cse);
+      }
+
+      if (node->defs[1] != NULL && node->defs[1]->ID == VAR_PSW)
+      {
+         if (buildExpression(cse, instr, CSE_FLAGS, &expr))
+            cse->flags = lookupExpression(cse, &expr, &found);
+         else
+            cse->flags = newValue(cse);
+      }
+      if (writesMemory(instr))
+         cse->memory++;
+
+      if (dest != NULL && dest->ID >= 0 && dest->ID < cse->numRegisters)
+      {
+         cse->values[dest->ID] = value;
+         if (cse->holders[value] == REG_INVALID
+               && getSSADefinition(cse->ssa, dest->ID) != NULL
+               && dest->mcRegWhitelist == NULL)
+            cse->holders[value] = dest->ID;
+      }
+   }
+
+   free(flagsLive);
+   return removed;
+}
+
+/* Rewrite the uses of the registers whose definition has been removed */
+void replaceRegisters(t_cse *cse)
+{
+   t_list *current_bb_element, *current_element;
+   t_axe_register *regs[3];
+   int i, j, ID, changed;
+
+   current_bb_element = cse->graph->blocks;
+   for (; current_bb_element != NULL
+         ; current_bb_element = LNEXT(current_bb_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+      current_element = block->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         regs[0] = node->instr->reg_1;
+         regs[1] = node->instr->reg_2;
+         regs[2] = node->instr->reg_3;
+         changed = 0;
+         for (i = 0; i < 3; i++)
+         {
+            if (regs[i] == NULL)
+               continue;
+            ID = resolveRegister(cse, regs[i]->ID);
+            if (ID != regs[i]->ID) {
+               regs[i]->ID = ID;
+               changed = 1;
+            }
+         }
+         if (changed)
+            updateNodeDefUses(cse->graph, node);
+      }
+
+      current_element = getPhis(cse->ssa, block);
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_element);
+
+         for (j = 0; j < phi->numArgs; j++)
+            phi->args[j] = resolveRegister(cse, phi->args[j]);
+      }
+   }
+}
+
+void eliminateCommonSubexpressions(t_ssa_form *ssa)
+{
+   t_cse cse;
+   t_list *current_element;
+   int i, removed, total;
+
+   assert(ssa != NULL);
+
+   cse.ssa = ssa;
+   cse.graph = ssa->graph;
+   cse.arena = initialize_arena("common subexpressions");
+   cse.table = allocHashMap(hashExpression, compareExpressions);
+   cse.numRegisters = ssa->program->current_register + 1;
+   cse.values = malloc(sizeof(int) * cse.numRegisters);
+   cse.replacements = malloc(sizeof(int) * cse.numRegisters);
+   if (cse.arena == NULL || cse.values == NULL || cse.replacements == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < cse.numRegisters; i++)
+      cse.replacements[i] = REG_INVALID;
+   cse.holders = NULL;
+   cse.numValues = cse.maxValues = 0;
+
+   /* The table of the expressions is emptied at the beginning of each
+    * block. Keeping, instead, the expressions of the immediate dominator
+    * would extend the elimination to the whole graph. */
+   total = 0;
+   current_element = cse.graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+
+      do {
+         removed = numberBlock(&cse, block);
+         total += removed;
+      } while (removed > 0);
+   }
+
+   if (total > 0) {
+      replaceRegisters(&cse);
+      performLivenessAnalysis(cse.graph);
+   }
+   setStatistic("cse.removed_instructions", total);
+
+   free(cse.holders);
+   free(cse.replacements);
+   free(cse.values);
+   freeHashMap(cse.table);
+   finalize_arena(cse.arena);
+}
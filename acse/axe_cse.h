@@ -0,0 +1,29 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_cse.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Common subexpression elimination by local value numbering. Inside each
+ * basic block, the instructions which compute a value already computed by
+ * a previous instruction of the block (the same operation on operands with
+ * the same values, the address of the same label, or a load from the same
+ * address with no store in between) are removed, and the uses of their
+ * result are replaced with the register which already holds the value.
+ *
+ * The pass works on the SSA form: only the temporary registers in SSA form
+ * hold a value for their whole lifetime, so only they are replaced.
+ */
+
+#ifndef _AXE_CSE_H
+#define _AXE_CSE_H
+
+#include "axe_engine.h"
+#include "axe_cflow_graph.h"
+#include "axe_ssa.h"
+
+/* Removes the redundant computations of each basic block of the graph of
+ * `ssa'. The liveness informations are updated. */
+extern void eliminateCommonSubexpressions(t_ssa_form *ssa);
+
+#endif
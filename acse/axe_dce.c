@@ -0,0 +1,177 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_dce.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <stdlib.h>
+#include "axe_dce.h"
+#include "axe_def_use.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+
+static int isUsefulNode(t_cflow_Node *node);
+static void markValue(t_def_use *du, int value, int *usefulNodes
+      , int *usefulPhis, int *worklist, int *numPending);
+
+
+int hasSideEffects(t_axe_instruction *instr)
+{
+   switch (instr->opcode)
+   {
+      case STORE : case AXE_READ : case AXE_WRITE :
+      case JSR : case RET : case HALT : case NOP :
+         return 1;
+      case DIV :
+         /* a division by zero stops the program */
+         return 1;
+      case DIVI :
+         return instr->immediate == 0;
+   }
+   if (isJumpInstruction(instr))
+      return 1;
+
+   /* the target transformations use some instructions only to tell the
+    * register allocator which registers are overwritten */
+   if (instr->mcFlags != 0)
+      return 1;
+   if ((instr->reg_1 != NULL && instr->reg_1->mcRegWhitelist != NULL)
+         || (instr->reg_2 != NULL && instr->reg_2->mcRegWhitelist != NULL)
+         || (instr->reg_3 != NULL && instr->reg_3->mcRegWhitelist != NULL))
+      return 1;
+
+   /* a store to memory */
+   return instr->reg_1 != NULL && instr->reg_1->indirect;
+}
+
+/* Returns non-zero if `node' must be kept even if the values it computes
+ * are never used */
+int isUsefulNode(t_cflow_Node *node)
+{
+   return hasSideEffects(node->instr)
+         || (node->defs[0] == NULL && node->defs[1] == NULL);
+}
+
+/* Marks as useful the node or the phi which computes `value', and adds it
+ * to the worklist. A node is stored as its number, a phi `j' as
+ * `-(j + 1)'. */
+void markValue(t_def_use *du, int value, int *usefulNodes, int *usefulPhis
+      , int *worklist, int *numPending)
+{
+   int k;
+
+   if (value == DU_NO_VALUE || (value >= du->entryBase
+         && value < du->phiBase))
+      return;
+
+   if (value >= du->phiBase) {
+      k = value - du->phiBase;
+      if (usefulPhis[k])
+         return;
+      usefulPhis[k] = 1;
+      worklist[(*numPending)++] = -(k + 1);
+   } else {
+      k = value / 2;
+      if (usefulNodes[k])
+         return;
+      usefulNodes[k] = 1;
+      worklist[(*numPending)++] = k;
+   }
+}
+
+/*
+ * The nodes with side effects are useful, and so are the nodes and the phis
+ * which compute a value read by a useful node or phi: they are marked
+ * following the def-use chains backwards, and the nodes which are not
+ * marked are removed. The uses in the blocks which cannot be reached are
+ * not connected to a definition: all the definitions of the variables they
+ * read are kept.
+ */
+int eliminateDeadCode(t_cflow_Graph *graph)
+{
+   t_def_use *du;
+   int *usefulNodes, *usefulPhis, *pinned, *worklist;
+   int numPending, removed, block, slot, i, j, k;
+
+   du = buildDefUseChains(graph);
+   usefulNodes = calloc(du->numNodes + 1, sizeof(int));
+   usefulPhis = calloc(du->numPhis + 1, sizeof(int));
+   pinned = calloc(du->numVars + 1, sizeof(int));
+   worklist = malloc(sizeof(int) * (du->numNodes + du->numPhis + 1));
+   if (usefulNodes == NULL || usefulPhis == NULL || pinned == NULL
+         || worklist == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (k = 0; k < du->numNodes; k++)
+   {
+      if (du->blocks[du->nodes[k].block]->rpoNumber >= 0)
+         continue;
+      usefulNodes[k] = 1;
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (du->nodes[k].useVars[i] >= 0)
+            pinned[du->nodes[k].useVars[i]] = 1;
+      }
+   }
+
+   numPending = 0;
+   for (k = 0; k < du->numNodes; k++)
+   {
+      t_cflow_Node *node = du->nodes[k].node;
+
+      if (usefulNodes[k])
+         continue;
+      usefulNodes[k] = isUsefulNode(node);
+      for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+         if (node->defs[i] != NULL && node->defs[i]->index < du->numVars
+               && pinned[node->defs[i]->index])
+            usefulNodes[k] = 1;
+      }
+      if (usefulNodes[k])
+         worklist[numPending++] = k;
+   }
+
+   /* mark the definitions of the values read by the useful nodes */
+   while (numPending > 0)
+   {
+      k = worklist[--numPending];
+      if (k >= 0) {
+         for (i = 0; i < CFLOW_MAX_USES; i++)
+            markValue(du, du->nodes[k].useValues[i], usefulNodes
+                  , usefulPhis, worklist, &numPending);
+         continue;
+      }
+
+      j = -k - 1;
+      block = du->phis[j].block;
+      for (slot = 0; slot < DU_NUM_IN_EDGES(du, block); slot++)
+         markValue(du, du->phiArgs[du->phis[j].firstArg + slot]
+               , usefulNodes, usefulPhis, worklist, &numPending);
+   }
+
+   removed = 0;
+   for (k = 0; k < du->numNodes; k++)
+   {
+      if (usefulNodes[k])
+         continue;
+      removeNodeFromBlock(du->blocks[du->nodes[k].block], du->nodes[k].node);
+      if (cflow_errorcode != CFLOW_OK)
+         notifyError(AXE_INVALID_CFLOW_GRAPH);
+      removed++;
+   }
+
+   free(worklist);
+   free(pinned);
+   free(usefulPhis);
+   free(usefulNodes);
+   freeDefUseChains(du);
+
+   performLivenessAnalysis(graph);
+   if (cflow_errorcode != CFLOW_OK)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+
+   addToStatistic("dce.removed_instructions", removed);
+   return removed;
+}
@@ -0,0 +1,31 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_dce.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Dead code elimination over the def-use chains of the registers and of
+ * the flags. The instructions which have an effect other than writing a
+ * register are useful: stores to memory, input and output, branches, the
+ * end of the program and the instructions which constrain the register
+ * allocation. The instructions which compute a value read by a useful
+ * instruction are useful too; all the others are removed, including the
+ * ones which only feed each other around a loop. The frontend leaves
+ * behind many temporaries which are never read, and so do the target
+ * transformations.
+ */
+
+#ifndef _AXE_DCE_H
+#define _AXE_DCE_H
+
+#include "axe_cflow_graph.h"
+
+/* Returns non-zero if `instr' has an effect other than writing its
+ * destination register and the flags */
+extern int hasSideEffects(t_axe_instruction *instr);
+
+/* Removes the dead instructions of `graph'. The dominance and the liveness
+ * informations are updated. Returns the number of instructions removed. */
+extern int eliminateDeadCode(t_cflow_Graph *graph);
+
+#endif
@@ -17,10 +17,12 @@
 #define INSTR_WIDTH (3*7)
 
 static void printArrayOfVariables(t_cflow_var **array, int size, FILE *fout);
-static void printListOfVariables(t_list *variables, FILE *fout);
+static void printSetOfVariables(t_cflow_Graph *graph
+      , t_bitset *set, FILE *fout);
 static void printCFlowGraphVariable(t_cflow_var *var, FILE *fout);
-static void printBBlockInfos(t_basic_block *block, FILE *fout, int verbose);
-static void printLiveIntervals(t_list *intervals, FILE *fout);
+static void printBBlockInfos(t_cflow_Graph *graph, t_basic_block *block
+      , FILE *fout, int verbose);
+static void printLiveIntervals(t_vector *intervals, FILE *fout);
 static void printBindings(int *bindings, int numVars, FILE *fout);
 static void printLabel(t_axe_label *label, int printInline, FILE *fout);
 static off_t printFormPadding(off_t formBegin, int formSize, FILE *fout);
@@ -70,10 +72,10 @@ void printRegAllocInfos(t_reg_allocator *RA, FILE *fout)
    fflush(fout);
 }
 
-void printLiveIntervals(t_list *intervals, FILE *fout)
+void printLiveIntervals(t_vector *intervals, FILE *fout)
 {
-   t_list *current_element;
    t_live_interval *interval;
+   int counter;
 
    /* precondition */
    if (fout == NULL)
@@ -81,36 +83,47 @@ void printLiveIntervals(t_list *intervals, FILE *fout)
 
    fprintf(fout, "LIVE_INTERVALS:\n");
 
-   /* retireve the first element of the list */
-   current_element = intervals;
-   while (current_element != NULL)
+   for (counter = 0; counter < VSIZE(intervals); counter++)
    {
-      interval = (t_live_interval *) LDATA(current_element);
+      interval = (t_live_interval *) VDATA(intervals, counter);
 
       fprintf(fout, "\tLIVE_INTERVAL of T%d : [%d, %d]"
             , interval->varID, interval->startPoint, interval->endPoint);
 
       if (interval->mcRegConstraints) {
-         t_list *i = interval->mcRegConstraints;
-         fprintf(fout, " CONSTRAINED TO R%d", LINTDATA(i));
-         i = LNEXT(i);
-         for (; i; i = LNEXT(i)) {
-             fprintf(fout, ", R%d", LINTDATA(i));
+         /* print the registers in order of preference: first the hints,
+          * then the other allowed registers */
+         unsigned int regs = interval->mcRegConstraints;
+         const char *separator = " CONSTRAINED TO";
+         int i;
+
+         for (i = 0; i < interval->numRegHints; i++) {
+            int reg = interval->mcRegHints[i];
+            if (regs & RA_REGISTER_MASK(reg)) {
+               fprintf(fout, "%s R%d", separator, reg);
+               regs &= ~RA_REGISTER_MASK(reg);
+               separator = ",";
+            }
+         }
+         for (; regs != 0; regs &= regs - 1) {
+            fprintf(fout, "%s R%d", separator, __builtin_ctz(regs));
+            separator = ",";
          }
       }
 
       fprintf(fout, "\n");
-      
-      /* retrieve the next element in the list of intervals */
-      current_element = LNEXT(current_element);
    }
    fflush(fout);
 }
 
-void printBBlockInfos(t_basic_block *block, FILE *fout, int verbose)
+void printBBlockInfos(t_cflow_Graph *graph, t_basic_block *block
+      , FILE *fout, int verbose)
 {
    t_list *current_element;
    t_cflow_Node *current_node;
+   t_bitset **liveIn = NULL;
+   t_bitset **liveOut = NULL;
+   int numNodes;
    int count;
    
    /* preconditions */
@@ -119,6 +132,32 @@ void printBBlockInfos(t_basic_block *block, FILE *fout, int verbose)
    if (fout == NULL)
       return;
 
+   /* compute the liveness sets of each node from the live-out set of the
+    * block, walking the block backwards */
+   numNodes = getLength(block->nodes);
+   if (verbose != 0 && block->liveOut != NULL)
+   {
+      t_bitset *live = allocBitset(graph->numVariables);
+
+      liveIn = calloc(numNodes, sizeof(t_bitset *));
+      liveOut = calloc(numNodes, sizeof(t_bitset *));
+      copyBitset(live, block->liveOut);
+      count = numNodes - 1;
+      current_element = getLastElement(block->nodes);
+      while (current_element != NULL)
+      {
+         current_node = (t_cflow_Node *) LDATA(current_element);
+         liveOut[count] = allocBitset(graph->numVariables);
+         copyBitset(liveOut[count], live);
+         computeLiveINVarsOfNode(current_node, live);
+         liveIn[count] = allocBitset(graph->numVariables);
+         copyBitset(liveIn[count], live);
+         count--;
+         current_element = LPREV(current_element);
+      }
+      freeBitset(live);
+   }
+
    fprintf(fout,"NUMBER OF PREDECESSORS : %d \n"
          , getLength(block->pred) );
    fprintf(fout,"NUMBER OF SUCCESSORS : %d \n"
@@ -152,10 +191,12 @@ void printBBlockInfos(t_basic_block *block, FILE *fout, int verbose)
          fprintf(fout, "]");
 
          fprintf(fout, "\n\t\t\tLIVE IN = [");
-         printListOfVariables(current_node->in, fout);
+         if (liveIn != NULL)
+            printSetOfVariables(graph, liveIn[count - 1], fout);
          fprintf(fout, "]");
          fprintf(fout, "\n\t\t\tLIVE OUT = [");
-         printListOfVariables(current_node->out, fout);
+         if (liveOut != NULL)
+            printSetOfVariables(graph, liveOut[count - 1], fout);
          fprintf(fout, "]");
       }
       
@@ -163,6 +204,15 @@ void printBBlockInfos(t_basic_block *block, FILE *fout, int verbose)
       count++;
       current_element = LNEXT(current_element);
    }
+
+   if (liveIn != NULL) {
+      for (count = 0; count < numNodes; count++) {
+         freeBitset(liveIn[count]);
+         freeBitset(liveOut[count]);
+      }
+      free(liveIn);
+      free(liveOut);
+   }
    fflush(fout);
 }
 
@@ -185,25 +235,19 @@ void printArrayOfVariables(t_cflow_var **array, int size, FILE *fout)
    fflush(fout);
 }
 
-void printListOfVariables(t_list *variables, FILE *fout)
+void printSetOfVariables(t_cflow_Graph *graph, t_bitset *set, FILE *fout)
 {
-   t_list *current_element;
-   t_cflow_var *current_variable;
-   
-   if (variables == NULL)
+   int i;
+
+   if (set == NULL)
       return;
    if (fout == NULL)
       return;
 
-   current_element = variables;
-   while(current_element != NULL)
-   {
-      current_variable = (t_cflow_var *) LDATA(current_element);
-      printCFlowGraphVariable(current_variable, fout);
-      if (LNEXT(current_element) != NULL)
+   for (i = nextInBitset(set, 0); i >= 0; i = nextInBitset(set, i + 1)) {
+      printCFlowGraphVariable(graph->variables[i], fout);
+      if (nextInBitset(set, i + 1) >= 0)
          fprintf(fout, ", ");
-      
-      current_element = LNEXT(current_element);
    }
    fflush(fout);
 }
@@ -255,7 +299,7 @@ void printGraphInfos(t_cflow_Graph *graph, FILE *fout, int verbose)
    fprintf(fout,"NUMBER OF BASIC BLOCKS : %d \n"
          , getLength(graph->blocks));
    fprintf(fout,"NUMBER OF USED VARIABLES : %d \n"
-         , getLength(graph->cflow_variables));
+         , graph->numVariables);
    fprintf(fout,"--------------------------\n");
    fprintf(fout,"START BASIC BLOCK INFOS.  \n");
    fprintf(fout,"--------------------------\n");
@@ -266,7 +310,7 @@ void printGraphInfos(t_cflow_Graph *graph, FILE *fout, int verbose)
    {
       current_bblock = (t_basic_block *) LDATA(current_element);
       fprintf(fout,"[BLOCK %d] \n", counter);
-      printBBlockInfos(current_bblock, fout, verbose);
+      printBBlockInfos(graph, current_bblock, fout, verbose);
       if (LNEXT(current_element) != NULL)
          fprintf(fout,"--------------------------\n");
       else
@@ -0,0 +1,579 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_def_use.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "axe_def_use.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+
+static void checkCflowError(void);
+static void collectNodes(t_def_use *du);
+static void collectEdges(t_def_use *du);
+static void placePhis(t_def_use *du);
+static void enterBlock(t_def_use *du, int block, int *current
+      , t_vector *undo);
+static void renameValues(t_def_use *du);
+static void collectUsers(t_def_use *du);
+
+
+void checkCflowError(void)
+{
+   if (cflow_errorcode != CFLOW_OK)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+}
+
+int getDefUseBlockNumber(t_def_use *du, t_basic_block *block)
+{
+   return (int)(intptr_t)lookupHashMap(du->blockNumbers, block);
+}
+
+int getReachingValue(t_def_use *du, int node, int var)
+{
+   int i;
+
+   for (i = 0; i < CFLOW_MAX_USES; i++) {
+      if (du->nodes[node].useVars[i] == var)
+         return du->nodes[node].useValues[i];
+   }
+   return DU_NO_VALUE;
+}
+
+/* Number the nodes in the order of the code, and record the variables
+ * they use */
+void collectNodes(t_def_use *du)
+{
+   t_list *current_element;
+   int b, i, k;
+
+   du->numNodes = 0;
+   for (b = 0; b < du->numBlocks; b++)
+      du->numNodes += getLength(du->blocks[b]->nodes);
+   du->nodes = malloc(sizeof(t_du_node) * (du->numNodes + 1));
+   du->firstNode = malloc(sizeof(int) * (du->numBlocks + 1));
+   if (du->nodes == NULL || du->firstNode == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   k = 0;
+   for (b = 0; b < du->numBlocks; b++)
+   {
+      du->firstNode[b] = k;
+      current_element = du->blocks[b]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         du->nodes[k].node = node;
+         du->nodes[k].block = b;
+         for (i = 0; i < CFLOW_MAX_USES; i++)
+         {
+            du->nodes[k].useVars[i] = -1;
+            du->nodes[k].useValues[i] = DU_NO_VALUE;
+            if (node->uses[i] != NULL && node->uses[i]->ID != REG_0)
+               du->nodes[k].useVars[i] = node->uses[i]->index;
+         }
+         k++;
+      }
+   }
+   du->firstNode[du->numBlocks] = k;
+}
+
+/* Number the edges of the graph, grouping them both by source and by
+ * destination */
+void collectEdges(t_def_use *du)
+{
+   t_list *current_element;
+   int *numIn;
+   int b, e;
+
+   /* the edge from the beginning of the program comes first */
+   du->numEdges = 1;
+   for (b = 0; b < du->numBlocks; b++)
+      du->numEdges += getLength(du->blocks[b]->succ);
+
+   du->edgeFrom = malloc(sizeof(int) * du->numEdges);
+   du->edgeTo = malloc(sizeof(int) * du->numEdges);
+   du->edgeSlot = malloc(sizeof(int) * du->numEdges);
+   du->inEdges = malloc(sizeof(int) * du->numEdges);
+   du->firstOutEdge = malloc(sizeof(int) * (du->numBlocks + 1));
+   du->firstInEdge = calloc(du->numBlocks + 1, sizeof(int));
+   numIn = calloc(du->numBlocks + 1, sizeof(int));
+   if (du->edgeFrom == NULL || du->edgeTo == NULL || du->edgeSlot == NULL
+         || du->inEdges == NULL || du->firstOutEdge == NULL || du->firstInEdge == NULL
+         || numIn == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   du->edgeFrom[0] = -1;
+   du->edgeTo[0] = getDefUseBlockNumber(du, du->graph->startingBlock);
+   e = 1;
+   for (b = 0; b < du->numBlocks; b++)
+   {
+      du->firstOutEdge[b] = e;
+      current_element = du->blocks[b]->succ;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *succ = (t_basic_block *) LDATA(current_element);
+
+         if (succ == du->graph->endingBlock)
+            continue;
+         du->edgeFrom[e] = b;
+         du->edgeTo[e] = getDefUseBlockNumber(du, succ);
+         e++;
+      }
+   }
+   du->firstOutEdge[du->numBlocks] = e;
+   du->numEdges = e;
+
+   for (e = 0; e < du->numEdges; e++)
+      du->firstInEdge[du->edgeTo[e] + 1]++;
+   for (b = 0; b < du->numBlocks; b++)
+      du->firstInEdge[b + 1] += du->firstInEdge[b];
+   for (e = 0; e < du->numEdges; e++)
+   {
+      b = du->edgeTo[e];
+      du->edgeSlot[e] = numIn[b];
+      du->inEdges[du->firstInEdge[b] + numIn[b]] = e;
+      numIn[b]++;
+   }
+
+   free(numIn);
+}
+
+/*
+ * Place the phis at the iterated dominance frontier of the blocks defining
+ * each variable. Only the variables used by a block before being defined
+ * in it need phis: the uses of the other ones are reached by a definition
+ * of the same block.
+ */
+void placePhis(t_def_use *du)
+{
+   int *global, *stamp, *numDefs, *firstDef, *defBlocks;
+   int *placed, *queued, *worklist;
+   int *phiVars, *phiBlocks, *numBlockPhis;
+   int numPending, maxPhis, numPhis, numArgs;
+   t_list *current_element;
+   int b, i, j, k, var;
+
+   global = calloc(du->numVars + 1, sizeof(int));
+   stamp = calloc(du->numVars + 1, sizeof(int));
+   numDefs = calloc(du->numVars + 1, sizeof(int));
+   firstDef = calloc(du->numVars + 2, sizeof(int));
+   placed = calloc(du->numBlocks + 1, sizeof(int));
+   queued = calloc(du->numBlocks + 1, sizeof(int));
+   worklist = malloc(sizeof(int) * (du->numBlocks + 1));
+   if (global == NULL || stamp == NULL || numDefs == NULL
+         || firstDef == NULL || placed == NULL || queued == NULL
+         || worklist == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   /* find the global variables, and count the blocks defining each
+    * variable */
+   for (b = 0; b < du->numBlocks; b++)
+   {
+      if (du->blocks[b]->rpoNumber < 0)
+         continue;
+      for (k = du->firstNode[b]; k < du->firstNode[b + 1]; k++)
+      {
+         t_cflow_Node *node = du->nodes[k].node;
+
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            var = du->nodes[k].useVars[i];
+            if (var >= 0 && stamp[var] != b + 1)
+               global[var] = 1;
+         }
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            if (node->defs[i] == NULL || node->defs[i]->ID == REG_0)
+               continue;
+            var = node->defs[i]->index;
+            if (stamp[var] != b + 1) {
+               stamp[var] = b + 1;
+               numDefs[var]++;
+            }
+         }
+      }
+   }
+
+   /* list the blocks defining each variable */
+   for (var = 0; var < du->numVars; var++)
+      firstDef[var + 1] = firstDef[var] + numDefs[var];
+   defBlocks = malloc(sizeof(int) * (firstDef[du->numVars] + 1));
+   if (defBlocks == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   memset(stamp, 0, sizeof(int) * du->numVars);
+   memset(numDefs, 0, sizeof(int) * du->numVars);
+   for (b = 0; b < du->numBlocks; b++)
+   {
+      if (du->blocks[b]->rpoNumber < 0)
+         continue;
+      for (k = du->firstNode[b]; k < du->firstNode[b + 1]; k++)
+      {
+         t_cflow_Node *node = du->nodes[k].node;
+
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            if (node->defs[i] == NULL || node->defs[i]->ID == REG_0)
+               continue;
+            var = node->defs[i]->index;
+            if (stamp[var] != b + 1) {
+               stamp[var] = b + 1;
+               defBlocks[firstDef[var] + numDefs[var]++] = b;
+            }
+         }
+      }
+   }
+
+   maxPhis = 16;
+   numPhis = 0;
+   phiVars = malloc(sizeof(int) * maxPhis);
+   phiBlocks = malloc(sizeof(int) * maxPhis);
+   if (phiVars == NULL || phiBlocks == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (var = 0; var < du->numVars; var++)
+   {
+      if (!global[var])
+         continue;
+
+      numPending = 0;
+      for (i = firstDef[var]; i < firstDef[var + 1]; i++) {
+         queued[defBlocks[i]] = var + 1;
+         worklist[numPending++] = defBlocks[i];
+      }
+
+      while (numPending > 0)
+      {
+         b = worklist[--numPending];
+         current_element = du->blocks[b]->domFrontier;
+         for (; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            int join = getDefUseBlockNumber(du
+                  , (t_basic_block *) LDATA(current_element));
+
+            if (placed[join] == var + 1)
+               continue;
+            placed[join] = var + 1;
+            if (numPhis == maxPhis) {
+               maxPhis *= 2;
+               phiVars = realloc(phiVars, sizeof(int) * maxPhis);
+               phiBlocks = realloc(phiBlocks, sizeof(int) * maxPhis);
+               if (phiVars == NULL || phiBlocks == NULL)
+                  notifyError(AXE_OUT_OF_MEMORY);
+            }
+            phiVars[numPhis] = var;
+            phiBlocks[numPhis] = join;
+            numPhis++;
+            if (queued[join] != var + 1) {
+               queued[join] = var + 1;
+               worklist[numPending++] = join;
+            }
+         }
+      }
+   }
+
+   /* group the phis by block */
+   du->numPhis = numPhis;
+   du->phis = malloc(sizeof(t_du_phi) * (numPhis + 1));
+   du->firstPhi = calloc(du->numBlocks + 1, sizeof(int));
+   numBlockPhis = calloc(du->numBlocks + 1, sizeof(int));
+   if (du->phis == NULL || du->firstPhi == NULL || numBlockPhis == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (j = 0; j < numPhis; j++)
+      du->firstPhi[phiBlocks[j] + 1]++;
+   for (b = 0; b < du->numBlocks; b++)
+      du->firstPhi[b + 1] += du->firstPhi[b];
+
+   numArgs = 0;
+   for (j = 0; j < numPhis; j++)
+   {
+      t_du_phi *phi;
+
+      b = phiBlocks[j];
+      phi = &du->phis[du->firstPhi[b] + numBlockPhis[b]++];
+      phi->var = phiVars[j];
+      phi->block = b;
+      phi->firstArg = numArgs;
+      numArgs += DU_NUM_IN_EDGES(du, b);
+   }
+   du->phiArgs = malloc(sizeof(int) * (numArgs + 1));
+   if (du->phiArgs == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < numArgs; i++)
+      du->phiArgs[i] = DU_NO_VALUE;
+
+   free(numBlockPhis);
+   free(phiBlocks);
+   free(phiVars);
+   free(defBlocks);
+   free(worklist);
+   free(queued);
+   free(placed);
+   free(firstDef);
+   free(numDefs);
+   free(stamp);
+   free(global);
+}
+
+/* Record the values reaching the phis and the uses of the block number
+ * `block', and the values reaching the phis of its successors. `current'
+ * is the value of each variable, and is updated with the definitions of
+ * the block; the previous values are saved on `undo'. */
+void enterBlock(t_def_use *du, int block, int *current, t_vector *undo)
+{
+   int e, i, j, k, var;
+
+   for (j = du->firstPhi[block]; j < du->firstPhi[block + 1]; j++)
+   {
+      var = du->phis[j].var;
+      addToVector(undo, INTDATA(var));
+      addToVector(undo, INTDATA(current[var]));
+      current[var] = du->phiBase + j;
+   }
+
+   for (k = du->firstNode[block]; k < du->firstNode[block + 1]; k++)
+   {
+      t_cflow_Node *node = du->nodes[k].node;
+
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (du->nodes[k].useVars[i] >= 0)
+            du->nodes[k].useValues[i] = current[du->nodes[k].useVars[i]];
+      }
+      for (i = 0; i < CFLOW_MAX_DEFS; i++)
+      {
+         if (node->defs[i] == NULL || node->defs[i]->ID == REG_0)
+            continue;
+         var = node->defs[i]->index;
+         addToVector(undo, INTDATA(var));
+         addToVector(undo, INTDATA(current[var]));
+         current[var] = i == 0 ? DU_RESULT_VALUE(k) : DU_FLAGS_VALUE(k);
+      }
+   }
+
+   for (e = du->firstOutEdge[block]; e < du->firstOutEdge[block + 1]; e++)
+   {
+      int succ = du->edgeTo[e];
+
+      for (j = du->firstPhi[succ]; j < du->firstPhi[succ + 1]; j++)
+         du->phiArgs[du->phis[j].firstArg + du->edgeSlot[e]]
+               = current[du->phis[j].var];
+   }
+}
+
+/* Connect each use to the value which reaches it, visiting the dominator
+ * tree in preorder. The values defined in a block are forgotten when the
+ * visit of the subtree of the block is complete. */
+void renameValues(t_def_use *du)
+{
+   int *firstChild, *children, *numChildren;
+   int *stack, *nextChild, *undoMark, *current;
+   t_vector *undo;
+   int start, top, b, j;
+
+   firstChild = calloc(du->numBlocks + 2, sizeof(int));
+   numChildren = calloc(du->numBlocks + 1, sizeof(int));
+   children = malloc(sizeof(int) * (du->numBlocks + 1));
+   stack = malloc(sizeof(int) * (du->numBlocks + 1));
+   nextChild = malloc(sizeof(int) * (du->numBlocks + 1));
+   undoMark = malloc(sizeof(int) * (du->numBlocks + 1));
+   current = malloc(sizeof(int) * (du->numVars + 1));
+   if (firstChild == NULL || numChildren == NULL || children == NULL
+         || stack == NULL || nextChild == NULL || undoMark == NULL
+         || current == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   undo = allocVector(0);
+
+   /* the children of each block in the dominator tree */
+   for (b = 0; b < du->numBlocks; b++) {
+      if (du->blocks[b]->idom != NULL)
+         firstChild[getDefUseBlockNumber(du, du->blocks[b]->idom) + 1]++;
+   }
+   for (b = 0; b < du->numBlocks; b++)
+      firstChild[b + 1] += firstChild[b];
+   for (b = 0; b < du->numBlocks; b++)
+   {
+      int parent;
+
+      if (du->blocks[b]->idom == NULL)
+         continue;
+      parent = getDefUseBlockNumber(du, du->blocks[b]->idom);
+      children[firstChild[parent] + numChildren[parent]++] = b;
+   }
+
+   /* at the beginning of the program each variable holds its entry
+    * value */
+   for (j = 0; j < du->numVars; j++)
+      current[j] = du->entryBase + j;
+   start = du->edgeTo[0];
+   for (j = du->firstPhi[start]; j < du->firstPhi[start + 1]; j++)
+      du->phiArgs[du->phis[j].firstArg + du->edgeSlot[0]]
+            = current[du->phis[j].var];
+
+   undoMark[0] = VSIZE(undo);
+   enterBlock(du, start, current, undo);
+   stack[0] = start;
+   nextChild[0] = firstChild[start];
+   top = 1;
+   while (top > 0)
+   {
+      b = stack[top - 1];
+      if (nextChild[top - 1] < firstChild[b + 1]) {
+         int child = children[nextChild[top - 1]++];
+
+         undoMark[top] = VSIZE(undo);
+         enterBlock(du, child, current, undo);
+         stack[top] = child;
+         nextChild[top] = firstChild[child];
+         top++;
+         continue;
+      }
+
+      /* leave the block */
+      top--;
+      while (VSIZE(undo) > undoMark[top]) {
+         int value = (int)(intptr_t)removeLastFromVector(undo);
+         int var = (int)(intptr_t)removeLastFromVector(undo);
+         current[var] = value;
+      }
+   }
+
+   freeVector(undo);
+   free(current);
+   free(undoMark);
+   free(nextChild);
+   free(stack);
+   free(children);
+   free(numChildren);
+   free(firstChild);
+}
+
+/* Build the lists of the nodes and of the phis which read each value */
+void collectUsers(t_def_use *du)
+{
+   int *numUsers;
+   int i, j, k, slot, value;
+
+   du->firstUser = calloc(du->numValues + 1, sizeof(int));
+   numUsers = calloc(du->numValues + 1, sizeof(int));
+   if (du->firstUser == NULL || numUsers == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (k = 0; k < du->numNodes; k++) {
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (du->nodes[k].useValues[i] != DU_NO_VALUE)
+            numUsers[du->nodes[k].useValues[i]]++;
+      }
+   }
+   for (j = 0; j < du->numPhis; j++)
+   {
+      for (slot = 0; slot < DU_NUM_IN_EDGES(du, du->phis[j].block); slot++)
+      {
+         value = du->phiArgs[du->phis[j].firstArg + slot];
+         if (value != DU_NO_VALUE)
+            numUsers[value]++;
+      }
+   }
+
+   for (i = 0; i < du->numValues; i++) {
+      du->firstUser[i + 1] = du->firstUser[i] + numUsers[i];
+      numUsers[i] = 0;
+   }
+   du->users = malloc(sizeof(int) * (du->firstUser[du->numValues] + 1));
+   if (du->users == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (k = 0; k < du->numNodes; k++)
+   {
+      for (i = 0; i < CFLOW_MAX_USES; i++)
+      {
+         value = du->nodes[k].useValues[i];
+         if (value != DU_NO_VALUE)
+            du->users[du->firstUser[value] + numUsers[value]++] = k;
+      }
+   }
+   for (j = 0; j < du->numPhis; j++)
+   {
+      for (slot = 0; slot < DU_NUM_IN_EDGES(du, du->phis[j].block); slot++)
+      {
+         value = du->phiArgs[du->phis[j].firstArg + slot];
+         if (value != DU_NO_VALUE)
+            du->users[du->firstUser[value] + numUsers[value]++] = -(j + 1);
+      }
+   }
+
+   free(numUsers);
+}
+
+t_def_use *buildDefUseChains(t_cflow_Graph *graph)
+{
+   t_def_use *du;
+   t_list *current_element;
+   int i;
+
+   assert(graph != NULL);
+
+   du = malloc(sizeof(t_def_use));
+   if (du == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   du->graph = graph;
+   du->numVars = graph->numVariables;
+   du->numBlocks = getLength(graph->blocks);
+   du->blocks = malloc(sizeof(t_basic_block *) * (du->numBlocks + 1));
+   if (du->blocks == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   du->blockNumbers = allocHashMap(NULL, NULL);
+
+   i = 0;
+   current_element = graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      du->blocks[i] = (t_basic_block *) LDATA(current_element);
+      putInHashMap(du->blockNumbers, du->blocks[i], INTDATA(i));
+      i++;
+   }
+
+   computeDominators(graph);
+   checkCflowError();
+   computeDominanceFrontiers(graph);
+   checkCflowError();
+
+   collectNodes(du);
+   collectEdges(du);
+   placePhis(du);
+   du->entryBase = DU_RESULT_VALUE(du->numNodes);
+   du->phiBase = du->entryBase + du->numVars;
+   du->numValues = du->phiBase + du->numPhis;
+   renameValues(du);
+   collectUsers(du);
+   return du;
+}
+
+void freeDefUseChains(t_def_use *du)
+{
+   if (du == NULL)
+      return;
+
+   free(du->users);
+   free(du->firstUser);
+   free(du->phiArgs);
+   free(du->firstPhi);
+   free(du->phis);
+   free(du->firstInEdge);
+   free(du->inEdges);
+   free(du->firstOutEdge);
+   free(du->edgeSlot);
+   free(du->edgeTo);
+   free(du->edgeFrom);
+   free(du->firstNode);
+   free(du->nodes);
+   freeHashMap(du->blockNumbers);
+   free(du->blocks);
+   free(du);
+}
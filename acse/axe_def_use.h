@@ -0,0 +1,122 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_def_use.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Def-use chains of all the registers and of the flags. Each use is
+ * connected to the value which reaches it: the value computed by a node,
+ * the value held by the register at the beginning of the program, or the
+ * value of a phi where several definitions meet. The phis are placed at
+ * the iterated dominance frontier of the definitions, as in the
+ * construction of the SSA form, but the code is left unchanged: unlike
+ * the SSA form, the chains also cover the registers bound to the scalar
+ * variables and the flags.
+ *
+ * The values are identified by a number. The node number `k' (the nodes
+ * are numbered in the order of the code) computes the values
+ * DU_RESULT_VALUE(k), written to its destination register, and
+ * DU_FLAGS_VALUE(k), the flags. They are followed by the value of each
+ * variable at the beginning of the program, and by the value of each phi.
+ */
+
+#ifndef _AXE_DEF_USE_H
+#define _AXE_DEF_USE_H
+
+#include "axe_cflow_graph.h"
+
+#define DU_RESULT_VALUE(node) (2 * (node))
+#define DU_FLAGS_VALUE(node) (2 * (node) + 1)
+
+/* the value read by a use of REG_0, or by a use which is not recorded */
+#define DU_NO_VALUE -1
+
+/* a node of the control flow graph */
+typedef struct t_du_node
+{
+   t_cflow_Node *node;     /* the users of the chains may set it to NULL
+                            * when they remove the node */
+   int block;              /* the number of the block of the node */
+   int useVars[CFLOW_MAX_USES];     /* the index of the variables in
+                                     * `node->uses', or -1 for REG_0 */
+   int useValues[CFLOW_MAX_USES];   /* the values which reach those uses;
+                                     * DU_NO_VALUE in the blocks which
+                                     * cannot be reached */
+}t_du_node;
+
+/* a phi, which merges the values of a variable at the beginning of a
+ * block */
+typedef struct t_du_phi
+{
+   int var;                /* the index of the variable */
+   int block;
+   int firstArg;           /* position of the arguments in `phiArgs', one
+                            * for each edge entering the block */
+}t_du_phi;
+
+typedef struct t_def_use
+{
+   t_cflow_Graph *graph;
+   t_basic_block **blocks; /* the blocks, in the order of the code */
+   int numBlocks;
+   t_hashmap *blockNumbers;   /* position of each block in `blocks' */
+   int numVars;            /* number of variables of the graph */
+
+   t_du_node *nodes;       /* the nodes, in the order of the code */
+   int numNodes;
+   int *firstNode;         /* the nodes of the block `b' are those from
+                            * `firstNode[b]' to `firstNode[b + 1]' */
+
+   int numEdges;           /* the edge 0 enters the starting block from the
+                            * beginning of the program; the edges leaving
+                            * each block are consecutive. The edges to the
+                            * ending block are left out. */
+   int *edgeFrom, *edgeTo; /* the blocks connected by each edge; -1 for
+                            * the beginning of the program */
+   int *edgeSlot;          /* position of each edge among those entering
+                            * its destination */
+   int *firstOutEdge;      /* the edges leaving the block `b' are those
+                            * from `firstOutEdge[b]' to
+                            * `firstOutEdge[b + 1]' */
+   int *inEdges;           /* the edges entering the block `b' are those
+                            * from `inEdges[firstInEdge[b]]' to
+                            * `inEdges[firstInEdge[b + 1]]' */
+   int *firstInEdge;
+
+   t_du_phi *phis;         /* the phis, grouped by block */
+   int numPhis;
+   int *firstPhi;          /* the phis of the block `b' are those from
+                            * `firstPhi[b]' to `firstPhi[b + 1]' */
+   int *phiArgs;           /* the values reaching the phis from each edge;
+                            * DU_NO_VALUE for the edges leaving the blocks
+                            * which cannot be reached */
+
+   int numValues;
+   int entryBase;          /* number of the value of the first variable at
+                            * the beginning of the program */
+   int phiBase;            /* number of the value of the first phi */
+   int *firstUser;         /* the users of the value `v' are those from
+                            * `users[firstUser[v]]' to
+                            * `users[firstUser[v + 1]]': a node `k' is
+                            * stored as `k', a phi `j' as `-(j + 1)' */
+   int *users;
+}t_def_use;
+
+/* Builds the def-use chains of `graph'. The dominance informations of
+ * `graph' are updated. */
+extern t_def_use *buildDefUseChains(t_cflow_Graph *graph);
+
+/* Returns the number of `block' in the order of the code */
+extern int getDefUseBlockNumber(t_def_use *du, t_basic_block *block);
+
+/* Returns the value of the variable with index `var' read by the node
+ * number `node', or DU_NO_VALUE if the node does not read it */
+extern int getReachingValue(t_def_use *du, int node, int var);
+
+/* Returns the number of edges entering the block number `block' */
+#define DU_NUM_IN_EDGES(du, block) \
+      ((du)->firstInEdge[(block) + 1] - (du)->firstInEdge[block])
+
+extern void freeDefUseChains(t_def_use *du);
+
+#endif
@@ -25,12 +25,14 @@ extern int line_num;
 /* last line number inserted in an instruction as a comment */
 int prev_line_num = -1;
 
-/* Function used when a compare is needed between two labels */
-static int compareVariables (void *Var_A, void *Var_B);
-
 /* Finalize the memory associated with an instruction */
 static void finalizeInstructions(t_list *instructions);
 
+/* Insert an instruction in the code segment after the given link, or at the
+ * beginning if `prev' is NULL. Returns the link of the new instruction. */
+static t_list *linkInstruction(t_program_infos *program
+      , t_list *prev, t_axe_instruction *instr);
+
 /* Finalize the data segment */
 static void finalizeDataSegment(t_list *dataDirectives);
 
@@ -40,6 +42,9 @@ static void finalizeVariables(t_list *variables);
 /* add a variable to the program */
 static void addVariable(t_program_infos *program, t_axe_variable *variable);
 
+/* enlarge `program->variablesByID' to contain the given string ID */
+static void growVariablesByID(t_program_infos *program, int stringID);
+
       
 /* create a new variable */
 void createVariable(t_program_infos *program, char *ID
@@ -51,6 +56,11 @@ void createVariable(t_program_infos *program, char *ID
    if (program == NULL)
       notifyError(AXE_PROGRAM_NOT_INITIALIZED);
 
+   /* all the variable identifiers are interned */
+   ID = internString(program->strings, ID);
+   if (ID == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
    /* initialize a new variable */
    var = alloc_variable(ID, type, isArray, arraySize, init_val);
    if (var == NULL)
@@ -109,33 +119,13 @@ void finalizeInstructions(t_list *instructions)
       current_element = LNEXT(current_element);
    }
 
-   /* free the list of instructions */
-   freeList(instructions);
-}
-
-int compareVariables (void *Var_A, void *Var_B)
-{
-   t_axe_variable *va;
-   t_axe_variable *vb;
-   
-   if (Var_A == NULL)
-      return Var_B == NULL;
-
-   if (Var_B == NULL)
-      return 0;
-
-   va = (t_axe_variable *) Var_A;
-   vb = (t_axe_variable *) Var_B;
-
-   /* test if the name is the same */
-   return (!strcmp(va->ID, vb->ID));
+   /* the links of the list belong to the arena of the program */
 }
 
 t_axe_variable * getVariable
       (t_program_infos *program, char *ID)
 {
-   t_axe_variable search_pattern;
-   t_list *elementFound;
+   int stringID;
    
    /* preconditions */
    if (program == NULL)
@@ -144,18 +134,12 @@ t_axe_variable * getVariable
    if (ID == NULL)
       notifyError(AXE_VARIABLE_ID_UNSPECIFIED);
 
-   /* initialize the pattern */
-   search_pattern.ID = ID;
-   
-   /* search inside the list of variables */
-   elementFound = CustomfindElement
-         (program->variables, &search_pattern, compareVariables);
-
-   /* if the element is found return it to the caller. Otherwise return NULL. */
-   if (elementFound != NULL)
-      return (t_axe_variable *) LDATA(elementFound);
+   /* variables are indexed by the ID of their interned identifier */
+   stringID = getStringID(program->strings, ID);
+   if (stringID == STRING_NOT_FOUND || stringID >= program->maxVariablesByID)
+      return NULL;
 
-   return NULL;
+   return program->variablesByID[stringID];
 }
 
 /* initialize an instance of `t_program_infos' */
@@ -174,14 +158,21 @@ t_program_infos * allocProgramInfos()
 
    /* initialize the new instance of `result' */
    result->variables = NULL;
+   result->variablesByID = NULL;
+   result->maxVariablesByID = 0;
    result->instructions = NULL;
+   result->lastInstruction = NULL;
+   result->numInstructions = 0;
    result->instrInsPtrStack = addElement(NULL, NULL, -1);
    result->data = NULL;
    result->current_register = 1; /* we are excluding the register R0 */
    result->lmanager = initialize_label_manager();
    result->sy_table = initialize_sy_table();
+   result->strings = initialize_string_table();
+   result->arena = initialize_arena("program");
 
-   if (result->lmanager == NULL || result->sy_table == NULL)
+   if (result->lmanager == NULL || result->sy_table == NULL
+         || result->strings == NULL || result->arena == NULL)
    {
       finalizeProgramInfos(result);
       notifyError(AXE_OUT_OF_MEMORY);
@@ -207,7 +198,7 @@ void addInstruction(t_program_infos *program, t_axe_instruction *instr)
    instr->labelID = assign_label(program->lmanager);
 
    if (line_num >= 0 && line_num != prev_line_num) {
-      instr->user_comment = calloc(20, sizeof(char));
+      instr->user_comment = arenaCalloc(program->arena, 20);
       if (instr->user_comment) {
          snprintf(instr->user_comment, 20, "line %d", line_num);
       }
@@ -216,13 +207,64 @@ void addInstruction(t_program_infos *program, t_axe_instruction *instr)
 
    /* update the list of instructions */
    t_list *ip = LDATA(program->instrInsPtrStack);
-   if (!ip) {
-      program->instructions = addElement(program->instructions, instr, 0);
-      SET_DATA(program->instrInsPtrStack, program->instructions);
+   ip = linkInstruction(program, ip, instr);
+   SET_DATA(program->instrInsPtrStack, ip);
+}
+
+t_list *linkInstruction(t_program_infos *program
+      , t_list *prev, t_axe_instruction *instr)
+{
+   t_list *link;
+
+   /* the links are allocated from the arena of the program; as most
+    * instructions are appended, consecutive links are close in memory */
+   link = arenaAlloc(program->arena, sizeof(t_list));
+   if (link == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   link->data = instr;
+   instr->link = link;
+
+   link->prev = prev;
+   if (prev) {
+      link->next = prev->next;
+      prev->next = link;
    } else {
-      ip = addAfter(ip, instr);
-      SET_DATA(program->instrInsPtrStack, ip);
+      link->next = program->instructions;
+      program->instructions = link;
    }
+   if (link->next)
+      link->next->prev = link;
+   else
+      program->lastInstruction = link;
+
+   program->numInstructions++;
+   return link;
+}
+
+void appendInstruction(t_program_infos *program, t_axe_instruction *instr)
+{
+   if (program == NULL)
+      notifyError(AXE_PROGRAM_NOT_INITIALIZED);
+   if (instr == NULL)
+      notifyError(AXE_INVALID_INSTRUCTION);
+
+   linkInstruction(program, program->lastInstruction, instr);
+}
+
+void clearInstructions(t_program_infos *program)
+{
+   t_list *current_element;
+
+   if (program == NULL)
+      notifyError(AXE_PROGRAM_NOT_INITIALIZED);
+
+   for (current_element = program->instructions; current_element != NULL
+         ; current_element = LNEXT(current_element))
+      ((t_axe_instruction *)LDATA(current_element))->link = NULL;
+
+   program->instructions = NULL;
+   program->lastInstruction = NULL;
+   program->numInstructions = 0;
 }
 
 void removeInstructionLink(t_program_infos *program, t_list *instrLi)
@@ -266,7 +308,16 @@ void removeInstructionLink(t_program_infos *program, t_list *instrLi)
    }
 
    /* remove the instruction */
-   program->instructions = removeElementLink(program->instructions, instrLi);
+   if (instrLi->prev)
+      instrLi->prev->next = instrLi->next;
+   else
+      program->instructions = instrLi->next;
+   if (instrLi->next)
+      instrLi->next->prev = instrLi->prev;
+   else
+      program->lastInstruction = instrLi->prev;
+   program->numInstructions--;
+   instrToRemove->link = NULL;
    free_Instruction(instrToRemove);
 }
 
@@ -297,6 +348,11 @@ t_list *popInstrInsertionPoint(t_program_infos *p)
    return ip;
 }
 
+t_list *getInstrInsertionPoint(t_program_infos *p)
+{
+   return LDATA(p->instrInsPtrStack);
+}
+
 /* reserve a new label identifier for future uses */
 t_axe_label *newNamedLabel(t_program_infos *program, const char *name)
 {
@@ -361,6 +417,7 @@ void addVariable(t_program_infos *program, t_axe_variable *variable)
 {
    t_axe_variable *variableFound;
    t_axe_data *new_data_info;
+   int stringID;
    int sy_error;
    
    /* test the preconditions */
@@ -420,6 +477,11 @@ void addVariable(t_program_infos *program, t_axe_variable *variable)
 
    /* now we can add the new variable to the program */
    program->variables = addElement(program->variables, variable, -1);
+   stringID = getStringID(program->strings, variable->ID);
+   assert(stringID != STRING_NOT_FOUND);
+   if (stringID >= program->maxVariablesByID)
+      growVariablesByID(program, stringID);
+   program->variablesByID[stringID] = variable;
 
    /* create an instance of `t_axe_data' */
    if (variable->type == INTEGER_TYPE)
@@ -458,6 +520,26 @@ void addVariable(t_program_infos *program, t_axe_variable *variable)
       notifyError(AXE_SY_TABLE_ERROR);
 }
 
+void growVariablesByID(t_program_infos *program, int stringID)
+{
+   t_axe_variable **newVariablesByID;
+   int newMax;
+
+   newMax = program->maxVariablesByID ? program->maxVariablesByID : 64;
+   while (newMax <= stringID)
+      newMax *= 2;
+
+   newVariablesByID = (t_axe_variable **) realloc(program->variablesByID
+         , newMax * sizeof(t_axe_variable *));
+   if (newVariablesByID == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   memset(newVariablesByID + program->maxVariablesByID, 0
+         , (newMax - program->maxVariablesByID) * sizeof(t_axe_variable *));
+   program->variablesByID = newVariablesByID;
+   program->maxVariablesByID = newMax;
+}
+
 int getNewRegister(t_program_infos *program)
 {
    int result;
@@ -487,7 +569,11 @@ void finalizeProgramInfos(t_program_infos *program)
       finalize_label_manager(program->lmanager);
    if (program->sy_table != NULL)
       finalize_sy_table(program->sy_table);
+   if (program->strings != NULL)
+      finalize_string_table(program->strings);
+   finalize_arena(program->arena);
 
+   free(program->variablesByID);
    free(program);
 }
 
@@ -518,13 +604,9 @@ void finalizeVariables(t_list *variables)
    while(current_element != NULL)
    {
       current_var = (t_axe_variable *) LDATA(current_element);
+      /* the identifier of the variable belongs to the string table */
       if (current_var != NULL)
-      {
-         if (current_var->ID != NULL)
-            free(current_var->ID);
-         
          free(current_var);
-      }
       
       current_element = LNEXT(current_element);
    }
@@ -18,15 +18,26 @@
 #include "axe_labels.h"
 #include "collections.h"
 #include "symbol_table.h"
+#include "axe_strings.h"
+#include "axe_arena.h"
 
 typedef struct t_program_infos
 {
   t_list *variables;
-  t_list *instructions;
+  t_axe_variable **variablesByID; /* variables indexed by the string ID
+                                   * of their identifier */
+  int maxVariablesByID;
+  t_list *instructions;           /* the code segment. The links are owned
+                                   * by the program: use the functions below
+                                   * to modify the list. */
+  t_list *lastInstruction;        /* the last link of `instructions' */
+  int numInstructions;            /* the length of `instructions' */
   t_list *instrInsPtrStack;
   t_list *data;
   t_axe_label_manager *lmanager;
   t_symbol_table *sy_table;
+  t_string_table *strings;        /* interned identifiers */
+  t_arena *arena;                 /* memory of the instructions */
   int current_register;
 } t_program_infos;
 
@@ -46,6 +57,17 @@ extern void addInstruction(t_program_infos *program, t_axe_instruction *instr);
  * list. */
 extern void removeInstructionLink(t_program_infos *program, t_list *instrLi);
 
+/* add an instruction at the end of the code segment, without assigning
+ * pending labels or comments to it, and without moving the insertion point */
+extern void appendInstruction(t_program_infos *program, t_axe_instruction *instr);
+
+/* empty the code segment, without finalizing the instructions it contains */
+extern void clearInstructions(t_program_infos *program);
+
+/* Returns the link of the given instruction in the list of instructions of
+ * the program, or NULL if the instruction is not part of the program. */
+#define getInstructionLink(instr) ((instr)->link)
+
 /* Save the current insertion point in the instruction list, and replace it
  * with `ip`. New instructions will be inserted after the `ip` instruction.
  * To insert instructions at the beginning of the program, ip shall be NULL. */
@@ -55,6 +77,11 @@ extern void pushInstrInsertionPoint(t_program_infos *p, t_list *ip);
  * previous position of the instruction insertion point. */
 extern t_list *popInstrInsertionPoint(t_program_infos *p);
 
+/* Returns the current insertion point in the instruction list: the link of
+ * the instruction after which the new instructions are inserted, or NULL if
+ * they are inserted at the beginning of the program. */
+extern t_list *getInstrInsertionPoint(t_program_infos *p);
+
 /* reserve a new label identifier and return the identifier to the caller */
 extern t_axe_label *newLabel(t_program_infos *program);
 
@@ -73,7 +100,8 @@ extern t_axe_label *newNamedLabel(t_program_infos *program, const char *name);
 extern t_axe_label *assignNewNamedLabel(
       t_program_infos *program, const char *name);
 
-/* add a variable to the program */
+/* add a variable to the program. The identifier is interned in
+ * `program->strings', thus `ID' does not need to outlive this call. */
 extern void createVariable(t_program_infos *program, char *ID, int type,
       int isArray, int arraySize, int init_val);
 
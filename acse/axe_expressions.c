@@ -13,6 +13,7 @@
 #include "axe_gencode.h"
 #include "axe_errors.h"
 #include "axe_utils.h"
+#include "axe_arena.h"
 
 
 static t_axe_expression handle_bin_numeric_op_Imm
@@ -21,6 +22,16 @@ static t_axe_expression handle_bin_numeric_op_Imm
 static t_axe_expression handle_bin_comparison_Imm
          (int val1, int val2, int condition);
 
+static t_axe_condition * create_condition(t_program_infos *program
+         , t_list *split, t_axe_expression left, t_axe_expression right);
+
+static t_axe_instruction * gen_comparison_branch(t_program_infos *program
+         , int opcode, int sense, t_axe_label *label);
+
+static t_axe_instruction * gen_operand_branch(t_program_infos *program
+         , t_axe_expression exp, t_list *end, int sense, t_axe_label *label
+         , t_axe_label **next);
+
 
 t_axe_expression handle_bin_numeric_op (t_program_infos *program
          , t_axe_expression exp1, t_axe_expression exp2, int binop)
@@ -274,6 +285,7 @@ t_axe_expression handle_bin_comparison_Imm
 t_axe_expression handle_binary_comparison (t_program_infos *program
          , t_axe_expression exp1, t_axe_expression exp2, int condition)
 {
+   t_axe_expression result;
    int output_register;
 
    /* we have to test if one (or both) of
@@ -285,6 +297,24 @@ t_axe_expression handle_binary_comparison (t_program_infos *program
                   (exp1.value, exp2.value, condition);
    }
                      
+   /* an immediate first operand becomes the second one, and the relation
+   * is mirrored. Negating the difference would not negate its overflow,
+   * which the ordered relations test. */
+   if (exp1.expression_type == IMMEDIATE)
+   {
+      t_axe_expression immediate = exp1;
+
+      exp1 = exp2;
+      exp2 = immediate;
+      switch(condition)
+      {
+         case _LT_ : condition = _GT_; break;
+         case _GT_ : condition = _LT_; break;
+         case _LTEQ_ : condition = _GTEQ_; break;
+         case _GTEQ_ : condition = _LTEQ_; break;
+      }
+   }
+
    /* at first we have to ask for a free register
    * where to store the result of the comparison. */
    output_register = getNewRegister(program);
@@ -295,15 +325,6 @@ t_axe_expression handle_binary_comparison (t_program_infos *program
       gen_subi_instruction (program, output_register
                , exp1.value, exp2.value);
    }
-   else if (exp1.expression_type == IMMEDIATE)
-   {
-      gen_subi_instruction (program, output_register
-               , exp2.value, exp1.value);
-
-      /* we have to produce a NEG instruction */
-      gen_neg_instruction (program, output_register
-               , output_register, CG_DIRECT_ALL);
-   }
    else
    {
       /* we have to produce a SUB instruction */
@@ -324,6 +345,219 @@ t_axe_expression handle_binary_comparison (t_program_infos *program
          notifyError(AXE_INVALID_EXPRESSION);
    }
 
-   /* return the new expression */
-   return create_expression (output_register, REGISTER);
+   /* return the new expression. A branch on its value can test
+    * directly the flags set by the subtraction */
+   result = create_expression (output_register, REGISTER);
+   result.condition = create_condition(program, NULL, exp1, exp2);
+   return result;
+}
+
+t_axe_expression handle_logical_op (t_program_infos *program
+         , t_axe_expression exp1, t_axe_expression exp2, t_list *split
+         , int binop)
+{
+   t_axe_expression result;
+
+   result = handle_bin_numeric_op(program, exp1, exp2, binop);
+
+   /* a constant operand is folded into an immediate instruction */
+   if (  (exp1.expression_type == IMMEDIATE)
+         || (exp2.expression_type == IMMEDIATE) )
+   {
+      return result;
+   }
+
+   /* remember the operands, for the branches on the value of `result' */
+   result.condition = create_condition(program, split, exp1, exp2);
+   return result;
+}
+
+t_axe_expression handle_logical_not (t_program_infos *program
+         , t_axe_expression exp)
+{
+   t_axe_expression result;
+   int output_register;
+
+   if (exp.expression_type == IMMEDIATE)
+      return create_expression(!(exp.value), IMMEDIATE);
+
+   /* Generate a NOTL instruction which will store the negated
+    * logic value into a new register */
+   output_register = getNewRegister(program);
+   gen_notl_instruction(program, output_register, exp.value);
+
+   result = create_expression(output_register, REGISTER);
+   result.condition = create_condition(program, NULL, exp, exp);
+   return result;
+}
+
+/* Returns the description of the logical operation computed by the last
+ * instruction generated. */
+t_axe_condition * create_condition(t_program_infos *program
+         , t_list *split, t_axe_expression left, t_axe_expression right)
+{
+   t_axe_condition *condition;
+
+   condition = (t_axe_condition *)
+         arenaAlloc(program->arena, sizeof(t_axe_condition));
+   if (condition == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   condition->instr = (t_axe_instruction *)
+         LDATA(getInstrInsertionPoint(program));
+   condition->split = split;
+   condition->left = left;
+   condition->right = right;
+   return condition;
+}
+
+/* Generates after `end' the instructions which branch to `label' if the
+ * value of `exp' is TRUE (when `sense' is non-zero) or FALSE (otherwise).
+ * `*next' is the label of the instruction which follows the code of `exp';
+ * it is reserved here if it is needed and it is NULL. Returns the last
+ * branch generated, which is the last instruction of the code of `exp'. */
+t_axe_instruction * gen_operand_branch(t_program_infos *program
+         , t_axe_expression exp, t_list *end, int sense, t_axe_label *label
+         , t_axe_label **next)
+{
+   t_axe_condition *condition;
+   t_axe_instruction *branch;
+   t_axe_instruction *left_branch;
+   t_axe_label *middle;
+   t_list *end_right;
+   int opcode;
+   int moved;
+
+   condition = exp.condition;
+   if (condition == NULL)
+   {
+      /* test the value of the expression */
+      moved = (end != getInstrInsertionPoint(program));
+      if (moved)
+         pushInstrInsertionPoint(program, end);
+
+      if (exp.expression_type == IMMEDIATE)
+         gen_load_immediate(program, exp.value);
+      else
+         gen_andb_instruction(program, exp.value,
+               exp.value, exp.value, CG_DIRECT_ALL);
+
+      if (sense)
+         branch = gen_bne_instruction(program, label, 0);
+      else
+         branch = gen_beq_instruction(program, label, 0);
+
+      if (moved)
+         popInstrInsertionPoint(program);
+      return branch;
+   }
+
+   /* the value of the logical operation is not computed anymore */
+   opcode = condition->instr->opcode;
+   end_right = LPREV(getInstructionLink(condition->instr));
+   removeInstructionLink(program, getInstructionLink(condition->instr));
+
+   /* NOT: branch on the opposite value of the operand */
+   if (opcode == NOTL)
+   {
+      return gen_operand_branch(program, condition->left
+            , end_right, !sense, label, next);
+   }
+
+   /* comparison: branch on the flags set by the subtraction */
+   if (opcode != ANDL && opcode != ORL)
+   {
+      moved = (end_right != getInstrInsertionPoint(program));
+      if (moved)
+         pushInstrInsertionPoint(program, end_right);
+
+      branch = gen_comparison_branch(program, opcode, sense, label);
+
+      if (moved)
+         popInstrInsertionPoint(program);
+      return branch;
+   }
+
+   /* if the first operand of an AND is FALSE (or the first operand of an
+    * OR is TRUE), the second operand is not evaluated */
+   middle = NULL;
+   if ((opcode == ANDL) == !sense)
+   {
+      branch = gen_operand_branch(program, condition->left
+            , condition->split, sense, label, &middle);
+   }
+   else
+   {
+      if (*next == NULL)
+         *next = newLabel(program);
+      branch = gen_operand_branch(program, condition->left
+            , condition->split, !sense, *next, &middle);
+   }
+
+   /* the second operand may have generated no instructions */
+   left_branch = branch;
+   if (end_right == condition->split)
+      end_right = getInstructionLink(left_branch);
+   branch = gen_operand_branch(program, condition->right
+         , end_right, sense, label, next);
+
+   /* the first operand continues with the code of the second one */
+   if (middle != NULL)
+   {
+      pushInstrInsertionPoint(program, getInstructionLink(left_branch));
+      assignLabel(program, middle);
+      popInstrInsertionPoint(program);
+   }
+
+   return branch;
+}
+
+/* Generates a branch to `label', taken if the relation tested by the set
+ * instruction `opcode' holds (when `sense' is non-zero) or does not hold
+ * (otherwise) */
+t_axe_instruction * gen_comparison_branch(t_program_infos *program
+         , int opcode, int sense, t_axe_label *label)
+{
+   int branch;
+
+   switch(opcode)
+   {
+      case SLT : branch = BLT; break;
+      case SGT : branch = BGT; break;
+      case SEQ : branch = BEQ; break;
+      case SNE : branch = BNE; break;
+      case SLE : branch = BLE; break;
+      case SGE : branch = BGE; break;
+      default :
+         notifyError(AXE_INVALID_EXPRESSION);
+         return NULL;
+   }
+   if (!sense)
+      branch = getOppositeBranchOpcode(branch);
+
+   switch(branch)
+   {
+      case BLT : return gen_blt_instruction(program, label, 0);
+      case BGT : return gen_bgt_instruction(program, label, 0);
+      case BEQ : return gen_beq_instruction(program, label, 0);
+      case BNE : return gen_bne_instruction(program, label, 0);
+      case BLE : return gen_ble_instruction(program, label, 0);
+      default : return gen_bge_instruction(program, label, 0);
+   }
+}
+
+t_axe_instruction * gen_condition_branch(t_program_infos *program
+         , t_axe_expression exp, int sense, t_axe_label *label)
+{
+   t_axe_instruction *branch;
+   t_axe_label *next;
+
+   next = NULL;
+   branch = gen_operand_branch(program, exp
+         , getInstrInsertionPoint(program), sense, label, &next);
+
+   /* the label of the instruction which follows the condition */
+   if (next != NULL)
+      assignLabel(program, next);
+   return branch;
 }
@@ -61,4 +61,31 @@ extern t_axe_expression handle_bin_numeric_op(t_program_infos *program,
 extern t_axe_expression handle_binary_comparison(t_program_infos *program,
       t_axe_expression exp1, t_axe_expression exp2, int condition);
 
+/* This function generates instructions for the logical operations
+ * ANDL and ORL, like handle_bin_numeric_op. `split' is the last
+ * instruction of the code of `exp1'. When both the operands are not
+ * IMMEDIATE, the expression returned remembers them: if its value is only
+ * used by gen_condition_branch, the operands are tested by separate
+ * branches, and the second one is skipped when the first decides the
+ * result. */
+extern t_axe_expression handle_logical_op(t_program_infos *program,
+      t_axe_expression exp1, t_axe_expression exp2, t_list *split,
+      int binop);
+
+/* This function generates the instructions which compute the logical NOT
+ * of `exp'. Like handle_logical_op, the expression returned remembers its
+ * operand: a branch on its value is lowered to a branch on `exp'. */
+extern t_axe_expression handle_logical_not(t_program_infos *program,
+      t_axe_expression exp);
+
+/* This function generates a branch to `label', taken if the value of
+ * `exp' is TRUE when `sense' is non-zero, or FALSE when `sense' is zero.
+ * The code of `exp' must have been generated just before. The logical
+ * operations returned by handle_logical_op and handle_logical_not are
+ * lowered to a sequence of branches on their operands, and the comparisons
+ * returned by handle_binary_comparison to a single conditional branch
+ * after the subtraction. Returns the last branch generated. */
+extern t_axe_instruction *gen_condition_branch(t_program_infos *program,
+      t_axe_expression exp, int sense, t_axe_label *label);
+
 #endif
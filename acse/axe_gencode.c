@@ -11,6 +11,7 @@
 #include "axe_gencode.h"
 #include "axe_errors.h"
 #include "axe_utils.h"
+#include "axe_labels.h"
 
 
 static t_axe_instruction * gen_unary_instruction (t_program_infos *program,
@@ -21,6 +22,8 @@ static t_axe_instruction * gen_ternary_instruction (t_program_infos *program,
       int opcode, int r_dest, int r_source1, int r_source2, int flags, int type);
 static t_axe_instruction * gen_jump_instruction (t_program_infos *program,
       int opcode, t_axe_label *label, int addr);
+static t_axe_register * copy_register(t_program_infos *program,
+      t_axe_register *reg, t_hashmap *registers, int define);
 
 
 t_axe_instruction * gen_bt_instruction
@@ -418,7 +421,7 @@ t_axe_instruction * gen_halt_instruction
       notifyError(AXE_PROGRAM_NOT_INITIALIZED);
       
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(HALT);
+   instr = alloc_instruction(program->arena, HALT);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
@@ -439,7 +442,7 @@ t_axe_instruction * gen_nop_instruction(t_program_infos *program)
       notifyError(AXE_PROGRAM_NOT_INITIALIZED);
    
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(NOP);
+   instr = alloc_instruction(program->arena, NOP);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
@@ -486,13 +489,13 @@ t_axe_instruction * gen_unary_instruction (t_program_infos *program
       notifyError(AXE_INVALID_OPCODE);
 
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(opcode);
+   instr = alloc_instruction(program->arena, opcode);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
 
    /* initialize a register info */
-   reg = alloc_register(r_dest, type, 0);
+   reg = alloc_register(program->arena, r_dest, type, 0);
 
    if (reg == NULL)
    {
@@ -504,7 +507,7 @@ t_axe_instruction * gen_unary_instruction (t_program_infos *program
    instr->reg_1 = reg;
 
    /* initialize an address info */
-   address = alloc_address(addressType, addr, label);
+   address = alloc_address(program->arena, addressType, addr, label);
    
    if (address == NULL)
    {
@@ -558,13 +561,13 @@ t_axe_instruction * gen_binary_instruction (t_program_infos *program,
    }
 
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(opcode);
+   instr = alloc_instruction(program->arena, opcode);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
 
    /* initialize a register info */
-   reg_dest = alloc_register(r_dest, type, 0);
+   reg_dest = alloc_register(program->arena, r_dest, type, 0);
    if (reg_dest == NULL)
    {
       free_Instruction(instr);
@@ -574,7 +577,7 @@ t_axe_instruction * gen_binary_instruction (t_program_infos *program,
    /* update the reg_1 info */
    instr->reg_1 = reg_dest;
 
-   reg_source1 = alloc_register(r_source1, type, 0);
+   reg_source1 = alloc_register(program->arena, r_source1, type, 0);
    if (reg_source1 == NULL)
    {
       free_Instruction(instr);
@@ -624,7 +627,7 @@ t_axe_instruction * gen_ternary_instruction (t_program_infos *program,
    }
 
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(opcode);
+   instr = alloc_instruction(program->arena, opcode);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
@@ -634,7 +637,7 @@ t_axe_instruction * gen_ternary_instruction (t_program_infos *program,
    int dest_type = type;
    if (dest_type != INFERRED_TYPE && dest_ind)
       dest_type |= PTR_TYPE_FLAG;
-   reg_dest = alloc_register(r_dest, dest_type, !!dest_ind);
+   reg_dest = alloc_register(program->arena, r_dest, dest_type, !!dest_ind);
    if (reg_dest == NULL)
    {
       free_Instruction(instr);
@@ -644,7 +647,7 @@ t_axe_instruction * gen_ternary_instruction (t_program_infos *program,
    /* update the reg_1 info */
    instr->reg_1 = reg_dest;
 
-   reg_source1 = alloc_register(r_source1, type, 0);
+   reg_source1 = alloc_register(program->arena, r_source1, type, 0);
    if (reg_source1 == NULL)
    {
       free_Instruction(instr);
@@ -658,7 +661,8 @@ t_axe_instruction * gen_ternary_instruction (t_program_infos *program,
    int src2_type = type;
    if (src2_type != INFERRED_TYPE && src2_ind)
       src2_type |= PTR_TYPE_FLAG;
-   reg_source2 = alloc_register(r_source2, src2_type, !!src2_ind);
+   reg_source2 = alloc_register(program->arena, r_source2, src2_type
+         , !!src2_ind);
    if (reg_source1 == NULL)
    {
       free_Instruction(instr);
@@ -713,13 +717,13 @@ t_axe_instruction * gen_jump_instruction (t_program_infos *program
       notifyError(AXE_INVALID_OPCODE);
 
    /* create an instance of `t_axe_instruction' */
-   instr = alloc_instruction(opcode);
+   instr = alloc_instruction(program->arena, opcode);
 
    if (instr == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
 
    /* initialize an address info */
-   address = alloc_address(addressType, addr, label);
+   address = alloc_address(program->arena, addressType, addr, label);
    
    if (address == NULL)
    {
@@ -736,3 +740,112 @@ t_axe_instruction * gen_jump_instruction (t_program_infos *program
    /* return the load instruction */
    return instr;
 }
+
+t_axe_register * copy_register(t_program_infos *program
+      , t_axe_register *reg, t_hashmap *registers, int define)
+{
+   t_axe_register *result;
+   void *renamed;
+   int ID;
+
+   if (reg == NULL)
+      return NULL;
+
+   ID = reg->ID;
+   if (define && !reg->indirect && ID != REG_0)
+      putInHashMap(registers, INTDATA(ID), INTDATA(getNewRegister(program)));
+
+   /* the registers defined by the condition are renamed */
+   if (getFromHashMap(registers, INTDATA(ID), &renamed))
+      ID = (int)(intptr_t)renamed;
+
+   result = alloc_register(program->arena, ID, reg->type, reg->indirect);
+   if (result == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   return result;
+}
+
+t_axe_instruction * gen_loop_condition_copy(t_program_infos *program
+      , t_axe_instruction *first, t_axe_instruction *last, t_axe_label *label)
+{
+   t_hashmap *labels, *registers;
+   t_axe_instruction *instr, *copy;
+   t_axe_label *target, *renamed;
+   t_list *current_element;
+
+   /* test if program is initialized */
+   if (program == NULL)
+      notifyError(AXE_PROGRAM_NOT_INITIALIZED);
+
+   if (first == NULL || last == NULL || !isJumpInstruction(last))
+      notifyError(AXE_INVALID_INSTRUCTION);
+
+   /* the registers written by the condition are renamed; the labels of the
+    * condition are renamed too, but for the label of `first', which is
+    * reached from outside the condition. Only the registers and the
+    * labels of the condition are stored, so that the cost of the copy does
+    * not grow with the size of the program. */
+   registers = allocHashMap(NULL, NULL);
+   labels = allocHashMap(NULL, NULL);
+
+   current_element = LNEXT(getInstructionLink(first));
+   for (instr = first; instr != last; current_element = LNEXT(current_element))
+   {
+      instr = (t_axe_instruction *) LDATA(current_element);
+      if (instr->labelID != NULL)
+      {
+         putInHashMap(labels, INTDATA(instr->labelID->labelID)
+               , newLabel(program));
+      }
+   }
+
+   copy = NULL;
+   current_element = getInstructionLink(first);
+   for (instr = NULL; instr != last; current_element = LNEXT(current_element))
+   {
+      instr = (t_axe_instruction *) LDATA(current_element);
+
+      copy = alloc_instruction(program->arena, instr->opcode);
+      if (copy == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+
+      /* the sources are read before the destination is written */
+      copy->reg_2 = copy_register(program, instr->reg_2, registers, 0);
+      copy->reg_3 = copy_register(program, instr->reg_3, registers, 0);
+      copy->reg_1 = copy_register(program, instr->reg_1, registers, 1);
+      copy->immediate = instr->immediate;
+      copy->mcFlags = instr->mcFlags;
+
+      if (instr->address != NULL)
+      {
+         target = instr->address->labelID;
+         if (instr == last)
+         {
+            copy->opcode = getOppositeBranchOpcode(instr->opcode);
+            target = label;
+         }
+         else if (target != NULL)
+         {
+            renamed = lookupHashMap(labels, INTDATA(target->labelID));
+            if (renamed != NULL)
+               target = renamed;
+         }
+
+         copy->address = alloc_address(program->arena, instr->address->type
+               , instr->address->addr, target);
+         if (copy->address == NULL)
+            notifyError(AXE_OUT_OF_MEMORY);
+      }
+
+      if (instr != first && instr->labelID != NULL)
+      {
+         assignLabel(program
+               , lookupHashMap(labels, INTDATA(instr->labelID->labelID)));
+      }
+      addInstruction(program, copy);
+   }
+
+   freeHashMap(registers);
+   freeHashMap(labels);
+   return copy;
+}
@@ -477,5 +477,19 @@ extern t_axe_instruction *gen_bgt_instruction(
 extern t_axe_instruction *gen_ble_instruction(
       t_program_infos *program, t_axe_label *label, int addr);
 
+/*----------------------------------------------------
+ *                   LOOP CONDITIONS
+ *---------------------------------------------------*/
+
+/* Generates a copy of the instructions from `first' to `last', which
+ * evaluate the condition of a loop and end with the conditional branch
+ * `last' out of the loop. The copy is placed at the end of the loop, so
+ * that each iteration executes a single branch: the registers it writes
+ * and the labels inside it are replaced with new ones, and its last branch
+ * is taken when `last' is not, jumping to `label'. Returns the copy of
+ * the branch. */
+extern t_axe_instruction *gen_loop_condition_copy(t_program_infos *program,
+      t_axe_instruction *first, t_axe_instruction *last, t_axe_label *label);
+
 
 #endif
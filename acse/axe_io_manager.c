@@ -10,8 +10,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include "axe_io_manager.h"
+#include "reg_alloc_constants.h"
 
 static t_io_infos * allocOutputInfos();
+static void printUsage(const char *program);
+static int parseOptions(t_io_infos *infos, int argc, char **argv);
 
 
 t_io_infos * initializeOutputInfos(int argc, char **argv)
@@ -32,11 +35,14 @@ t_io_infos * initializeOutputInfos(int argc, char **argv)
    if (result == NULL)
       return NULL;
    
-   argc--;
+   /* parse the options, and move the positional arguments at the
+    * beginning of argv */
+   argc = parseOptions(result, argc, argv);
    argv++;
 
    if (argc > 0)
    {
+      result->input_file_name = argv[0];
       result->input_file = fopen(argv[0], "r");
       if (result->input_file == NULL)
       {
@@ -122,6 +128,62 @@ t_io_infos * initializeOutputInfos(int argc, char **argv)
    return result;
 }
 
+void printUsage(const char *program)
+{
+   fprintf(stderr, "usage: %s [options] [input [output]]\n", program);
+   fprintf(stderr, "options:\n");
+   fprintf(stderr, "  --stats FILE   write the compilation statistics"
+         " (JSON) on FILE\n");
+   fprintf(stderr, "  --trace FILE   write a trace of the compilation phases"
+         " (Chrome trace format) on FILE\n");
+   fprintf(stderr, "  --regalloc ALG register allocation algorithm:"
+         " `linear' (linear scan,\n                 the default) or"
+         " `coloring' (graph coloring)\n");
+}
+
+/* Parse the options in argv. The positional arguments are moved (in order)
+ * right after argv[0]; their number is returned. */
+int parseOptions(t_io_infos *infos, int argc, char **argv)
+{
+   int numPositional = 0;
+   int i;
+
+   for (i = 1; i < argc; i++)
+   {
+      char **value = NULL;
+
+      if (argv[i][0] != '-' || argv[i][1] == '\0') {
+         argv[++numPositional] = argv[i];
+         continue;
+      }
+
+      if (strcmp(argv[i], "--stats") == 0)
+         value = &infos->stats_file_name;
+      else if (strcmp(argv[i], "--trace") == 0)
+         value = &infos->trace_file_name;
+      else if (strcmp(argv[i], "--regalloc") == 0 && i + 1 < argc) {
+         if (strcmp(argv[i + 1], "linear") == 0)
+            infos->reg_alloc_algorithm = RA_LINEAR_SCAN;
+         else if (strcmp(argv[i + 1], "coloring") == 0)
+            infos->reg_alloc_algorithm = RA_GRAPH_COLORING;
+         else {
+            printUsage(argv[0]);
+            exit(-1);
+         }
+         i++;
+         continue;
+      }
+
+      if (value == NULL || i + 1 >= argc) {
+         printUsage(argv[0]);
+         exit(-1);
+      }
+      *value = argv[++i];
+   }
+
+   return numPositional;
+}
+
 t_io_infos * allocOutputInfos()
 {
    t_io_infos *result;
@@ -135,7 +197,11 @@ t_io_infos * allocOutputInfos()
       return NULL;
       
    /* initialize the instance internal data */
+   result->input_file_name = "standard input";
    result->output_file_name = NULL;
+   result->stats_file_name = NULL;
+   result->trace_file_name = NULL;
+   result->reg_alloc_algorithm = RA_LINEAR_SCAN;
    result->input_file = stdin;
 #ifndef NDEBUG
    result->frontend_output = stdout;
@@ -18,7 +18,11 @@ extern FILE *yyin;
 
 typedef struct t_io_infos
 {
+   char *input_file_name;
    char *output_file_name;
+   char *stats_file_name;     /* JSON report of the compilation statistics */
+   char *trace_file_name;     /* Chrome trace of the compilation phases */
+   int reg_alloc_algorithm;   /* RA_LINEAR_SCAN or RA_GRAPH_COLORING */
    FILE *input_file;
 #ifndef NDEBUG
    FILE *frontend_output;
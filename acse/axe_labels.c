@@ -16,7 +16,11 @@
 
 struct t_axe_label_manager
 {
-   t_list *labels;
+   t_vector *labels;          /* the labels, indexed by their original ID */
+   t_hashmap *aliases;        /* for each label ID, a t_small_vector of the
+                               * labels which became aliases of it */
+   t_hashmap *names;          /* the label ID (INTDATA) of each label name.
+                               * The keys are owned by the map. */
    unsigned int current_label_ID;
    t_axe_label *label_to_assign;
 };
@@ -25,6 +29,14 @@ struct t_axe_label_manager
 void setRawLabelName(t_axe_label_manager *lmanager, t_axe_label *label,
       const char *finalName);
 
+/* Get the labels with the same ID of `label' (`label' included) */
+static void getLabelsWithSameID(t_axe_label_manager *lmanager
+      , t_axe_label *label, t_small_vector *result);
+
+/* Make `label' an alias of the labels with identifier `labelID' */
+static void makeLabelAlias(t_axe_label_manager *lmanager
+      , t_axe_label *label, unsigned int labelID);
+
 int isAssigningLabel(t_axe_label_manager *lmanager)
 {
    /* preconditions: lmanager must be different from NULL */
@@ -62,14 +74,15 @@ t_axe_label * newLabelID(t_axe_label_manager *lmanager)
 
    /* update the value of `current_label_ID' */
    lmanager->current_label_ID++;
+
+   /* add the new label to the list of labels (even if NULL, to keep
+    * the list indexed by ID) */
+   addToVector(lmanager->labels, result);
    
    /* tests if an out of memory occurred */
    if (result == NULL)
       return NULL;
 
-   /* add the new label to the list of labels */
-   lmanager->labels = addElement(lmanager->labels, result, -1);
-
    /* return the new label */
    return result;
 }
@@ -108,7 +121,7 @@ t_axe_label * assignLabelID(t_axe_label_manager *lmanager, t_axe_label *label)
          name = strdup(name);
       
       /* Change ID and name */
-      label->labelID = (lmanager->label_to_assign)->labelID;
+      makeLabelAlias(lmanager, label, (lmanager->label_to_assign)->labelID);
       setRawLabelName(lmanager, label, name);
 
       free(name);
@@ -135,7 +148,9 @@ t_axe_label_manager * initialize_label_manager()
       notifyError(AXE_OUT_OF_MEMORY);
 
    /* initialize the new instance */
-   result->labels = NULL;
+   result->labels = allocVector(0);
+   result->aliases = allocHashMap(NULL, NULL);
+   result->names = allocHashMap(hashString, compareStrings);
    result->current_label_ID = 0;
    result->label_to_assign = NULL;
 
@@ -145,32 +160,41 @@ t_axe_label_manager * initialize_label_manager()
 /* finalize an instance of `t_axe_label_manager' */
 void finalize_label_manager(t_axe_label_manager *lmanager)
 {
-   t_list *current_element;
    t_axe_label *current_label;
+   t_small_vector *current_aliases;
+   int i;
    
    /* preconditions */
    if (lmanager == NULL)
       return;
 
-   /* initialize `current_element' to the head of the list
-    * of labels */
-   current_element = lmanager->labels;
-
-   while (current_element != NULL)
+   for (i = 0; i < VSIZE(lmanager->labels); i++)
    {
       /* retrieve the current label */
-      current_label = (t_axe_label *) LDATA(current_element);
-      assert(current_label != NULL);
+      current_label = (t_axe_label *) VDATA(lmanager->labels, i);
 
       /* free the memory associated with the current label */
-      free_label(current_label);
-
-      /* fetch the next label */
-      current_element = LNEXT(current_element);
+      if (current_label != NULL)
+         free_label(current_label);
    }
 
    /* free the memory associated to the list of labels */
-   freeList(lmanager->labels);
+   freeVector(lmanager->labels);
+
+   /* free the sets of aliases and the names */
+   for (i = nextInHashMap(lmanager->aliases, 0); i >= 0
+         ; i = nextInHashMap(lmanager->aliases, i + 1))
+   {
+      current_aliases = (t_small_vector *) HMVALUE(lmanager->aliases, i);
+      finalizeSmallVector(current_aliases);
+      free(current_aliases);
+   }
+   freeHashMap(lmanager->aliases);
+
+   for (i = nextInHashMap(lmanager->names, 0); i >= 0
+         ; i = nextInHashMap(lmanager->names, i + 1))
+      free(HMKEY(lmanager->names, i));
+   freeHashMap(lmanager->names);
 
    free(lmanager);
 }
@@ -198,11 +222,8 @@ int get_number_of_labels(t_axe_label_manager *lmanager)
    if (lmanager == NULL)
       return 0;
 
-   if (lmanager->labels == NULL)
-      return 0;
-
    /* postconditions */
-   return getLength(lmanager->labels);
+   return VSIZE(lmanager->labels);
 }
 
 void setLabelName(t_axe_label_manager *lmanager, t_axe_label *label,
@@ -227,17 +248,12 @@ void setLabelName(t_axe_label_manager *lmanager, t_axe_label *label,
    finalName = calloc(allocatedSpace, 1);
    snprintf(finalName, allocatedSpace, "_%s", sanitizedName);
    do {
-      t_list *i;
+      void *ownerID;
       ok = 1;
-      for (i = lmanager->labels; i != NULL; i = LNEXT(i)) {
-         t_axe_label *thisLab = LDATA(i);
-         if (!thisLab->name || thisLab->labelID == label->labelID)
-            continue;
-         if (strcmp(finalName, thisLab->name) == 0) {
-            ok = 0;
-            snprintf(finalName, allocatedSpace, "_%s_%d", sanitizedName, ++serial);
-            break;
-         }
+      if (getFromHashMap(lmanager->names, finalName, &ownerID)
+            && (unsigned int)(intptr_t)ownerID != label->labelID) {
+         ok = 0;
+         snprintf(finalName, allocatedSpace, "_%s_%d", sanitizedName, ++serial);
       }
    } while (!ok);
 
@@ -249,21 +265,88 @@ void setLabelName(t_axe_label_manager *lmanager, t_axe_label *label,
 void setRawLabelName(t_axe_label_manager *lmanager, t_axe_label *label,
       const char *finalName)
 {
-   t_list *i;
-
-   /* check the entire list of labels because there might be two
-    * label objects with the same ID and they need to be kept in sync */
-   for (i = lmanager->labels; i != NULL; i = LNEXT(i)) {
-      t_axe_label *thisLab = LDATA(i);
-
-      if (thisLab->labelID == label->labelID) {
-         /* found! remove old name */
+   t_small_vector sameID;
+   void *storedName;
+   int i;
+
+   /* there might be two label objects with the same ID and they need to be
+    * kept in sync */
+   initSmallVector(&sameID);
+   getLabelsWithSameID(lmanager, label, &sameID);
+
+   for (i = 0; i < SVSIZE(&sameID); i++) {
+      t_axe_label *thisLab = SVDATA(&sameID, i);
+
+      /* remove old name */
+      if (thisLab->name) {
+         if (removeFromHashMap(lmanager->names, thisLab->name, &storedName))
+            free(storedName);
          free(thisLab->name);
-         /* change to new name */
-         if (finalName)
-            thisLab->name = strdup(finalName);
-         else
-            thisLab->name = NULL;
       }
+      /* change to new name */
+      if (finalName)
+         thisLab->name = strdup(finalName);
+      else
+         thisLab->name = NULL;
+   }
+
+   if (finalName) {
+      if (removeFromHashMap(lmanager->names, (void *)finalName, &storedName))
+         free(storedName);
+      putInHashMap(lmanager->names, strdup(finalName)
+            , INTDATA(label->labelID));
+   }
+
+   finalizeSmallVector(&sameID);
+}
+
+void getLabelsWithSameID(t_axe_label_manager *lmanager
+      , t_axe_label *label, t_small_vector *result)
+{
+   t_axe_label *original;
+   t_small_vector *aliases;
+   int i;
+
+   /* the label originally created with this ID, unless it became an
+    * alias of another label */
+   if (label->labelID < (unsigned int)VSIZE(lmanager->labels)) {
+      original = VDATA(lmanager->labels, label->labelID);
+      if (original != NULL && original->labelID == label->labelID)
+         addToSmallVector(result, original);
+   }
+
+   aliases = lookupHashMap(lmanager->aliases, INTDATA(label->labelID));
+   if (aliases == NULL)
+      return;
+   for (i = 0; i < SVSIZE(aliases); i++) {
+      if (findInSmallVector(result, SVDATA(aliases, i)) < 0)
+         addToSmallVector(result, SVDATA(aliases, i));
+   }
+}
+
+void makeLabelAlias(t_axe_label_manager *lmanager
+      , t_axe_label *label, unsigned int labelID)
+{
+   t_small_vector *aliases;
+   int pos;
+
+   /* forget the previous alias relationship, if any */
+   aliases = lookupHashMap(lmanager->aliases, INTDATA(label->labelID));
+   if (aliases != NULL) {
+      pos = findInSmallVector(aliases, label);
+      if (pos >= 0)
+         removeFromSmallVectorAt(aliases, pos);
+   }
+
+   label->labelID = labelID;
+
+   aliases = lookupHashMap(lmanager->aliases, INTDATA(labelID));
+   if (aliases == NULL) {
+      aliases = malloc(sizeof(t_small_vector));
+      if (aliases == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      initSmallVector(aliases);
+      putInHashMap(lmanager->aliases, INTDATA(labelID), aliases);
    }
+   addToSmallVector(aliases, label);
 }
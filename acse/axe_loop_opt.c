@@ -0,0 +1,1984 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_loop_opt.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include "axe_loop_opt.h"
+#include "axe_dce.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_labels.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+
+extern int cflow_errorcode;
+
+/* a natural loop, and the definitions which reach its instructions */
+typedef struct t_loop
+{
+   t_program_infos *program;
+   t_cflow_Graph *graph;
+   t_basic_block *header;
+   t_basic_block **blocks;    /* the blocks of the loop in reverse
+                               * postorder: the header is the first one */
+   int numBlocks;
+   int *position;             /* for each rpoNumber, the position of the
+                               * block in `blocks', or -1 */
+   int maxBlocks;             /* allocated size of `blocks' and `position' */
+   int writesMemory;          /* non-zero if an instruction of the loop
+                               * writes to memory */
+   int numVars;               /* number of variables referenced inside the
+                               * loop */
+   t_cflow_var **vars;        /* the variables referenced inside the loop */
+   int *varNumber;            /* for each variable index, the position of
+                               * the variable in `vars', or -1 */
+   int numDefs;               /* number of definitions inside the loop */
+   int *blockDefs;            /* for each block, its first definition */
+   int *nextDef;              /* for each definition, the next one of the
+                               * same variable, or -1 */
+   int *firstDef;             /* for each variable, the first of its
+                               * definitions, or -1 */
+   int *hoisted;              /* for each definition, non-zero if its
+                               * instruction has been moved */
+   int *copySource;           /* for each definition by an invariant copy,
+                               * the register which holds the same value
+                               * before the loop; -1 for the others */
+   int *reachedFromOutside;   /* for each variable, non-zero if one of
+                               * its uses in the loop may be reached by a
+                               * definition outside the loop */
+   t_bitset **reachIn;        /* the definitions which reach the beginning
+                               * and the end of each block. The definitions
+                               * outside the loop are summarized by one
+                               * element for each variable, which follows the
+                               * definitions of the loop */
+   t_bitset **reachOut;
+   int current;               /* the block being visited */
+   int *lastDef;              /* for each variable, its last definition in
+                               * the part of the block already visited, or
+                               * -1 */
+   t_bitset *extended;        /* the variables which may become live in more
+                               * places once the instructions are moved */
+}t_loop;
+
+/* the value of a register as a linear function of a variable, in the part
+ * of a block already visited: scale * var + base + offset. `var' is NULL
+ * for the constants; `base' is NULL or a variable which is not defined
+ * inside the loop. */
+typedef struct t_linear
+{
+   t_cflow_var *var;
+   int scale;
+   t_cflow_var *base;
+   int offset;
+   int varVersion;            /* the definitions of `var' and `base' which */
+   int baseVersion;           /* the value refers to */
+}t_linear;
+
+/* a register which holds scale * iv + base in the whole loop */
+typedef struct t_family
+{
+   t_cflow_var *iv;
+   int scale;
+   t_cflow_var *base;
+   int reg;
+}t_family;
+
+/* an instruction which depends on an induction variable */
+typedef struct t_iv_use
+{
+   t_basic_block *block;
+   t_cflow_Node *node;
+   t_cflow_var *iv;
+   t_family *family;          /* for an address, the family which computes
+                               * it */
+   int offset;                /* for an address, its offset from the family;
+                               * for an increment, the constant added; for a
+                               * test, the operand which is the induction
+                               * variable */
+   t_linear operands[2];      /* for a test, its operands */
+}t_iv_use;
+
+/* the induction variables of a loop, and their uses */
+typedef struct t_induction
+{
+   t_loop *loop;
+   t_cflow_var *psw;
+   int numVars;               /* number of variables when the loop has been
+                               * visited */
+   int *numDefs;              /* for each variable, the number of its
+                               * definitions inside the loop */
+   int *notInduction;         /* for each variable, non-zero if one of its
+                               * definitions is not an increment */
+   int *version;              /* for each variable, the number of its
+                               * definitions already visited */
+   t_linear *values;          /* for each variable, its value */
+   int *valueBlock;           /* for each variable, the block where its
+                               * value has been computed, or -1 */
+   int *valueVersion;         /* for each variable, the definition its
+                               * value refers to */
+   t_list *families;
+   t_list *reduced;           /* the addresses computed by a family */
+   t_list *increments;        /* the definitions of the induction
+                               * variables */
+   t_list *tests;             /* the comparisons of an induction variable
+                               * with an invariant value */
+}t_induction;
+
+static void checkCflowError(void);
+static int compareRpoNumbers(const void *a, const void *b);
+static int isInLoop(t_loop *loop, t_basic_block *block);
+static int isLoopHeader(t_basic_block *block);
+static int findLoop(t_loop *loop, t_basic_block *header);
+static int isLoad(t_axe_instruction *instr);
+static t_axe_register *getCopySource(t_axe_instruction *instr);
+static int writesMemory(t_axe_instruction *instr);
+static int isLive(t_bitset *live, t_cflow_var *var);
+static void addVariable(t_loop *loop, t_cflow_var *var);
+static void numberDefinitions(t_loop *loop);
+static void enterBlock(t_loop *loop, int block);
+static void visitNode(t_loop *loop, t_cflow_Node *node, int *def);
+static void leaveBlock(t_loop *loop);
+static void computeReachingDefinitions(t_loop *loop);
+static void freeReachingDefinitions(t_loop *loop);
+static int countDefinitions(t_loop *loop, t_cflow_var *var);
+static int getReachingDefinition(t_loop *loop, t_cflow_var *var);
+static int isInvariant(t_loop *loop, t_cflow_Node *node);
+static int getInvariantCopySource(t_loop *loop, t_cflow_Node *node);
+static void propagateCopies(t_loop *loop, t_cflow_Node *node);
+static int isLiveAfter(t_basic_block *block, t_list *element
+      , t_cflow_var *var);
+static int isLiveAtExits(t_loop *loop, t_cflow_var *var);
+static int dominatesExits(t_loop *loop, t_basic_block *block);
+static int canHoist(t_loop *loop, t_basic_block *block, t_list *element);
+static int fallsThrough(t_basic_block *block);
+static t_basic_block *getPreheader(t_loop *loop, int *created);
+static t_cflow_Node *getInsertionPoint(t_basic_block *preheader);
+static void linkPreheader(t_loop *loop, t_basic_block *preheader);
+static void completePreheader(t_loop *loop, t_basic_block *preheader
+      , int created, t_cflow_Node *before);
+static void moveNode(t_loop *loop, t_basic_block *block, t_cflow_Node *node
+      , t_basic_block *preheader, t_cflow_Node *before);
+static void extendLiveness(t_loop *loop, t_basic_block *block
+      , t_list *element);
+static void updateLiveness(t_loop *loop, t_basic_block *preheader);
+static int hoistInvariants(t_loop *loop);
+static int visitLoops(t_loop *loop, int (*visit)(t_loop *loop));
+static int isPointer(t_cflow_var *var);
+static int isInductionVariable(t_induction *ind, t_cflow_var *var);
+static int isInvariantValue(t_induction *ind, t_linear *value);
+static void getValue(t_induction *ind, int b, t_axe_register *reg
+      , t_linear *result);
+static int addInvariant(t_linear *result, t_linear *value);
+static int evaluateNode(t_induction *ind, t_cflow_Node *node, int b
+      , t_linear *result);
+static void recordNode(t_induction *ind, t_cflow_Node *node, int b
+      , t_linear *value, int linear);
+static void findInductionVariables(t_induction *ind);
+static t_iv_use *addUse(t_list **list, t_basic_block *block
+      , t_cflow_Node *node, t_cflow_var *iv);
+static t_family *getFamily(t_induction *ind, t_linear *value);
+static void findTest(t_induction *ind, t_basic_block *block
+      , t_list *element, int b);
+static void findUses(t_induction *ind);
+static t_cflow_Node *genNode(t_loop *loop, t_basic_block *block
+      , t_cflow_Node *before, int opcode, int dest, int src1, int src2
+      , int immediate);
+static int genAddress(t_induction *ind, t_family *family, int reg
+      , int offset, t_basic_block *preheader, t_cflow_Node *before);
+static int reduceAddresses(t_induction *ind, t_basic_block *preheader
+      , t_cflow_Node *before);
+static int isTestOf(t_induction *ind, t_cflow_Node *node, t_cflow_var *iv);
+static int isEqualityTest(t_induction *ind, t_iv_use *test);
+static int canReplaceTests(t_induction *ind, t_family *family);
+static int usesAny(t_cflow_Node *node, t_bitset *vars);
+static int findDependentVariables(t_induction *ind, t_cflow_var *iv
+      , t_bitset *depends);
+static int removeDependentNodes(t_induction *ind, t_cflow_var *iv
+      , t_bitset *vars);
+static void replaceTests(t_induction *ind, t_basic_block *preheader
+      , t_cflow_Node *before);
+static void freeUses(t_list *uses);
+static int reduceStrength(t_loop *loop);
+
+
+void checkCflowError(void)
+{
+   if (cflow_errorcode != CFLOW_OK)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+}
+
+int compareRpoNumbers(const void *a, const void *b)
+{
+   return (*(t_basic_block **) a)->rpoNumber
+         - (*(t_basic_block **) b)->rpoNumber;
+}
+
+int isInLoop(t_loop *loop, t_basic_block *block)
+{
+   if (block == loop->graph->endingBlock || block->rpoNumber < 0)
+      return 0;
+   return loop->position[block->rpoNumber] >= 0;
+}
+
+/* Returns non-zero if `block' is the destination of a back edge */
+int isLoopHeader(t_basic_block *block)
+{
+   t_list *current_pred;
+
+   for (current_pred = block->pred; current_pred != NULL
+         ; current_pred = LNEXT(current_pred))
+   {
+      if (dominates(block, (t_basic_block *) LDATA(current_pred)))
+         return 1;
+   }
+   return 0;
+}
+
+/* Collects the blocks of the natural loop whose header is `header'.
+ * Returns zero if no back edge reaches `header'. */
+int findLoop(t_loop *loop, t_basic_block *header)
+{
+   t_list *current_pred;
+   int i, isLoop;
+
+   /* forget the previous loop */
+   for (i = 0; i < loop->numBlocks; i++) {
+      if (loop->blocks[i]->rpoNumber >= 0)
+         loop->position[loop->blocks[i]->rpoNumber] = -1;
+   }
+   loop->header = header;
+   loop->numBlocks = 0;
+   if (header->rpoNumber < 0)
+      return 0;
+
+   /* the sources of the back edges are in the loop; the loop contains all
+    * the blocks which reach them without passing through the header.
+    * `blocks' is used as a worklist. */
+   loop->position[header->rpoNumber] = loop->numBlocks;
+   loop->blocks[loop->numBlocks++] = header;
+   isLoop = 0;
+   for (current_pred = header->pred; current_pred != NULL
+         ; current_pred = LNEXT(current_pred))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+      if (!dominates(header, pred))
+         continue;
+      isLoop = 1;
+      if (loop->position[pred->rpoNumber] < 0) {
+         loop->position[pred->rpoNumber] = loop->numBlocks;
+         loop->blocks[loop->numBlocks++] = pred;
+      }
+   }
+   if (!isLoop)
+      return 0;
+
+   for (i = 1; i < loop->numBlocks; i++)
+   {
+      for (current_pred = loop->blocks[i]->pred; current_pred != NULL
+            ; current_pred = LNEXT(current_pred))
+      {
+         t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+         if (pred->rpoNumber < 0 || loop->position[pred->rpoNumber] >= 0)
+            continue;
+         loop->position[pred->rpoNumber] = loop->numBlocks;
+         loop->blocks[loop->numBlocks++] = pred;
+      }
+   }
+
+   /* the header dominates the other blocks, so it is still the first */
+   qsort(loop->blocks, loop->numBlocks, sizeof(t_basic_block *)
+         , compareRpoNumbers);
+   for (i = 0; i < loop->numBlocks; i++)
+      loop->position[loop->blocks[i]->rpoNumber] = i;
+   return 1;
+}
+
+/* Returns non-zero if `instr' reads from memory */
+int isLoad(t_axe_instruction *instr)
+{
+   if (instr->opcode == LOAD)
+      return 1;
+   return (instr->reg_2 != NULL && instr->reg_2->indirect)
+         || (instr->reg_3 != NULL && instr->reg_3->indirect);
+}
+
+/* Returns the register copied by `instr', or NULL if `instr' is not a
+ * copy between registers. The copies of R0 load a constant. */
+t_axe_register *getCopySource(t_axe_instruction *instr)
+{
+   t_axe_register *dest, *src;
+
+   if (instr->reg_1 == NULL || instr->reg_1->ID == REG_0
+         || instr->reg_1->indirect)
+      return NULL;
+
+   /* ADDI Rd Rs #0 is the copy used by the frontend to read a variable */
+   if (instr->opcode == ADDI && instr->immediate == 0
+         && instr->reg_2 != NULL)
+      src = instr->reg_2;
+   else if (!isMoveInstruction(instr, &dest, &src, NULL, NULL))
+      return NULL;
+
+   if (src == NULL || src->indirect || src->ID == REG_0)
+      return NULL;
+   return src;
+}
+
+/* Returns non-zero if `instr' may write to memory */
+int writesMemory(t_axe_instruction *instr)
+{
+   if (instr->opcode == STORE || instr->opcode == JSR)
+      return 1;
+   return instr->reg_1 != NULL && instr->reg_1->indirect;
+}
+
+int isLive(t_bitset *live, t_cflow_var *var)
+{
+   if (live == NULL)
+      return 0;
+   /* nothing is known about the variables created after the analysis */
+   if (var->index >= live->size)
+      return 1;
+   return isInBitset(live, var->index);
+}
+
+void addVariable(t_loop *loop, t_cflow_var *var)
+{
+   if (var == NULL || loop->varNumber[var->index] >= 0)
+      return;
+   loop->varNumber[var->index] = loop->numVars;
+   loop->vars[loop->numVars++] = var;
+}
+
+/* Numbers the variables and the definitions of the loop */
+void numberDefinitions(t_loop *loop)
+{
+   int b, i, def, var;
+
+   loop->writesMemory = 0;
+   loop->numDefs = 0;
+   loop->blockDefs = malloc(sizeof(int) * loop->numBlocks);
+   if (loop->blockDefs == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      t_list *current_element = loop->blocks[b]->nodes;
+
+      loop->blockDefs[b] = loop->numDefs;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         if (writesMemory(node->instr))
+            loop->writesMemory = 1;
+         for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+            if (node->defs[i] != NULL)
+               loop->numDefs++;
+            addVariable(loop, node->defs[i]);
+         }
+         for (i = 0; i < CFLOW_MAX_USES; i++)
+            addVariable(loop, node->uses[i]);
+      }
+   }
+
+   loop->nextDef = malloc(sizeof(int) * (loop->numDefs + 1));
+   loop->hoisted = calloc(loop->numDefs + 1, sizeof(int));
+   loop->copySource = malloc(sizeof(int) * (loop->numDefs + 1));
+   loop->firstDef = malloc(sizeof(int) * (loop->numVars + 1));
+   loop->reachedFromOutside = calloc(loop->numVars + 1, sizeof(int));
+   loop->lastDef = malloc(sizeof(int) * (loop->numVars + 1));
+   if (loop->nextDef == NULL || loop->hoisted == NULL
+         || loop->copySource == NULL || loop->firstDef == NULL
+         || loop->reachedFromOutside == NULL || loop->lastDef == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < loop->numVars; i++) {
+      loop->firstDef[i] = -1;
+      loop->lastDef[i] = -1;
+   }
+   for (i = 0; i < loop->numDefs; i++)
+      loop->copySource[i] = -1;
+
+   def = 0;
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      t_list *current_element = loop->blocks[b]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            if (node->defs[i] == NULL)
+               continue;
+            var = loop->varNumber[node->defs[i]->index];
+            loop->nextDef[def] = loop->firstDef[var];
+            loop->firstDef[var] = def;
+            def++;
+         }
+      }
+   }
+}
+
+void enterBlock(t_loop *loop, int block)
+{
+   loop->current = block;
+}
+
+/* Records the definitions of `node', the next node of the block being
+ * visited. `def' is the number of its first definition, and is advanced
+ * past its definitions. */
+void visitNode(t_loop *loop, t_cflow_Node *node, int *def)
+{
+   int i;
+
+   for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+      if (node->defs[i] != NULL)
+         loop->lastDef[loop->varNumber[node->defs[i]->index]] = (*def)++;
+   }
+}
+
+void leaveBlock(t_loop *loop)
+{
+   t_list *current_element = loop->blocks[loop->current]->nodes;
+   int i;
+
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+      for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+         if (node->defs[i] != NULL)
+            loop->lastDef[loop->varNumber[node->defs[i]->index]] = -1;
+      }
+   }
+}
+
+void computeReachingDefinitions(t_loop *loop)
+{
+   t_list *current_element, *current_pred;
+   t_bitset **gen, **kill, *reach;
+   int size, b, i, k, v, def, changed;
+
+   numberDefinitions(loop);
+   size = loop->numDefs + loop->numVars;
+
+   loop->reachIn = malloc(sizeof(t_bitset *) * loop->numBlocks);
+   loop->reachOut = malloc(sizeof(t_bitset *) * loop->numBlocks);
+   gen = malloc(sizeof(t_bitset *) * loop->numBlocks);
+   kill = malloc(sizeof(t_bitset *) * loop->numBlocks);
+   reach = allocBitset(size);
+   if (loop->reachIn == NULL || loop->reachOut == NULL || gen == NULL
+         || kill == NULL || reach == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   /* each block generates the last definition of each variable it defines,
+    * and kills all the other definitions of the variable */
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      loop->reachIn[b] = allocBitset(size);
+      loop->reachOut[b] = allocBitset(size);
+      gen[b] = allocBitset(size);
+      kill[b] = allocBitset(size);
+      if (loop->reachIn[b] == NULL || loop->reachOut[b] == NULL
+            || gen[b] == NULL || kill[b] == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+
+      enterBlock(loop, b);
+      def = loop->blockDefs[b];
+      current_element = loop->blocks[b]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            if (node->defs[i] == NULL)
+               continue;
+            v = loop->varNumber[node->defs[i]->index];
+            if (loop->lastDef[v] >= 0)
+               continue;
+            for (k = loop->firstDef[v]; k >= 0; k = loop->nextDef[k])
+               addToBitset(kill[b], k);
+            addToBitset(kill[b], loop->numDefs + v);
+         }
+         visitNode(loop, node, &def);
+      }
+      for (v = 0; v < loop->numVars; v++) {
+         if (loop->lastDef[v] >= 0)
+            addToBitset(gen[b], loop->lastDef[v]);
+      }
+      leaveBlock(loop);
+   }
+
+   /* any definition outside the loop may reach its header */
+   for (v = 0; v < loop->numVars; v++)
+      addToBitset(loop->reachIn[0], loop->numDefs + v);
+
+   do {
+      changed = 0;
+      for (b = 0; b < loop->numBlocks; b++)
+      {
+         t_basic_block *block = loop->blocks[b];
+
+         for (current_pred = block->pred; current_pred != NULL
+               ; current_pred = LNEXT(current_pred))
+         {
+            t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+            if (isInLoop(loop, pred))
+               unionBitsets(loop->reachIn[b]
+                     , loop->reachOut[loop->position[pred->rpoNumber]]);
+         }
+
+         copyBitset(reach, loop->reachIn[b]);
+         subtractBitsets(reach, kill[b]);
+         unionBitsets(reach, gen[b]);
+         if (!equalBitsets(reach, loop->reachOut[b])) {
+            copyBitset(loop->reachOut[b], reach);
+            changed = 1;
+         }
+      }
+   } while (changed);
+
+   for (b = 0; b < loop->numBlocks; b++) {
+      freeBitset(gen[b]);
+      freeBitset(kill[b]);
+   }
+   free(gen);
+   free(kill);
+   freeBitset(reach);
+
+   /* find the variables whose value, in some use, may come from outside */
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      enterBlock(loop, b);
+      def = loop->blockDefs[b];
+      current_element = loop->blocks[b]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         for (i = 0; i < CFLOW_MAX_USES; i++)
+         {
+            if (node->uses[i] == NULL)
+               continue;
+            v = loop->varNumber[node->uses[i]->index];
+            if (loop->lastDef[v] < 0
+                  && isInBitset(loop->reachIn[b], loop->numDefs + v))
+               loop->reachedFromOutside[v] = 1;
+         }
+         visitNode(loop, node, &def);
+      }
+      leaveBlock(loop);
+   }
+}
+
+void freeReachingDefinitions(t_loop *loop)
+{
+   int b;
+
+   for (b = 0; b < loop->numBlocks; b++) {
+      freeBitset(loop->reachIn[b]);
+      freeBitset(loop->reachOut[b]);
+   }
+   free(loop->reachIn);
+   free(loop->reachOut);
+   free(loop->blockDefs);
+   free(loop->nextDef);
+   free(loop->firstDef);
+   free(loop->hoisted);
+   free(loop->copySource);
+   free(loop->reachedFromOutside);
+   free(loop->lastDef);
+   for (b = 0; b < loop->numVars; b++)
+      loop->varNumber[loop->vars[b]->index] = -1;
+   loop->numVars = 0;
+}
+
+int countDefinitions(t_loop *loop, t_cflow_var *var)
+{
+   int k, result = 0;
+
+   k = loop->firstDef[loop->varNumber[var->index]];
+   for (; k >= 0; k = loop->nextDef[k])
+      result++;
+   return result;
+}
+
+/* Returns the only definition of `var' inside the loop which reaches the
+ * next node of the block being visited. Returns -1 if no definition inside
+ * the loop reaches the node, and -2 if more than one definition reaches
+ * it. */
+int getReachingDefinition(t_loop *loop, t_cflow_var *var)
+{
+   t_bitset *reach = loop->reachIn[loop->current];
+   int v = loop->varNumber[var->index];
+   int k, result = -1;
+
+   if (loop->lastDef[v] >= 0)
+      return loop->lastDef[v];
+   for (k = loop->firstDef[v]; k >= 0; k = loop->nextDef[k])
+   {
+      if (!isInBitset(reach, k))
+         continue;
+      if (result >= 0 || isInBitset(reach, loop->numDefs + v))
+         return -2;
+      result = k;
+   }
+   return result;
+}
+
+/* Returns non-zero if each operand of `node', the next node of the block
+ * being visited, is reached only by the definitions outside the loop, or
+ * by a single definition which has been moved out of the loop or is an
+ * invariant copy. */
+int isInvariant(t_loop *loop, t_cflow_Node *node)
+{
+   int i, reaching;
+
+   for (i = 0; i < CFLOW_MAX_USES; i++)
+   {
+      if (node->uses[i] == NULL)
+         continue;
+      reaching = getReachingDefinition(loop, node->uses[i]);
+      if (reaching == -1)
+         continue;
+      if (reaching < 0 || (!loop->hoisted[reaching]
+            && loop->copySource[reaching] < 0))
+         return 0;
+   }
+   return 1;
+}
+
+/* Returns the register which holds, before the loop, the value copied by
+ * the invariant copy `node' */
+int getInvariantCopySource(t_loop *loop, t_cflow_Node *node)
+{
+   t_axe_register *src = getCopySource(node->instr);
+   int reaching;
+
+   reaching = getReachingDefinition(loop
+         , getCflowVariable(loop->graph, src->ID));
+   if (reaching >= 0 && loop->copySource[reaching] >= 0)
+      return loop->copySource[reaching];
+   return src->ID;
+}
+
+/* The invariant copies are not moved out of the loop, since their
+ * destination would be live in the whole loop: the moved instructions
+ * read the copied registers instead. */
+void propagateCopies(t_loop *loop, t_cflow_Node *node)
+{
+   t_axe_register *regs[3];
+   int i, reaching, changed;
+
+   regs[0] = node->instr->reg_1;
+   regs[1] = node->instr->reg_2;
+   regs[2] = node->instr->reg_3;
+   changed = 0;
+   for (i = 0; i < 3; i++)
+   {
+      /* the destination is not a use */
+      if (regs[i] == NULL || (i == 0 && !regs[i]->indirect))
+         continue;
+      reaching = getReachingDefinition(loop
+            , getCflowVariable(loop->graph, regs[i]->ID));
+      if (reaching >= 0 && loop->copySource[reaching] >= 0) {
+         regs[i]->ID = loop->copySource[reaching];
+         changed = 1;
+      }
+   }
+   if (changed) {
+      updateNodeDefUses(loop->graph, node);
+      checkCflowError();
+   }
+}
+
+/* Returns non-zero if `var' is live after the node in `element' */
+int isLiveAfter(t_basic_block *block, t_list *element, t_cflow_var *var)
+{
+   t_list *current_element;
+   int i;
+
+   for (current_element = LNEXT(element); current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (node->uses[i] == var)
+            return 1;
+      }
+      for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+         if (node->defs[i] == var)
+            return 0;
+      }
+   }
+   return isLive(block->liveOut, var);
+}
+
+/* Returns non-zero if `var' is live on some edge which leaves the loop */
+int isLiveAtExits(t_loop *loop, t_cflow_var *var)
+{
+   t_list *current_succ;
+   int b;
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      for (current_succ = loop->blocks[b]->succ; current_succ != NULL
+            ; current_succ = LNEXT(current_succ))
+      {
+         t_basic_block *succ = (t_basic_block *) LDATA(current_succ);
+         if (!isInLoop(loop, succ) && isLive(succ->liveIn, var))
+            return 1;
+      }
+   }
+   return 0;
+}
+
+/* Returns non-zero if `block' dominates all the blocks which leave the
+ * loop: its instructions are executed at least once in each execution of
+ * the loop. */
+int dominatesExits(t_loop *loop, t_basic_block *block)
+{
+   t_list *current_succ;
+   int b;
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      for (current_succ = loop->blocks[b]->succ; current_succ != NULL
+            ; current_succ = LNEXT(current_succ))
+      {
+         t_basic_block *succ = (t_basic_block *) LDATA(current_succ);
+         if (!isInLoop(loop, succ) && !dominates(block, loop->blocks[b]))
+            return 0;
+      }
+   }
+   return 1;
+}
+
+/* Returns non-zero if the invariant node in `element' can be moved to the
+ * preheader of the loop without changing the value of any variable where
+ * it is used */
+int canHoist(t_loop *loop, t_basic_block *block, t_list *element)
+{
+   t_cflow_Node *node = (t_cflow_Node *) LDATA(element);
+   int i, defines;
+
+   if (hasSideEffects(node->instr))
+      return 0;
+   /* a load is never executed in advance: its address may be valid only
+    * when the loop is not left before it */
+   if (isLoad(node->instr)
+         && (loop->writesMemory || !dominatesExits(loop, block)))
+      return 0;
+
+   defines = 0;
+   for (i = 0; i < CFLOW_MAX_DEFS; i++)
+   {
+      t_cflow_var *var = node->defs[i];
+
+      /* writing R0 has no effect */
+      if (var == NULL || var->ID == REG_0)
+         continue;
+      defines = 1;
+
+      if (!isLiveAfter(block, element, var)) {
+         /* the value is never used, but it must not overwrite the value
+          * which enters the loop */
+         if (isLive(loop->header->liveIn, var))
+            return 0;
+         continue;
+      }
+
+      /* the uses of the variable inside the loop must be reached only by
+       * this definition */
+      if (countDefinitions(loop, var) != 1
+            || loop->reachedFromOutside[loop->varNumber[var->index]])
+         return 0;
+      /* when the node may not be executed, the variable must not be used
+       * after the loop */
+      if (!dominatesExits(loop, block) && isLiveAtExits(loop, var))
+         return 0;
+   }
+   return defines;
+}
+
+int fallsThrough(t_basic_block *block)
+{
+   t_axe_instruction *last = ((t_cflow_Node *)
+         LDATA(getLastElement(block->nodes)))->instr;
+
+   return !isUnconditionalJump(last) && !isHaltOrRetInstruction(last);
+}
+
+/* Returns the block where the instructions moved out of the loop are
+ * placed. The only predecessor of the header outside the loop is reused if
+ * the header is its only successor; otherwise, a new empty block is placed
+ * before the header, and `created' is set. Returns NULL if the block which
+ * precedes the header in the code falls through to it from the loop. */
+t_basic_block *getPreheader(t_loop *loop, int *created)
+{
+   t_basic_block *entry, *prev, *result;
+   t_list *current_pred, *element;
+   t_axe_instruction *last;
+   int numEntries;
+
+   *created = 0;
+   entry = NULL;
+   numEntries = 0;
+   for (current_pred = loop->header->pred; current_pred != NULL
+         ; current_pred = LNEXT(current_pred))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_pred);
+      if (!isInLoop(loop, pred)) {
+         entry = pred;
+         numEntries++;
+      }
+   }
+
+   if (numEntries == 1 && getLength(entry->succ) == 1)
+   {
+      last = ((t_cflow_Node *) LDATA(getLastElement(entry->nodes)))->instr;
+      /* the moved instructions must not change the flags tested by the
+       * branch */
+      if (!isJumpInstruction(last) || isUnconditionalJump(last))
+         return entry;
+   }
+
+   element = findElement(loop->graph->blocks, loop->header);
+   assert(element != NULL);
+   prev = LPREV(element) != NULL
+         ? (t_basic_block *) LDATA(LPREV(element)) : NULL;
+   if (prev != NULL && isInLoop(loop, prev) && fallsThrough(prev))
+      return NULL;
+
+   result = allocBasicBlock(loop->graph);
+   checkCflowError();
+   insertBlockAfter(loop->graph, prev, result);
+   checkCflowError();
+   *created = 1;
+   return result;
+}
+
+/* Returns the node of `preheader' before which the instructions moved out
+ * of the loop are placed: its final jump, or NULL if they are appended */
+t_cflow_Node *getInsertionPoint(t_basic_block *preheader)
+{
+   t_cflow_Node *last;
+
+   if (preheader->nodes == NULL)
+      return NULL;
+   last = (t_cflow_Node *) LDATA(getLastElement(preheader->nodes));
+   return isJumpInstruction(last->instr) ? last : NULL;
+}
+
+/* Makes the new block `preheader' the only predecessor of the header
+ * outside the loop. The branches to the header from outside the loop are
+ * redirected to a new label on the first instruction of the preheader. */
+void linkPreheader(t_loop *loop, t_basic_block *preheader)
+{
+   t_axe_instruction *first, *last;
+   t_axe_label *label = NULL;
+   t_list *entries = NULL, *current_element;
+
+   first = ((t_cflow_Node *) LDATA(loop->header->nodes))->instr;
+   for (current_element = loop->header->pred; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+      if (!isInLoop(loop, pred))
+         entries = addElement(entries, pred, -1);
+   }
+
+   for (current_element = entries; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *entry = (t_basic_block *) LDATA(current_element);
+
+      removeEdge(entry, loop->header);
+      setSucc(entry, preheader);
+      checkCflowError();
+
+      last = ((t_cflow_Node *) LDATA(getLastElement(entry->nodes)))->instr;
+      if (!isJumpInstruction(last)
+            || !compareLabels(last->address->labelID, first->labelID))
+         continue;
+      if (label == NULL) {
+         label = newLabel(loop->program);
+         ((t_cflow_Node *) LDATA(preheader->nodes))->instr->labelID = label;
+      }
+      last->address = alloc_address(loop->program->arena, LABEL_TYPE, 0, label);
+      if (last->address == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+   }
+   freeList(entries);
+
+   setSucc(preheader, loop->header);
+   checkCflowError();
+}
+
+/* Completes `preheader' once the instructions have been placed in it,
+ * before the node `before' */
+void completePreheader(t_loop *loop, t_basic_block *preheader, int created
+      , t_cflow_Node *before)
+{
+   t_cflow_Node *first;
+
+   if (created) {
+      linkPreheader(loop, preheader);
+      return;
+   }
+   if (before == NULL || before->instr->labelID == NULL)
+      return;
+
+   /* the label of the block goes on its first instruction */
+   first = (t_cflow_Node *) LDATA(preheader->nodes);
+   if (first != before) {
+      first->instr->labelID = before->instr->labelID;
+      before->instr->labelID = NULL;
+   }
+}
+
+/* Moves `node' from `block' to `preheader', before the node `before' or at
+ * the end if `before' is NULL */
+void moveNode(t_loop *loop, t_basic_block *block, t_cflow_Node *node
+      , t_basic_block *preheader, t_cflow_Node *before)
+{
+   t_axe_instruction *instr = node->instr;
+   t_axe_instruction *placeholder;
+   t_cflow_Node *moved;
+
+   moved = allocNode(loop->graph, instr);
+   checkCflowError();
+
+   /* the label of the instruction stays in the loop */
+   placeholder = alloc_instruction(loop->program->arena, NOP);
+   if (placeholder == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   placeholder->labelID = instr->labelID;
+   instr->labelID = NULL;
+   node->instr = placeholder;
+   removeNodeFromBlock(block, node);
+   checkCflowError();
+
+   if (before != NULL)
+      insertNodeBefore(preheader, before, moved);
+   else
+      insertNode(preheader, moved);
+   checkCflowError();
+}
+
+/* Records the variables whose liveness changes when the node in `element'
+ * is moved: the operands, which are now read in the preheader, and the
+ * results which are used after it, which are now live in the whole loop.
+ * The results which are never used do not change the liveness. */
+void extendLiveness(t_loop *loop, t_basic_block *block, t_list *element)
+{
+   t_cflow_Node *node = (t_cflow_Node *) LDATA(element);
+   int i;
+
+   for (i = 0; i < CFLOW_MAX_USES; i++) {
+      if (node->uses[i] != NULL && node->uses[i]->ID != REG_0)
+         addToBitset(loop->extended, node->uses[i]->index);
+   }
+   for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+      if (node->defs[i] != NULL && node->defs[i]->ID != REG_0
+            && isLiveAfter(block, element, node->defs[i]))
+         addToBitset(loop->extended, node->defs[i]->index);
+   }
+}
+
+/* Updates the liveness informations of the loop and of its preheader
+ * without a new analysis: the variables recorded by extendLiveness are
+ * considered live everywhere in them. The sets may be larger than needed,
+ * which only makes the decisions about the enclosing loops more
+ * conservative; the liveness elsewhere can only shrink. */
+void updateLiveness(t_loop *loop, t_basic_block *preheader)
+{
+   int b;
+
+   if (preheader->liveIn == NULL) {
+      preheader->liveIn = allocBitset(loop->graph->numVariables);
+      preheader->liveOut = allocBitset(loop->graph->numVariables);
+      if (preheader->liveIn == NULL || preheader->liveOut == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      copyBitset(preheader->liveIn, loop->header->liveIn);
+      copyBitset(preheader->liveOut, loop->header->liveIn);
+   }
+   unionBitsets(preheader->liveIn, loop->extended);
+   unionBitsets(preheader->liveOut, loop->extended);
+   for (b = 0; b < loop->numBlocks; b++) {
+      unionBitsets(loop->blocks[b]->liveIn, loop->extended);
+      unionBitsets(loop->blocks[b]->liveOut, loop->extended);
+   }
+}
+
+/* Moves the invariant instructions of `loop' to its preheader. The blocks
+ * are visited in reverse postorder, so that the definitions which reach an
+ * instruction from inside the loop are considered before it. Returns the
+ * number of instructions moved. */
+int hoistInvariants(t_loop *loop)
+{
+   t_list *nodes = NULL, *owners = NULL;
+   t_list *current_element, *current_owner;
+   t_basic_block *preheader;
+   t_cflow_Node *before;
+   int b, i, k, def, created, result;
+
+   computeReachingDefinitions(loop);
+   clearBitset(loop->extended);
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      t_basic_block *block = loop->blocks[b];
+
+      enterBlock(loop, b);
+      def = loop->blockDefs[b];
+      for (current_element = block->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         if (getCopySource(node->instr) != NULL)
+         {
+            if (isInvariant(loop, node))
+               loop->copySource[def] = getInvariantCopySource(loop, node);
+         }
+         else if (isInvariant(loop, node)
+               && canHoist(loop, block, current_element))
+         {
+            propagateCopies(loop, node);
+            extendLiveness(loop, block, current_element);
+            for (i = 0, k = def; i < CFLOW_MAX_DEFS; i++) {
+               if (node->defs[i] != NULL)
+                  loop->hoisted[k++] = 1;
+            }
+            nodes = addElement(nodes, node, -1);
+            owners = addElement(owners, block, -1);
+         }
+         visitNode(loop, node, &def);
+      }
+      leaveBlock(loop);
+   }
+   freeReachingDefinitions(loop);
+
+   result = getLength(nodes);
+   preheader = result > 0 ? getPreheader(loop, &created) : NULL;
+   if (preheader == NULL) {
+      freeList(nodes);
+      freeList(owners);
+      return 0;
+   }
+
+   before = getInsertionPoint(preheader);
+
+   current_owner = owners;
+   for (current_element = nodes; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      moveNode(loop, (t_basic_block *) LDATA(current_owner)
+            , (t_cflow_Node *) LDATA(current_element), preheader, before);
+      current_owner = LNEXT(current_owner);
+   }
+   freeList(nodes);
+   freeList(owners);
+   updateLiveness(loop, preheader);
+
+   completePreheader(loop, preheader, created, before);
+   if (created)
+      addToStatistic("licm.preheaders", 1);
+   return result;
+}
+
+/* Calls `visit' on each loop of the graph, starting from the innermost ones,
+ * and returns the sum of the results. The liveness informations are
+ * computed once: `visit' must keep them conservative. */
+int visitLoops(t_loop *loop, int (*visit)(t_loop *loop))
+{
+   t_cflow_Graph *graph = loop->graph;
+   t_list *processed = NULL, *headers, *current_element;
+   int *pending;
+   int b, innermost, total;
+
+   loop->extended = allocBitset(graph->numVariables);
+   if (loop->extended == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   performLivenessAnalysis(graph);
+   checkCflowError();
+
+   /* each round visits the loops which do not contain other loops still to
+    * be visited. These loops are disjoint: the code moved out of one of
+    * them does not change the analysis of the others. */
+   total = 0;
+   for (;;)
+   {
+      /* number the new preheaders */
+      computeDominators(graph);
+      checkCflowError();
+
+      loop->maxBlocks = getLength(graph->blocks);
+      loop->numBlocks = 0;
+      loop->blocks = malloc(sizeof(t_basic_block *) * loop->maxBlocks);
+      loop->position = malloc(sizeof(int) * loop->maxBlocks);
+      pending = calloc(loop->maxBlocks, sizeof(int));
+      loop->numVars = 0;
+      loop->vars = malloc(sizeof(t_cflow_var *) * graph->numVariables);
+      loop->varNumber = malloc(sizeof(int) * graph->numVariables);
+      if (loop->blocks == NULL || loop->position == NULL || pending == NULL
+            || loop->vars == NULL || loop->varNumber == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      for (b = 0; b < loop->maxBlocks; b++)
+         loop->position[b] = -1;
+      for (b = 0; b < graph->numVariables; b++)
+         loop->varNumber[b] = -1;
+
+      headers = NULL;
+      for (current_element = graph->blocks; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *block = (t_basic_block *) LDATA(current_element);
+
+         if (block->rpoNumber < 0 || !isLoopHeader(block)
+               || findElement(processed, block) != NULL)
+            continue;
+         pending[block->rpoNumber] = 1;
+         headers = addElement(headers, block, -1);
+      }
+
+      for (current_element = headers; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *header = (t_basic_block *) LDATA(current_element);
+
+         findLoop(loop, header);
+         innermost = 1;
+         for (b = 1; b < loop->numBlocks; b++) {
+            if (loop->blocks[b]->rpoNumber >= 0
+                  && pending[loop->blocks[b]->rpoNumber])
+               innermost = 0;
+         }
+         if (innermost) {
+            total += visit(loop);
+            processed = addElement(processed, header, -1);
+         }
+      }
+
+      free(loop->blocks);
+      free(loop->position);
+      free(loop->vars);
+      free(loop->varNumber);
+      free(pending);
+      if (headers == NULL)
+         break;
+      freeList(headers);
+   }
+
+   freeList(processed);
+   freeBitset(loop->extended);
+   return total;
+}
+
+void hoistLoopInvariants(t_program_infos *program, t_cflow_Graph *graph)
+{
+   t_loop loop;
+
+   loop.program = program;
+   loop.graph = graph;
+   addToStatistic("licm.hoisted_instructions"
+         , visitLoops(&loop, hoistInvariants));
+}
+
+int isPointer(t_cflow_var *var)
+{
+   return var->type >= 0 && (var->type & PTR_TYPE_FLAG);
+}
+
+/* Returns non-zero if each definition of `var' inside the loop adds a
+ * constant to it */
+int isInductionVariable(t_induction *ind, t_cflow_var *var)
+{
+   if (var == NULL || var->ID == REG_0 || var->ID == VAR_PSW
+         || var->index >= ind->numVars)
+      return 0;
+   return ind->numDefs[var->index] > 0 && !ind->notInduction[var->index];
+}
+
+/* Returns non-zero if `value' does not change inside the loop */
+int isInvariantValue(t_induction *ind, t_linear *value)
+{
+   if (value->base != NULL)
+      return 0;
+   if (value->var == NULL)
+      return 1;
+   return value->scale == 1 && value->var->index < ind->numVars
+         && ind->numDefs[value->var->index] == 0;
+}
+
+/* Computes the value of `reg' before the next node of the block `b' */
+void getValue(t_induction *ind, int b, t_axe_register *reg
+      , t_linear *result)
+{
+   t_cflow_var *var = getCflowVariable(ind->loop->graph, reg->ID);
+   t_linear *known;
+   int index = var->index;
+
+   if (var->ID == REG_0) {
+      result->var = result->base = NULL;
+      result->scale = result->offset = 0;
+      return;
+   }
+
+   known = &ind->values[index];
+   if (ind->valueBlock[index] == b
+         && ind->valueVersion[index] == ind->version[index]
+         && (known->var == NULL
+            || known->varVersion == ind->version[known->var->index])
+         && (known->base == NULL
+            || known->baseVersion == ind->version[known->base->index]))
+   {
+      *result = *known;
+      return;
+   }
+
+   /* the current value of the variable */
+   result->var = var;
+   result->scale = 1;
+   result->base = NULL;
+   result->offset = 0;
+   result->varVersion = ind->version[index];
+}
+
+/* Adds the invariant `value' to `result'. Returns zero if the sum is not
+ * linear. */
+int addInvariant(t_linear *result, t_linear *value)
+{
+   if (value->var == NULL) {
+      result->offset += value->offset;
+      return 1;
+   }
+   if (result->var == NULL) {
+      result->var = value->var;
+      result->scale = 1;
+      result->varVersion = value->varVersion;
+   } else if (result->base == NULL) {
+      result->base = value->var;
+      result->baseVersion = value->varVersion;
+   } else {
+      return 0;
+   }
+   result->offset += value->offset;
+   return 1;
+}
+
+/* Computes the value defined by `node', the next node of the block `b'.
+ * Returns zero if it is not a linear function of a variable. */
+int evaluateNode(t_induction *ind, t_cflow_Node *node, int b
+      , t_linear *result)
+{
+   t_axe_instruction *instr = node->instr;
+   t_axe_register *src;
+   t_linear other;
+
+   if (instr->reg_1 == NULL || instr->reg_1->indirect
+         || instr->reg_1->ID == REG_0 || isJumpInstruction(instr))
+      return 0;
+   if ((instr->reg_2 != NULL && instr->reg_2->indirect)
+         || (instr->reg_3 != NULL && instr->reg_3->indirect))
+      return 0;
+
+   src = getCopySource(instr);
+   if (src != NULL) {
+      getValue(ind, b, src, result);
+      return 1;
+   }
+
+   switch (instr->opcode)
+   {
+      case ADDI :
+         getValue(ind, b, instr->reg_2, result);
+         result->offset += instr->immediate;
+         return 1;
+      case SUBI :
+         getValue(ind, b, instr->reg_2, result);
+         result->offset -= instr->immediate;
+         return 1;
+      case MULI :
+         getValue(ind, b, instr->reg_2, result);
+         if (result->base != NULL)
+            return 0;
+         result->scale *= instr->immediate;
+         result->offset *= instr->immediate;
+         return 1;
+      case ADD :
+         getValue(ind, b, instr->reg_2, result);
+         getValue(ind, b, instr->reg_3, &other);
+         if (isInvariantValue(ind, &other))
+            return addInvariant(result, &other);
+         if (isInvariantValue(ind, result)) {
+            t_linear value = *result;
+            *result = other;
+            return addInvariant(result, &value);
+         }
+         return 0;
+      case SUB :
+         getValue(ind, b, instr->reg_2, result);
+         getValue(ind, b, instr->reg_3, &other);
+         if (other.var != NULL || other.base != NULL)
+            return 0;
+         result->offset -= other.offset;
+         return 1;
+   }
+   return 0;
+}
+
+/* Records the definitions of `node', the next node of the block `b', whose
+ * destination has the value `value' if `linear' is non-zero */
+void recordNode(t_induction *ind, t_cflow_Node *node, int b
+      , t_linear *value, int linear)
+{
+   int i, index;
+
+   for (i = 0; i < CFLOW_MAX_DEFS; i++)
+   {
+      if (node->defs[i] == NULL)
+         continue;
+      index = node->defs[i]->index;
+      ind->version[index]++;
+      if (!linear || node->defs[i]->ID == VAR_PSW)
+         continue;
+      ind->values[index] = *value;
+      ind->valueBlock[index] = b;
+      ind->valueVersion[index] = ind->version[index];
+   }
+}
+
+/* Finds the variables whose definitions inside the loop all add a constant
+ * to their previous value */
+void findInductionVariables(t_induction *ind)
+{
+   t_loop *loop = ind->loop;
+   t_list *current_element;
+   t_linear value;
+   int b, i, linear;
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      for (current_element = loop->blocks[b]->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         linear = evaluateNode(ind, node, b, &value);
+         for (i = 0; i < CFLOW_MAX_DEFS; i++)
+         {
+            t_cflow_var *var = node->defs[i];
+
+            if (var == NULL || var->ID == VAR_PSW)
+               continue;
+            ind->numDefs[var->index]++;
+            if (!linear || value.var != var || value.scale != 1
+                  || value.base != NULL)
+               ind->notInduction[var->index] = 1;
+         }
+         recordNode(ind, node, b, &value, linear);
+      }
+   }
+}
+
+t_iv_use *addUse(t_list **list, t_basic_block *block, t_cflow_Node *node
+      , t_cflow_var *iv)
+{
+   t_iv_use *result = calloc(1, sizeof(t_iv_use));
+
+   if (result == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   result->block = block;
+   result->node = node;
+   result->iv = iv;
+   *list = addElement(*list, result, -1);
+   return result;
+}
+
+/* Returns the family of the registers which hold scale * iv + base,
+ * creating it if needed */
+t_family *getFamily(t_induction *ind, t_linear *value)
+{
+   t_list *current_element;
+   t_family *family;
+
+   for (current_element = ind->families; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      family = (t_family *) LDATA(current_element);
+      if (family->iv == value->var && family->scale == value->scale
+            && family->base == value->base)
+         return family;
+   }
+
+   family = malloc(sizeof(t_family));
+   if (family == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   family->iv = value->var;
+   family->scale = value->scale;
+   family->base = value->base;
+   family->reg = REG_INVALID;
+   ind->families = addElement(ind->families, family, -1);
+   return family;
+}
+
+/* Records a test of `node' which compares an induction variable with an
+ * invariant value, if its result is used only through the flags */
+void findTest(t_induction *ind, t_basic_block *block, t_list *element
+      , int b)
+{
+   t_cflow_Node *node = (t_cflow_Node *) LDATA(element);
+   t_axe_instruction *instr = node->instr;
+   t_linear operands[2];
+   t_iv_use *test;
+   int i;
+
+   if (instr->opcode != SUB && instr->opcode != SUBI)
+      return;
+   if (instr->reg_1->indirect || instr->reg_1->ID == REG_0
+         || instr->reg_2->indirect
+         || (instr->reg_3 != NULL && instr->reg_3->indirect))
+      return;
+   if (node->defs[0] == NULL || isLiveAfter(block, element, node->defs[0]))
+      return;
+
+   getValue(ind, b, instr->reg_2, &operands[0]);
+   if (instr->opcode == SUB) {
+      getValue(ind, b, instr->reg_3, &operands[1]);
+   } else {
+      operands[1].var = operands[1].base = NULL;
+      operands[1].scale = 0;
+      operands[1].offset = instr->immediate;
+   }
+
+   for (i = 0; i < 2; i++)
+   {
+      if (isInductionVariable(ind, operands[i].var)
+            && operands[i].scale == 1 && operands[i].base == NULL
+            && isInvariantValue(ind, &operands[1 - i]))
+      {
+         test = addUse(&ind->tests, block, node, operands[i].var);
+         test->operands[0] = operands[0];
+         test->operands[1] = operands[1];
+         test->offset = i;
+         return;
+      }
+   }
+}
+
+/* Finds the addresses computed from an induction variable, the increments
+ * of the induction variables and their tests */
+void findUses(t_induction *ind)
+{
+   t_loop *loop = ind->loop;
+   t_list *current_element;
+   t_linear value;
+   t_iv_use *use;
+   int b, linear;
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      t_basic_block *block = loop->blocks[b];
+
+      for (current_element = block->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         findTest(ind, block, current_element, b);
+         linear = evaluateNode(ind, node, b, &value);
+         if (linear && isInductionVariable(ind, node->defs[0])) {
+            use = addUse(&ind->increments, block, node, node->defs[0]);
+            use->offset = value.offset;
+         } else if (linear && isInductionVariable(ind, value.var)
+               && value.base != NULL && isPointer(value.base)
+               && value.scale != 0) {
+            use = addUse(&ind->reduced, block, node, value.var);
+            use->family = getFamily(ind, &value);
+            use->offset = value.offset;
+         }
+         recordNode(ind, node, b, &value, linear);
+      }
+   }
+}
+
+/* Creates a node for a new instruction, and inserts it in `block' before
+ * `before', or at its end if `before' is NULL */
+t_cflow_Node *genNode(t_loop *loop, t_basic_block *block
+      , t_cflow_Node *before, int opcode, int dest, int src1, int src2
+      , int immediate)
+{
+   t_arena *arena = loop->program->arena;
+   t_axe_instruction *instr;
+   t_cflow_Node *node;
+
+   instr = alloc_instruction(arena, opcode);
+   if (instr == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   instr->reg_1 = alloc_register(arena, dest, INFERRED_TYPE, 0);
+   instr->reg_2 = alloc_register(arena, src1, INFERRED_TYPE, 0);
+   if (src2 != REG_INVALID)
+      instr->reg_3 = alloc_register(arena, src2, INFERRED_TYPE, 0);
+   if (instr->reg_1 == NULL || instr->reg_2 == NULL
+         || (src2 != REG_INVALID && instr->reg_3 == NULL))
+      notifyError(AXE_OUT_OF_MEMORY);
+   instr->immediate = immediate;
+
+   node = allocNode(loop->graph, instr);
+   checkCflowError();
+   updateNodeDefUses(loop->graph, node);
+   checkCflowError();
+   if (before != NULL)
+      insertNodeBefore(block, before, node);
+   else
+      insertNode(block, node);
+   checkCflowError();
+   return node;
+}
+
+/* Generates the instructions which compute scale * (reg + offset) + base
+ * in the preheader, and returns the register of the result */
+int genAddress(t_induction *ind, t_family *family, int reg, int offset
+      , t_basic_block *preheader, t_cflow_Node *before)
+{
+   t_loop *loop = ind->loop;
+   int temp, result, scale = family->scale;
+
+   result = getNewRegister(loop->program);
+   if (reg == REG_0) {
+      /* a constant offset from the base */
+      genNode(loop, preheader, before, ADDI, result, family->base->ID
+            , REG_INVALID, offset * scale);
+      return result;
+   }
+
+   if (offset != 0) {
+      temp = getNewRegister(loop->program);
+      genNode(loop, preheader, before, ADDI, temp, reg, REG_INVALID
+            , offset);
+      reg = temp;
+   }
+   if (scale != 1) {
+      temp = getNewRegister(loop->program);
+      genNode(loop, preheader, before, MULI, temp, reg, REG_INVALID
+            , family->scale);
+      reg = temp;
+   }
+   /* the base comes first, as in the addresses computed by the frontend */
+   genNode(loop, preheader, before, ADD, result, family->base->ID, reg, 0);
+   return result;
+}
+
+/* Replaces the addresses computed from the induction variables with the
+ * registers of their families, which are initialized in the preheader and
+ * advanced with the induction variables. Returns the number of addresses
+ * replaced. */
+int reduceAddresses(t_induction *ind, t_basic_block *preheader
+      , t_cflow_Node *before)
+{
+   t_loop *loop = ind->loop;
+   t_list *current_element, *current_family;
+   t_cflow_Node *added;
+   t_family *family;
+   t_iv_use *use;
+   int result = 0;
+
+   for (current_family = ind->families; current_family != NULL
+         ; current_family = LNEXT(current_family))
+   {
+      family = (t_family *) LDATA(current_family);
+      family->reg = genAddress(ind, family, family->iv->ID, 0
+            , preheader, before);
+   }
+
+   for (current_element = ind->reduced; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_axe_instruction *instr;
+
+      use = (t_iv_use *) LDATA(current_element);
+      instr = use->node->instr;
+      instr->opcode = ADDI;
+      instr->reg_2->ID = use->family->reg;
+      instr->reg_3 = NULL;
+      instr->immediate = use->offset;
+      updateNodeDefUses(loop->graph, use->node);
+      checkCflowError();
+      result++;
+   }
+
+   /* the registers are advanced just before the induction variables, since
+    * the flags set by the increments may be tested */
+   for (current_element = ind->increments; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      use = (t_iv_use *) LDATA(current_element);
+      for (current_family = ind->families; current_family != NULL
+            ; current_family = LNEXT(current_family))
+      {
+         family = (t_family *) LDATA(current_family);
+         if (family->iv != use->iv)
+            continue;
+         added = genNode(loop, use->block, use->node, ADDI, family->reg
+               , family->reg, REG_INVALID, use->offset * family->scale);
+         if (use->node->instr->labelID != NULL) {
+            added->instr->labelID = use->node->instr->labelID;
+            use->node->instr->labelID = NULL;
+         }
+      }
+   }
+   return result;
+}
+
+int isTestOf(t_induction *ind, t_cflow_Node *node, t_cflow_var *iv)
+{
+   t_list *current_element;
+
+   for (current_element = ind->tests; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_iv_use *test = (t_iv_use *) LDATA(current_element);
+      if (test->node == node && test->iv == iv)
+         return 1;
+   }
+   return 0;
+}
+
+int usesAny(t_cflow_Node *node, t_bitset *vars)
+{
+   int i;
+
+   for (i = 0; i < CFLOW_MAX_USES; i++) {
+      if (node->uses[i] != NULL && node->uses[i]->index < vars->size
+            && isInBitset(vars, node->uses[i]->index))
+         return 1;
+   }
+   return 0;
+}
+
+/* Collects in `depends' the variables computed inside the loop from `iv',
+ * ignoring its tests. Returns zero if one of them is used after the loop,
+ * or by an instruction which cannot be removed. */
+int findDependentVariables(t_induction *ind, t_cflow_var *iv
+      , t_bitset *depends)
+{
+   t_loop *loop = ind->loop;
+   t_list *vars, *current_element;
+   int b, i, changed, result;
+
+   clearBitset(depends);
+   addToBitset(depends, iv->index);
+   vars = addElement(NULL, iv, -1);
+   result = 1;
+   do {
+      changed = 0;
+      for (b = 0; b < loop->numBlocks && result; b++)
+      {
+         t_basic_block *block = loop->blocks[b];
+
+         for (current_element = block->nodes; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+            if (!usesAny(node, depends) || isTestOf(ind, node, iv))
+               continue;
+            /* the flags set by the instruction must not be tested */
+            if (hasSideEffects(node->instr) || (ind->psw != NULL
+                  && isLiveAfter(block, current_element, ind->psw))) {
+               result = 0;
+               break;
+            }
+            for (i = 0; i < CFLOW_MAX_DEFS; i++)
+            {
+               t_cflow_var *var = node->defs[i];
+
+               if (var == NULL || var->ID == VAR_PSW
+                     || isInBitset(depends, var->index))
+                  continue;
+               addToBitset(depends, var->index);
+               vars = addElement(vars, var, -1);
+               changed = 1;
+            }
+         }
+      }
+   } while (changed && result);
+
+   for (current_element = vars; current_element != NULL && result
+         ; current_element = LNEXT(current_element))
+   {
+      if (isLiveAtExits(loop, (t_cflow_var *) LDATA(current_element)))
+         result = 0;
+   }
+   freeList(vars);
+   return result;
+}
+
+/* Removes the instructions of the loop which use one of `vars', except the
+ * tests of `iv'. Returns the number of instructions removed. */
+int removeDependentNodes(t_induction *ind, t_cflow_var *iv, t_bitset *vars)
+{
+   t_loop *loop = ind->loop;
+   t_list *current_element, *next_element;
+   int b, result = 0;
+
+   for (b = 0; b < loop->numBlocks; b++)
+   {
+      t_basic_block *block = loop->blocks[b];
+
+      for (current_element = block->nodes; current_element != NULL
+            ; current_element = next_element)
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+         next_element = LNEXT(current_element);
+         if (!usesAny(node, vars) || isTestOf(ind, node, iv))
+            continue;
+         removeNodeFromBlock(block, node);
+         checkCflowError();
+         result++;
+      }
+   }
+   return result;
+}
+
+/* Returns non-zero if the flags set by `test' are only checked for
+ * equality */
+int isEqualityTest(t_induction *ind, t_iv_use *test)
+{
+   t_list *current_element;
+   int i;
+
+   if (ind->psw == NULL)
+      return 1;
+
+   for (current_element = LNEXT(test->node->link); current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (node->uses[i] != ind->psw)
+            continue;
+         switch (node->instr->opcode) {
+            case BEQ : case BNE : case SEQ : case SNE :
+               break;
+            default :
+               return 0;
+         }
+      }
+      for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+         if (node->defs[i] == ind->psw)
+            return 1;
+      }
+   }
+   return !isLive(test->block->liveOut, ind->psw);
+}
+
+/* Returns non-zero if every test of the induction variable of `family' can
+ * be rewritten in terms of the addresses of the family. Addresses may wrap
+ * around even when the indices do not, so only equalities are preserved,
+ * and only when the scale is odd: the multiplication is then invertible
+ * modulo 2^32 */
+int canReplaceTests(t_induction *ind, t_family *family)
+{
+   t_list *current_element;
+   t_iv_use *test;
+
+   if ((family->scale & 1) == 0)
+      return 0;
+
+   for (current_element = ind->tests; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      test = (t_iv_use *) LDATA(current_element);
+      if (test->iv == family->iv && !isEqualityTest(ind, test))
+         return 0;
+   }
+   return 1;
+}
+
+/* Rewrites the equality tests of the induction variables as comparisons
+ * between the register of one of their families and its value at the end
+ * of the loop, computed in the preheader, when the induction variables are
+ * no longer needed afterwards. The induction variables are then removed. */
+void replaceTests(t_induction *ind, t_basic_block *preheader
+      , t_cflow_Node *before)
+{
+   t_loop *loop = ind->loop;
+   t_list *current_family, *current_element, *done = NULL;
+   t_bitset *depends;
+   t_family *family;
+   t_iv_use *test;
+   t_linear *limit;
+   int limitReg, limitOffset;
+
+   depends = allocBitset(loop->graph->numVariables);
+   if (depends == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (current_family = ind->families; current_family != NULL
+         ; current_family = LNEXT(current_family))
+   {
+      family = (t_family *) LDATA(current_family);
+
+      if (findElement(done, family->iv) != NULL
+            || !canReplaceTests(ind, family))
+         continue;
+      done = addElement(done, family->iv, -1);
+      if (!findDependentVariables(ind, family->iv, depends))
+         continue;
+
+      for (current_element = ind->tests; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_axe_instruction *instr;
+
+         test = (t_iv_use *) LDATA(current_element);
+         if (test->iv != family->iv)
+            continue;
+         instr = test->node->instr;
+
+         /* iv + c1 equal to limit + c2 is scale * iv + base equal to
+          * scale * (limit + c2 - c1) + base */
+         limit = &test->operands[1 - test->offset];
+         limitReg = limit->var != NULL ? limit->var->ID : REG_0;
+         limitOffset = limit->offset - test->operands[test->offset].offset;
+         limitReg = genAddress(ind, family, limitReg, limitOffset
+               , preheader, before);
+
+         /* the difference of two addresses is an address */
+         if (instr->opcode == SUBI) {
+            instr->opcode = SUB;
+            instr->reg_3 = alloc_register(loop->program->arena
+                  , REG_0, INFERRED_TYPE, 0);
+            if (instr->reg_3 == NULL)
+               notifyError(AXE_OUT_OF_MEMORY);
+         }
+         instr->reg_1->ID = getNewRegister(loop->program);
+         instr->reg_1->type = INFERRED_TYPE;
+         instr->reg_2->ID = test->offset == 0 ? family->reg : limitReg;
+         instr->reg_3->ID = test->offset == 0 ? limitReg : family->reg;
+         updateNodeDefUses(loop->graph, test->node);
+         checkCflowError();
+         addToStatistic("ivsr.replaced_tests", 1);
+      }
+
+      addToStatistic("ivsr.removed_instructions"
+            , removeDependentNodes(ind, family->iv, depends));
+   }
+
+   freeList(done);
+   freeBitset(depends);
+}
+
+void freeUses(t_list *uses)
+{
+   t_list *current_element;
+
+   for (current_element = uses; current_element != NULL
+         ; current_element = LNEXT(current_element))
+      free(LDATA(current_element));
+   freeList(uses);
+}
+
+/* Reduces the strength of the addresses computed from the induction
+ * variables of `loop'. Returns the number of addresses replaced. */
+int reduceStrength(t_loop *loop)
+{
+   t_induction ind;
+   t_basic_block *preheader;
+   t_cflow_Node *before;
+   t_list *current_element;
+   int i, created, result;
+
+   /* the instructions added to the preheader overwrite the flags */
+   ind.psw = getCflowVariable(loop->graph, VAR_PSW);
+   if (ind.psw != NULL && isLive(loop->header->liveIn, ind.psw))
+      return 0;
+
+   ind.loop = loop;
+   ind.numVars = loop->graph->numVariables;
+   ind.numDefs = calloc(ind.numVars, sizeof(int));
+   ind.notInduction = calloc(ind.numVars, sizeof(int));
+   ind.version = calloc(ind.numVars, sizeof(int));
+   ind.values = malloc(sizeof(t_linear) * ind.numVars);
+   ind.valueBlock = malloc(sizeof(int) * ind.numVars);
+   ind.valueVersion = malloc(sizeof(int) * ind.numVars);
+   if (ind.numDefs == NULL || ind.notInduction == NULL
+         || ind.version == NULL || ind.values == NULL
+         || ind.valueBlock == NULL || ind.valueVersion == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < ind.numVars; i++)
+      ind.valueBlock[i] = -1;
+   ind.families = ind.reduced = ind.increments = ind.tests = NULL;
+
+   findInductionVariables(&ind);
+   for (i = 0; i < ind.numVars; i++)
+      ind.valueBlock[i] = -1;
+   findUses(&ind);
+
+   result = 0;
+   preheader = ind.reduced != NULL ? getPreheader(loop, &created) : NULL;
+   if (preheader != NULL)
+   {
+      before = getInsertionPoint(preheader);
+      result = reduceAddresses(&ind, preheader, before);
+      replaceTests(&ind, preheader, before);
+
+      /* the operands of the new instructions are live in the preheader */
+      clearBitset(loop->extended);
+      for (current_element = preheader->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            if (node->uses[i] != NULL
+                  && node->uses[i]->index < loop->extended->size)
+               addToBitset(loop->extended, node->uses[i]->index);
+         }
+      }
+      updateLiveness(loop, preheader);
+
+      completePreheader(loop, preheader, created, before);
+      if (created)
+         addToStatistic("ivsr.preheaders", 1);
+   }
+
+   for (current_element = ind.families; current_element != NULL
+         ; current_element = LNEXT(current_element))
+      free(LDATA(current_element));
+   freeList(ind.families);
+   freeUses(ind.reduced);
+   freeUses(ind.increments);
+   freeUses(ind.tests);
+   free(ind.numDefs);
+   free(ind.notInduction);
+   free(ind.version);
+   free(ind.values);
+   free(ind.valueBlock);
+   free(ind.valueVersion);
+   return result;
+}
+
+void reduceInductionVariables(t_program_infos *program
+      , t_cflow_Graph *graph)
+{
+   t_loop loop;
+
+   loop.program = program;
+   loop.graph = graph;
+   addToStatistic("ivsr.reduced_addresses"
+         , visitLoops(&loop, reduceStrength));
+}
@@ -0,0 +1,52 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_loop_opt.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Loop optimizations. The natural loops are identified by their back edges
+ * (the edges whose destination, the header of the loop, dominates their
+ * source); the loops with the same header are considered as a single loop.
+ *
+ * Loop invariant code motion moves the instructions whose operands do not
+ * change inside a loop to its preheader, a block which is executed once
+ * before entering the loop. An instruction is invariant if each of its
+ * operands is reached only by definitions outside the loop, or by a single
+ * invariant definition which has already been moved. The address of a
+ * label (MOVA) and the constants are invariant in every loop. Memory loads
+ * are invariant in the loops which do not write to memory.
+ *
+ * An induction variable is a variable whose definitions inside a loop
+ * only add a constant to it. The addresses computed as base + scale * i,
+ * from an induction variable `i' and a base which does not change in the
+ * loop, are kept in a new register initialized in the preheader, which is
+ * advanced by scale * c whenever `i' is advanced by c (strength
+ * reduction). The equality tests of `i' against an invariant limit are
+ * rewritten as comparisons of that register with the address computed from
+ * the limit (linear function test replacement), when the scale is odd.
+ * The other tests are kept: the addresses may wrap around even when `i'
+ * does not, which would change the result of an ordered comparison.
+ */
+
+#ifndef _AXE_LOOP_OPT_H
+#define _AXE_LOOP_OPT_H
+
+#include "axe_engine.h"
+#include "axe_cflow_graph.h"
+
+/* Moves the invariant instructions out of the loops of `graph', starting
+ * from the innermost ones. A preheader is created for the loops which
+ * have none. The dominators are updated; the liveness informations are
+ * only approximated, and must be computed again. */
+extern void hoistLoopInvariants(t_program_infos *program
+      , t_cflow_Graph *graph);
+
+/* Replaces the addresses of the array elements indexed by an induction
+ * variable with registers which are advanced together with it. When the
+ * variable is then used only by the tests of a loop, the tests compare the
+ * new registers instead, and the variable is removed from the loop. The
+ * liveness informations must be computed again. */
+extern void reduceInductionVariables(t_program_infos *program
+      , t_cflow_Graph *graph);
+
+#endif
@@ -8,6 +8,10 @@
  * Formal Languages & Compilers Machine, 2007-2020
  */
 
+#include <assert.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
 #include "axe_reg_alloc.h"
 #include "reg_alloc_constants.h"
 #include "axe_target_info.h"
@@ -17,289 +21,508 @@
 
 extern int errorcode;
 
-static int compareIntervalIDs(void *varA, void *varB);
-static int compareStartPoints(void *varA, void *varB);
-static int compareEndPoints(void *varA, void *varB);
-static t_list * updateListOfIntervals(t_list *result
-            , t_cflow_Node *current_node, int counter);
-static t_list * allocFreeRegisters(int regNum);
-static t_list * addFreeRegister
-      (t_list *registers, int regID, int position);
-static int assignRegister(t_reg_allocator *RA, t_list *constraints);
-static t_list * expireOldIntervals(t_reg_allocator *RA
-            , t_list *active_intervals, t_live_interval *interval);
-static t_list * getLiveIntervals(t_cflow_Graph *graph);
-static int insertListOfIntervals(t_reg_allocator *RA, t_list *intervals);
-static int insertLiveInterval(t_reg_allocator *RA, t_live_interval *interval);
-static void finalizeLiveInterval (t_live_interval *interval);
-static t_live_interval * allocLiveInterval(int varID, t_list *mcRegs, int startPoint, int endPoint);
-static t_list * spillAtInterval(t_reg_allocator *RA
-      , t_list *active_intervals, t_live_interval *interval);
-
+/* the set of active live intervals, kept in a binary min-heap ordered by
+ * ending point. Among intervals with the same ending point, the one made
+ * active last comes first. */
+typedef struct t_active_intervals
+{
+   t_live_interval **intervals;  /* the heap of active intervals */
+   int *sequence;                /* when each interval was made active */
+   int size;                     /* number of active intervals */
+   int nextSequence;
+}t_active_intervals;
+
+static int compareStartPoints(const void *varA, const void *varB);
+static int precedesInActiveSet(t_active_intervals *active, int a, int b);
+static void swapActiveIntervals(t_active_intervals *active, int a, int b);
+static void siftUpActiveInterval(t_active_intervals *active, int pos);
+static void siftDownActiveInterval(t_active_intervals *active, int pos);
+static void insertActiveInterval(t_active_intervals *active
+            , t_live_interval *interval);
+static void removeActiveInterval(t_active_intervals *active, int pos);
+static void updateVarInterval(t_arena *arena, t_live_interval **intervals
+            , t_cflow_var *var, int counter, int isDef);
+static unsigned int allocFreeRegisters(int regNum);
+static int assignRegister(t_reg_allocator *RA, t_live_interval *interval);
+static void subtractRegisterSets(t_live_interval *interval, unsigned int b);
+static void optimizeRegisterSet(t_live_interval *interval, unsigned int b);
+static void initializeRegisterConstraints(t_reg_allocator *ra);
+static void expireOldIntervals(t_reg_allocator *RA
+            , t_active_intervals *active, t_live_interval *interval);
+static t_vector * getLiveIntervals(t_reg_allocator *RA, t_cflow_Graph *graph);
+static void addUsePoint(t_vector **usePoints, t_cflow_var *var, int counter);
+static void setUsePoints(t_reg_allocator *RA, t_live_interval *interval
+      , t_vector *usePoints);
+static t_live_interval * allocLiveInterval(t_arena *arena, int varID
+      , t_list *mcRegs, int startPoint, int endPoint);
+static void spillAtInterval(t_reg_allocator *RA
+      , t_active_intervals *active, t_live_interval *interval);
+static int findBlock(t_reg_allocator *RA, int point);
+static int getBlockEnd(t_reg_allocator *RA, int block);
+static int nextUsePoint(t_live_interval *interval, int point);
+static void insertLiveInterval(t_reg_allocator *RA, t_live_interval *interval);
+static void splitInterval(t_reg_allocator *RA, t_live_interval *interval
+      , int point);
+static void bindRegisters(t_reg_allocator *RA);
+static double spillCost(t_reg_allocator *RA, t_live_interval *interval
+      , int point);
+static int isRematerializable(t_axe_instruction *instr);
+static void findRematerializableVariables(t_reg_allocator *RA
+      , t_cflow_Graph *graph);
 
 /*
  * Perform a spill that allows the allocation of the given
- * interval, given the list of active live intervals
+ * interval, given the set of active live intervals. The interval which
+ * loses its register is split rather than spilled for its whole lifetime.
  */
-t_list * spillAtInterval(t_reg_allocator *RA
-      , t_list *active_intervals, t_live_interval *interval)
+void spillAtInterval(t_reg_allocator *RA
+      , t_active_intervals *active, t_live_interval *interval)
 {
-   t_list *last_element;
-   t_live_interval *last_interval;
+   t_live_interval *victim_interval;
+   int victim, i;
    
-   /* get the last element of the list of active intervals */
-   /* Precondition: if the list of active intervals is empty
+   /* Precondition: if the set of active intervals is empty
     * we are working on a machine with 0 registers available
     * for the register allocation */
-   if (active_intervals == NULL)
+   if (active->size == 0)
    {
-      RA->bindings[interval->varID] = RA_SPILL_REQUIRED;
-      return active_intervals;
+      splitInterval(RA, interval, interval->startPoint);
+      return;
    }
    
-   last_element = getLastElement(active_intervals);
-   last_interval = (t_live_interval *) LDATA(last_element);
+   /* find the active interval which is the cheapest to spill, among the
+    * ones whose register can be given to the current interval. Among the
+    * intervals with the same cost, pick the one which ends last and, among
+    * those, the one which was made active first. */
+   victim = -1;
+   for (i = 0; i < active->size; i++) {
+      t_live_interval *candidate = active->intervals[i];
+      double cost, victimCost;
+
+      if (!(interval->mcRegConstraints & RA_REGISTER_MASK(candidate->reg)))
+         continue;
+      if (victim < 0) {
+         victim = i;
+         continue;
+      }
+      cost = spillCost(RA, candidate, interval->startPoint);
+      victimCost = spillCost(RA, active->intervals[victim]
+            , interval->startPoint);
+      if (cost < victimCost || (cost == victimCost
+            && precedesInActiveSet(active, victim, i)))
+         victim = i;
+   }
 
-   /* If the current interval ends before the last one, spill
-    * the last one, otherwise spill the current interval. */
-   if (last_interval->endPoint > interval->endPoint)
+   /* If the current interval is more expensive to spill than the victim,
+    * the victim is spilled, otherwise the current interval is spilled. */
+   if (victim >= 0)
    {
-      int attempt = RA->bindings[last_interval->varID];
-      if (findElement(interval->mcRegConstraints, INTDATA(attempt))) {
-         RA->bindings[interval->varID]
-               = RA->bindings[last_interval->varID];
-         RA->bindings[last_interval->varID] = RA_SPILL_REQUIRED;
+      double cost, victimCost;
 
-         active_intervals = removeElement(active_intervals, last_interval);
-         
-         active_intervals = addSorted(active_intervals
-                     , interval, compareEndPoints);
-         return active_intervals;
+      victim_interval = active->intervals[victim];
+      cost = spillCost(RA, interval, interval->startPoint);
+      victimCost = spillCost(RA, victim_interval, interval->startPoint);
+      if (victimCost < cost || (victimCost == cost
+            && victim_interval->endPoint > interval->endPoint))
+      {
+         interval->reg = victim_interval->reg;
+         splitInterval(RA, victim_interval, interval->startPoint);
+
+         removeActiveInterval(active, victim);
+         insertActiveInterval(active, interval);
+         return;
       }
    }
       
-   RA->bindings[interval->varID] = RA_SPILL_REQUIRED;
-   return active_intervals;
+   splitInterval(RA, interval, interval->startPoint);
 }
 
 /*
- * Given two live intervals, compare them by
- * the start point (find whichever starts first)
+ * Returns the cost of keeping `interval' in memory rather than in a register
+ * inside the basic block which contains `point', for each instruction of the
+ * block it spans: the density of its uses and definitions in the block, plus
+ * the move at the boundary of the block, weighted by the estimated frequency
+ * of the block. The moves of the variables which can be rematerialized are
+ * cheaper. The intervals which cannot be split are spilled only as a last
+ * resort.
  */
-int compareStartPoints(void *varA, void *varB)
+double spillCost(t_reg_allocator *RA, t_live_interval *interval, int point)
 {
-   t_live_interval *liA;
-   t_live_interval *liB;
-   
-   if (varA == NULL)
-      return 0;
-
-   if (varB == NULL)
-      return 0;
-
-   liA = (t_live_interval *) varA;
-   liB = (t_live_interval *) varB;
-
-   return (liA->startPoint - liB->startPoint);
+   int block, first, last, uses, i;
+
+   if (!interval->canSplit)
+      return HUGE_VAL;
+
+   block = findBlock(RA, point);
+   first = VINTDATA(RA->blockStarts, block);
+   last = getBlockEnd(RA, block);
+   if (first < interval->startPoint)
+      first = interval->startPoint;
+   if (last > interval->endPoint)
+      last = interval->endPoint;
+
+   uses = 1;
+   for (i = nextUsePoint(interval, first - 1); i >= 0 && i <= last;
+         i = nextUsePoint(interval, i))
+      uses++;
+
+   if (RA->rematDefs[interval->varID] != NULL)
+      return RA->blockFrequencies[block] * uses / (last - first + 1)
+            * RA_REMAT_COST_FACTOR;
+   return RA->blockFrequencies[block] * uses / (last - first + 1);
 }
 
 /*
- * Given two live intervals, compare them
- * by the end point (find whichever ends first)
+ * Returns the number of the basic block which contains the instruction
+ * at the given index
  */
-int compareEndPoints(void *varA, void *varB)
+int findBlock(t_reg_allocator *RA, int point)
 {
-   t_live_interval *liA;
-   t_live_interval *liB;
-   
-   if (varA == NULL)
-     return 0;
+   int low = 0;
+   int high = VSIZE(RA->blockStarts) - 1;
+
+   while (low < high) {
+      int mid = (low + high + 1) / 2;
+      if (VINTDATA(RA->blockStarts, mid) <= point)
+         low = mid;
+      else
+         high = mid - 1;
+   }
+   return low;
+}
 
-   if (varB == NULL)
-      return 0;
+/* Returns the index of the last instruction of the given basic block */
+int getBlockEnd(t_reg_allocator *RA, int block)
+{
+   if (block + 1 < VSIZE(RA->blockStarts))
+      return VINTDATA(RA->blockStarts, block + 1) - 1;
+   return INT_MAX;
+}
 
-   liA = (t_live_interval *) varA;
-   liB = (t_live_interval *) varB;
+/*
+ * Returns the first instruction after `point' which uses or defines the
+ * variable of `interval' and is inside the interval, or -1 if none
+ */
+int nextUsePoint(t_live_interval *interval, int point)
+{
+   int low = 0;
+   int high = interval->numUsePoints;
+
+   while (low < high) {
+      int mid = (low + high) / 2;
+      if (interval->usePoints[mid] <= point)
+         low = mid + 1;
+      else
+         high = mid;
+   }
+   if (low == interval->numUsePoints
+         || interval->usePoints[low] > interval->endPoint)
+      return -1;
+   return interval->usePoints[low];
+}
 
-   return (liA->endPoint - liB->endPoint);
+/*
+ * Add a live interval to the vector of the intervals to be allocated,
+ * keeping it sorted by starting point
+ */
+void insertLiveInterval(t_reg_allocator *RA, t_live_interval *interval)
+{
+   int low = 0;
+   int high = VSIZE(RA->live_intervals);
+
+   while (low < high) {
+      int mid = (low + high) / 2;
+      if (compareStartPoints(&VDATA(RA->live_intervals, mid), &interval) <= 0)
+         low = mid + 1;
+      else
+         high = mid;
+   }
+   insertInVectorAt(RA->live_intervals, low, interval);
 }
 
 /*
- * Given two live intervals, check if they
- * refer to the same interval
+ * Take the variable of `interval' out of its register starting from the
+ * basic block which contains the instruction `point'. The part of the
+ * interval in the previous blocks keeps its register; the variable stays
+ * in memory until the next block which references it, where a new interval
+ * begins which gets a second chance of being allocated to a register. The
+ * value is moved between the register and memory at the boundaries of the
+ * blocks by `materializeRegisterAllocation'.
  */
-int compareIntervalIDs(void *varA, void *varB)
+void splitInterval(t_reg_allocator *RA, t_live_interval *interval, int point)
 {
-   t_live_interval *liA;
-   t_live_interval *liB;
+   t_live_interval *rest;
+   int block, blockStart, next, end;
 
-   if (varA == NULL)
-      return 0;
+   if (!interval->canSplit) {
+      interval->reg = RA_SPILL_REQUIRED;
+      return;
+   }
 
-   if (varB == NULL)
-      return 0;
+   block = findBlock(RA, point);
+   blockStart = VINTDATA(RA->blockStarts, block);
+   end = interval->endPoint;
+   next = nextUsePoint(interval, getBlockEnd(RA, block));
 
-   liA = (t_live_interval *) varA;
-   liB = (t_live_interval *) varB;
+   if (interval->startPoint < blockStart && interval->reg >= 0)
+      interval->endPoint = blockStart - 1;
+   else
+      interval->reg = RA_SPILL_REQUIRED;
 
-   return (liA->varID == liB->varID);
+   if (next >= 0)
+   {
+      /* the rest of the interval starts at the beginning of the block */
+      rest = arenaAlloc(RA->arena, sizeof(t_live_interval));
+      if (rest == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      *rest = *interval;
+      rest->startPoint = VINTDATA(RA->blockStarts, findBlock(RA, next));
+      rest->startsAtDef = 0;
+      rest->copiedFrom = RA_EXCLUDED_VARIABLE;
+      rest->endPoint = end;
+      rest->reg = RA_SPILL_REQUIRED;
+      insertLiveInterval(RA, rest);
+   }
+   else if (interval->reg == RA_SPILL_REQUIRED)
+      return;
+
+   RA->numSplits++;
+   if (RA->splitIntervals[interval->varID] == NULL)
+      RA->splitIntervals[interval->varID] = allocVector(0);
 }
 
 /*
- * Insert a live interval in the register allocator
+ * Compute the bindings of the variables from the registers assigned to
+ * their intervals
  */
-int insertLiveInterval(t_reg_allocator *RA, t_live_interval *interval)
+void bindRegisters(t_reg_allocator *RA)
 {
-   /* test the preconditions */
-   if (RA == NULL)
-      return RA_INVALID_ALLOCATOR;
+   t_live_interval *interval;
+   t_vector *parts;
+   int i;
 
-   if (interval == NULL)
-      return RA_INVALID_INTERVAL;
+   for (i = 0; i < VSIZE(RA->live_intervals); i++) {
+      interval = VDATA(RA->live_intervals, i);
+      parts = RA->splitIntervals[interval->varID];
+      if (parts == NULL)
+         RA->bindings[interval->varID] = interval->reg;
+      else if (interval->reg != RA_SPILL_REQUIRED)
+         addToVector(parts, interval);
+   }
 
-   /* test if an interval for the requested variable is already inserted */
-   if (CustomfindElement(RA->live_intervals
-               , interval, compareIntervalIDs) != NULL)
-   {
-      return RA_INTERVAL_ALREADY_INSERTED;
+   /* a split variable which never got a register again is simply spilled */
+   for (i = 0; i < RA->varNum; i++) {
+      parts = RA->splitIntervals[i];
+      if (parts == NULL)
+         continue;
+      RA->bindings[i] = RA_SPILL_REQUIRED;
+      if (VSIZE(parts) == 0) {
+         freeVector(parts);
+         RA->splitIntervals[i] = NULL;
+      } else
+         addToVector(RA->splitVariables, INTDATA(i));
    }
+}
 
-   /* add the given interval to the list of intervals,
-    * in order of starting point */
-    RA->live_intervals = addSorted(RA->live_intervals
-            , interval, compareStartPoints);
-   
-   return RA_OK;
+/*
+ * Given two pointers to live intervals, compare them by the start point
+ * (find whichever starts first). Intervals starting at the same point are
+ * ordered by decreasing variable identifier, so that the temporaries created
+ * last are allocated first.
+ */
+int compareStartPoints(const void *varA, const void *varB)
+{
+   t_live_interval *liA = *(t_live_interval **)varA;
+   t_live_interval *liB = *(t_live_interval **)varB;
+
+   if (liA->startPoint != liB->startPoint)
+      return liA->startPoint - liB->startPoint;
+   return liB->varID - liA->varID;
 }
 
 /*
- * Allocate and initialize the free registers list,
- * assuming regNum general purpose registers
+ * Returns non-zero if the active interval in position `a' of the heap
+ * must be expired before the one in position `b'
  */
-t_list * allocFreeRegisters(int regNum)
+int precedesInActiveSet(t_active_intervals *active, int a, int b)
 {
-   int count;
-   t_list *result;
+   t_live_interval *liA = active->intervals[a];
+   t_live_interval *liB = active->intervals[b];
 
-   /* initialize the local variables */
-   count = 1;
-   result = NULL;
-   
-   while(count <= regNum)
-   {
-      /* add a new register to the list of free registers */
-      result = addFreeRegister(result, count, -1);
+   if (liA->endPoint != liB->endPoint)
+      return liA->endPoint < liB->endPoint;
+   return active->sequence[a] > active->sequence[b];
+}
+
+void swapActiveIntervals(t_active_intervals *active, int a, int b)
+{
+   t_live_interval *interval = active->intervals[a];
+   int sequence = active->sequence[a];
 
-      /* update the `count' variable */
-      count ++;
+   active->intervals[a] = active->intervals[b];
+   active->sequence[a] = active->sequence[b];
+   active->intervals[b] = interval;
+   active->sequence[b] = sequence;
+}
+
+void siftUpActiveInterval(t_active_intervals *active, int pos)
+{
+   while (pos > 0 && precedesInActiveSet(active, pos, (pos - 1) / 2)) {
+      swapActiveIntervals(active, pos, (pos - 1) / 2);
+      pos = (pos - 1) / 2;
    }
+}
 
-   /* return the list of free registers */
-   return result;
+void siftDownActiveInterval(t_active_intervals *active, int pos)
+{
+   for (;;) {
+      int first = pos;
+      int left = pos * 2 + 1;
+      int right = pos * 2 + 2;
+
+      if (left < active->size && precedesInActiveSet(active, left, first))
+         first = left;
+      if (right < active->size && precedesInActiveSet(active, right, first))
+         first = right;
+      if (first == pos)
+         return;
+      swapActiveIntervals(active, pos, first);
+      pos = first;
+   }
 }
 
 /*
- * Return register regID to the free list in the given position
+ * Add a live interval to the set of active intervals
  */
-t_list * addFreeRegister(t_list *registers, int regID, int position)
+void insertActiveInterval(t_active_intervals *active
+            , t_live_interval *interval)
 {
-   int *element;
+   int pos = active->size++;
 
-   /* Allocate memory space for the reg id */
-   element = (int *) malloc(sizeof(int));
-   if (element == NULL)
-      notifyError(AXE_OUT_OF_MEMORY);
+   active->intervals[pos] = interval;
+   active->sequence[pos] = active->nextSequence++;
+   siftUpActiveInterval(active, pos);
+}
 
-   /* initialize element */
-   (* element) = regID;
-   
-   /* update the list of registers */
-   registers = addElement(registers, element, position);
+/*
+ * Remove the live interval at the given position of the heap from the set
+ * of active intervals
+ */
+void removeActiveInterval(t_active_intervals *active, int pos)
+{
+   active->size--;
+   if (pos == active->size)
+      return;
 
-   /* return the list of free registers */
-   return registers;
+   swapActiveIntervals(active, pos, active->size);
+   siftUpActiveInterval(active, pos);
+   siftDownActiveInterval(active, pos);
 }
 
-int _compareFreeRegLI(void *freeReg, void *constraintReg)
+/*
+ * Allocate and initialize the set of free registers,
+ * assuming regNum general purpose registers
+ */
+unsigned int allocFreeRegisters(int regNum)
 {
-   return *(int *)constraintReg == *(int *)freeReg;
+   /* registers are numbered from 1 to regNum */
+   assert(regNum < RA_MAX_REGISTERS);
+   return ((1U << regNum) - 1) << 1;
 }
 
 /*
- * Get a new register from the free list
+ * Get a new register from the set of free registers
  */
-int assignRegister(t_reg_allocator *RA, t_list *constraints)
+int assignRegister(t_reg_allocator *RA, t_live_interval *interval)
 {
+   unsigned int available, others;
    int regID;
+   int i;
 
-   t_list *i = constraints;
-   for (; i; i = LNEXT(i)) {
-      regID = LINTDATA(i);
-      t_list *freeReg = CustomfindElement(RA->freeRegisters, &regID, _compareFreeRegLI);
-      if (freeReg) {
-         free(LDATA(freeReg));
-         RA->freeRegisters = removeElementLink(RA->freeRegisters, freeReg);
-         return regID;
+   available = RA->freeRegisters & interval->mcRegConstraints;
+   if (available == 0)
+      return RA_SPILL_REQUIRED;
+
+   /* prefer the registers suggested by the hints; otherwise pick
+    * the allowed register which has been free for the longest time (the
+    * one with the lowest identifier among the unused ones). A register
+    * released recently may still hold the value of a variable kept in
+    * memory, which the spill code optimization uses to remove the
+    * following loads of the variable. */
+   regID = __builtin_ctz(available);
+   others = available & (available - 1);
+   while (others != 0) {
+      int reg = __builtin_ctz(others);
+
+      others &= others - 1;
+      if (RA->freedAt[reg] < RA->freedAt[regID])
+         regID = reg;
+   }
+   for (i = 0; i < interval->numRegHints; i++) {
+      if (available & RA_REGISTER_MASK(interval->mcRegHints[i])) {
+         regID = interval->mcRegHints[i];
+         break;
       }
    }
 
-   return RA_SPILL_REQUIRED;
+   RA->freeRegisters &= ~RA_REGISTER_MASK(regID);
+   return regID;
 }
 
-t_list *subtractRegisterSets(t_list *a, t_list *b)
+/* Remove the registers in the set `b` from the registers where the
+ * interval can be allocated. */
+void subtractRegisterSets(t_live_interval *interval, unsigned int b)
 {
-   for (; b; b = LNEXT(b)) {
-      a = removeElement(a, LDATA(b));
-   }
-   return a;
+   interval->mcRegConstraints &= ~b;
 }
 
-/* Move the elements in list `a` which are also contained in list `b` to the
- * front of the list. */
-t_list *optimizeRegisterSet(t_list *a, t_list *b)
+/* Move the registers where the interval can be allocated which are also
+ * contained in the set `b` to the front of the list of hints. */
+void optimizeRegisterSet(t_live_interval *interval, unsigned int b)
 {
-   for (; b; b = LNEXT(b)) {
-      t_list *old;
-      if ((old = findElement(a, LDATA(b)))) {
-         a = removeElementLink(a, old);
-         a = addElement(a, LDATA(b), 0);
+   b &= interval->mcRegConstraints;
+   while (b != 0) {
+      int reg = __builtin_ctz(b);
+      int i;
+
+      b &= b - 1;
+      for (i = 0; i < interval->numRegHints; i++) {
+         if (interval->mcRegHints[i] == reg)
+            break;
       }
+      if (i == interval->numRegHints)
+         interval->numRegHints++;
+      memmove(&interval->mcRegHints[1], &interval->mcRegHints[0]
+            , sizeof(interval->mcRegHints[0]) * i);
+      interval->mcRegHints[0] = reg;
    }
-   return a;
 }
 
 void initializeRegisterConstraints(t_reg_allocator *ra)
 {
-   t_list *allregs = NULL;
-   t_list *allregs2 = ra->freeRegisters;
-   for (; allregs2; allregs2 = LNEXT(allregs2)) {
-      int reg = *(int *)LDATA(allregs2);
-      allregs = addElement(allregs, INTDATA(reg), -1);
-   }
+   unsigned int allregs = ra->freeRegisters;
+   int i, j;
 
-   t_list *i = ra->live_intervals;
-   for (; i; i = LNEXT(i)) {
-      t_live_interval *interval = LDATA(i);
+   for (i = 0; i < VSIZE(ra->live_intervals); i++) {
+      t_live_interval *interval = VDATA(ra->live_intervals, i);
       if (interval->mcRegConstraints)
          continue;
-      interval->mcRegConstraints = cloneList(allregs);
-      t_list *j = LNEXT(i);
-      for (; j; j = LNEXT(j)) {
-         t_live_interval *overlappingIval = LDATA(j);
+      interval->mcRegConstraints = allregs;
+      for (j = i + 1; j < VSIZE(ra->live_intervals); j++) {
+         t_live_interval *overlappingIval = VDATA(ra->live_intervals, j);
          if (overlappingIval->startPoint > interval->endPoint)
             break;
          if (!overlappingIval->mcRegConstraints)
             continue;
-         if (overlappingIval->startPoint == interval->endPoint) {
+         if (overlappingIval->startPoint == interval->endPoint
+               && overlappingIval->startsAtDef) {
             /* an instruction is using interval as a source and overlappingIval
              * as a destination. Optimize the constraint order to allow
              * allocating source and destination to the same register
              * if possible. */
-            interval->mcRegConstraints = optimizeRegisterSet(
-               interval->mcRegConstraints, overlappingIval->mcRegConstraints);
+            optimizeRegisterSet(interval, overlappingIval->mcRegConstraints);
          } else {
-            interval->mcRegConstraints = subtractRegisterSets(
-               interval->mcRegConstraints, overlappingIval->mcRegConstraints);
+            subtractRegisterSets(interval, overlappingIval->mcRegConstraints);
          }
       }
       assert(interval->mcRegConstraints);
@@ -312,9 +535,6 @@ void initializeRegisterConstraints(t_reg_allocator *ra)
 t_reg_allocator * initializeRegAlloc(t_cflow_Graph *graph)
 {
    t_reg_allocator *result; /* the register allocator */
-   t_list *intervals;
-   t_list *current_cflow_var;
-   t_cflow_var *cflow_var;
    int max_var_ID;
    int counter;
 
@@ -333,19 +553,8 @@ t_reg_allocator * initializeRegAlloc(t_cflow_Graph *graph)
 
    /* retrieve the max identifier from each live interval */
    max_var_ID = 0;
-   current_cflow_var = graph->cflow_variables;
-   while (current_cflow_var != NULL)
-   {
-      /* fetch the data informations about a variable */
-      cflow_var = (t_cflow_var *) LDATA(current_cflow_var);
-      assert(cflow_var != NULL);
-      
-      /* update the value of max_var_ID */
-      max_var_ID = MAX(max_var_ID, cflow_var->ID);
-
-      /* retrieve the next variable */
-      current_cflow_var = LNEXT(current_cflow_var);
-   }
+   for (counter = 0; counter < graph->numVariables; counter++)
+      max_var_ID = MAX(max_var_ID, graph->variables[counter]->ID);
    result->varNum = max_var_ID + 1; /* +1 to count R0 */
 
    /* Assuming there are some variables to associate to regs,
@@ -363,27 +572,23 @@ t_reg_allocator * initializeRegAlloc(t_cflow_Graph *graph)
       result->bindings[counter] = RA_REGISTER_INVALID;
 
    /* Liveness analysis: compute the list of live intervals */
-   result->live_intervals = NULL;
-   intervals = getLiveIntervals(graph);
-
-   /* Copy the liveness info into the register allocator */
-   if (intervals != NULL)
-   {
-      if (insertListOfIntervals(result, intervals) != RA_OK)
-      {
-         notifyError(AXE_REG_ALLOC_ERROR);
-      }
-
-      /* deallocate memory used to hold the results of the
-       * liveness analysis */
-      freeList(intervals);
-   }
+   result->arena = initialize_arena("register allocator");
+   if (result->arena == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   result->blockStarts = allocVector(0);
+   result->blockFrequencies = NULL;
+   result->live_intervals = getLiveIntervals(result, graph);
+   result->splitIntervals = calloc(result->varNum, sizeof(t_vector *));
+   if (result->splitIntervals == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   result->splitVariables = allocVector(0);
+   result->numSplits = 0;
+   findRematerializableVariables(result, graph);
 
-   /* create a list of freeRegisters */
-   if (result->regNum > 0)
-      result->freeRegisters = allocFreeRegisters(result->regNum);
-   else
-      result->freeRegisters = NULL;
+   /* create the set of free registers */
+   result->freeRegisters = allocFreeRegisters(result->regNum);
+   for (counter = 0; counter < RA_MAX_REGISTERS; counter++)
+      result->freedAt[counter] = -1;
 
    initializeRegisterConstraints(result);
    
@@ -391,58 +596,136 @@ t_reg_allocator * initializeRegAlloc(t_cflow_Graph *graph)
    return result;
 }
 
+/* Returns non-zero if `instr' computes a value which does not depend on the
+ * content of any register or memory location */
+int isRematerializable(t_axe_instruction *instr)
+{
+   if (instr->reg_1 == NULL || instr->reg_1->indirect
+         || instr->reg_1->mcRegWhitelist != NULL || instr->mcFlags != 0)
+      return 0;
+   if (instr->opcode == MOVA)
+      return instr->address != NULL;
+   return instr->opcode == ADDI && instr->reg_2 != NULL
+         && instr->reg_2->ID == REG_0 && !instr->reg_2->indirect;
+}
+
 /*
- * Deallocate the register allocator data structures
+ * Find the variables whose value can be recomputed by repeating their only
+ * definition, which loads a constant or the address of a label. Recomputing
+ * a constant modifies the flags, thus the variables which are used or live
+ * at the beginning of a block where the flags are live are excluded, as
+ * well as the ones written to memory by a STORE.
  */
-void finalizeRegAlloc(t_reg_allocator *RA)
+void findRematerializableVariables(t_reg_allocator *RA, t_cflow_Graph *graph)
 {
-   if (RA == NULL)
-      return;
+   t_list *current_bb_element, *current_nd_element;
+   t_cflow_Node *node;
+   int *numDefs;
+   char *excluded;
+   int pswIndex, pswLive, i, varID;
+
+   RA->rematDefs = calloc(RA->varNum, sizeof(t_axe_instruction *));
+   numDefs = calloc(RA->varNum, sizeof(int));
+   excluded = calloc(RA->varNum, sizeof(char));
+   if (RA->rematDefs == NULL || numDefs == NULL || excluded == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   pswIndex = -1;
+   for (i = 0; i < graph->numVariables; i++) {
+      if (graph->variables[i]->ID == VAR_PSW)
+         pswIndex = i;
+   }
 
-   /* If the list of live intervals is not empty,
-    * deallocate its content */
-   if (RA->live_intervals != NULL)
+   current_bb_element = graph->blocks;
+   for (; current_bb_element != NULL
+         ; current_bb_element = LNEXT(current_bb_element))
    {
-      t_list *current_element;
-      t_live_interval *current_interval;
-
-      /* finalize the memory blocks associated with all
-       * the live intervals */
-      for (current_element = RA->live_intervals
-            ;  current_element != NULL
-            ;  current_element = LNEXT(current_element))
+      t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+      pswLive = pswIndex >= 0 && block->liveOut != NULL
+            && isInBitset(block->liveOut, pswIndex);
+
+      /* visit the instructions backwards, to know if the flags are live
+       * before each of them */
+      current_nd_element = getLastElement(block->nodes);
+      for (; current_nd_element != NULL
+            ; current_nd_element = LPREV(current_nd_element))
       {
-         /* fetch the current interval */
-         current_interval = (t_live_interval *) LDATA(current_element);
-         if (current_interval != NULL)
-         {
-            /* finalize the memory block associated with
-             * the current interval */
-            finalizeLiveInterval(current_interval);
+         node = (t_cflow_Node *) LDATA(current_nd_element);
+
+         for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+            if (node->defs[i] == NULL)
+               continue;
+            varID = node->defs[i]->ID;
+            if (varID == VAR_PSW) {
+               pswLive = 0;
+               continue;
+            }
+            if (varID <= REG_0 || varID >= RA->varNum)
+               continue;
+            numDefs[varID]++;
+            if (isRematerializable(node->instr))
+               RA->rematDefs[varID] = node->instr;
+         }
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            if (node->uses[i] != NULL && node->uses[i]->ID == VAR_PSW)
+               pswLive = 1;
+         }
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            if (node->uses[i] == NULL)
+               continue;
+            varID = node->uses[i]->ID;
+            if (varID <= REG_0 || varID >= RA->varNum)
+               continue;
+            if (pswLive || node->instr->opcode == STORE)
+               excluded[varID] = 1;
          }
       }
 
-      /* deallocate the list of intervals */
-      freeList(RA->live_intervals);
+      if (pswLive && block->liveIn != NULL) {
+         for (i = nextInBitset(block->liveIn, 0); i >= 0
+               ; i = nextInBitset(block->liveIn, i + 1)) {
+            varID = graph->variables[i]->ID;
+            if (varID > REG_0 && varID < RA->varNum)
+               excluded[varID] = 1;
+         }
+      }
    }
 
-   /* Free memory used for the variable/register bindings */
-   if (RA->bindings != NULL)
-      free(RA->bindings);
-   if (RA->freeRegisters != NULL)
-   {
-      t_list *current_element;
+   for (i = 0; i < RA->varNum; i++) {
+      if (numDefs[i] != 1 || excluded[i])
+         RA->rematDefs[i] = NULL;
+   }
+   free(numDefs);
+   free(excluded);
+}
 
-      current_element = RA->freeRegisters;
-      while (current_element != NULL)
-      {
-         free(LDATA(current_element));
-         current_element = LNEXT(current_element);
-      }
+/*
+ * Deallocate the register allocator data structures
+ */
+void finalizeRegAlloc(t_reg_allocator *RA)
+{
+   int i;
 
-      freeList(RA->freeRegisters);
-   }
+   if (RA == NULL)
+      return;
 
+   /* deallocate the vector of intervals; the intervals themselves are
+    * released together with the arena */
+   freeVector(RA->live_intervals);
+   finalize_arena(RA->arena);
+   freeVector(RA->blockStarts);
+   free(RA->blockFrequencies);
+   for (i = 0; i < RA->varNum; i++)
+      freeVector(RA->splitIntervals[i]);
+   free(RA->splitIntervals);
+   freeVector(RA->splitVariables);
+   free(RA->rematDefs);
+   free(RA->liveRangeEnds);
+
+   /* Free memory used for the variable/register bindings */
+   if (RA->bindings != NULL)
+      free(RA->bindings);
    free(RA);
 }
 
@@ -450,106 +733,90 @@ void finalizeRegAlloc(t_reg_allocator *RA)
  * Allocate and initialize a live interval data structure
  * with a given varID, starting and ending points
  */
-t_live_interval * allocLiveInterval
-               (int varID, t_list *mcRegs, int startPoint, int endPoint)
+t_live_interval * allocLiveInterval(t_arena *arena, int varID
+      , t_list *mcRegs, int startPoint, int endPoint)
 {
    t_live_interval *result;
 
    /* create a new instance of `t_live_interval' */
-   result = malloc(sizeof(t_live_interval));
+   result = arenaAlloc(arena, sizeof(t_live_interval));
    if (result == NULL)
       notifyError(AXE_OUT_OF_MEMORY);
 
    /* initialize the new instance */
    result->varID = varID;
-   result->mcRegConstraints = cloneList(mcRegs);
+   result->mcRegConstraints = 0;
+   for (; mcRegs; mcRegs = LNEXT(mcRegs))
+      result->mcRegConstraints |= RA_REGISTER_MASK(LINTDATA(mcRegs));
+   result->numRegHints = 0;
    result->startPoint = startPoint;
    result->endPoint = endPoint;
+   result->startsAtDef = 0;
+   result->copiedFrom = RA_EXCLUDED_VARIABLE;
+   result->reg = RA_SPILL_REQUIRED;
+   result->canSplit = mcRegs == NULL;
+   result->usePoints = NULL;
+   result->numUsePoints = 0;
 
    /* return the new `t_live_interval' */
    return result;
 }
 
 /*
- * Deallocate a live interval
+ * Perform live intervals computation. Returns the vector of live intervals
+ * sorted by starting point.
  */
-void finalizeLiveInterval (t_live_interval *interval)
-{
-   if (interval == NULL)
-      return;
-
-   /* finalize the current interval */
-   free(interval->mcRegConstraints);
-   free(interval);
-}
-
-/*
- * Insert all elements of the intervals list into
- * the register allocator data structure
- */
-int insertListOfIntervals(t_reg_allocator *RA, t_list *intervals)
-{
-   t_list *current_element;
-   t_live_interval *interval;
-   int ra_errorcode;
-   
-   /* preconditions */
-   if (RA == NULL)
-      return RA_INVALID_ALLOCATOR;
-   if (intervals == NULL)
-      return RA_OK;
-
-   for (current_element = intervals
-         ;  current_element != NULL
-         ;  current_element = LNEXT(current_element) )
-   {
-      /* Get the current live interval */
-      interval = (t_live_interval *) LDATA(current_element);
-      
-      if (interval == NULL)
-         return RA_INVALID_INTERVAL;
-
-      /* insert a new live interval */
-      ra_errorcode = insertLiveInterval(RA, interval);
-
-      /* test if an error occurred */
-      if (ra_errorcode != RA_OK)
-         return ra_errorcode;
-   }
-
-   return RA_OK;
-}
-
-/*
- * Perform live intervals computation
- */
-t_list * getLiveIntervals(t_cflow_Graph *graph)
+t_vector * getLiveIntervals(t_reg_allocator *RA, t_cflow_Graph *graph)
 {
+   t_live_interval **intervals;
+   t_vector **usePoints;
    t_list *current_bb_element;
    t_list *current_nd_element;
    t_basic_block *current_block;
    t_cflow_Node *current_node;
-   t_list *result;
-   int counter;
+   t_live_interval *interval;
+   t_axe_register *source;
+   t_vector *result;
+   int counter, first, numBlocks;
+   int i;
+
+   result = allocVector(0);
 
    /* preconditions */
    if (graph == NULL)
-      return NULL;
+      return result;
 
    if (graph->blocks == NULL)
-      return NULL;
+      return result;
 
-   /* initialize the local variable `result' */
-   result = NULL;
+   /* the live interval of each variable, indexed by variable identifier */
+   intervals = calloc(RA->varNum, sizeof(t_live_interval *));
+   usePoints = calloc(RA->varNum, sizeof(t_vector *));
+   if (intervals == NULL || usePoints == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   /* the estimated execution frequency of each block */
+   RA->blockFrequencies = malloc(sizeof(double)
+         * (getLength(graph->blocks) + 1));
+   if (RA->blockFrequencies == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   numBlocks = 0;
 
    /* intialize the instruction counter */
    counter = 0;
    
-   /* fetch the first basic block */
+   /* Inside a basic block, a variable is live between the first and the
+    * last instruction that reference it. Thus it is enough to extend
+    * the intervals with the live-in set of the block at its first
+    * instruction, with the defs and uses of each instruction, and with the
+    * live-out set of the block at its last instruction. */
    current_bb_element = graph->blocks;
    while (current_bb_element != NULL)
    {
       current_block = (t_basic_block *) LDATA(current_bb_element);
+      first = counter;
+      addToVector(RA->blockStarts, INTDATA(first));
+      RA->blockFrequencies[numBlocks++] = current_block->frequency;
 
       /* fetch the first node of the basic block */
       current_nd_element = current_block->nodes;
@@ -557,220 +824,378 @@ t_list * getLiveIntervals(t_cflow_Graph *graph)
       {
          current_node = (t_cflow_Node *) LDATA(current_nd_element);
 
-         /* update the live intervals with the liveness informations */
-         result = updateListOfIntervals(result, current_node, counter);
+         for (i = 0; i < CFLOW_MAX_USES; i++) {
+            if (current_node->uses[i]) {
+               updateVarInterval(RA->arena, intervals, current_node->uses[i], counter, 0);
+               addUsePoint(usePoints, current_node->uses[i], counter);
+            }
+         }
+         for (i = 0; i < CFLOW_MAX_DEFS; i++) {
+            if (current_node->defs[i]) {
+               updateVarInterval(RA->arena, intervals, current_node->defs[i], counter, 1);
+               addUsePoint(usePoints, current_node->defs[i], counter);
+            }
+         }
+         if (isMoveInstruction(current_node->instr, NULL, &source, NULL, NULL)
+               && source != NULL && current_node->defs[0] != NULL
+               && current_node->defs[0]->ID >= 0) {
+            interval = intervals[current_node->defs[0]->ID];
+            if (interval != NULL && interval->startPoint == counter)
+               interval->copiedFrom = source->ID;
+         }
          
          /* fetch the next node in the basic block */
          counter++;
          current_nd_element = LNEXT(current_nd_element);
       }
 
+      if (current_block->liveIn != NULL) {
+         for (i = nextInBitset(current_block->liveIn, 0); i >= 0
+               ; i = nextInBitset(current_block->liveIn, i + 1))
+            updateVarInterval(RA->arena, intervals, graph->variables[i], first, 0);
+      }
+      if (current_block->liveOut != NULL) {
+         for (i = nextInBitset(current_block->liveOut, 0); i >= 0
+               ; i = nextInBitset(current_block->liveOut, i + 1))
+            updateVarInterval(RA->arena, intervals, graph->variables[i], counter - 1, 0);
+      }
+
       /* fetch the next element in the list of basic blocks */
       current_bb_element = LNEXT(current_bb_element);
    }
 
+   /* sort the intervals by starting point */
+   RA->liveRangeEnds = malloc(sizeof(int) * (RA->varNum + 1));
+   if (RA->liveRangeEnds == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < RA->varNum; i++) {
+      RA->liveRangeEnds[i] = -1;
+      if (intervals[i] != NULL) {
+         setUsePoints(RA, intervals[i], usePoints[i]);
+         addToVector(result, intervals[i]);
+         RA->liveRangeEnds[i] = intervals[i]->endPoint;
+      }
+      freeVector(usePoints[i]);
+   }
+   sortVector(result, compareStartPoints);
+
+   free(intervals);
+   free(usePoints);
    return result;
 }
 
 /*
- * Update the liveness interval for the variable 'id', used or defined
- * at position 'counter'.
+ * Record that the variable `var' is used or defined by the instruction at
+ * position `counter'. The positions are recorded in increasing order.
+ */
+void addUsePoint(t_vector **usePoints, t_cflow_var *var, int counter)
+{
+   t_vector *points;
+
+   if (var->ID == RA_EXCLUDED_VARIABLE || var->ID == VAR_PSW)
+      return;
+
+   points = usePoints[var->ID];
+   if (points == NULL) {
+      points = allocVector(0);
+      usePoints[var->ID] = points;
+   }
+   if (VSIZE(points) == 0 || VINTDATA(points, VSIZE(points) - 1) != counter)
+      addToVector(points, INTDATA(counter));
+}
+
+/* Copy the use points of the variable of `interval' in the arena */
+void setUsePoints(t_reg_allocator *RA, t_live_interval *interval
+      , t_vector *usePoints)
+{
+   int i;
+
+   if (usePoints == NULL)
+      return;
+   interval->numUsePoints = VSIZE(usePoints);
+   interval->usePoints = arenaAlloc(RA->arena
+         , sizeof(int) * interval->numUsePoints);
+   if (interval->usePoints == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < interval->numUsePoints; i++)
+      interval->usePoints[i] = VINTDATA(usePoints, i);
+}
+
+/*
+ * Update the liveness interval for the variable `var', used or defined
+ * at position 'counter'. `isDef' is non-zero if the variable is defined
+ * at that position, zero if it is used or live there.
  */
-t_list *updateVarInterval(t_cflow_var *var, int counter, t_list *intervals )
+void updateVarInterval(t_arena *arena, t_live_interval **intervals
+            , t_cflow_var *var, int counter, int isDef)
 {
-    t_list *element_found;
     t_live_interval *interval_found;
-    t_live_interval pattern;
 
     if (var->ID == RA_EXCLUDED_VARIABLE || var->ID == VAR_PSW)
-        return intervals;
+        return;
     
-    pattern.varID = var->ID;
-    /* search for the current live interval */
-    element_found = CustomfindElement(intervals, &pattern, compareIntervalIDs);
-    if (element_found != NULL)
+    interval_found = intervals[var->ID];
+    if (interval_found != NULL)
     {
-        interval_found = (t_live_interval *) LDATA(element_found);
         /* update the interval informations */
-        if (interval_found->startPoint > counter)
+        if (interval_found->startPoint > counter) {
             interval_found->startPoint = counter;
+            interval_found->copiedFrom = RA_EXCLUDED_VARIABLE;
+        }
         if (interval_found->endPoint < counter)
             interval_found->endPoint = counter;
+        if (interval_found->startPoint == counter && !isDef)
+            interval_found->startsAtDef = 0;
     }
     else
     {
         /* we have to add a new live interval */
-        interval_found = allocLiveInterval(var->ID, var->mcRegWhitelist, counter, counter);
+        interval_found = allocLiveInterval(arena, var->ID, var->mcRegWhitelist, counter, counter);
         if (interval_found == NULL)
             notifyError(AXE_OUT_OF_MEMORY);
-        intervals = addElement(intervals, interval_found, -1);
+        interval_found->startsAtDef = isDef;
+        intervals[var->ID] = interval_found;
     }
-    
-    return intervals;
 }
 
 /*
- * Use liveness information to update the list of
- * live intervals
- */
-t_list * updateListOfIntervals(t_list *result
-         , t_cflow_Node *current_node, int counter)
-{
-   t_list *current_element;
-   t_cflow_var *current_var;
-   int i;
-   
-   if (current_node == NULL)
-      return result;
-
-   current_element = current_node->in;
-   while (current_element != NULL)
-   {
-      current_var = (t_cflow_var *) LDATA(current_element);
-
-      result = updateVarInterval(current_var, counter, result);
-      
-      /* fetch the next element in the list of live variables */
-      current_element = LNEXT(current_element);
-   }
-   
-   current_element = current_node->out;
-   while (current_element != NULL)
-   {
-      current_var = (t_cflow_var *) LDATA(current_element);
-
-      result = updateVarInterval(current_var, counter, result);
-      
-      /* fetch the next element in the list of live variables */
-      current_element = LNEXT(current_element);
-   }
-
-   for (i=0; i<CFLOW_MAX_DEFS; i++) {
-      if (current_node->defs[i])
-         result = updateVarInterval(current_node->defs[i], counter, result);
-   }
-
-   return result;
-}
-
-/*
- * Remove from active_intervals all the live intervals that end before the
+ * Remove from the active intervals all the live intervals that end before the
  * beginning of the current live interval
  */
-t_list * expireOldIntervals(t_reg_allocator *RA, t_list *active_intervals
+void expireOldIntervals(t_reg_allocator *RA, t_active_intervals *active
                , t_live_interval *interval)
 {
-   t_list *current_element;
-   t_list *next_element;
    t_live_interval *current_interval;
 
    /* Check for valid register allocator and set of active intervals */
-   if (active_intervals == NULL)
-      return NULL;
    if (RA == NULL)
-      return NULL;
+      return;
    if (interval == NULL)
-      return active_intervals;
+      return;
 
-   /* Iterate over the set of active intervals */
-   current_element = active_intervals;
-   while(current_element != NULL)
+   /* Iterate over the set of active intervals, in order of ending point */
+   while(active->size > 0)
    {
       /* Get the live interval */
-      current_interval = (t_live_interval *) LDATA(current_element);
+      current_interval = active->intervals[0];
 
       /* If the considered interval ends before the beginning of 
        * the current live interval, we don't need to keep track of
        * it anymore; otherwise, this is the first interval we must
        * still take into account when assigning registers. */
       if (current_interval->endPoint > interval->startPoint)
-         return active_intervals;
-
-      /* when current_interval->endPoint == interval->startPoint, 
-       * the variable associated to current_interval is being used by the
-       * instruction that defines interval. As a result, we can allocate
-       * interval to the same reg as current_interval. */
-      if (current_interval->endPoint == interval->startPoint) {
-         int curIntReg = RA->bindings[current_interval->varID];
-         if (curIntReg >= 0) {
-            t_list *allocated = addElement(NULL, INTDATA(curIntReg), 0);
-            interval->mcRegConstraints = optimizeRegisterSet(
-                  interval->mcRegConstraints, allocated);
-            freeList(allocated);
-         }
+         return;
+
+      /* a variable which is live before the instruction at the start of
+       * the interval (e.g. a variable live at the beginning of a basic
+       * block) cannot share the register with the ending interval */
+      if (current_interval->endPoint == interval->startPoint
+            && !interval->startsAtDef)
+         return;
+
+      /* when current_interval->endPoint == interval->startPoint and
+       * interval starts with a copy of the variable associated to
+       * current_interval, allocating interval to the same reg as
+       * current_interval removes the copy. The other intervals do not
+       * reuse the register, which may still hold the value of a variable
+       * kept in memory. */
+      if (current_interval->endPoint == interval->startPoint
+            && interval->copiedFrom == current_interval->varID) {
+         int curIntReg = current_interval->reg;
+         if (curIntReg >= 0)
+            optimizeRegisterSet(interval, RA_REGISTER_MASK(curIntReg));
       }
 
-      /* Get the next live interval */
-      next_element = LNEXT(current_element);
-
-      /* Remove the current element from the list */
-      active_intervals = removeElement(active_intervals, current_interval);
+      /* Remove the current element from the set */
+      removeActiveInterval(active, 0);
 
       /* Free all the registers associated with the removed interval */
-      RA->freeRegisters = addFreeRegister
-            (RA->freeRegisters, RA->bindings[current_interval->varID], 0);
-
-      /* Step to the next interval */
-      current_element = next_element;
+      RA->freeRegisters |= RA_REGISTER_MASK(current_interval->reg);
+      RA->freedAt[current_interval->reg] = current_interval->endPoint;
    }
-
-   /* Return the updated list of active intervals */
-   return active_intervals;
 }
 
-/*
- * Main register allocation function
- */
 int execute_linear_scan(t_reg_allocator *RA)
 {
-   t_list *current_element;
    t_live_interval *current_interval;
-   t_list *active_intervals;
+   t_active_intervals active;
+   int counter;
    
    /* test the preconditions */
    if (RA == NULL)   /* Register allocator created? */
       return RA_INVALID_ALLOCATOR;
-   if (RA->live_intervals == NULL) /* Liveness analysis ready? */
+   if (VSIZE(RA->live_intervals) == 0) /* Liveness analysis ready? */
       return RA_OK;
 
-   /* initialize the list of active intervals */
-   active_intervals = NULL;
+   /* initialize the set of active intervals. At most one interval per
+    * register can be active at the same time. */
+   active.intervals = malloc(sizeof(t_live_interval *) * (RA->regNum + 1));
+   active.sequence = malloc(sizeof(int) * (RA->regNum + 1));
+   if (active.intervals == NULL || active.sequence == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   active.size = 0;
+   active.nextSequence = 0;
    
    /* Iterate over the list of live intervals */   
-   for( current_element = RA->live_intervals
-        ;   current_element != NULL
-        ;   current_element = LNEXT(current_element) )
+   for (counter = 0; counter < VSIZE(RA->live_intervals); counter++)
    {
       /* Get the live interval */
-      current_interval = (t_live_interval *) LDATA(current_element);
+      current_interval = (t_live_interval *) VDATA(RA->live_intervals, counter);
 
       /* Check which intervals are ended and remove 
        * them from the active set, thus freeing registers */
-      active_intervals = expireOldIntervals
-               (RA, active_intervals, current_interval);
+      expireOldIntervals(RA, &active, current_interval);
 
-      int reg = assignRegister(RA, current_interval->mcRegConstraints);
+      int reg = assignRegister(RA, current_interval);
 
       /* If all registers are busy, perform a spill */
       if (reg == RA_SPILL_REQUIRED)
       {
          /* perform a spill */
-         active_intervals = spillAtInterval
-               (RA, active_intervals, current_interval);
+         spillAtInterval(RA, &active, current_interval);
       }
       else /* Otherwise, assign a new register to the current live interval */
       {
-         RA->bindings[current_interval->varID] = reg;
+         current_interval->reg = reg;
 
-         /* Add the current interval to the list of active intervals, in
+         /* Add the current interval to the set of active intervals, in
           * order of ending points (to allow easier expire management) */
-         active_intervals = addSorted(active_intervals
-            , current_interval, compareEndPoints);
+         insertActiveInterval(&active, current_interval);
       }
    }
 
-   /* free the list of active intervals */
-   freeList(active_intervals);
+   /* free the set of active intervals */
+   free(active.intervals);
+   free(active.sequence);
+
+   bindRegisters(RA);
    
    return RA_OK;
 }
+
+int countSpilledVariables(t_reg_allocator *RA)
+{
+   int counter;
+   int result = 0;
+
+   if (RA == NULL)
+      return 0;
+
+   for (counter = 0; counter < RA->varNum; counter++) {
+      if (RA->bindings[counter] == RA_SPILL_REQUIRED
+            && RA->splitIntervals[counter] == NULL)
+         result++;
+   }
+   return result;
+}
+
+int getRegisterInBlock(t_reg_allocator *RA, int varID, int block)
+{
+   t_vector *parts;
+   t_live_interval *interval;
+   int start, low, high;
+
+   parts = RA->splitIntervals[varID];
+   if (parts == NULL)
+      return RA->bindings[varID];
+
+   /* find the last part which starts before the end of the block */
+   start = VINTDATA(RA->blockStarts, block);
+   low = 0;
+   high = VSIZE(parts);
+   while (low < high) {
+      int mid = (low + high) / 2;
+      interval = VDATA(parts, mid);
+      if (interval->startPoint <= getBlockEnd(RA, block))
+         low = mid + 1;
+      else
+         high = mid;
+   }
+   if (low == 0)
+      return RA_SPILL_REQUIRED;
+   interval = VDATA(parts, low - 1);
+   if (interval->endPoint < start)
+      return RA_SPILL_REQUIRED;
+   return interval->reg;
+}
+
+int assignSpillSlots(t_reg_allocator *RA, int *slots)
+{
+   t_live_interval *interval, *range, *ranges;
+   t_active_intervals active;
+   t_vector *sorted;
+   int *freeSlots;
+   int numFree, numSlots, i;
+
+   /* the range of each spilled variable goes from the first to the last
+    * instruction where it is live. The intervals of a split variable do not
+    * cover the parts where it is in memory, thus the end of the range is
+    * the one computed before the splits. The value of a variable is never
+    * written back to memory after its range. */
+   ranges = calloc(RA->varNum, sizeof(t_live_interval));
+   if (ranges == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   for (i = 0; i < RA->varNum; i++) {
+      slots[i] = -1;
+      ranges[i].varID = i;
+      ranges[i].startPoint = -1;
+   }
+   for (i = 0; i < VSIZE(RA->live_intervals); i++) {
+      interval = VDATA(RA->live_intervals, i);
+      if (RA->bindings[interval->varID] != RA_SPILL_REQUIRED)
+         continue;
+      range = &ranges[interval->varID];
+      if (range->startPoint < 0 || range->startPoint > interval->startPoint)
+         range->startPoint = interval->startPoint;
+      range->endPoint = RA->liveRangeEnds[interval->varID];
+   }
+
+   numSlots = 0;
+   sorted = allocVector(0);
+   for (i = 0; i < RA->varNum; i++) {
+      if (RA->bindings[i] != RA_SPILL_REQUIRED || RA->rematDefs[i] != NULL)
+         continue;
+      if (ranges[i].startPoint < 0) {
+         /* never live: keep a slot for the stores of its definitions */
+         slots[i] = numSlots++;
+         continue;
+      }
+      addToVector(sorted, &ranges[i]);
+   }
+   sortVector(sorted, compareStartPoints);
+
+   /* assign the slots as registers are assigned by the linear scan, without
+    * limits on their number */
+   active.intervals = malloc(sizeof(t_live_interval *) * (VSIZE(sorted) + 1));
+   active.sequence = malloc(sizeof(int) * (VSIZE(sorted) + 1));
+   freeSlots = malloc(sizeof(int) * (VSIZE(sorted) + 1));
+   if (active.intervals == NULL || active.sequence == NULL
+         || freeSlots == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   active.size = 0;
+   active.nextSequence = 0;
+   numFree = 0;
+
+   for (i = 0; i < VSIZE(sorted); i++) {
+      interval = VDATA(sorted, i);
+      while (active.size > 0
+            && active.intervals[0]->endPoint < interval->startPoint)
+      {
+         freeSlots[numFree++] = active.intervals[0]->reg;
+         removeActiveInterval(&active, 0);
+      }
+      if (numFree > 0)
+         interval->reg = freeSlots[--numFree];
+      else
+         interval->reg = numSlots++;
+      slots[interval->varID] = interval->reg;
+      insertActiveInterval(&active, interval);
+   }
+
+   free(freeSlots);
+   free(active.intervals);
+   free(active.sequence);
+   freeVector(sorted);
+   free(ranges);
+   return numSlots;
+}
@@ -17,28 +17,66 @@
 #include "axe_engine.h"
 #include "collections.h"
 #include "axe_cflow_graph.h"
+#include "reg_alloc_constants.h"
 
 typedef struct t_live_interval
 {
    int varID;     /* a variable identifier */
-   t_list *mcRegConstraints; /* list of all registers where this variable can
-                              * be allocated. */
+   unsigned int mcRegConstraints; /* set of all registers where this
+                                   * variable can be allocated; bit N is set
+                                   * if register N is allowed. */
+   unsigned char mcRegHints[RA_MAX_REGISTERS]; /* allowed registers to be
+                                   * tried first, in order of preference */
+   int numRegHints;  /* number of elements in mcRegHints */
    int startPoint;  /* the index of the first instruction
                      * that make use of (or define) this variable */
    int endPoint;   /* the index of the last instruction
                     * that make use of (or define) this variable */
+   int startsAtDef; /* non-zero if the variable is defined, and not used nor
+                     * live, at the first instruction of the interval */
+   int copiedFrom; /* the variable copied into this one by the first
+                    * instruction of the interval, or RA_EXCLUDED_VARIABLE */
+   int reg;        /* the register assigned to the interval, or
+                    * RA_SPILL_REQUIRED */
+   int canSplit;   /* zero if the variable must stay in one register (or in
+                    * memory) for its whole lifetime */
+   int *usePoints; /* the instructions which use or define the variable, in
+                    * order. Shared by all the intervals of the variable. */
+   int numUsePoints;
 }t_live_interval;
 
 typedef struct t_reg_allocator
 {
-   t_list *live_intervals;    /* an ordered list of live intervals */
+   t_vector *live_intervals;  /* the live intervals, ordered by start */
    int regNum;                /* the number of registers of the machine */
    int varNum;                /* number of variables */
    int *bindings;             /* an array of bindings of kind : varID-->register.
                                * If a certain variable X need to be spilled
                                * in memory, the value of `register' is set
                                * to the value of the macro RA_SPILL_REQUIRED */
-   t_list *freeRegisters;     /* a list of free registers */
+   unsigned int freeRegisters; /* the set of free registers */
+   int freedAt[RA_MAX_REGISTERS]; /* for each register, the end point of the
+                               * last interval which has released it; -1
+                               * if the register has never been used */
+   t_arena *arena;            /* memory of the live intervals */
+   t_vector *blockStarts;     /* index of the first instruction of each basic
+                               * block, in the order of the blocks */
+   double *blockFrequencies;  /* estimated frequency of each basic block */
+   t_vector **splitIntervals; /* for each variable whose live interval has
+                               * been split, the parts of the interval
+                               * allocated to a register, in order; NULL for
+                               * the other variables. The binding of a split
+                               * variable is RA_SPILL_REQUIRED. */
+   t_vector *splitVariables;  /* identifiers of the split variables */
+   int numSplits;             /* number of times an interval has been split */
+   int *liveRangeEnds;        /* for each variable, the position of the last
+                               * instruction where it is live, computed
+                               * before any interval is split; -1 for the
+                               * variables which are never live */
+   t_axe_instruction **rematDefs; /* for each variable whose value can be
+                               * recomputed instead of being reloaded from
+                               * memory, its only definition (a constant or
+                               * a label address); NULL for the others */
 }t_reg_allocator;
 
 
@@ -51,4 +89,19 @@ extern void finalizeRegAlloc(t_reg_allocator *RA);
 /* execute the register allocation algorithm (Linear Scan) */
 extern int execute_linear_scan(t_reg_allocator *RA);
 
+/* returns the number of variables which have been spilled to memory */
+extern int countSpilledVariables(t_reg_allocator *RA);
+
+/* returns the register of the variable `varID' inside the basic block number
+ * `block' (in the order of the blocks of the graph), or RA_SPILL_REQUIRED if
+ * the variable lives in memory in that block. Unlike `bindings', it takes
+ * into account the splitting of the live intervals. */
+extern int getRegisterInBlock(t_reg_allocator *RA, int varID, int block);
+
+/* fill `slots' (an array of `RA->varNum' elements) with the memory slot of
+ * each variable whose binding is RA_SPILL_REQUIRED, and with -1 for the
+ * other variables. Variables which are never live at the same time share
+ * the same slot. Returns the number of slots. */
+extern int assignSpillSlots(t_reg_allocator *RA, int *slots);
+
 #endif
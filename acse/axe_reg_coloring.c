@@ -0,0 +1,611 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_reg_coloring.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include "axe_reg_coloring.h"
+#include "reg_alloc_constants.h"
+#include "axe_target_info.h"
+#include "axe_errors.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+#include "axe_arena.h"
+
+/* states of the nodes of the interference graph */
+#define NODE_EXCLUDED   0  /* not a register allocation candidate */
+#define NODE_ACTIVE     1  /* still part of the graph */
+#define NODE_COALESCED  2  /* merged with another node (see `alias') */
+#define NODE_STACKED    3  /* removed from the graph, waiting for a color */
+#define NODE_COLORED    4  /* a register has been chosen, or it is spilled */
+
+/* above this number of bits the interference matrix is replaced by a hash
+ * set of edges */
+#define MAX_MATRIX_BITS (1 << 27)
+
+/* a node of the interference graph. There is a node for each variable of
+ * the control flow graph, with the same index. The machine registers are
+ * precolored nodes; the edges towards them are not stored explicitly but
+ * in the `forbidden' mask of each node. */
+typedef struct t_coloring_node
+{
+   t_cflow_var *var;
+   int state;
+   int alias;              /* the node this one has been coalesced into */
+   int degree;             /* neighbors which are still in the graph */
+   unsigned int forbidden; /* precolored neighbors: registers where the
+                            * variable cannot be allocated */
+   double spillCost;       /* uses and definitions weighted by the
+                            * frequency of their blocks */
+   int color;              /* the register, or RA_SPILL_REQUIRED */
+   t_vector *adjacent;     /* neighbor nodes (node indices). Neighbors which
+                            * have been coalesced are stale and skipped. */
+   t_small_vector partners; /* nodes related to this one by a copy */
+}t_coloring_node;
+
+typedef struct t_coloring_move
+{
+   int dest;
+   int src;
+}t_coloring_move;
+
+typedef struct t_interference_graph
+{
+   t_coloring_node *nodes;
+   int numNodes;
+   int numColors;             /* number of available registers (K) */
+   unsigned int allRegisters; /* the set of available registers */
+   t_bitset *matrix;          /* lower triangular adjacency matrix */
+   t_hashset *edges;          /* set of edges, if there is no matrix */
+   int numEdges;
+   t_vector *moves;           /* candidate copies (t_coloring_move) */
+   int *marks;                /* scratch space for the neighbor visits */
+   int currentMark;
+}t_interference_graph;
+
+static t_interference_graph * allocInterferenceGraph(t_reg_allocator *RA
+      , t_cflow_Graph *graph);
+static void finalizeInterferenceGraph(t_interference_graph *ig);
+static int isCandidate(t_cflow_var *var);
+static int interferes(t_interference_graph *ig, int a, int b);
+static void addInterference(t_interference_graph *ig, int a, int b);
+static int findAlias(t_interference_graph *ig, int node);
+static int countRegisters(unsigned int set);
+static int effectiveDegree(t_interference_graph *ig, int node);
+static void buildInterferenceGraph(t_interference_graph *ig
+      , t_cflow_Graph *graph, t_arena *arena);
+static void buildBlockInterferences(t_interference_graph *ig
+      , t_cflow_Graph *graph, t_basic_block *block, t_bitset *live
+      , t_arena *arena);
+static int canCoalesce(t_interference_graph *ig, int a, int b);
+static void mergeNodes(t_interference_graph *ig, int a, int b);
+static int coalesceMoves(t_interference_graph *ig);
+static int selectSpillCandidate(t_interference_graph *ig);
+static void removeNode(t_interference_graph *ig, int node
+      , t_vector *lowDegree);
+static int * simplifyGraph(t_interference_graph *ig, int *stackSize);
+static void selectColor(t_interference_graph *ig, int node);
+
+
+t_interference_graph * allocInterferenceGraph(t_reg_allocator *RA
+      , t_cflow_Graph *graph)
+{
+   t_interference_graph *ig;
+   long matrixBits;
+   int i;
+
+   ig = malloc(sizeof(t_interference_graph));
+   if (ig == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   ig->numNodes = graph->numVariables;
+   ig->numColors = RA->regNum;
+   ig->allRegisters = RA->freeRegisters;
+   ig->nodes = calloc(ig->numNodes + 1, sizeof(t_coloring_node));
+   ig->marks = calloc(ig->numNodes + 1, sizeof(int));
+   if (ig->nodes == NULL || ig->marks == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   ig->currentMark = 0;
+   ig->numEdges = 0;
+   ig->moves = allocVector(0);
+
+   matrixBits = (long)ig->numNodes * (ig->numNodes - 1) / 2;
+   ig->matrix = NULL;
+   ig->edges = NULL;
+   if (matrixBits <= MAX_MATRIX_BITS)
+      ig->matrix = allocBitset(matrixBits > 0 ? (int)matrixBits : 1);
+   else
+      ig->edges = allocHashSet(NULL, NULL);
+
+   for (i = 0; i < ig->numNodes; i++)
+   {
+      t_coloring_node *node = &ig->nodes[i];
+      t_list *reg;
+
+      node->var = graph->variables[i];
+      node->state = isCandidate(node->var) ? NODE_ACTIVE : NODE_EXCLUDED;
+      node->alias = i;
+      node->color = RA_SPILL_REQUIRED;
+      node->adjacent = allocVector(0);
+      initSmallVector(&node->partners);
+
+      /* a variable which can be allocated only to some registers
+       * interferes with the precolored nodes of all the others */
+      if (node->var->mcRegWhitelist != NULL) {
+         unsigned int allowed = 0;
+         for (reg = node->var->mcRegWhitelist; reg; reg = LNEXT(reg))
+            allowed |= RA_REGISTER_MASK(LINTDATA(reg));
+         node->forbidden = ig->allRegisters & ~allowed;
+      }
+   }
+
+   return ig;
+}
+
+void finalizeInterferenceGraph(t_interference_graph *ig)
+{
+   int i;
+
+   for (i = 0; i < ig->numNodes; i++) {
+      freeVector(ig->nodes[i].adjacent);
+      finalizeSmallVector(&ig->nodes[i].partners);
+   }
+   free(ig->nodes);
+   free(ig->marks);
+   freeBitset(ig->matrix);
+   if (ig->edges != NULL)
+      freeHashSet(ig->edges);
+   freeVector(ig->moves);
+   free(ig);
+}
+
+/* R0 and the status word are never allocated */
+int isCandidate(t_cflow_var *var)
+{
+   return var != NULL && var->ID != RA_EXCLUDED_VARIABLE
+         && var->ID != VAR_PSW;
+}
+
+int interferes(t_interference_graph *ig, int a, int b)
+{
+   int tmp;
+
+   if (a < b) {
+      tmp = a;
+      a = b;
+      b = tmp;
+   }
+   if (ig->matrix != NULL)
+      return isInBitset(ig->matrix, (int)((long)a * (a - 1) / 2 + b));
+   return isInHashSet(ig->edges
+         , INTDATA((intptr_t)a * ig->numNodes + b));
+}
+
+void addInterference(t_interference_graph *ig, int a, int b)
+{
+   int tmp;
+
+   if (a == b || interferes(ig, a, b))
+      return;
+
+   if (a < b) {
+      tmp = a;
+      a = b;
+      b = tmp;
+   }
+   if (ig->matrix != NULL)
+      addToBitset(ig->matrix, (int)((long)a * (a - 1) / 2 + b));
+   else
+      addToHashSet(ig->edges, INTDATA((intptr_t)a * ig->numNodes + b));
+
+   addToVector(ig->nodes[a].adjacent, INTDATA(b));
+   addToVector(ig->nodes[b].adjacent, INTDATA(a));
+   ig->nodes[a].degree++;
+   ig->nodes[b].degree++;
+   ig->numEdges++;
+}
+
+int findAlias(t_interference_graph *ig, int node)
+{
+   while (ig->nodes[node].alias != node)
+      node = ig->nodes[node].alias;
+   return node;
+}
+
+int countRegisters(unsigned int set)
+{
+   return __builtin_popcount(set);
+}
+
+/* number of neighbors, including the precolored ones */
+int effectiveDegree(t_interference_graph *ig, int node)
+{
+   return ig->nodes[node].degree + countRegisters(ig->nodes[node].forbidden);
+}
+
+/*
+ * Add the interferences of the instructions of `block'. A variable defined
+ * by an instruction interferes with all the variables live after it, except
+ * the source of a copy, which can share the register of the destination.
+ */
+void buildBlockInterferences(t_interference_graph *ig, t_cflow_Graph *graph
+      , t_basic_block *block, t_bitset *live, t_arena *arena)
+{
+   t_list *current_element;
+   double weight;
+   int i, j, v;
+
+   weight = block->frequency;
+   copyBitset(live, block->liveOut);
+
+   for (current_element = getLastElement(block->nodes)
+         ; current_element != NULL
+         ; current_element = LPREV(current_element))
+   {
+      t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+      t_axe_register *dest, *src;
+      t_cflow_var *srcVar = NULL;
+
+      if (isMoveInstruction(node->instr, &dest, &src, NULL, NULL)
+            && src != NULL && !dest->indirect && !src->indirect)
+      {
+         t_cflow_var *destVar = getCflowVariable(graph, dest->ID);
+         srcVar = getCflowVariable(graph, src->ID);
+         if (isCandidate(destVar) && isCandidate(srcVar)
+               && destVar != srcVar)
+         {
+            t_coloring_move *move = arenaAlloc(arena
+                  , sizeof(t_coloring_move));
+            if (move == NULL)
+               notifyError(AXE_OUT_OF_MEMORY);
+            move->dest = destVar->index;
+            move->src = srcVar->index;
+            addToVector(ig->moves, move);
+            addToSmallVector(&ig->nodes[move->dest].partners
+                  , INTDATA(move->src));
+            addToSmallVector(&ig->nodes[move->src].partners
+                  , INTDATA(move->dest));
+         }
+         else
+            srcVar = NULL;
+      }
+
+      for (i = 0; i < CFLOW_MAX_DEFS; i++)
+      {
+         t_cflow_var *def = node->defs[i];
+         if (!isCandidate(def))
+            continue;
+
+         for (v = nextInBitset(live, 0); v >= 0; v = nextInBitset(live, v + 1))
+         {
+            if (ig->nodes[v].state == NODE_EXCLUDED)
+               continue;
+            if (srcVar != NULL && v == srcVar->index)
+               continue;
+            addInterference(ig, def->index, v);
+         }
+         for (j = i + 1; j < CFLOW_MAX_DEFS; j++) {
+            if (isCandidate(node->defs[j]))
+               addInterference(ig, def->index, node->defs[j]->index);
+         }
+         ig->nodes[def->index].spillCost += weight;
+      }
+
+      for (i = 0; i < CFLOW_MAX_USES; i++) {
+         if (isCandidate(node->uses[i]))
+            ig->nodes[node->uses[i]->index].spillCost += weight;
+      }
+
+      computeLiveINVarsOfNode(node, live);
+   }
+}
+
+void buildInterferenceGraph(t_interference_graph *ig, t_cflow_Graph *graph
+      , t_arena *arena)
+{
+   t_list *current_element;
+   t_bitset *live;
+
+   live = allocBitset(graph->numVariables);
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      if (block->liveOut != NULL)
+         buildBlockInterferences(ig, graph, block, live, arena);
+   }
+   freeBitset(live);
+}
+
+/*
+ * Briggs' conservative test: the nodes `a' and `b' can be merged if the
+ * resulting node has less than K neighbors of significant degree (K or
+ * more), because then it will still be colorable.
+ */
+int canCoalesce(t_interference_graph *ig, int a, int b)
+{
+   unsigned int forbidden;
+   int significant;
+   int i, n;
+
+   forbidden = ig->nodes[a].forbidden | ig->nodes[b].forbidden;
+   significant = countRegisters(forbidden);
+   if (significant >= ig->numColors)
+      return 0;
+
+   /* the neighbors of both nodes lose one neighbor with the merge */
+   ig->currentMark++;
+   for (i = 0; i < VSIZE(ig->nodes[a].adjacent); i++) {
+      n = VINTDATA(ig->nodes[a].adjacent, i);
+      if (ig->nodes[n].state == NODE_ACTIVE)
+         ig->marks[n] = ig->currentMark;
+   }
+   for (i = 0; i < VSIZE(ig->nodes[b].adjacent); i++) {
+      n = VINTDATA(ig->nodes[b].adjacent, i);
+      if (ig->nodes[n].state != NODE_ACTIVE)
+         continue;
+      if (ig->marks[n] == ig->currentMark) {
+         ig->marks[n] = -ig->currentMark;
+         if (effectiveDegree(ig, n) - 1 >= ig->numColors)
+            significant++;
+      } else if (ig->marks[n] != -ig->currentMark) {
+         ig->marks[n] = -ig->currentMark;
+         if (effectiveDegree(ig, n) >= ig->numColors)
+            significant++;
+      }
+   }
+   for (i = 0; i < VSIZE(ig->nodes[a].adjacent); i++) {
+      n = VINTDATA(ig->nodes[a].adjacent, i);
+      if (ig->nodes[n].state != NODE_ACTIVE || ig->marks[n] < 0)
+         continue;
+      ig->marks[n] = -ig->currentMark;
+      if (effectiveDegree(ig, n) >= ig->numColors)
+         significant++;
+   }
+
+   return significant < ig->numColors;
+}
+
+/* merge the node `b' into the node `a' */
+void mergeNodes(t_interference_graph *ig, int a, int b)
+{
+   t_coloring_node *nodeA = &ig->nodes[a];
+   t_coloring_node *nodeB = &ig->nodes[b];
+   int i, n;
+
+   nodeB->state = NODE_COALESCED;
+   nodeB->alias = a;
+   for (i = 0; i < VSIZE(nodeB->adjacent); i++)
+   {
+      n = VINTDATA(nodeB->adjacent, i);
+      if (ig->nodes[n].state != NODE_ACTIVE)
+         continue;
+      if (interferes(ig, a, n))
+         ig->nodes[n].degree--;
+      else {
+         /* the edge with `b' becomes an edge with `a' */
+         ig->nodes[n].degree--;
+         nodeB->degree--;
+         addInterference(ig, a, n);
+         ig->numEdges--;
+      }
+   }
+   nodeA->forbidden |= nodeB->forbidden;
+   nodeA->spillCost += nodeB->spillCost;
+   for (i = 0; i < SVSIZE(&nodeB->partners); i++)
+      addToSmallVector(&nodeA->partners, SVDATA(&nodeB->partners, i));
+}
+
+/* coalesce the copies until no more copies can be coalesced. Returns the
+ * number of nodes merged. */
+int coalesceMoves(t_interference_graph *ig)
+{
+   int coalesced = 0;
+   int modified;
+   int i;
+
+   do
+   {
+      modified = 0;
+      for (i = 0; i < VSIZE(ig->moves); i++)
+      {
+         t_coloring_move *move = VDATA(ig->moves, i);
+         int a = findAlias(ig, move->dest);
+         int b = findAlias(ig, move->src);
+
+         if (a == b || interferes(ig, a, b) || !canCoalesce(ig, a, b))
+            continue;
+         mergeNodes(ig, a, b);
+         coalesced++;
+         modified = 1;
+      }
+   } while (modified);
+
+   return coalesced;
+}
+
+/* choose the node to remove from the graph when all the remaining nodes
+ * have significant degree: the one with the lowest cost per neighbor. The
+ * nodes restricted to some registers are chosen only as a last resort. */
+int selectSpillCandidate(t_interference_graph *ig)
+{
+   double bestCost = 0;
+   int best = -1;
+   int bestRestricted = 1;
+   int i;
+
+   for (i = 0; i < ig->numNodes; i++)
+   {
+      t_coloring_node *node = &ig->nodes[i];
+      double cost;
+      int restricted;
+
+      if (node->state != NODE_ACTIVE)
+         continue;
+      cost = node->spillCost / (effectiveDegree(ig, i) + 1);
+      restricted = node->forbidden != 0;
+      if (best < 0 || (bestRestricted && !restricted)
+            || (restricted == bestRestricted && cost < bestCost))
+      {
+         best = i;
+         bestCost = cost;
+         bestRestricted = restricted;
+      }
+   }
+   return best;
+}
+
+/* remove `node' from the graph, updating the degree of its neighbors */
+void removeNode(t_interference_graph *ig, int node, t_vector *lowDegree)
+{
+   t_vector *adjacent = ig->nodes[node].adjacent;
+   int i, n;
+
+   ig->nodes[node].state = NODE_STACKED;
+   for (i = 0; i < VSIZE(adjacent); i++)
+   {
+      n = VINTDATA(adjacent, i);
+      if (ig->nodes[n].state != NODE_ACTIVE)
+         continue;
+      ig->nodes[n].degree--;
+      if (effectiveDegree(ig, n) == ig->numColors - 1)
+         addToVector(lowDegree, INTDATA(n));
+   }
+}
+
+/* Remove all the nodes from the graph. The nodes with less than K
+ * neighbors are removed first, since they can always be colored; when
+ * there are none left, a spill candidate is removed optimistically.
+ * Returns the nodes in order of removal. */
+int * simplifyGraph(t_interference_graph *ig, int *stackSize)
+{
+   t_vector *lowDegree;
+   int *stack;
+   int remaining = 0;
+   int i;
+
+   stack = malloc(sizeof(int) * (ig->numNodes + 1));
+   if (stack == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   lowDegree = allocVector(0);
+   for (i = 0; i < ig->numNodes; i++) {
+      if (ig->nodes[i].state != NODE_ACTIVE)
+         continue;
+      remaining++;
+      if (effectiveDegree(ig, i) < ig->numColors)
+         addToVector(lowDegree, INTDATA(i));
+   }
+
+   *stackSize = 0;
+   while (remaining > 0)
+   {
+      int node;
+
+      if (VSIZE(lowDegree) > 0) {
+         node = (int)(intptr_t)removeLastFromVector(lowDegree);
+         if (ig->nodes[node].state != NODE_ACTIVE)
+            continue;
+      } else
+         node = selectSpillCandidate(ig);
+
+      removeNode(ig, node, lowDegree);
+      stack[(*stackSize)++] = node;
+      remaining--;
+   }
+
+   freeVector(lowDegree);
+   return stack;
+}
+
+/* give `node' a register not used by its neighbors, preferring the
+ * registers of the nodes it is copied from or to */
+void selectColor(t_interference_graph *ig, int node)
+{
+   t_coloring_node *current = &ig->nodes[node];
+   unsigned int available;
+   int i, n;
+
+   available = ig->allRegisters & ~current->forbidden;
+   for (i = 0; i < VSIZE(current->adjacent); i++) {
+      n = VINTDATA(current->adjacent, i);
+      if (ig->nodes[n].state == NODE_COLORED
+            && ig->nodes[n].color != RA_SPILL_REQUIRED)
+         available &= ~RA_REGISTER_MASK(ig->nodes[n].color);
+   }
+
+   current->state = NODE_COLORED;
+   if (available == 0) {
+      current->color = RA_SPILL_REQUIRED;
+      return;
+   }
+
+   current->color = __builtin_ctz(available);
+   for (i = 0; i < SVSIZE(&current->partners); i++) {
+      t_coloring_node *partner;
+
+      partner = &ig->nodes[findAlias(ig
+            , (int)(intptr_t)SVDATA(&current->partners, i))];
+      if (partner->state == NODE_COLORED
+            && partner->color != RA_SPILL_REQUIRED
+            && (available & RA_REGISTER_MASK(partner->color))) {
+         current->color = partner->color;
+         return;
+      }
+   }
+}
+
+int execute_graph_coloring(t_reg_allocator *RA, t_cflow_Graph *graph)
+{
+   t_interference_graph *ig;
+   int *stack;
+   int stackSize;
+   int coalesced;
+   int i;
+
+   /* test the preconditions */
+   if (RA == NULL)
+      return RA_INVALID_ALLOCATOR;
+   if (graph == NULL)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+
+   ig = allocInterferenceGraph(RA, graph);
+   buildInterferenceGraph(ig, graph, RA->arena);
+   setStatistic("ra.interferences", ig->numEdges);
+
+   /* the variables which can be rematerialized are cheaper to spill */
+   for (i = 0; i < ig->numNodes; i++)
+   {
+      t_coloring_node *node = &ig->nodes[i];
+
+      if (node->state != NODE_EXCLUDED && node->var->ID >= 0
+            && RA->rematDefs[node->var->ID] != NULL)
+         node->spillCost *= RA_REMAT_COST_FACTOR;
+   }
+   setStatistic("ra.copies", VSIZE(ig->moves));
+
+   coalesced = coalesceMoves(ig);
+   setStatistic("ra.coalesced", coalesced);
+
+   stack = simplifyGraph(ig, &stackSize);
+   while (stackSize > 0)
+      selectColor(ig, stack[--stackSize]);
+   free(stack);
+
+   /* the coalesced nodes share the register of the node they have been
+    * merged with */
+   for (i = 0; i < ig->numNodes; i++)
+   {
+      t_coloring_node *node = &ig->nodes[i];
+
+      if (node->state == NODE_EXCLUDED)
+         continue;
+      assert(node->var->ID < RA->varNum);
+      RA->bindings[node->var->ID] = ig->nodes[findAlias(ig, i)].color;
+   }
+
+   finalizeInterferenceGraph(ig);
+   return RA_OK;
+}
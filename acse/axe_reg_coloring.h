@@ -0,0 +1,28 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_reg_coloring.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Register allocation by graph coloring (Chaitin-Briggs), an alternative to
+ * the linear scan algorithm of axe_reg_alloc.c. The interference graph is
+ * built from the liveness informations of the control flow graph; copies
+ * are conservatively coalesced, and the graph is colored by simplification
+ * and optimistic selection. Spill candidates are chosen by spill cost,
+ * weighting each use and definition by the estimated frequency of its
+ * block.
+ */
+
+#ifndef _AXE_REG_COLORING_H
+#define _AXE_REG_COLORING_H
+
+#include "axe_reg_alloc.h"
+#include "axe_cflow_graph.h"
+
+/* Assign a register to each variable of `graph', or mark it as spilled, by
+ * filling the bindings of the register allocator `RA'. The liveness
+ * analysis and `computeLoopDepths' must have been performed on `graph'.
+ * Returns RA_OK on success. */
+extern int execute_graph_coloring(t_reg_allocator *RA, t_cflow_Graph *graph);
+
+#endif
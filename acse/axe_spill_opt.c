@@ -0,0 +1,620 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_spill_opt.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include "axe_spill_opt.h"
+#include "reg_alloc_constants.h"
+#include "axe_target_info.h"
+#include "axe_errors.h"
+#include "axe_stats.h"
+#include "axe_utils.h"
+
+/* the value of a register which does not hold the content of any memory
+ * location */
+#define NO_LABEL -1
+
+/* number of machine registers, including REG_0 */
+#define NUM_MACHINE_REGS (NUM_REGISTERS + 1)
+
+typedef struct t_spill_opt
+{
+   t_program_infos *program;
+   t_cflow_Graph *graph;
+   t_basic_block **blocks;    /* the reachable blocks, by rpoNumber */
+   int numBlocks;             /* number of reachable blocks */
+   char *eligible;            /* for each label identifier, non-zero if the
+                               * label is accessed only by direct loads and
+                               * stores */
+   unsigned int numLabels;
+   unsigned int *liveIn;      /* registers live at the beginning of each
+                               * block */
+   unsigned int *liveOut;     /* registers live at the end of each block */
+   int *available;            /* for each block and register, the label whose
+                               * memory location holds the same value as the
+                               * register at the end of the block, or
+                               * NO_LABEL */
+   char *visited;             /* non-zero for the blocks whose `available'
+                               * has been computed at least once */
+}t_spill_opt;
+
+static unsigned int usedRegisters(t_axe_instruction *instr);
+static unsigned int definedRegisters(t_axe_instruction *instr);
+static int memoryLabel(t_spill_opt *opt, t_axe_instruction *instr);
+static void findEligibleLabels(t_spill_opt *opt);
+static void computeRegisterLiveness(t_spill_opt *opt);
+static int compareLoopDepths(const void *a, const void *b);
+static int hoistLoopInvariantLoads(t_spill_opt *opt, t_basic_block *header
+      , int *marks, t_vector *body);
+static void insertLoadAtEnd(t_spill_opt *opt, t_basic_block *block
+      , t_axe_instruction *model);
+static void meetAvailability(t_spill_opt *opt, t_basic_block *block
+      , int *state);
+static int transferAvailability(t_spill_opt *opt, t_axe_instruction *instr
+      , int *state);
+static void computeAvailability(t_spill_opt *opt);
+static void removeRedundantAccesses(t_spill_opt *opt);
+
+
+/* Returns the set of the registers read by `instr' */
+unsigned int usedRegisters(t_axe_instruction *instr)
+{
+   unsigned int result = 0;
+
+   if (instr->reg_2 != NULL)
+      result |= RA_REGISTER_MASK(instr->reg_2->ID);
+   if (instr->reg_3 != NULL)
+      result |= RA_REGISTER_MASK(instr->reg_3->ID);
+   if (instr->reg_1 != NULL && (instr->reg_1->indirect
+         || instr->opcode == STORE || instr->opcode == AXE_WRITE
+         || instr->opcode == JSR))
+      result |= RA_REGISTER_MASK(instr->reg_1->ID);
+   return result & ~RA_REGISTER_MASK(REG_0);
+}
+
+/* Returns the set of the registers written by `instr' */
+unsigned int definedRegisters(t_axe_instruction *instr)
+{
+   if (instr->reg_1 == NULL || instr->reg_1->indirect)
+      return 0;
+   if (isJumpInstruction(instr) || isHaltOrRetInstruction(instr))
+      return 0;
+   if (instr->opcode == STORE || instr->opcode == AXE_WRITE
+         || instr->opcode == NOP)
+      return 0;
+   return RA_REGISTER_MASK(instr->reg_1->ID) & ~RA_REGISTER_MASK(REG_0);
+}
+
+/*
+ * Returns the identifier of the label accessed by `instr', if it is a
+ * direct load or store of a memory location considered by the
+ * optimization; NO_LABEL otherwise
+ */
+int memoryLabel(t_spill_opt *opt, t_axe_instruction *instr)
+{
+   t_axe_label *label;
+
+   if (instr->opcode != LOAD && instr->opcode != STORE)
+      return NO_LABEL;
+   if (instr->reg_1 == NULL || instr->reg_1->indirect)
+      return NO_LABEL;
+   if (instr->address == NULL || instr->address->type != LABEL_TYPE)
+      return NO_LABEL;
+   label = instr->address->labelID;
+   if (label == NULL || !opt->eligible[label->labelID])
+      return NO_LABEL;
+   return (int)label->labelID;
+}
+
+/*
+ * Find the labels which are accessed only by direct loads and stores. The
+ * memory locations of the other labels (for instance the arrays, whose
+ * address is taken with MOVA) may be modified by indirect accesses.
+ */
+void findEligibleLabels(t_spill_opt *opt)
+{
+   t_list *current_bb_element, *current_nd_element;
+   t_axe_instruction *instr;
+   unsigned int i;
+   int pass;
+
+   /* the first pass finds the largest label identifier */
+   opt->numLabels = 0;
+   for (pass = 0; pass < 2; pass++)
+   {
+      current_bb_element = opt->graph->blocks;
+      for (; current_bb_element != NULL
+            ; current_bb_element = LNEXT(current_bb_element))
+      {
+         t_basic_block *block = (t_basic_block *) LDATA(current_bb_element);
+
+         current_nd_element = block->nodes;
+         for (; current_nd_element != NULL
+               ; current_nd_element = LNEXT(current_nd_element))
+         {
+            instr = ((t_cflow_Node *) LDATA(current_nd_element))->instr;
+            if (instr->address == NULL || instr->address->labelID == NULL)
+               continue;
+            i = instr->address->labelID->labelID;
+            if (pass == 0) {
+               if (i >= opt->numLabels)
+                  opt->numLabels = i + 1;
+            } else if ((instr->opcode != LOAD && instr->opcode != STORE)
+                  || instr->reg_1 == NULL || instr->reg_1->indirect) {
+               opt->eligible[i] = 0;
+            }
+         }
+      }
+
+      if (pass == 0) {
+         opt->eligible = malloc(opt->numLabels + 1);
+         if (opt->eligible == NULL)
+            notifyError(AXE_OUT_OF_MEMORY);
+         for (i = 0; i < opt->numLabels; i++)
+            opt->eligible[i] = 1;
+      }
+   }
+}
+
+/* Compute the sets of the registers live at the boundaries of the blocks */
+void computeRegisterLiveness(t_spill_opt *opt)
+{
+   unsigned int *gen, *kill;
+   t_list *current_element;
+   int changed, i;
+
+   gen = calloc(opt->numBlocks + 1, sizeof(unsigned int));
+   kill = calloc(opt->numBlocks + 1, sizeof(unsigned int));
+   if (gen == NULL || kill == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (i = 0; i < opt->numBlocks; i++)
+   {
+      current_element = opt->blocks[i]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_axe_instruction *instr
+               = ((t_cflow_Node *) LDATA(current_element))->instr;
+         gen[i] |= usedRegisters(instr) & ~kill[i];
+         kill[i] |= definedRegisters(instr);
+      }
+      opt->liveIn[i] = gen[i];
+      opt->liveOut[i] = 0;
+   }
+
+   /* the blocks are visited in postorder, to follow the data flow */
+   do {
+      changed = 0;
+      for (i = opt->numBlocks - 1; i >= 0; i--)
+      {
+         unsigned int out = 0;
+
+         current_element = opt->blocks[i]->succ;
+         for (; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            t_basic_block *succ = (t_basic_block *) LDATA(current_element);
+            if (succ->rpoNumber >= 0)
+               out |= opt->liveIn[succ->rpoNumber];
+         }
+         if (out != opt->liveOut[i]) {
+            opt->liveOut[i] = out;
+            opt->liveIn[i] = gen[i] | (out & ~kill[i]);
+            changed = 1;
+         }
+      }
+   } while (changed);
+
+   free(gen);
+   free(kill);
+}
+
+/* Orders the loop headers from the innermost loops to the outermost */
+int compareLoopDepths(const void *a, const void *b)
+{
+   t_basic_block *blockA = *((t_basic_block **) a);
+   t_basic_block *blockB = *((t_basic_block **) b);
+
+   if (blockA->loopDepth != blockB->loopDepth)
+      return blockB->loopDepth - blockA->loopDepth;
+   return blockA->rpoNumber - blockB->rpoNumber;
+}
+
+/*
+ * Move out of the loop with the given header the loads of a memory location
+ * into a register which is not otherwise modified inside the loop. The loads
+ * are inserted at the end of the blocks which enter the loop, and the ones
+ * inside the loop become redundant. Returns the number of loads inserted.
+ */
+int hoistLoopInvariantLoads(t_spill_opt *opt, t_basic_block *header
+      , int *marks, t_vector *body)
+{
+   t_axe_instruction *loads[NUM_MACHINE_REGS];
+   unsigned int loaded, clobbered, candidates;
+   t_list *current_element;
+   int mark = header->rpoNumber + 1;
+   int numEntries, inserted, reg, i;
+
+   /* the loop contains the blocks which reach the sources of the back edges
+    * without passing through the header */
+   clearVector(body);
+   marks[header->rpoNumber] = mark;
+   addToVector(body, header);
+   for (current_element = header->pred; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+      if (pred->rpoNumber < 0 || marks[pred->rpoNumber] == mark
+            || !dominates(header, pred))
+         continue;
+      marks[pred->rpoNumber] = mark;
+      addToVector(body, pred);
+   }
+   if (VSIZE(body) == 1)
+      return 0;
+   for (i = 1; i < VSIZE(body); i++)
+   {
+      t_basic_block *block = (t_basic_block *) VDATA(body, i);
+      for (current_element = block->pred; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+         if (pred->rpoNumber < 0 || marks[pred->rpoNumber] == mark)
+            continue;
+         marks[pred->rpoNumber] = mark;
+         addToVector(body, pred);
+      }
+   }
+
+   /* find the registers which are written inside the loop only by loads of
+    * the same memory location */
+   loaded = 0;
+   clobbered = 0;
+   for (i = 0; i < VSIZE(body); i++)
+   {
+      t_basic_block *block = (t_basic_block *) VDATA(body, i);
+      for (current_element = block->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_axe_instruction *instr
+               = ((t_cflow_Node *) LDATA(current_element))->instr;
+
+         if (instr->opcode == JSR || instr->opcode == RET)
+            clobbered = ~0U;
+         if (instr->opcode != LOAD || memoryLabel(opt, instr) == NO_LABEL) {
+            clobbered |= definedRegisters(instr);
+            continue;
+         }
+         reg = instr->reg_1->ID;
+         if (!(loaded & RA_REGISTER_MASK(reg))) {
+            loaded |= RA_REGISTER_MASK(reg);
+            loads[reg] = instr;
+         } else if (loads[reg]->address->labelID != instr->address->labelID)
+            clobbered |= RA_REGISTER_MASK(reg);
+      }
+   }
+
+   /* the memory location must not be written from another register */
+   for (i = 0; i < VSIZE(body) && (loaded & ~clobbered); i++)
+   {
+      t_basic_block *block = (t_basic_block *) VDATA(body, i);
+      for (current_element = block->nodes; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_axe_instruction *instr
+               = ((t_cflow_Node *) LDATA(current_element))->instr;
+
+         if (instr->opcode != STORE || memoryLabel(opt, instr) == NO_LABEL)
+            continue;
+         for (reg = 0; reg < NUM_MACHINE_REGS; reg++) {
+            if ((loaded & RA_REGISTER_MASK(reg)) && reg != instr->reg_1->ID
+                  && loads[reg]->address->labelID
+                     == instr->address->labelID)
+               clobbered |= RA_REGISTER_MASK(reg);
+         }
+      }
+   }
+
+   /* the register must not hold another value when the loop is entered,
+    * neither for the loop nor for the other successors of the blocks
+    * which enter it */
+   candidates = loaded & ~clobbered & ~opt->liveIn[header->rpoNumber]
+         & ~RA_REGISTER_MASK(REG_0);
+   numEntries = 0;
+   for (current_element = header->pred; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+      if (pred->rpoNumber < 0 || marks[pred->rpoNumber] == mark)
+         continue;
+      candidates &= ~opt->liveOut[pred->rpoNumber];
+      numEntries++;
+   }
+   if (numEntries == 0 || candidates == 0)
+      return 0;
+
+   inserted = 0;
+   for (reg = 0; reg < NUM_MACHINE_REGS; reg++)
+   {
+      if (!(candidates & RA_REGISTER_MASK(reg)))
+         continue;
+
+      for (current_element = header->pred; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+         if (pred->rpoNumber < 0 || marks[pred->rpoNumber] == mark)
+            continue;
+         insertLoadAtEnd(opt, pred, loads[reg]);
+         opt->liveOut[pred->rpoNumber] |= RA_REGISTER_MASK(reg);
+         inserted++;
+      }
+
+      /* the register is now live in the whole loop */
+      for (i = 0; i < VSIZE(body); i++) {
+         t_basic_block *block = (t_basic_block *) VDATA(body, i);
+         opt->liveIn[block->rpoNumber] |= RA_REGISTER_MASK(reg);
+         opt->liveOut[block->rpoNumber] |= RA_REGISTER_MASK(reg);
+      }
+   }
+   return inserted;
+}
+
+/* Insert a copy of the load `model' at the end of `block', before its
+ * terminator */
+void insertLoadAtEnd(t_spill_opt *opt, t_basic_block *block
+      , t_axe_instruction *model)
+{
+   t_arena *arena = opt->program->arena;
+   t_axe_instruction *instr;
+   t_cflow_Node *last, *node;
+
+   instr = alloc_instruction(arena, LOAD);
+   if (instr == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   instr->reg_1 = alloc_register(arena, model->reg_1->ID
+         , model->reg_1->type, 0);
+   instr->address = alloc_address(arena, LABEL_TYPE, 0
+         , model->address->labelID);
+   if (instr->reg_1 == NULL || instr->address == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   node = allocNode(opt->graph, instr);
+   if (node == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   last = (t_cflow_Node *) LDATA(getLastElement(block->nodes));
+   if (isJumpInstruction(last->instr) || isHaltOrRetInstruction(last->instr))
+   {
+      /* the jumps to the block must execute the load too */
+      instr->labelID = last->instr->labelID;
+      last->instr->labelID = NULL;
+      insertNodeBefore(block, last, node);
+   }
+   else
+      insertNodeAfter(block, last, node);
+}
+
+/*
+ * Compute the values held by the registers at the beginning of `block'
+ * from the ones at the end of its predecessors
+ */
+void meetAvailability(t_spill_opt *opt, t_basic_block *block, int *state)
+{
+   t_list *current_element;
+   int first = 1;
+   int i;
+
+   for (i = 0; i < NUM_MACHINE_REGS; i++)
+      state[i] = NO_LABEL;
+   if (block->rpoNumber == 0)
+      return;
+
+   for (current_element = block->pred; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *pred = (t_basic_block *) LDATA(current_element);
+      int *out;
+
+      if (pred->rpoNumber < 0 || !opt->visited[pred->rpoNumber])
+         continue;
+      out = &opt->available[pred->rpoNumber * NUM_MACHINE_REGS];
+      for (i = 0; i < NUM_MACHINE_REGS; i++) {
+         if (first)
+            state[i] = out[i];
+         else if (state[i] != out[i])
+            state[i] = NO_LABEL;
+      }
+      first = 0;
+   }
+}
+
+/*
+ * Update the values held by the registers after the execution of `instr'.
+ * Returns non-zero if `instr' is a load or a store which does not change
+ * neither the register nor the memory.
+ */
+int transferAvailability(t_spill_opt *opt, t_axe_instruction *instr
+      , int *state)
+{
+   unsigned int defs;
+   int label, reg, i;
+
+   label = memoryLabel(opt, instr);
+   if (label != NO_LABEL)
+   {
+      reg = instr->reg_1->ID;
+      if (reg != REG_0 && state[reg] == label)
+         return 1;
+      if (instr->opcode == STORE) {
+         for (i = 0; i < NUM_MACHINE_REGS; i++) {
+            if (state[i] == label)
+               state[i] = NO_LABEL;
+         }
+      }
+      if (reg != REG_0)
+         state[reg] = label;
+      return 0;
+   }
+
+   if (instr->opcode == JSR || instr->opcode == RET) {
+      for (i = 0; i < NUM_MACHINE_REGS; i++)
+         state[i] = NO_LABEL;
+      return 0;
+   }
+
+   defs = definedRegisters(instr);
+   for (i = 0; defs != 0; i++, defs >>= 1) {
+      if (defs & 1)
+         state[i] = NO_LABEL;
+   }
+   return 0;
+}
+
+/*
+ * Compute, for each block, the memory locations whose value is held by
+ * each register at the end of the block, on every path which reaches it
+ */
+void computeAvailability(t_spill_opt *opt)
+{
+   int state[NUM_MACHINE_REGS];
+   t_list *current_element;
+   int changed, i, j;
+
+   do {
+      changed = 0;
+      for (i = 0; i < opt->numBlocks; i++)
+      {
+         int *out = &opt->available[i * NUM_MACHINE_REGS];
+
+         meetAvailability(opt, opt->blocks[i], state);
+         for (current_element = opt->blocks[i]->nodes; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            transferAvailability(opt
+                  , ((t_cflow_Node *) LDATA(current_element))->instr, state);
+         }
+
+         for (j = 0; j < NUM_MACHINE_REGS; j++) {
+            if (!opt->visited[i] || out[j] != state[j]) {
+               out[j] = state[j];
+               changed = 1;
+            }
+         }
+         opt->visited[i] = 1;
+      }
+   } while (changed);
+}
+
+/* Remove the loads and stores which do not change neither the registers nor
+ * the memory */
+void removeRedundantAccesses(t_spill_opt *opt)
+{
+   int state[NUM_MACHINE_REGS];
+   t_list *current_element, *next_element;
+   int loads = 0, stores = 0;
+   int i;
+
+   for (i = 0; i < opt->numBlocks; i++)
+   {
+      meetAvailability(opt, opt->blocks[i], state);
+      for (current_element = opt->blocks[i]->nodes; current_element != NULL
+            ; current_element = next_element)
+      {
+         t_axe_instruction *instr
+               = ((t_cflow_Node *) LDATA(current_element))->instr;
+
+         next_element = LNEXT(current_element);
+         if (!transferAvailability(opt, instr, state))
+            continue;
+         if (instr->opcode == LOAD)
+            loads++;
+         else
+            stores++;
+         removeNodeFromBlock(opt->blocks[i]
+               , (t_cflow_Node *) LDATA(current_element));
+      }
+   }
+
+   setStatistic("spillopt.removed_loads", loads);
+   setStatistic("spillopt.removed_stores", stores);
+}
+
+void optimizeSpillCode(t_program_infos *program, t_cflow_Graph *graph)
+{
+   t_spill_opt opt;
+   t_list *current_element;
+   t_basic_block **headers;
+   t_vector *body;
+   int *marks;
+   int numHeaders, hoisted, i;
+
+   assert(program != NULL);
+   assert(graph != NULL);
+
+   opt.program = program;
+   opt.graph = graph;
+
+   /* the blocks which are not reachable are left untouched */
+   opt.numBlocks = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      if (block->rpoNumber >= opt.numBlocks)
+         opt.numBlocks = block->rpoNumber + 1;
+   }
+   opt.blocks = calloc(opt.numBlocks + 1, sizeof(t_basic_block *));
+   opt.liveIn = calloc(opt.numBlocks + 1, sizeof(unsigned int));
+   opt.liveOut = calloc(opt.numBlocks + 1, sizeof(unsigned int));
+   opt.available = malloc(sizeof(int) * NUM_MACHINE_REGS
+         * (opt.numBlocks + 1));
+   opt.visited = calloc(opt.numBlocks + 1, sizeof(char));
+   headers = malloc(sizeof(t_basic_block *) * (opt.numBlocks + 1));
+   marks = calloc(opt.numBlocks + 1, sizeof(int));
+   if (opt.blocks == NULL || opt.liveIn == NULL || opt.liveOut == NULL
+         || opt.available == NULL || opt.visited == NULL || headers == NULL
+         || marks == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   numHeaders = 0;
+   for (current_element = graph->blocks; current_element != NULL
+         ; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      if (block->rpoNumber < 0)
+         continue;
+      opt.blocks[block->rpoNumber] = block;
+      if (block->loopDepth > 0)
+         headers[numHeaders++] = block;
+   }
+
+   findEligibleLabels(&opt);
+   computeRegisterLiveness(&opt);
+
+   /* the loads hoisted out of an inner loop can be hoisted again out of
+    * the loops which contain it */
+   qsort(headers, numHeaders, sizeof(t_basic_block *), compareLoopDepths);
+   body = allocVector(0);
+   hoisted = 0;
+   for (i = 0; i < numHeaders; i++)
+      hoisted += hoistLoopInvariantLoads(&opt, headers[i], marks, body);
+   freeVector(body);
+   setStatistic("spillopt.hoisted_loads", hoisted);
+
+   computeAvailability(&opt);
+   removeRedundantAccesses(&opt);
+
+   free(marks);
+   free(headers);
+   free(opt.visited);
+   free(opt.available);
+   free(opt.liveOut);
+   free(opt.liveIn);
+   free(opt.blocks);
+   free(opt.eligible);
+}
@@ -0,0 +1,28 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_spill_opt.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Optimization of the loads and stores inserted for the variables kept in
+ * memory (the spilled variables and the scalar variables), performed after
+ * the register allocation has been materialized. A load is removed when the
+ * register already holds the value of the memory location on every path
+ * which reaches it, and a store when the memory location already holds the
+ * value of the register. Loads of values which are not modified inside a
+ * loop are moved to the blocks which enter the loop.
+ */
+
+#ifndef _AXE_SPILL_OPT_H
+#define _AXE_SPILL_OPT_H
+
+#include "axe_engine.h"
+#include "axe_cflow_graph.h"
+
+/* Optimize the loads and stores of the final code in `graph'. Only the
+ * memory locations which are accessed exclusively by direct loads and
+ * stores are considered. `computeLoopDepths' must have been performed on
+ * `graph', and its blocks must not have changed since. */
+extern void optimizeSpillCode(t_program_infos *program, t_cflow_Graph *graph);
+
+#endif
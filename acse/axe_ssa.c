@@ -0,0 +1,847 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_ssa.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include "axe_ssa.h"
+#include "cflow_constants.h"
+#include "axe_errors.h"
+#include "axe_utils.h"
+#include "symbol_table.h"
+
+extern int cflow_errorcode;
+
+/* the state of the construction of the SSA form */
+typedef struct t_ssa_builder
+{
+   t_ssa_form *ssa;
+   t_basic_block **blocks;    /* the blocks, indexed by `rpoNumber' */
+   int numBlocks;
+   t_list **children;         /* for each block, the blocks it immediately
+                               * dominates */
+   int numVars;               /* number of variables before the renaming;
+                               * the following arrays are indexed by the
+                               * index of the variables */
+   int *numDefinitions;       /* number of instructions defining the var */
+   t_list **defBlocks;        /* the blocks where the variable is defined */
+   int *candidate;            /* non-zero for the temporary registers */
+   int *renamed;              /* non-zero for the variables with phis or
+                               * more than one definition; the others are
+                               * already in SSA form */
+   int *current;              /* the name of the variable while renaming */
+   t_vector *undo;            /* pairs (variable, previous name) */
+}t_ssa_builder;
+
+static void checkCflowError(void);
+static void removeUnreachableBlocks(t_cflow_Graph *graph);
+static void findCandidates(t_ssa_builder *sb);
+static void countDefinitions(t_ssa_builder *sb);
+static t_ssa_phi *allocPhi(t_cflow_Graph *graph, t_basic_block *block
+      , int original);
+static void placePhis(t_ssa_builder *sb);
+static void pushName(t_ssa_builder *sb, int var, int name);
+static void renameNode(t_ssa_builder *sb, t_cflow_Node *node);
+static void fillPhiArguments(t_ssa_builder *sb, t_basic_block *pred
+      , t_basic_block *succ);
+static void enterBlock(t_ssa_builder *sb, t_basic_block *block);
+static void renameVariables(t_ssa_builder *sb);
+static void recordDefinitions(t_ssa_builder *sb);
+static t_cflow_Node *genCopy(t_ssa_form *ssa, int dest, int src);
+static t_basic_block *findFallThrough(t_cflow_Graph *graph
+      , t_basic_block *block);
+static t_basic_block *splitEdge(t_ssa_form *ssa, t_basic_block *pred
+      , t_basic_block *block);
+static void insertCopies(t_ssa_form *ssa, t_basic_block *pred
+      , t_basic_block *block, int *dests, int *srcs, int numCopies);
+
+
+void checkCflowError(void)
+{
+   if (cflow_errorcode != CFLOW_OK)
+      notifyError(AXE_INVALID_CFLOW_GRAPH);
+}
+
+/* Remove the blocks which are not reachable from the starting block. They
+ * are not dominated by any block, and have no place in the SSA form. */
+void removeUnreachableBlocks(t_cflow_Graph *graph)
+{
+   t_list *current_element, *next_element;
+
+   current_element = graph->blocks;
+   for (; current_element != NULL; current_element = next_element)
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+
+      next_element = LNEXT(current_element);
+      if (block->rpoNumber < 0) {
+         removeBlock(graph, block);
+         checkCflowError();
+      }
+   }
+}
+
+/* The temporary registers are the registers without constraints which do
+ * not hold a scalar variable of the program */
+void findCandidates(t_ssa_builder *sb)
+{
+   t_program_infos *program = sb->ssa->program;
+   t_cflow_Graph *graph = sb->ssa->graph;
+   t_list *current_element;
+   int i, location, sy_errorcode;
+
+   for (i = 0; i < sb->numVars; i++)
+   {
+      t_cflow_var *var = graph->variables[i];
+      sb->candidate[i] = var->ID > REG_0 && var->mcRegWhitelist == NULL;
+   }
+
+   current_element = program->variables;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_axe_variable *variable = (t_axe_variable *) LDATA(current_element);
+      t_cflow_var *var;
+
+      location = getLocation(program->sy_table, variable->ID
+            , &sy_errorcode);
+      if (location == SY_LOCATION_UNSPECIFIED)
+         continue;
+      var = getCflowVariable(graph, location);
+      if (var != NULL)
+         sb->candidate[var->index] = 0;
+   }
+}
+
+void countDefinitions(t_ssa_builder *sb)
+{
+   t_list *current_node;
+   int i;
+
+   for (i = 0; i < sb->numBlocks; i++)
+   {
+      current_node = sb->blocks[i]->nodes;
+      for (; current_node != NULL; current_node = LNEXT(current_node))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_node);
+         int var;
+
+         if (node->defs[0] == NULL)
+            continue;
+         var = node->defs[0]->index;
+         sb->numDefinitions[var]++;
+         if (sb->defBlocks[var] == NULL
+               || LDATA(sb->defBlocks[var]) != sb->blocks[i])
+            sb->defBlocks[var] = addFirst(sb->defBlocks[var], sb->blocks[i]);
+      }
+   }
+}
+
+t_ssa_phi *allocPhi(t_cflow_Graph *graph, t_basic_block *block
+      , int original)
+{
+   t_ssa_phi *phi;
+   t_list *current_pred;
+   int i;
+
+   phi = malloc(sizeof(t_ssa_phi));
+   if (phi == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   phi->block = block;
+   phi->dest = original;
+   phi->original = original;
+   phi->numArgs = getLength(block->pred);
+   if (block == graph->startingBlock)
+      phi->numArgs++;
+   phi->preds = malloc(sizeof(t_basic_block *) * (phi->numArgs + 1));
+   phi->args = malloc(sizeof(int) * (phi->numArgs + 1));
+   if (phi->preds == NULL || phi->args == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   i = 0;
+   current_pred = block->pred;
+   for (; current_pred != NULL; current_pred = LNEXT(current_pred)) {
+      phi->preds[i] = (t_basic_block *) LDATA(current_pred);
+      phi->args[i] = REG_INVALID;
+      i++;
+   }
+   if (block == graph->startingBlock) {
+      phi->preds[i] = NULL;
+      phi->args[i] = REG_INVALID;
+   }
+   return phi;
+}
+
+/*
+ * Place the phi functions of the temporaries in the iterated dominance
+ * frontier of their definitions. A phi is placed only
+ * where the temporary is live (pruned SSA form). Since the phis become
+ * copies, which modify the flags, a temporary which would need a phi where
+ * the flags are live is left out of SSA form.
+ */
+void placePhis(t_ssa_builder *sb)
+{
+   t_ssa_form *ssa = sb->ssa;
+   t_cflow_var *psw;
+   t_basic_block **worklist;
+   int *placed, *queued;
+   t_list *current_element, *phiBlocks;
+   int var, numPending, conflict;
+
+   psw = getCflowVariable(ssa->graph, VAR_PSW);
+   worklist = malloc(sizeof(t_basic_block *) * (sb->numBlocks + 1));
+   placed = calloc(sb->numBlocks + 1, sizeof(int));
+   queued = calloc(sb->numBlocks + 1, sizeof(int));
+   if (worklist == NULL || placed == NULL || queued == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (var = 0; var < sb->numVars; var++)
+   {
+      if (!sb->candidate[var] || sb->numDefinitions[var] == 0)
+         continue;
+
+      numPending = 0;
+      current_element = sb->defBlocks[var];
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *block = (t_basic_block *) LDATA(current_element);
+         queued[block->rpoNumber] = var + 1;
+         worklist[numPending++] = block;
+      }
+
+      phiBlocks = NULL;
+      conflict = 0;
+      while (numPending > 0)
+      {
+         t_basic_block *block = worklist[--numPending];
+
+         current_element = block->domFrontier;
+         for (; current_element != NULL
+               ; current_element = LNEXT(current_element))
+         {
+            t_basic_block *join = (t_basic_block *) LDATA(current_element);
+
+            if (placed[join->rpoNumber] == var + 1
+                  || !isInBitset(join->liveIn, var))
+               continue;
+            placed[join->rpoNumber] = var + 1;
+            if (psw != NULL && isInBitset(join->liveIn, psw->index))
+               conflict = 1;
+            phiBlocks = addFirst(phiBlocks, join);
+            if (queued[join->rpoNumber] != var + 1) {
+               queued[join->rpoNumber] = var + 1;
+               worklist[numPending++] = join;
+            }
+         }
+      }
+
+      if (conflict) {
+         sb->candidate[var] = 0;
+         freeList(phiBlocks);
+         continue;
+      }
+
+      /* a single definition which reaches all the uses is already in SSA
+       * form, and keeps its name */
+      if (phiBlocks == NULL && sb->numDefinitions[var] == 1)
+         continue;
+
+      sb->renamed[var] = 1;
+      ssa->numRenamed++;
+      current_element = phiBlocks;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_basic_block *join = (t_basic_block *) LDATA(current_element);
+         t_ssa_phi *phi = allocPhi(ssa->graph, join
+               , ssa->graph->variables[var]->ID);
+         t_list *phis = lookupHashMap(ssa->phis, join);
+
+         putInHashMap(ssa->phis, join, addLast(phis, phi));
+         ssa->numPhis++;
+      }
+      freeList(phiBlocks);
+   }
+
+   free(queued);
+   free(placed);
+   free(worklist);
+}
+
+void pushName(t_ssa_builder *sb, int var, int name)
+{
+   addToVector(sb->undo, INTDATA(var));
+   addToVector(sb->undo, INTDATA(sb->current[var]));
+   sb->current[var] = name;
+}
+
+/* Replace the registers used by `node' with their current name, and give a
+ * new name to the register it defines */
+void renameNode(t_ssa_builder *sb, t_cflow_Node *node)
+{
+   t_axe_instruction *instr = node->instr;
+   t_axe_register *regs[3];
+   t_cflow_var *var;
+   int defVar, i, j, changed;
+
+   regs[0] = instr->reg_2;
+   regs[1] = instr->reg_3;
+   regs[2] = node->defs[0] == NULL ? instr->reg_1 : NULL;
+   defVar = node->defs[0] != NULL ? node->defs[0]->index : -1;
+
+   changed = 0;
+   for (i = 0; i < 3; i++)
+   {
+      if (regs[i] == NULL)
+         continue;
+      var = getCflowVariable(sb->ssa->graph, regs[i]->ID);
+      if (var == NULL || var->index >= sb->numVars || !sb->renamed[var->index]
+            || sb->current[var->index] == REG_INVALID)
+         continue;
+
+      /* the register must be actually used by the node */
+      for (j = 0; j < CFLOW_MAX_USES; j++) {
+         if (node->uses[j] == var)
+            break;
+      }
+      if (j == CFLOW_MAX_USES)
+         continue;
+
+      regs[i]->ID = sb->current[var->index];
+      changed = 1;
+   }
+
+   if (defVar >= 0 && defVar < sb->numVars && sb->renamed[defVar]) {
+      instr->reg_1->ID = getNewRegister(sb->ssa->program);
+      pushName(sb, defVar, instr->reg_1->ID);
+      changed = 1;
+   }
+
+   if (changed) {
+      updateNodeDefUses(sb->ssa->graph, node);
+      checkCflowError();
+   }
+}
+
+/* Set the arguments of the phis of `succ' for the edge coming from `pred'
+ * to the current names of the variables */
+void fillPhiArguments(t_ssa_builder *sb, t_basic_block *pred
+      , t_basic_block *succ)
+{
+   t_list *current_phi;
+   int i;
+
+   current_phi = getPhis(sb->ssa, succ);
+   for (; current_phi != NULL; current_phi = LNEXT(current_phi))
+   {
+      t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_phi);
+      t_cflow_var *var = getCflowVariable(sb->ssa->graph, phi->original);
+
+      for (i = 0; i < phi->numArgs; i++) {
+         if (phi->preds[i] == pred)
+            phi->args[i] = sb->current[var->index];
+      }
+   }
+}
+
+/* Rename the phis and the instructions of `block', and fill the arguments
+ * of the phis of its successors */
+void enterBlock(t_ssa_builder *sb, t_basic_block *block)
+{
+   t_ssa_form *ssa = sb->ssa;
+   t_list *current_element, *current_phi;
+
+   current_phi = getPhis(ssa, block);
+   for (; current_phi != NULL; current_phi = LNEXT(current_phi))
+   {
+      t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_phi);
+      t_cflow_var *var = getCflowVariable(ssa->graph, phi->original);
+
+      phi->dest = getNewRegister(ssa->program);
+      pushName(sb, var->index, phi->dest);
+   }
+
+   current_element = block->nodes;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+      renameNode(sb, (t_cflow_Node *) LDATA(current_element));
+
+   current_element = block->succ;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+      fillPhiArguments(sb, block, (t_basic_block *) LDATA(current_element));
+}
+
+/* Visit the dominator tree in preorder, keeping the current name of each
+ * variable. The names given in a block are forgotten when the visit of
+ * the subtree of the block is complete. */
+void renameVariables(t_ssa_builder *sb)
+{
+   t_basic_block **stack;
+   t_list **nextChild;
+   int *undoMark;
+   int top, i;
+
+   stack = malloc(sizeof(t_basic_block *) * (sb->numBlocks + 1));
+   nextChild = malloc(sizeof(t_list *) * (sb->numBlocks + 1));
+   undoMark = malloc(sizeof(int) * (sb->numBlocks + 1));
+   if (stack == NULL || nextChild == NULL || undoMark == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (i = 0; i < sb->numVars; i++)
+      sb->current[i] = REG_INVALID;
+
+   top = 0;
+   if (sb->numBlocks > 0) {
+      fillPhiArguments(sb, NULL, sb->blocks[0]);
+      undoMark[0] = VSIZE(sb->undo);
+      enterBlock(sb, sb->blocks[0]);
+      stack[0] = sb->blocks[0];
+      nextChild[0] = sb->children[0];
+      top = 1;
+   }
+   while (top > 0)
+   {
+      if (nextChild[top - 1] != NULL) {
+         t_basic_block *child = (t_basic_block *) LDATA(nextChild[top - 1]);
+
+         nextChild[top - 1] = LNEXT(nextChild[top - 1]);
+         undoMark[top] = VSIZE(sb->undo);
+         enterBlock(sb, child);
+         stack[top] = child;
+         nextChild[top] = sb->children[child->rpoNumber];
+         top++;
+         continue;
+      }
+
+      /* leave the block */
+      top--;
+      while (VSIZE(sb->undo) > undoMark[top]) {
+         int name = (int)(intptr_t)removeLastFromVector(sb->undo);
+         int var = (int)(intptr_t)removeLastFromVector(sb->undo);
+         sb->current[var] = name;
+      }
+   }
+
+   free(undoMark);
+   free(nextChild);
+   free(stack);
+}
+
+/* Record the definition of each register in SSA form */
+void recordDefinitions(t_ssa_builder *sb)
+{
+   t_ssa_form *ssa = sb->ssa;
+   t_list *current_element;
+   int i;
+
+   ssa->numDefs = ssa->program->current_register + 1;
+   ssa->defs = calloc(ssa->numDefs, sizeof(t_ssa_def));
+   if (ssa->defs == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   for (i = 0; i < sb->numBlocks; i++)
+   {
+      current_element = getPhis(ssa, sb->blocks[i]);
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_element);
+         ssa->defs[phi->dest].block = sb->blocks[i];
+         ssa->defs[phi->dest].phi = phi;
+      }
+
+      current_element = sb->blocks[i]->nodes;
+      for (; current_element != NULL
+            ; current_element = LNEXT(current_element))
+      {
+         t_cflow_Node *node = (t_cflow_Node *) LDATA(current_element);
+         int var;
+
+         if (node->defs[0] == NULL)
+            continue;
+         /* the variables created by the renaming follow the others */
+         var = node->defs[0]->index;
+         if (var < sb->numVars && !(sb->candidate[var] && !sb->renamed[var]))
+            continue;
+         ssa->defs[node->defs[0]->ID].block = sb->blocks[i];
+         ssa->defs[node->defs[0]->ID].node = node;
+      }
+   }
+}
+
+t_ssa_form *buildSSAForm(t_program_infos *program, t_cflow_Graph *graph)
+{
+   t_ssa_builder sb;
+   t_ssa_form *ssa;
+   t_list *current_element;
+   int i;
+
+   assert(program != NULL);
+   assert(graph != NULL);
+
+   ssa = malloc(sizeof(t_ssa_form));
+   if (ssa == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   ssa->program = program;
+   ssa->graph = graph;
+   ssa->phis = allocHashMap(NULL, NULL);
+   ssa->defs = NULL;
+   ssa->numDefs = 0;
+   ssa->numPhis = 0;
+   ssa->numRenamed = 0;
+
+   computeDominators(graph);
+   checkCflowError();
+   removeUnreachableBlocks(graph);
+   computeDominanceFrontiers(graph);
+   performLivenessAnalysis(graph);
+   checkCflowError();
+
+   sb.ssa = ssa;
+   sb.numBlocks = getLength(graph->blocks);
+   sb.numVars = graph->numVariables;
+   sb.blocks = malloc(sizeof(t_basic_block *) * (sb.numBlocks + 1));
+   sb.children = calloc(sb.numBlocks + 1, sizeof(t_list *));
+   sb.numDefinitions = calloc(sb.numVars + 1, sizeof(int));
+   sb.defBlocks = calloc(sb.numVars + 1, sizeof(t_list *));
+   sb.candidate = calloc(sb.numVars + 1, sizeof(int));
+   sb.renamed = calloc(sb.numVars + 1, sizeof(int));
+   sb.current = calloc(sb.numVars + 1, sizeof(int));
+   sb.undo = allocVector(0);
+   if (sb.blocks == NULL || sb.children == NULL || sb.numDefinitions == NULL
+         || sb.defBlocks == NULL || sb.candidate == NULL
+         || sb.renamed == NULL || sb.current == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   current_element = graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+
+      sb.blocks[block->rpoNumber] = block;
+      if (block->idom != NULL)
+         sb.children[block->idom->rpoNumber] = addFirst(
+               sb.children[block->idom->rpoNumber], block);
+   }
+
+   findCandidates(&sb);
+   countDefinitions(&sb);
+   placePhis(&sb);
+   renameVariables(&sb);
+   recordDefinitions(&sb);
+
+   performLivenessAnalysis(graph);
+   checkCflowError();
+
+   for (i = 0; i < sb.numBlocks; i++)
+      freeList(sb.children[i]);
+   for (i = 0; i < sb.numVars; i++)
+      freeList(sb.defBlocks[i]);
+   freeVector(sb.undo);
+   free(sb.current);
+   free(sb.renamed);
+   free(sb.candidate);
+   free(sb.defBlocks);
+   free(sb.numDefinitions);
+   free(sb.children);
+   free(sb.blocks);
+   return ssa;
+}
+
+t_list *getPhis(t_ssa_form *ssa, t_basic_block *block)
+{
+   return (t_list *) lookupHashMap(ssa->phis, block);
+}
+
+t_ssa_def *getSSADefinition(t_ssa_form *ssa, int ID)
+{
+   if (ID < 0 || ID >= ssa->numDefs || ssa->defs[ID].block == NULL)
+      return NULL;
+   return &ssa->defs[ID];
+}
+
+/* Returns a new node which copies `src' into `dest' */
+t_cflow_Node *genCopy(t_ssa_form *ssa, int dest, int src)
+{
+   t_arena *arena = ssa->program->arena;
+   t_axe_instruction *instr;
+   t_cflow_Node *node;
+
+   instr = alloc_instruction(arena, ADDI);
+   if (instr == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   instr->reg_1 = alloc_register(arena, dest, INFERRED_TYPE, 0);
+   instr->reg_2 = alloc_register(arena, src, INFERRED_TYPE, 0);
+   if (instr->reg_1 == NULL || instr->reg_2 == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   instr->immediate = 0;
+
+   node = allocNode(ssa->graph, instr);
+   checkCflowError();
+   updateNodeDefUses(ssa->graph, node);
+   checkCflowError();
+   return node;
+}
+
+/* Returns the block which follows `block' in the code, or NULL */
+t_basic_block *findFallThrough(t_cflow_Graph *graph, t_basic_block *block)
+{
+   t_list *element = findElement(graph->blocks, block);
+
+   if (element == NULL || LNEXT(element) == NULL)
+      return NULL;
+   return (t_basic_block *) LDATA(LNEXT(element));
+}
+
+/* Insert a new empty block on the edge from `pred' to `block', and return
+ * it. The new block falls through to `block', or ends with a jump to it. */
+t_basic_block *splitEdge(t_ssa_form *ssa, t_basic_block *pred
+      , t_basic_block *block)
+{
+   t_cflow_Graph *graph = ssa->graph;
+   t_arena *arena = ssa->program->arena;
+   t_basic_block *result, *after;
+   t_axe_instruction *branch, *jump, *first;
+   t_list *current_element;
+
+   result = allocBasicBlock(graph);
+   checkCflowError();
+
+   if (findFallThrough(graph, pred) == block) {
+      insertBlockAfter(graph, pred, result);
+   } else {
+      /* the new block is the target of the branch of `pred'. It must be
+       * placed after a block which does not fall through. */
+      branch = ((t_cflow_Node *) LDATA(getLastElement(pred->nodes)))->instr;
+      first = ((t_cflow_Node *) LDATA(block->nodes))->instr;
+      assert(isJumpInstruction(branch) && first->labelID != NULL);
+
+      jump = alloc_instruction(arena, BT);
+      if (jump == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      jump->address = alloc_address(arena, LABEL_TYPE, 0, first->labelID);
+      jump->labelID = newLabel(ssa->program);
+      branch->address = alloc_address(arena, LABEL_TYPE, 0, jump->labelID);
+      if (jump->address == NULL || branch->address == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      insertNode(result, allocNode(graph, jump));
+
+      after = NULL;
+      current_element = getLastElement(graph->blocks);
+      for (; current_element != NULL && after == NULL
+            ; current_element = LPREV(current_element))
+      {
+         t_basic_block *candidate = (t_basic_block *) LDATA(current_element);
+         t_axe_instruction *last = ((t_cflow_Node *)
+               LDATA(getLastElement(candidate->nodes)))->instr;
+         if (isUnconditionalJump(last) || isHaltOrRetInstruction(last))
+            after = candidate;
+      }
+      assert(after != NULL);
+      insertBlockAfter(graph, after, result);
+   }
+   checkCflowError();
+
+   removeEdge(pred, block);
+   setSucc(pred, result);
+   setSucc(result, block);
+   checkCflowError();
+   return result;
+}
+
+/*
+ * Insert the copies `dests[i] = srcs[i]' on the edge from `pred' to
+ * `block', or on the entry of the program if `pred' is NULL. The copies are parallel: each source is read before any
+ * destination is written. They are sequentialized by emitting first the
+ * copies whose destination is not read by another pending copy; a cycle
+ * of copies is broken by saving one of the destinations in a new
+ * temporary register.
+ */
+void insertCopies(t_ssa_form *ssa, t_basic_block *pred
+      , t_basic_block *block, int *dests, int *srcs, int numCopies)
+{
+   t_basic_block *target;
+   t_cflow_Node *last, *before;
+   int i, j, pending, ready, temp;
+
+   if (pred == NULL) {
+      /* the copies on the entry of the program go in a new starting block */
+      target = allocBasicBlock(ssa->graph);
+      checkCflowError();
+      insertBlockAfter(ssa->graph, NULL, target);
+      setSucc(target, block);
+      checkCflowError();
+      before = NULL;
+   } else if (getLength(pred->succ) > 1) {
+      target = splitEdge(ssa, pred, block);
+      before = target->nodes != NULL
+            ? (t_cflow_Node *) LDATA(target->nodes) : NULL;
+   } else {
+      target = pred;
+      last = (t_cflow_Node *) LDATA(getLastElement(pred->nodes));
+      /* a conditional branch to the block which follows anyway */
+      if (isJumpInstruction(last->instr)
+            && !isUnconditionalJump(last->instr)) {
+         removeNodeFromBlock(pred, last);
+         checkCflowError();
+         last = (t_cflow_Node *) LDATA(getLastElement(pred->nodes));
+      }
+      before = isJumpInstruction(last->instr) ? last : NULL;
+   }
+
+   pending = numCopies;
+   while (pending > 0)
+   {
+      ready = -1;
+      for (i = 0; i < numCopies && ready < 0; i++)
+      {
+         if (dests[i] == REG_INVALID)
+            continue;
+         for (j = 0; j < numCopies; j++) {
+            if (j != i && dests[j] != REG_INVALID && srcs[j] == dests[i])
+               break;
+         }
+         if (j == numCopies)
+            ready = i;
+      }
+
+      if (ready < 0) {
+         /* all the pending copies are part of cycles */
+         for (ready = 0; dests[ready] == REG_INVALID; ready++);
+         temp = getNewRegister(ssa->program);
+         if (before != NULL)
+            insertNodeBefore(target, before, genCopy(ssa, temp, dests[ready]));
+         else
+            insertNode(target, genCopy(ssa, temp, dests[ready]));
+         for (j = 0; j < numCopies; j++) {
+            if (dests[j] != REG_INVALID && srcs[j] == dests[ready])
+               srcs[j] = temp;
+         }
+         continue;
+      }
+
+      if (before != NULL)
+         insertNodeBefore(target, before
+               , genCopy(ssa, dests[ready], srcs[ready]));
+      else
+         insertNode(target, genCopy(ssa, dests[ready], srcs[ready]));
+      dests[ready] = REG_INVALID;
+      pending--;
+   }
+   checkCflowError();
+
+   /* the label of the block goes on its first instruction */
+   if (before != NULL && before->instr->labelID != NULL)
+   {
+      t_cflow_Node *first = (t_cflow_Node *) LDATA(target->nodes);
+      if (first != before) {
+         first->instr->labelID = before->instr->labelID;
+         before->instr->labelID = NULL;
+      }
+   }
+}
+
+void destroySSAForm(t_ssa_form *ssa)
+{
+   t_list *current_element, *current_phi;
+   t_basic_block **preds;
+   int *dests, *srcs;
+   int numPreds, numCopies, maxCopies, i, k;
+
+   assert(ssa != NULL);
+
+   maxCopies = 0;
+   current_element = ssa->graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      t_list *phis = getPhis(ssa, block);
+
+      if (phis == NULL)
+         continue;
+
+      if (getLength(phis) > maxCopies)
+         maxCopies = getLength(phis);
+   }
+   dests = malloc(sizeof(int) * (maxCopies + 1));
+   srcs = malloc(sizeof(int) * (maxCopies + 1));
+   if (dests == NULL || srcs == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+
+   /* the blocks inserted while splitting the edges have no phis */
+   current_element = ssa->graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_basic_block *block = (t_basic_block *) LDATA(current_element);
+      t_list *phis = getPhis(ssa, block);
+      t_list *current_pred;
+
+      if (phis == NULL)
+         continue;
+
+      /* the edges of the block change while the copies are inserted. The
+       * entry of the program (NULL) is a predecessor of the starting
+       * block. */
+      numPreds = getLength(block->pred) + 1;
+      preds = malloc(sizeof(t_basic_block *) * (numPreds + 1));
+      if (preds == NULL)
+         notifyError(AXE_OUT_OF_MEMORY);
+      i = 0;
+      current_pred = block->pred;
+      for (; current_pred != NULL; current_pred = LNEXT(current_pred))
+         preds[i++] = (t_basic_block *) LDATA(current_pred);
+      preds[i] = NULL;
+
+      for (i = 0; i < numPreds; i++)
+      {
+         numCopies = 0;
+         current_phi = phis;
+         for (; current_phi != NULL; current_phi = LNEXT(current_phi))
+         {
+            t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_phi);
+
+            for (k = 0; k < phi->numArgs; k++) {
+               if (phi->preds[k] == preds[i])
+                  break;
+            }
+            if (k == phi->numArgs || phi->args[k] == REG_INVALID
+                  || phi->args[k] == phi->dest)
+               continue;
+            dests[numCopies] = phi->dest;
+            srcs[numCopies] = phi->args[k];
+            numCopies++;
+         }
+         if (numCopies > 0)
+            insertCopies(ssa, preds[i], block, dests, srcs, numCopies);
+      }
+      free(preds);
+   }
+
+   /* free the phis */
+   current_element = ssa->graph->blocks;
+   for (; current_element != NULL; current_element = LNEXT(current_element))
+   {
+      t_list *phis = getPhis(ssa, (t_basic_block *) LDATA(current_element));
+
+      for (current_phi = phis; current_phi != NULL
+            ; current_phi = LNEXT(current_phi))
+      {
+         t_ssa_phi *phi = (t_ssa_phi *) LDATA(current_phi);
+         free(phi->preds);
+         free(phi->args);
+         free(phi);
+      }
+      freeList(phis);
+   }
+
+   performLivenessAnalysis(ssa->graph);
+   checkCflowError();
+
+   free(srcs);
+   free(dests);
+   freeHashMap(ssa->phis);
+   free(ssa->defs);
+   free(ssa);
+}
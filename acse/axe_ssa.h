@@ -0,0 +1,79 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_ssa.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Static single assignment form of the temporary registers. While the
+ * control flow graph is in SSA form, each temporary register is defined by
+ * exactly one instruction or phi function, which dominates all its uses.
+ * The registers bound to the scalar variables of the program are not
+ * renamed, since the values of the variables are loaded from and stored to
+ * memory by name.
+ *
+ * The phi functions are not instructions: they are kept aside, for each
+ * basic block, and become copies in the predecessors of the block when the
+ * code is translated out of SSA form.
+ */
+
+#ifndef _AXE_SSA_H
+#define _AXE_SSA_H
+
+#include "axe_engine.h"
+#include "axe_cflow_graph.h"
+
+/* a phi function at the beginning of a basic block */
+typedef struct t_ssa_phi
+{
+   t_basic_block *block;
+   int dest;               /* the register defined by the phi */
+   int original;           /* the register renamed to `dest' */
+   int numArgs;
+   t_basic_block **preds;  /* the predecessors of `block'; NULL stands for
+                            * the entry of the program, which precedes the
+                            * starting block */
+   int *args;              /* for each predecessor, the register selected
+                            * when coming from it; REG_INVALID if the value
+                            * is not defined along that edge */
+}t_ssa_phi;
+
+/* the definition of a register in SSA form */
+typedef struct t_ssa_def
+{
+   t_basic_block *block;   /* the block of the definition; NULL if the
+                            * register is not in SSA form */
+   t_cflow_Node *node;     /* the defining node, or NULL for a phi */
+   t_ssa_phi *phi;         /* the defining phi, or NULL for a node */
+}t_ssa_def;
+
+typedef struct t_ssa_form
+{
+   t_program_infos *program;
+   t_cflow_Graph *graph;
+   t_hashmap *phis;        /* for each block, the list of its phis */
+   t_ssa_def *defs;        /* the definitions, indexed by register ID */
+   int numDefs;            /* number of elements of `defs' */
+   int numPhis;
+   int numRenamed;         /* number of registers which have been renamed
+                            * because they were defined more than once */
+}t_ssa_form;
+
+/* Translates the temporary registers of `graph' in SSA form. The dominance
+ * informations and the liveness are updated; the blocks which cannot be
+ * reached are removed. A temporary register is left out of SSA form when
+ * it would need a phi in a block where the flags are live. */
+extern t_ssa_form *buildSSAForm(t_program_infos *program, t_cflow_Graph *graph);
+
+/* Returns the phi functions of `block' (a list of t_ssa_phi) */
+extern t_list *getPhis(t_ssa_form *ssa, t_basic_block *block);
+
+/* Returns the definition of the register `ID', or NULL if the register is
+ * not in SSA form */
+extern t_ssa_def *getSSADefinition(t_ssa_form *ssa, int ID);
+
+/* Translates the code out of SSA form, and frees `ssa'. The phi functions
+ * are replaced by copies at the end of the predecessors of their block;
+ * the critical edges are split when needed. The liveness is updated. */
+extern void destroySSAForm(t_ssa_form *ssa);
+
+#endif
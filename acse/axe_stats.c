@@ -0,0 +1,244 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_stats.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <string.h>
+#include <time.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+#include "axe_stats.h"
+#include "axe_arena.h"
+
+/* maximum number of phases and counters which are recorded. The ones in
+ * excess are ignored. */
+#define STATS_MAX_PHASES      64
+#define STATS_MAX_COUNTERS    128
+
+typedef struct t_phase_stats
+{
+   const char *name;
+   double startTime;       /* microseconds since the first phase */
+   double endTime;
+   long peakRSS;           /* peak resident set size (KB) at the end */
+   long allocations;       /* arena allocations performed in the phase */
+}t_phase_stats;
+
+typedef struct t_counter_stats
+{
+   const char *name;
+   long value;
+}t_counter_stats;
+
+static t_phase_stats phases[STATS_MAX_PHASES];
+static int numPhases = 0;
+static int phaseRunning = 0;
+static long phaseStartAllocations;
+
+static t_counter_stats counters[STATS_MAX_COUNTERS];
+static int numCounters = 0;
+
+static int timeBaseValid = 0;
+static struct timespec timeBase;
+
+static double getElapsedTime(void);
+static long getPeakRSS(void);
+static t_counter_stats *findCounter(const char *name);
+static void writeJSONString(FILE *fout, const char *str);
+
+
+/* microseconds elapsed since the first call */
+double getElapsedTime(void)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   if (!timeBaseValid) {
+      timeBase = now;
+      timeBaseValid = 1;
+   }
+   return (double)(now.tv_sec - timeBase.tv_sec) * 1e6
+         + (double)(now.tv_nsec - timeBase.tv_nsec) / 1e3;
+}
+
+/* peak resident set size of the process in KB, 0 if unknown */
+long getPeakRSS(void)
+{
+#ifndef _WIN32
+   struct rusage usage;
+
+   if (getrusage(RUSAGE_SELF, &usage) != 0)
+      return 0;
+#ifdef __APPLE__
+   /* macOS reports the size in bytes */
+   return usage.ru_maxrss / 1024;
+#else
+   return usage.ru_maxrss;
+#endif
+#else
+   return 0;
+#endif
+}
+
+void beginPhase(const char *name)
+{
+   t_phase_stats *phase;
+
+   if (phaseRunning)
+      endPhase();
+   if (numPhases >= STATS_MAX_PHASES)
+      return;
+
+   phase = &phases[numPhases];
+   phase->name = name;
+   phase->startTime = getElapsedTime();
+   phase->endTime = phase->startTime;
+   phase->peakRSS = 0;
+   phase->allocations = 0;
+   phaseStartAllocations = getTotalArenaAllocations();
+   phaseRunning = 1;
+}
+
+void endPhase(void)
+{
+   t_phase_stats *phase;
+
+   if (!phaseRunning)
+      return;
+
+   phase = &phases[numPhases];
+   phase->endTime = getElapsedTime();
+   phase->peakRSS = getPeakRSS();
+   phase->allocations = getTotalArenaAllocations() - phaseStartAllocations;
+   numPhases++;
+   phaseRunning = 0;
+}
+
+t_counter_stats *findCounter(const char *name)
+{
+   int i;
+
+   for (i = 0; i < numCounters; i++) {
+      if (strcmp(counters[i].name, name) == 0)
+         return &counters[i];
+   }
+   if (numCounters >= STATS_MAX_COUNTERS)
+      return NULL;
+
+   counters[numCounters].name = name;
+   counters[numCounters].value = 0;
+   return &counters[numCounters++];
+}
+
+void setStatistic(const char *name, long value)
+{
+   t_counter_stats *counter = findCounter(name);
+
+   if (counter != NULL)
+      counter->value = value;
+}
+
+void addToStatistic(const char *name, long value)
+{
+   t_counter_stats *counter = findCounter(name);
+
+   if (counter != NULL)
+      counter->value += value;
+}
+
+void writeJSONString(FILE *fout, const char *str)
+{
+   fputc('"', fout);
+   for (; *str; str++) {
+      if (*str == '"' || *str == '\\')
+         fprintf(fout, "\\%c", *str);
+      else if ((unsigned char)*str < 0x20)
+         fprintf(fout, "\\u%04x", (unsigned char)*str);
+      else
+         fputc(*str, fout);
+   }
+   fputc('"', fout);
+}
+
+void writeStatsReport(FILE *fout, const char *input, const char *target)
+{
+   double totalTime = 0;
+   long totalAllocations = 0;
+   int i;
+
+   if (fout == NULL)
+      return;
+   endPhase();
+
+   fprintf(fout, "{\n  \"input\": ");
+   writeJSONString(fout, input);
+   fprintf(fout, ",\n  \"target\": ");
+   writeJSONString(fout, target);
+
+   fprintf(fout, ",\n  \"phases\": [");
+   for (i = 0; i < numPhases; i++) {
+      double time = phases[i].endTime - phases[i].startTime;
+
+      fprintf(fout, "%s\n    {\"name\": ", i > 0 ? "," : "");
+      writeJSONString(fout, phases[i].name);
+      fprintf(fout, ", \"time_ms\": %.3f, \"peak_rss_kb\": %ld"
+            ", \"allocations\": %ld}", time / 1e3, phases[i].peakRSS
+            , phases[i].allocations);
+      totalTime += time;
+      totalAllocations += phases[i].allocations;
+   }
+   fprintf(fout, "\n  ],\n");
+
+   fprintf(fout, "  \"total_time_ms\": %.3f,\n", totalTime / 1e3);
+   fprintf(fout, "  \"peak_rss_kb\": %ld,\n", getPeakRSS());
+   fprintf(fout, "  \"allocations\": %ld,\n", totalAllocations);
+
+   fprintf(fout, "  \"counters\": {");
+   for (i = 0; i < numCounters; i++) {
+      fprintf(fout, "%s\n    ", i > 0 ? "," : "");
+      writeJSONString(fout, counters[i].name);
+      fprintf(fout, ": %ld", counters[i].value);
+   }
+   fprintf(fout, "\n  }\n}\n");
+   fflush(fout);
+}
+
+void writeStatsTrace(FILE *fout)
+{
+   int i;
+
+   if (fout == NULL)
+      return;
+   endPhase();
+
+   fprintf(fout, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+
+   /* a complete event for each phase, followed by the memory usage at the
+    * end of the phase as a counter event */
+   for (i = 0; i < numPhases; i++) {
+      fprintf(fout, "  {\"name\": ");
+      writeJSONString(fout, phases[i].name);
+      fprintf(fout, ", \"cat\": \"acse\", \"ph\": \"X\", \"pid\": 1"
+            ", \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f"
+            ", \"args\": {\"allocations\": %ld}},\n"
+            , phases[i].startTime, phases[i].endTime - phases[i].startTime
+            , phases[i].allocations);
+      fprintf(fout, "  {\"name\": \"memory\", \"ph\": \"C\", \"pid\": 1"
+            ", \"ts\": %.3f, \"args\": {\"peak_rss_kb\": %ld}},\n"
+            , phases[i].endTime, phases[i].peakRSS);
+   }
+
+   /* the counters are attached to the process as metadata */
+   fprintf(fout, "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1"
+         ", \"args\": {\"name\": \"acse\"");
+   for (i = 0; i < numCounters; i++) {
+      fprintf(fout, ", ");
+      writeJSONString(fout, counters[i].name);
+      fprintf(fout, ": %ld", counters[i].value);
+   }
+   fprintf(fout, "}}\n]}\n");
+   fflush(fout);
+}
@@ -0,0 +1,43 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * axe_stats.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Compile-time instrumentation. The compiler is split into phases; for each
+ * phase the wall-clock time, the peak resident set size and the number of
+ * allocations performed are recorded. Passes can also record named counters
+ * (IR sizes, iterations...). The results can be written as a JSON report or
+ * as a trace in the Chrome trace event format (viewable in chrome://tracing
+ * or https://ui.perfetto.dev).
+ */
+
+#ifndef _AXE_STATS_H
+#define _AXE_STATS_H
+
+#include <stdio.h>
+
+/* start measuring the phase called `name'. `name' must stay valid until the
+ * statistics are written. Phases cannot be nested: beginning a phase ends
+ * the current one. */
+extern void beginPhase(const char *name);
+
+/* stop measuring the current phase */
+extern void endPhase(void);
+
+/* set the counter called `name' to `value'. `name' must stay valid until
+ * the statistics are written. */
+extern void setStatistic(const char *name, long value);
+
+/* add `value' to the counter called `name' (which starts from zero) */
+extern void addToStatistic(const char *name, long value);
+
+/* write the statistics collected so far as a JSON object. `input' and
+ * `target' are copied in the report to identify it. */
+extern void writeStatsReport(FILE *fout, const char *input
+      , const char *target);
+
+/* write the phases and the counters in the Chrome trace event format */
+extern void writeStatsTrace(FILE *fout);
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ * Politecnico di Milano, 2020
+ * 
+ * axe_strings.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "axe_strings.h"
+
+/* initial number of slots of the hash table. Must be a power of two. */
+#define STR_INITIAL_BUCKETS 256
+
+/* a slot of the open addressing hash table. The slot is empty if `id' is
+ * STRING_NOT_FOUND. */
+typedef struct
+{
+   unsigned int hash;
+   int id;
+}t_string_slot;
+
+struct t_string_table
+{
+   char **strings;         /* the interned strings, indexed by ID */
+   int numStrings;         /* number of strings in the table */
+   int maxStrings;         /* allocated size of `strings' */
+   t_string_slot *buckets; /* hash table, maps strings to their IDs */
+   int numBuckets;         /* size of `buckets' (a power of two) */
+};
+
+static unsigned int hashString(const char *str);
+static t_string_slot *findSlot(t_string_table *table
+      , const char *str, unsigned int hash);
+static int growBuckets(t_string_table *table);
+
+
+t_string_table *initialize_string_table(void)
+{
+   t_string_table *result;
+   int i;
+
+   result = (t_string_table *) malloc(sizeof(t_string_table));
+   if (result == NULL)
+      return NULL;
+
+   result->strings = NULL;
+   result->numStrings = 0;
+   result->maxStrings = 0;
+   result->numBuckets = STR_INITIAL_BUCKETS;
+   result->buckets = (t_string_slot *) malloc(
+         STR_INITIAL_BUCKETS * sizeof(t_string_slot));
+   if (result->buckets == NULL)
+   {
+      free(result);
+      return NULL;
+   }
+   for (i = 0; i < STR_INITIAL_BUCKETS; i++)
+      result->buckets[i].id = STRING_NOT_FOUND;
+
+   return result;
+}
+
+void finalize_string_table(t_string_table *table)
+{
+   int i;
+
+   if (table == NULL)
+      return;
+
+   for (i = 0; i < table->numStrings; i++)
+      free(table->strings[i]);
+   free(table->strings);
+   free(table->buckets);
+   free(table);
+}
+
+/* FNV-1a hash of a string */
+static unsigned int hashString(const char *str)
+{
+   unsigned int hash = 2166136261u;
+
+   while (*str != '\0')
+   {
+      hash ^= (unsigned char) *str;
+      hash *= 16777619u;
+      str++;
+   }
+
+   return hash;
+}
+
+/* Returns the slot which contains `str', or the empty slot where `str' would
+ * be inserted. Collisions are resolved by linear probing. */
+static t_string_slot *findSlot(t_string_table *table
+      , const char *str, unsigned int hash)
+{
+   unsigned int mask = (unsigned int) table->numBuckets - 1;
+   unsigned int i = hash & mask;
+
+   while (table->buckets[i].id != STRING_NOT_FOUND)
+   {
+      t_string_slot *slot = &table->buckets[i];
+      char *candidate = table->strings[slot->id];
+
+      if (slot->hash == hash && (candidate == str || !strcmp(candidate, str)))
+         return slot;
+      i = (i + 1) & mask;
+   }
+
+   return &table->buckets[i];
+}
+
+/* Doubles the size of the hash table, rehashing all the strings */
+static int growBuckets(t_string_table *table)
+{
+   t_string_slot *oldBuckets = table->buckets;
+   int oldNumBuckets = table->numBuckets;
+   int i;
+
+   table->numBuckets = oldNumBuckets * 2;
+   table->buckets = (t_string_slot *) malloc(
+         table->numBuckets * sizeof(t_string_slot));
+   if (table->buckets == NULL)
+   {
+      table->buckets = oldBuckets;
+      table->numBuckets = oldNumBuckets;
+      return 0;
+   }
+   for (i = 0; i < table->numBuckets; i++)
+      table->buckets[i].id = STRING_NOT_FOUND;
+
+   for (i = 0; i < oldNumBuckets; i++)
+   {
+      if (oldBuckets[i].id == STRING_NOT_FOUND)
+         continue;
+      *findSlot(table, table->strings[oldBuckets[i].id]
+            , oldBuckets[i].hash) = oldBuckets[i];
+   }
+
+   free(oldBuckets);
+   return 1;
+}
+
+char *internString(t_string_table *table, const char *str)
+{
+   t_string_slot *slot;
+   unsigned int hash;
+   char *copy;
+
+   if (table == NULL || str == NULL)
+      return NULL;
+
+   hash = hashString(str);
+   slot = findSlot(table, str, hash);
+   if (slot->id != STRING_NOT_FOUND)
+      return table->strings[slot->id];
+
+   /* keep the load factor of the hash table below 1/2 */
+   if ((table->numStrings + 1) * 2 > table->numBuckets)
+   {
+      if (!growBuckets(table))
+         return NULL;
+      slot = findSlot(table, str, hash);
+   }
+
+   if (table->numStrings == table->maxStrings)
+   {
+      int newMaxStrings = table->maxStrings ? table->maxStrings * 2 : 64;
+      char **newStrings = (char **) realloc(table->strings
+            , newMaxStrings * sizeof(char *));
+
+      if (newStrings == NULL)
+         return NULL;
+      table->strings = newStrings;
+      table->maxStrings = newMaxStrings;
+   }
+
+   copy = strdup(str);
+   if (copy == NULL)
+      return NULL;
+
+   slot->hash = hash;
+   slot->id = table->numStrings;
+   table->strings[table->numStrings++] = copy;
+   return copy;
+}
+
+int getStringID(t_string_table *table, const char *str)
+{
+   if (table == NULL || str == NULL)
+      return STRING_NOT_FOUND;
+
+   return findSlot(table, str, hashString(str))->id;
+}
+
+int getNumStrings(t_string_table *table)
+{
+   if (table == NULL)
+      return 0;
+   return table->numStrings;
+}
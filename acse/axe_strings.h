@@ -0,0 +1,43 @@
+/*
+ * Politecnico di Milano, 2020
+ * 
+ * axe_strings.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ * 
+ * A string interning table. Every distinct string inserted in the table is
+ * stored exactly once, so that interned strings can be compared by pointer
+ * and identified by a dense integer ID.
+ */
+
+#ifndef _AXE_STRINGS_H
+#define _AXE_STRINGS_H
+
+/* returned by `getStringID' for strings that have never been interned */
+#define STRING_NOT_FOUND -1
+
+struct t_string_table;
+
+/* Typedef for the struct t_string_table */
+typedef struct t_string_table t_string_table;
+
+/* create a new empty string table. Returns NULL if out of memory. */
+extern t_string_table *initialize_string_table(void);
+
+/* free the table and all the strings it contains */
+extern void finalize_string_table(t_string_table *table);
+
+/* Returns the interned copy of `str'. The returned pointer stays valid until
+ * the table is finalized, and is the same for all the strings which compare
+ * equal with `strcmp'. Returns NULL if out of memory. */
+extern char *internString(t_string_table *table, const char *str);
+
+/* Returns the ID of the interned copy of `str', without interning it.
+ * IDs are assigned sequentially starting from zero, in order of interning.
+ * If `str' was never interned, STRING_NOT_FOUND is returned. */
+extern int getStringID(t_string_table *table, const char *str);
+
+/* Returns the number of strings in the table. All valid string IDs are
+ * smaller than this number. */
+extern int getNumStrings(t_string_table *table);
+
+#endif
@@ -17,18 +17,20 @@ t_axe_expression create_expression (int value, int type)
 
    expression.value = value;
    expression.expression_type = type;
+   expression.condition = NULL;
 
    return expression;
 }
 
 /* create and initialize an instance of `t_axe_register' */
-t_axe_register * alloc_register(int ID, int type, int indirect)
+t_axe_register * alloc_register(t_arena *arena, int ID, int type
+      , int indirect)
 {
    t_axe_register *result;
 
    /* create an instance of `t_axe_register' */
    result = (t_axe_register *)
-            malloc(sizeof(t_axe_register));
+            arenaAlloc(arena, sizeof(t_axe_register));
    
    /* check the postconditions */
    if (result == NULL)
@@ -45,12 +47,13 @@ t_axe_register * alloc_register(int ID, int type, int indirect)
 }
 
 /* create and initialize an instance of `t_axe_instruction' */
-t_axe_instruction * alloc_instruction(int opcode)
+t_axe_instruction * alloc_instruction(t_arena *arena, int opcode)
 {
    t_axe_instruction *result;
 
    /* create an instance of `t_axe_data' */
-   result = (t_axe_instruction *) malloc(sizeof(t_axe_instruction));
+   result = (t_axe_instruction *) arenaAlloc(arena
+         , sizeof(t_axe_instruction));
    
    /* check the postconditions */
    if (result == NULL)
@@ -66,6 +69,7 @@ t_axe_instruction * alloc_instruction(int opcode)
    result->address = NULL;
    result->user_comment = NULL;
    result->mcFlags = 0;
+   result->link = NULL;
 
    /* return `result' */
    return result;
@@ -97,7 +101,9 @@ t_while_statement create_while_statement()
    t_while_statement statement;
 
    /* initialize the WHILE informations */
-   statement.label_condition = NULL;
+   statement.condition = NULL;
+   statement.branch_end = NULL;
+   statement.label_body = NULL;
    statement.label_end = NULL;
 
    /* return a new instance of `t_while_statement' */
@@ -183,7 +189,8 @@ t_axe_variable * alloc_variable
    return result;
 }
 
-/* finalize an instruction info. */
+/* finalize an instruction info. The memory of the instruction, of its
+ * registers, address and comment belongs to the arena of the program. */
 void free_Instruction(t_axe_instruction *inst)
 {
    /* preconditions */
@@ -191,26 +198,12 @@ void free_Instruction(t_axe_instruction *inst)
       return;
    
    /* free memory */
-   if (inst->reg_1 != NULL) {
+   if (inst->reg_1 != NULL)
       freeList(inst->reg_1->mcRegWhitelist);
-      free(inst->reg_1);
-   }
-   if (inst->reg_2 != NULL) {
+   if (inst->reg_2 != NULL)
       freeList(inst->reg_2->mcRegWhitelist);
-      free(inst->reg_2);
-   }
-   if (inst->reg_3 != NULL) {
+   if (inst->reg_3 != NULL)
       freeList(inst->reg_3->mcRegWhitelist);
-      free(inst->reg_3);
-   }
-   if (inst->address != NULL) {
-      free(inst->address);
-   }
-   if (inst->user_comment != NULL) {
-      free(inst->user_comment);
-   }
-
-   free(inst);
 }
 
 /* finalize a data info. */
@@ -220,12 +213,13 @@ void free_Data(t_axe_data *data)
       free(data);
 }
 
-t_axe_address * alloc_address(int type, int address, t_axe_label *label)
+t_axe_address * alloc_address(t_arena *arena, int type, int address
+      , t_axe_label *label)
 {
    t_axe_address *result;
 
    result = (t_axe_address *)
-         malloc(sizeof(t_axe_address));
+         arenaAlloc(arena, sizeof(t_axe_address));
 
    if (result == NULL)
       return NULL;
@@ -18,6 +18,7 @@
 #include <assert.h>
 #include "axe_constants.h"
 #include "collections.h"
+#include "axe_arena.h"
 
 typedef struct t_axe_label
 {
@@ -81,6 +82,8 @@ typedef struct t_axe_instruction
                                   * into the output code as a comment */
    t_axe_label *labelID;         /* a label associated with the current
                                   * instruction */
+   t_list *link;                 /* the position of the instruction in the
+                                  * code segment of the program */
 }t_axe_instruction;
 
 /* this structure is used in order to define assembler directives.
@@ -101,8 +104,28 @@ typedef struct t_axe_expression
 {
    int value;           /* an immediate value or a register identifier */
    int expression_type; /* actually only integer values are supported */
+   struct t_axe_condition *condition;  /* how the value of a logical
+                                        * expression has been computed, or
+                                        * NULL */
 } t_axe_expression;
 
+/* this structure describes how the logical AND (or OR, or NOT) of
+ * expressions, or the comparison of two expressions, has been computed.
+ * When the value of the expression is used only to decide a branch, the
+ * branch can test the operands separately, and skip the second one when the
+ * first decides the result (short-circuit evaluation); a comparison is
+ * tested by a conditional branch on the flags set by the subtraction. Then
+ * the instruction which computes the value is removed. */
+typedef struct t_axe_condition
+{
+   t_axe_instruction *instr;  /* the ANDL, ORL or NOTL instruction, or the
+                               * set instruction of a comparison */
+   t_list *split;             /* the last instruction of the code of the
+                               * first operand */
+   t_axe_expression left;     /* the first operand */
+   t_axe_expression right;    /* the second operand (unused by NOTL) */
+} t_axe_condition;
+
 typedef struct t_axe_declaration
 {
    int isArray;           /* must be TRUE if the current variable is an array */
@@ -115,8 +138,12 @@ typedef struct t_axe_declaration
 
 typedef struct t_while_statement
 {
-   t_axe_label *label_condition;   /* this label points to the expression
-                                    * that is used as loop condition */
+   t_list *condition;              /* the instruction which precedes the
+                                    * expression used as loop condition */
+   t_axe_instruction *branch_end;  /* the branch to `label_end' taken when
+                                    * the condition is not verified */
+   t_axe_label *label_body;        /* this label points to the first
+                                    * instruction of the loop body */
    t_axe_label *label_end;         /* this label points to the instruction
                                     * that follows the while construct */
 } t_while_statement;
@@ -133,14 +160,16 @@ extern t_axe_expression create_expression(int value, int type);
 /* create an instance that will mantain infos about a while statement */
 extern t_while_statement create_while_statement();
 
-/* create an instance of `t_axe_register' */
-extern t_axe_register * alloc_register(int ID, int type, int indirect);
+/* create an instance of `t_axe_register' in `arena' */
+extern t_axe_register * alloc_register(t_arena *arena, int ID, int type,
+      int indirect);
 
-/* create an instance of `t_axe_instruction' */
-extern t_axe_instruction *alloc_instruction(int opcode);
+/* create an instance of `t_axe_instruction' in `arena' */
+extern t_axe_instruction *alloc_instruction(t_arena *arena, int opcode);
 
-/* create an instance of `t_axe_address' */
-extern t_axe_address *alloc_address(int type, int address, t_axe_label *label);
+/* create an instance of `t_axe_address' in `arena' */
+extern t_axe_address *alloc_address(t_arena *arena, int type, int address,
+      t_axe_label *label);
 
 /* create an instance of `t_axe_data' */
 extern t_axe_data *alloc_data(int directiveType, int value, t_axe_label *label);
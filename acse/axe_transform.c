@@ -16,38 +16,29 @@
 #include "axe_errors.h"
 #include "axe_debug.h"
 #include "axe_utils.h"
+#include "axe_stats.h"
 
 extern int errorcode;
 extern int cflow_errorcode;
 
-typedef struct t_tempLabel
-{
-   t_axe_label *labelID;
-   int regID;
-} t_tempLabel;
-
 
 static t_axe_instruction * _createUnary (t_program_infos *program
             , int reg, t_axe_label *label, int opcode);
 static t_axe_instruction * createUnaryInstruction
                (t_program_infos *program, int reg, int opcode);
-static t_tempLabel * allocTempLabel(t_axe_label *labelID, int regID);
-static void freeTempLabel(t_tempLabel *tempLabel);
-static void finalizeListOfTempLabels(t_list *tempLabels);
-static int compareTempLabels(void *valA, void *valB);
 
 /* create new locations into the data segment in order to manage correctly
- * spilled variables */
+ * spilled variables: one for each of the labels in `slotLabels' */
 static void updateTheDataSegment
-            (t_program_infos *program, t_list *tempLabels);
+            (t_program_infos *program, t_vector *slotLabels);
 static void updateTheCodeSegment
             (t_program_infos *program, t_cflow_Graph *graph);
-static t_list * _insertLoad(t_program_infos *program, t_cflow_Graph *graph
+static void _insertLoad(t_program_infos *program, t_cflow_Graph *graph
       , t_basic_block *block, t_cflow_Node *current_node
-            , t_cflow_var *var, t_list *usedVars);
-static t_list * _insertStore(t_program_infos *program, t_cflow_Graph *graph
+            , t_cflow_var *var, t_bitset *usedVars);
+static void _insertStore(t_program_infos *program, t_cflow_Graph *graph
       , t_basic_block *block, t_cflow_Node *current_node
-            , t_cflow_var *var, t_list *usedVars);
+            , t_cflow_var *var, t_bitset *usedVars);
             
 /* create a load instruction without assigning it to program */
 static t_axe_instruction * createLoadInstruction
@@ -55,30 +46,53 @@ static t_axe_instruction * createLoadInstruction
 /* create a store instruction without assigning it to program */
 static t_axe_instruction * createStoreInstruction
                   (t_program_infos *program, int reg);
+/* create a copy of the definition `def' of a rematerializable variable,
+ * which writes the register `reg' */
+static t_axe_instruction * createRematerialization
+                  (t_program_infos *program, t_axe_instruction *def, int reg);
 
 /* update the control flow informations by unsing the result
  * of the register allocation process and a list of bindings
  * between new assembly labels and spilled variables */
 static void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
-            , t_reg_allocator *RA, t_list *label_bindings);
-
-/* this function returns a list of t_templabel containing binding
- * informations between spilled variables and labels that will point
- * to a memory block in the data segment */
-static t_list * retrieveLabelBindings(t_program_infos *program, t_reg_allocator *RA);
+            , t_reg_allocator *RA, t_vector *label_bindings);
+
+/* this function returns a vector containing, for each spilled variable,
+ * the label that will point to its memory block in the data segment. The
+ * vector is indexed by variable identifier; the elements for variables
+ * which have not been spilled are NULL. Variables which are never live at
+ * the same time share the same memory block; the label of each memory
+ * block is added to `slotLabels'. The label of a block which holds an
+ * address has a pointer type. */
+static t_vector * retrieveLabelBindings(t_program_infos *program
+            , t_cflow_Graph *graph, t_reg_allocator *RA
+            , t_vector *slotLabels);
+
+/* returns non-zero if the split variable `varID', allocated to `reg' in the
+ * block `block', must be loaded from memory when entering the block */
+static int needsReloadAtEntry(t_reg_allocator *RA, t_basic_block *block
+            , int varID, int reg, t_hashmap *blockNumbers);
+
+/* insert the loads and stores which move the split variables between
+ * memory and their registers at the boundaries of the block `block' */
+static void insertResolutionMoves(t_program_infos *program
+            , t_cflow_Graph *graph, t_reg_allocator *RA, t_basic_block *block
+            , t_hashmap *blockNumbers, t_vector *label_bindings);
       
-int _insertLoadSpill(t_program_infos *program, int temp_register, int selected_register
+int _insertLoadSpill(t_program_infos *program, t_reg_allocator *RA
+            , int temp_register, int selected_register
             , t_cflow_Graph *graph, t_basic_block *current_block
-            , t_cflow_Node *current_node, t_list *labelBindings, int before);
+            , t_cflow_Node *current_node, t_vector *labelBindings, int before);
             
-int _insertStoreSpill(t_program_infos *program, int temp_register, int selected_register
+int _insertStoreSpill(t_program_infos *program, t_reg_allocator *RA
+            , int temp_register, int selected_register
             , t_cflow_Graph *graph, t_basic_block *current_block
-            , t_cflow_Node *current_node, t_list *labelBindings, int before);
+            , t_cflow_Node *current_node, t_vector *labelBindings, int before);
 
       
-static t_list * _insertStore(t_program_infos *program, t_cflow_Graph *graph
+void _insertStore(t_program_infos *program, t_cflow_Graph *graph
       , t_basic_block *current_block, t_cflow_Node *current_node
-            , t_cflow_var *var, t_list *usedVars)
+            , t_cflow_var *var, t_bitset *usedVars)
 {
    /* we have to insert a store instruction into the code */
    t_axe_instruction *storeInstr;
@@ -101,22 +115,20 @@ static t_list * _insertStore(t_program_infos *program, t_cflow_Graph *graph
       if (cflow_errorcode != CFLOW_OK) {
          finalizeNode(storeNode);
          free_Instruction(storeInstr);
-         return usedVars;
+         return;
       }
 
       /* insert the node `loadNode' before `current_node' */
       insertNodeAfter(current_block, current_node, storeNode);
    
-      /* update the list of usedVars */
-      usedVars = removeElement(usedVars, var);
+      /* update the set of usedVars */
+      removeFromBitset(usedVars, var->index);
    }
-
-   return usedVars;
 }
 
-t_list * _insertLoad(t_program_infos *program, t_cflow_Graph *graph
+void _insertLoad(t_program_infos *program, t_cflow_Graph *graph
       , t_basic_block *current_block, t_cflow_Node *current_node
-            , t_cflow_var *var, t_list *usedVars)
+            , t_cflow_var *var, t_bitset *usedVars)
 {
    /* we have to insert a load instruction into the code */
    t_axe_instruction *current_instr;
@@ -145,7 +157,7 @@ t_list * _insertLoad(t_program_infos *program, t_cflow_Graph *graph
       if (cflow_errorcode != CFLOW_OK) {
          finalizeNode(loadNode);
          free_Instruction(loadInstr);
-         return usedVars;
+         return;
       }
 
       /* update the label informations */
@@ -157,11 +169,9 @@ t_list * _insertLoad(t_program_infos *program, t_cflow_Graph *graph
       /* insert the node `loadNode' before `current_node' */
       insertNodeBefore(current_block, current_node, loadNode);
 
-      /* update the list of usedVars */
-      usedVars = addElement(usedVars, var, -1);
+      /* update the set of usedVars */
+      addToBitset(usedVars, var->index);
    }
-
-   return usedVars;
 }
 
 void updateTheCodeSegment(t_program_infos *program, t_cflow_Graph *graph)
@@ -188,8 +198,7 @@ void updateTheCodeSegment(t_program_infos *program, t_cflow_Graph *graph)
       {
          node = (t_cflow_Node *) LDATA(current_nd_element);
 
-         program->instructions =
-               addElement(program->instructions, node->instr, -1);
+         appendInstruction(program, node->instr);
          
          current_nd_element = LNEXT(current_nd_element);
       }
@@ -198,36 +207,38 @@ void updateTheCodeSegment(t_program_infos *program, t_cflow_Graph *graph)
    }
 }
 
-void updateTheDataSegment(t_program_infos *program, t_list *labelBindings)
+void updateTheDataSegment(t_program_infos *program, t_vector *slotLabels)
 {
-   t_list *current_element;
-   t_tempLabel *current_TL;
+   t_axe_label *current_label;
    t_axe_data *new_data_info;
+   t_list *new_data;
+   int counter;
 
    /* preconditions */
    if (program == NULL) {
-      finalizeListOfTempLabels(labelBindings);
+      freeVector(slotLabels);
       notifyError(AXE_PROGRAM_NOT_INITIALIZED);
    }
 
-   /* initialize the value of `current_element' */
-   current_element = labelBindings;
-   while(current_element != NULL)
+   new_data = NULL;
+   for (counter = VSIZE(slotLabels) - 1; counter >= 0; counter--)
    {
-      current_TL = (t_tempLabel *) LDATA(current_element);
+      current_label = (t_axe_label *) VDATA(slotLabels, counter);
 
-      new_data_info = alloc_data (DIR_WORD, 0, current_TL->labelID);
+      new_data_info = alloc_data (DIR_WORD, 0, current_label);
          
       if (new_data_info == NULL){
-         finalizeListOfTempLabels(labelBindings);
+         freeVector(slotLabels);
+         freeList(new_data);
          notifyError(AXE_OUT_OF_MEMORY);
       }
 
-      /* update the list of directives */
-      program->data = addElement(program->data, new_data_info, -1);
-      
-      current_element = LNEXT(current_element);
+      new_data = addFirst(new_data, new_data_info);
    }
+
+   /* update the list of directives */
+   program->data = addList(program->data, new_data);
+   freeList(new_data);
 }
 
 t_axe_instruction * _createUnary (t_program_infos *program
@@ -247,13 +258,13 @@ t_axe_instruction * _createUnary (t_program_infos *program
    }
 
    /* create an instance of `t_axe_instruction' */
-   result = alloc_instruction(opcode);
+   result = alloc_instruction(program->arena, opcode);
    if (result == NULL) {
       errorcode = AXE_OUT_OF_MEMORY;
       return NULL;
    }
 
-   result->reg_1 = alloc_register(reg, INFERRED_TYPE, 0);
+   result->reg_1 = alloc_register(program->arena, reg, INFERRED_TYPE, 0);
    if (result->reg_1 == NULL) {
       errorcode = AXE_OUT_OF_MEMORY;
       free_Instruction(result);
@@ -261,7 +272,7 @@ t_axe_instruction * _createUnary (t_program_infos *program
    }
 
    /* initialize an address info */
-   result->address = alloc_address(LABEL_TYPE, 0, label);
+   result->address = alloc_address(program->arena, LABEL_TYPE, 0, label);
    if (result->address == NULL) {
       errorcode = AXE_OUT_OF_MEMORY;
       free_Instruction(result);
@@ -271,113 +282,57 @@ t_axe_instruction * _createUnary (t_program_infos *program
    return result;
 }
 
-int compareTempLabels(void *valA, void *valB)
-{
-   t_tempLabel *tlA;
-   t_tempLabel *tlB;
-   
-   if (valA == NULL)
-      return 0;
-   if (valB == NULL)
-      return 0;
-
-   tlA = (t_tempLabel *) valA;
-   tlB = (t_tempLabel *) valB;
-
-   return (tlA->regID == tlB->regID);
-}
-
-t_tempLabel * allocTempLabel(t_axe_label *labelID, int regID)
-{
-   t_tempLabel *result;
-
-   /* preconditions */
-   if (labelID == NULL) {
-      errorcode = AXE_INVALID_LABEL;
-      return NULL;
-   }
-
-   /* create a new temp-label */
-   result = malloc(sizeof(t_tempLabel));
-   if (result == NULL) {
-      errorcode = AXE_OUT_OF_MEMORY;
-      return NULL;
-   }
-   
-   /* initialize the temp label */
-   result->labelID = labelID;
-   result->regID = regID;
-
-   return result;
-}
-
-void freeTempLabel(t_tempLabel *tempLabel)
-{
-   if (tempLabel != NULL)
-      free(tempLabel);
-}
-
-void finalizeListOfTempLabels(t_list *tempLabels)
-{
-   t_list *current_element;
-   t_tempLabel *tempLabel;
-
-   /* test the preconditions */
-   if (tempLabels == NULL)
-      return;
-
-   /* assign to current_element the address of the first
-    * element of the list `tempLabels' */
-   current_element = tempLabels;
-   
-   while(current_element != NULL)
-   {
-      tempLabel = (t_tempLabel *) LDATA(current_element);
-      if (tempLabel != NULL)
-         freeTempLabel(tempLabel);
-      
-      current_element = LNEXT(current_element);
-   }
-
-   /* finalize the list of elements of type `t_tempLabel' */
-   freeList(tempLabels);
-}
-
 void materializeRegisterAllocation(t_program_infos *program,
   t_cflow_Graph *graph, t_reg_allocator *RA)
 {
-   t_list *label_bindings;
-
-   /* retrieve a list of t_templabels for the given RA infos.*/
-   label_bindings = retrieveLabelBindings(program, RA);
+   t_vector *label_bindings;
+   t_vector *slot_labels;
+   int counter, rematerialized;
+
+   /* retrieve the labels of the spilled variables for the given RA infos.*/
+   slot_labels = allocVector(0);
+   label_bindings = retrieveLabelBindings(program, graph, RA, slot_labels);
+   setStatistic("ra.spill_slots", VSIZE(slot_labels));
+
+   /* the spilled variables which can be rematerialized have no slot */
+   rematerialized = 0;
+   for (counter = 0; counter < RA->varNum; counter++) {
+      if (RA->bindings[counter] == RA_SPILL_REQUIRED
+            && RA->rematDefs[counter] != NULL)
+         rematerialized++;
+   }
+   setStatistic("ra.rematerialized", rematerialized);
 
    /* update the content of the data segment */
-   updateTheDataSegment(program, label_bindings);
+   updateTheDataSegment(program, slot_labels);
 
    /* update the control flow graph with the reg-alloc infos. */
    updatCflowInfos(program, graph, RA, label_bindings);
 
-   /* finalize the list of tempLabels */
-   finalizeListOfTempLabels(label_bindings);
+   /* finalize the label bindings */
+   freeVector(label_bindings);
+   freeVector(slot_labels);
 }
 
 void updateProgramInfos(t_program_infos *program,
    t_cflow_Graph *graph)
 {  
    /* erase the old code segment */
-   freeList(program->instructions);
-   program->instructions = NULL;
+   clearInstructions(program);
 
    /* update the code segment informations */
    updateTheCodeSegment(program, graph);
 }
 
-t_list * retrieveLabelBindings(t_program_infos *program, t_reg_allocator *RA)
+t_vector * retrieveLabelBindings(t_program_infos *program
+            , t_cflow_Graph *graph, t_reg_allocator *RA
+            , t_vector *slotLabels)
 {
-   int counter;
-   t_list *result;
-   t_tempLabel *tlabel;
+   int counter, numSlots;
+   int *slots;
+   t_vector *result;
    t_axe_label *axe_label;
+   t_cflow_var *var;
    
    /* preconditions */
    if (program == NULL)
@@ -386,25 +341,38 @@ t_list * retrieveLabelBindings(t_program_infos *program, t_reg_allocator *RA)
       notifyError(AXE_INVALID_REG_ALLOC);
 
    /* initialize the local variable `result' */
-   result = NULL;
-   tlabel = NULL;
+   result = allocVector(RA->varNum);
+   resizeVector(result, RA->varNum);
 
-   for (counter = 0; counter < RA->varNum; counter++)
-   {
-      if (RA->bindings[counter] == RA_SPILL_REQUIRED)
-      {
-         /* retrieve a new label */
-         axe_label = newLabel(program);
-         if (axe_label == NULL)
-            notifyError(AXE_INVALID_LABEL);
+   /* find which spilled variables can share the same memory block */
+   slots = malloc(sizeof(int) * (RA->varNum + 1));
+   if (slots == NULL)
+      notifyError(AXE_OUT_OF_MEMORY);
+   numSlots = assignSpillSlots(RA, slots);
 
-         /* create a new tempLabel */
-         tlabel = allocTempLabel(axe_label, counter);
+   for (counter = 0; counter < numSlots; counter++)
+   {
+      /* retrieve a new label */
+      axe_label = newLabel(program);
+      if (axe_label == NULL)
+         notifyError(AXE_INVALID_LABEL);
+      addToVector(slotLabels, axe_label);
+   }
 
-         /* add the current tlabel to the list of labelbindings */
-         result = addElement(result, tlabel, -1);
-      }
+   /* bind the label of its memory block to each spilled variable */
+   for (counter = 0; counter < RA->varNum; counter++)
+   {
+      if (slots[counter] < 0)
+         continue;
+      axe_label = (t_axe_label *) VDATA(slotLabels, slots[counter]);
+      VDATA(result, counter) = axe_label;
+
+      /* the target may need a larger block for an address */
+      var = getCflowVariable(graph, counter);
+      if (var != NULL && var->type >= 0 && (var->type & PTR_TYPE_FLAG))
+         axe_label->type = INTEGER_PTR_TYPE;
    }
+   free(slots);
    
    /* postcondition: return the list of bindings */
    return result;
@@ -452,6 +420,35 @@ t_axe_instruction * createLoadInstruction
    return createUnaryInstruction(program, reg, LOAD);
 }
 
+t_axe_instruction * createRematerialization
+                  (t_program_infos *program, t_axe_instruction *def, int reg)
+{
+   t_axe_instruction *result;
+
+   result = alloc_instruction(program->arena, def->opcode);
+   if (result == NULL) {
+      errorcode = AXE_OUT_OF_MEMORY;
+      return NULL;
+   }
+
+   result->reg_1 = alloc_register(program->arena, reg, def->reg_1->type, 0);
+   if (def->reg_2 != NULL)
+      result->reg_2 = alloc_register(program->arena, REG_0
+            , def->reg_2->type, 0);
+   result->immediate = def->immediate;
+   if (def->address != NULL)
+      result->address = alloc_address(program->arena, def->address->type
+            , def->address->addr, def->address->labelID);
+   if (result->reg_1 == NULL || (def->reg_2 != NULL && result->reg_2 == NULL)
+         || (def->address != NULL && result->address == NULL)) {
+      errorcode = AXE_OUT_OF_MEMORY;
+      free_Instruction(result);
+      return NULL;
+   }
+
+   return result;
+}
+
 t_cflow_Graph * insertLoadAndStoreInstr
          (t_program_infos *program, t_cflow_Graph *graph)
 {
@@ -459,14 +456,14 @@ t_cflow_Graph * insertLoadAndStoreInstr
    t_basic_block *current_block;
    t_list *current_nd_element;
    t_cflow_Node *current_node;
-   t_list *usedVars;
+   t_bitset *usedVars;
 
    /* assertions */
    assert(program != NULL);
    assert(graph != NULL);
    
-   /* initialize the list of variables used by this basic block */
-   usedVars = NULL;
+   /* initialize the set of variables used by this basic block */
+   usedVars = allocBitset(graph->numVariables);
    current_bb_element = graph->blocks;
    while (current_bb_element != NULL)
    {
@@ -484,9 +481,9 @@ t_cflow_Graph * insertLoadAndStoreInstr
             t_cflow_var *use = current_node->uses[usei];
             if ((use != NULL) && (use->ID != REG_0) && (use->ID != VAR_PSW))
             {
-               if (findElement(usedVars, use) == NULL)
+               if (!isInBitset(usedVars, use->index))
                {
-                  usedVars = _insertLoad(program, graph, current_block
+                  _insertLoad(program, graph, current_block
                         , current_node, use, usedVars);
                }
             }
@@ -497,9 +494,9 @@ t_cflow_Graph * insertLoadAndStoreInstr
             t_cflow_var *def = current_node->defs[defi];
             if ((def != NULL) && (def->ID != REG_0) && (def->ID != VAR_PSW))
             {
-               if (findElement(usedVars, def) == NULL)
+               if (!isInBitset(usedVars, def->index))
                {
-                  usedVars = addElement(usedVars, def, -1);
+                  addToBitset(usedVars, def->index);
                }
             }
          }
@@ -509,7 +506,7 @@ t_cflow_Graph * insertLoadAndStoreInstr
       }
 
       current_nd_element = getLastElement(current_block->nodes);
-      while((current_nd_element != NULL) && (usedVars != NULL))
+      while((current_nd_element != NULL) && (nextInBitset(usedVars, 0) >= 0))
       {
          int usei, defi;
          current_node = (t_cflow_Node *) LDATA(current_nd_element);
@@ -519,9 +516,9 @@ t_cflow_Graph * insertLoadAndStoreInstr
             t_cflow_var *use = current_node->uses[usei];
             if ((use != NULL) && (use->ID != REG_0) && (use->ID != VAR_PSW))
             {
-               if (findElement(usedVars, use) != NULL)
+               if (isInBitset(usedVars, use->index))
                {
-                  usedVars = _insertStore(program, graph, current_block
+                  _insertStore(program, graph, current_block
                         , current_node, use, usedVars);
                }
             }
@@ -532,9 +529,9 @@ t_cflow_Graph * insertLoadAndStoreInstr
             t_cflow_var *def = current_node->defs[defi];
             if ((def != NULL) && (def->ID != REG_0) && (def->ID != VAR_PSW))
             {
-               if (findElement(usedVars, def) != NULL)
+               if (isInBitset(usedVars, def->index))
                {
-                  usedVars = _insertStore(program, graph, current_block
+                  _insertStore(program, graph, current_block
                         , current_node, def, usedVars);
                }
             }
@@ -547,25 +544,151 @@ t_cflow_Graph * insertLoadAndStoreInstr
       current_bb_element = LNEXT(current_bb_element);
    }
 
-   /* free the list `usedVars' */
-   freeList(usedVars);
+   /* free the set `usedVars' */
+   freeBitset(usedVars);
    
    return graph;
 }
 
+int needsReloadAtEntry(t_reg_allocator *RA, t_basic_block *block
+            , int varID, int reg, t_hashmap *blockNumbers)
+{
+   t_list *current_pred;
+
+   for (current_pred = block->pred; current_pred != NULL
+         ; current_pred = LNEXT(current_pred))
+   {
+      void *pred = LDATA(current_pred);
+      int predNumber = (int)(intptr_t)lookupHashMap(blockNumbers, pred);
+      if (getRegisterInBlock(RA, varID, predNumber) != reg)
+         return 1;
+   }
+   return 0;
+}
+
+/*
+ * A split variable lives in memory at the boundary between two blocks
+ * unless it is in the same register on both sides. A block where the
+ * variable is in a register loads it at the beginning if any predecessor
+ * does not have it in the same register, and stores it at the end if any
+ * successor may read it from memory.
+ */
+void insertResolutionMoves(t_program_infos *program, t_cflow_Graph *graph
+            , t_reg_allocator *RA, t_basic_block *block
+            , t_hashmap *blockNumbers, t_vector *label_bindings)
+{
+   t_cflow_Node *first_node, *last_node;
+   t_list *current_succ;
+   int i, varID, reg;
+   int moves = 0;
+
+   if (block->nodes == NULL)
+      return;
+
+   last_node = (t_cflow_Node *) LDATA(getLastElement(block->nodes));
+   if (block->liveOut != NULL)
+   {
+      for (i = nextInBitset(block->liveOut, 0); i >= 0
+            ; i = nextInBitset(block->liveOut, i + 1))
+      {
+         varID = graph->variables[i]->ID;
+         if (varID < 0 || RA->splitIntervals[varID] == NULL)
+            continue;
+         reg = RA->bindings[varID];
+         if (reg == RA_SPILL_REQUIRED)
+            continue;
+
+         for (current_succ = block->succ; current_succ != NULL
+               ; current_succ = LNEXT(current_succ))
+         {
+            t_basic_block *succ = (t_basic_block *) LDATA(current_succ);
+            int succNumber, succReg;
+
+            if (succ->liveIn == NULL || !isInBitset(succ->liveIn, i))
+               continue;
+            succNumber = (int)(intptr_t)lookupHashMap(blockNumbers, succ);
+            succReg = getRegisterInBlock(RA, varID, succNumber);
+            if (succReg != reg || needsReloadAtEntry(RA, succ, varID
+                     , succReg, blockNumbers))
+               break;
+         }
+         if (current_succ == NULL)
+            continue;
+
+         _insertStoreSpill(program, RA, varID, reg, graph, block, last_node
+               , label_bindings, isJumpInstruction(last_node->instr)
+                  || isHaltOrRetInstruction(last_node->instr));
+         moves++;
+      }
+   }
+
+   first_node = (t_cflow_Node *) LDATA(block->nodes);
+   if (block->liveIn != NULL && block->pred != NULL)
+   {
+      for (i = nextInBitset(block->liveIn, 0); i >= 0
+            ; i = nextInBitset(block->liveIn, i + 1))
+      {
+         varID = graph->variables[i]->ID;
+         if (varID < 0 || RA->splitIntervals[varID] == NULL)
+            continue;
+         reg = RA->bindings[varID];
+         if (reg == RA_SPILL_REQUIRED
+               || !needsReloadAtEntry(RA, block, varID, reg, blockNumbers))
+            continue;
+
+         _insertLoadSpill(program, RA, varID, reg, graph, block, first_node
+               , label_bindings, 1);
+         first_node = (t_cflow_Node *) LDATA(block->nodes);
+         moves++;
+      }
+   }
+
+   addToStatistic("ra.resolution_moves", moves);
+}
+
 void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
-            , t_reg_allocator *RA, t_list *label_bindings)
+            , t_reg_allocator *RA, t_vector *label_bindings)
 {      
+   t_hashmap *blockNumbers;
+   int blockNumber;
+   int *liveEnd;
+   int position;
+   int i;
+
    /* preconditions */
    assert(program != NULL);
    assert(graph != NULL);
    assert(RA != NULL);
-   
+
+   /* the values of the spilled variables are written back only where they
+    * may be used later: the memory blocks they share are reserved only up
+    * to the end of their live range (see `assignSpillSlots') */
+   liveEnd = RA->liveRangeEnds;
+   position = 0;
+
+   /* number the blocks, to find the registers of the split variables */
+   blockNumbers = allocHashMap(NULL, NULL);
+   blockNumber = 0;
    t_list *current_bb_element = graph->blocks;
+   while (current_bb_element != NULL) {
+      putInHashMap(blockNumbers, LDATA(current_bb_element)
+            , INTDATA(blockNumber++));
+      current_bb_element = LNEXT(current_bb_element);
+   }
+   
+   blockNumber = 0;
+   current_bb_element = graph->blocks;
    while (current_bb_element != NULL)
    {
       int counter;
 
+      /* the split variables are bound to the register they have in this
+       * block, or to memory */
+      for (i = 0; i < VSIZE(RA->splitVariables); i++) {
+         int varID = VINTDATA(RA->splitVariables, i);
+         RA->bindings[varID] = getRegisterInBlock(RA, varID, blockNumber);
+      }
+
       /* spill register slots
        * each array element corresponds to one of the registers reserved for
        * the spill, ordered by ascending register number. */
@@ -631,22 +754,18 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
                      /* test if a write back is needed */
                      if (! (current_instr->reg_1)->indirect)
                      {
-                        /* if the current instruction is a STORE we don't need
-                         * to write back the value of reg_1 again in memory. */
-                        /* Also if the current instruction is a WRITE instruction
-                         * we don't have to set the flag "dirty" for the
-                         * register assignedRegisters[current_row], since reg_1
-                         * is "used" but not "defined" */
+                        /* if the current instruction is a STORE or a WRITE
+                         * instruction we don't have to set the flag "dirty"
+                         * for the register assignedRegisters[current_row],
+                         * since reg_1 is "used" but not "defined". A STORE
+                         * writes to its own address, not to the memory
+                         * location of the spilled variable: the flag is
+                         * left unchanged. */
                         if (  (current_instr->opcode != STORE)
                               && (current_instr->opcode != AXE_WRITE) )
                         {
                            assignedRegisters[current_row].needsWB = 1;
                         }
-                        /* if the current instruction is a STORE we have to
-                         * notify that the write back is happened by
-                         * resetting the flag "dirty" */
-                        if (current_instr->opcode == STORE)
-                           assignedRegisters[current_row].needsWB = 0;
                      }
 
                      /* notify that the value was found */
@@ -732,15 +851,17 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
                      int register_found = current_row + NUM_REGISTERS
                            + 1 - NUM_SPILL_REGS;
                      
-                     if (assignedRegisters[current_row].needsWB == 1)
+                     if (assignedRegisters[current_row].needsWB == 1
+                           && liveEnd[assignedRegisters[current_row]
+                              .assignedVar] >= position)
                      {
                         /* NEED WRITE BACK */
-                        _insertStoreSpill(program, assignedRegisters[current_row].assignedVar
+                        _insertStoreSpill(program, RA, assignedRegisters[current_row].assignedVar
                               , register_found, graph, current_block
                                     , current_node, label_bindings, 1);
                      }
 
-                     _insertLoadSpill(program, (current_instr->reg_2)->ID
+                     _insertLoadSpill(program, RA, (current_instr->reg_2)->ID
                            , register_found, graph, current_block
                                 , current_node, label_bindings, 1);
 
@@ -781,15 +902,17 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
                      int register_found = current_row + NUM_REGISTERS
                            + 1 - NUM_SPILL_REGS;
                      
-                     if (assignedRegisters[current_row].needsWB == 1)
+                     if (assignedRegisters[current_row].needsWB == 1
+                           && liveEnd[assignedRegisters[current_row]
+                              .assignedVar] >= position)
                      {
                         /* NEED WRITE BACK */
-                        _insertStoreSpill(program, assignedRegisters[current_row].assignedVar
+                        _insertStoreSpill(program, RA, assignedRegisters[current_row].assignedVar
                               , register_found, graph, current_block
                                     , current_node, label_bindings, 1);
                      }
 
-                     _insertLoadSpill(program, (current_instr->reg_3)->ID
+                     _insertLoadSpill(program, RA, (current_instr->reg_3)->ID
                            , register_found, graph, current_block
                                 , current_node, label_bindings, 1);
 
@@ -830,19 +953,22 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
                      int register_found = current_row + NUM_REGISTERS
                            + 1 - NUM_SPILL_REGS;
                      
-                     if (assignedRegisters[current_row].needsWB == 1)
+                     if (assignedRegisters[current_row].needsWB == 1
+                           && liveEnd[assignedRegisters[current_row]
+                              .assignedVar] >= position)
                      {
                         /* NEED WRITE BACK */
-                        _insertStoreSpill(program, assignedRegisters[current_row].assignedVar
+                        _insertStoreSpill(program, RA, assignedRegisters[current_row].assignedVar
                               , register_found, graph, current_block
                                     , current_node, label_bindings, 1);
                      }
 
                      /* test if we need to load the value from register */
                      if (  (current_instr->reg_1)->indirect
-                           || (current_instr->opcode == AXE_WRITE))
+                           || (current_instr->opcode == AXE_WRITE)
+                           || (current_instr->opcode == STORE))
                      {
-                        _insertLoadSpill(program, (current_instr->reg_1)->ID
+                        _insertLoadSpill(program, RA, (current_instr->reg_1)->ID
                               , register_found, graph, current_block
                                     , current_node, label_bindings, 1);
                      }
@@ -917,6 +1043,7 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
 
          /* retrieve the previous element */
          current_nd_element = LNEXT(current_nd_element);
+         position++;
       }
 
       int bbHasTermInstr = current_block->nodes && 
@@ -926,47 +1053,59 @@ void updatCflowInfos(t_program_infos *program, t_cflow_Graph *graph
       /* writeback everything at the end of the basic block */
       for (counter = 0; counter < NUM_SPILL_REGS; counter ++)
       {
-         if (assignedRegisters[counter].needsWB == 1)
+         if (assignedRegisters[counter].needsWB == 1
+               && liveEnd[assignedRegisters[counter].assignedVar]
+                  >= position - 1)
          {
             /* NEED WRITE BACK */
-            _insertStoreSpill(program, assignedRegisters[counter].assignedVar
+            _insertStoreSpill(program, RA, assignedRegisters[counter].assignedVar
                      , (counter + NUM_REGISTERS + 1 - NUM_SPILL_REGS)
                            , graph, current_block
                               , current_node, label_bindings, bbHasTermInstr);
          }
       }
+
+      insertResolutionMoves(program, graph, RA, current_block
+            , blockNumbers, label_bindings);
       
       /* retrieve the next basic block element */
       current_bb_element = LNEXT(current_bb_element);
+      blockNumber++;
    }
+
+   for (i = 0; i < VSIZE(RA->splitVariables); i++)
+      RA->bindings[VINTDATA(RA->splitVariables, i)] = RA_SPILL_REQUIRED;
+   freeHashMap(blockNumbers);
 }
 
-int _insertStoreSpill(t_program_infos *program, int temp_register, int selected_register
+int _insertStoreSpill(t_program_infos *program, t_reg_allocator *RA
+            , int temp_register, int selected_register
             , t_cflow_Graph *graph, t_basic_block *current_block
-            , t_cflow_Node *current_node, t_list *labelBindings, int before)
+            , t_cflow_Node *current_node, t_vector *labelBindings, int before)
 {
    t_axe_instruction *storeInstr;
    t_cflow_Node *storeNode = NULL;
-   t_list *elementFound;
-   t_tempLabel pattern;
-   t_tempLabel *tlabel;
+   t_axe_label *tlabel;
+
+   /* the variables which can be rematerialized are never stored */
+   if (temp_register >= 0 && temp_register < RA->varNum
+         && RA->rematDefs[temp_register] != NULL)
+      return 0;
 
-   pattern.regID = temp_register;
-   elementFound = CustomfindElement (labelBindings
-               , &pattern, compareTempLabels);
+   tlabel = NULL;
+   if (temp_register >= 0 && temp_register < VSIZE(labelBindings))
+      tlabel = (t_axe_label *) VDATA(labelBindings, temp_register);
 
-   if (elementFound == NULL) {
+   if (tlabel == NULL) {
       finalizeNode(storeNode);
       errorcode = AXE_TRANSFORM_ERROR;
       return -1;
    }
 
-   tlabel = (t_tempLabel *) LDATA(elementFound);
-   assert(tlabel != NULL);
 
    /* create a store instruction */
    storeInstr = _createUnary (program
-            , selected_register, tlabel->labelID, STORE);
+            , selected_register, tlabel, STORE);
 
    /* test if an error occurred */
    if (errorcode != AXE_OK) {
@@ -988,37 +1127,49 @@ int _insertStoreSpill(t_program_infos *program, int temp_register, int selected_
    if (before == 0)
       insertNodeAfter(current_block, current_node, storeNode);
    else
+   {
+      /* the jumps to `current_node' must execute the store too */
+      if ((current_node->instr)->labelID != NULL)
+      {
+         storeInstr->labelID = (current_node->instr)->labelID;
+         (current_node->instr)->labelID = NULL;
+      }
       insertNodeBefore(current_block, current_node, storeNode);
+   }
    
    return 0;
 }
 
-int _insertLoadSpill(t_program_infos *program, int temp_register, int selected_register
+int _insertLoadSpill(t_program_infos *program, t_reg_allocator *RA
+            , int temp_register, int selected_register
             , t_cflow_Graph *graph, t_basic_block *block
-            , t_cflow_Node *current_node, t_list *labelBindings, int before)
+            , t_cflow_Node *current_node, t_vector *labelBindings, int before)
 {
    t_axe_instruction *loadInstr;
    t_cflow_Node *loadNode = NULL;
-   t_list *elementFound;
-   t_tempLabel pattern;
-   t_tempLabel *tlabel;
+   t_axe_label *tlabel;
 
-   pattern.regID = temp_register;
-   elementFound = CustomfindElement (labelBindings
-               , &pattern, compareTempLabels);
+   tlabel = NULL;
+   if (temp_register >= 0 && temp_register < VSIZE(labelBindings))
+      tlabel = (t_axe_label *) VDATA(labelBindings, temp_register);
 
-   if (elementFound == NULL) {
+   if (temp_register >= 0 && temp_register < RA->varNum
+         && RA->rematDefs[temp_register] != NULL)
+   {
+      /* recompute the value instead of loading it */
+      loadInstr = createRematerialization(program
+            , RA->rematDefs[temp_register], selected_register);
+   }
+   else if (tlabel == NULL) {
       finalizeNode(loadNode);
       errorcode = AXE_TRANSFORM_ERROR;
       return -1;
    }
-
-   tlabel = (t_tempLabel *) LDATA(elementFound);
-   assert(tlabel != NULL);
-      
-   /* create a load instruction */
-   loadInstr = _createUnary (program
-            , selected_register, tlabel->labelID, LOAD);
+   else {
+      /* create a load instruction */
+      loadInstr = _createUnary (program
+               , selected_register, tlabel, LOAD);
+   }
 
    /* test if an error occurred */
    if (errorcode != AXE_OK) {
@@ -20,6 +20,8 @@
 #include "axe_io_manager.h"
 #include "axe_errors.h"
 #include "axe_target_info.h"
+#include "axe_stats.h"
+#include "axe_arena.h"
 
 extern int errorcode;
 extern int line_num;
@@ -262,6 +264,30 @@ int switchOpcodeImmediateForm(int orig)
    return orig ^ 0x10;
 }
 
+int getOppositeBranchOpcode(int orig)
+{
+   switch (orig)
+   {
+      case BT : return BF;
+      case BF : return BT;
+      case BHI : return BLS;
+      case BLS : return BHI;
+      case BCC : return BCS;
+      case BCS : return BCC;
+      case BNE : return BEQ;
+      case BEQ : return BNE;
+      case BVC : return BVS;
+      case BVS : return BVC;
+      case BPL : return BMI;
+      case BMI : return BPL;
+      case BGE : return BLT;
+      case BLT : return BGE;
+      case BGT : return BLE;
+      case BLE : return BGT;
+   }
+   return INVALID_OPCODE;
+}
+
 void setMCRegisterWhitelist(t_axe_register *regObj, ...)
 {
    t_list *res = NULL;
@@ -344,7 +370,7 @@ void set_end_Program(t_program_infos *program)
       t_list *last_element;
 
       /* get the last element of the list */
-      last_element = getLastElement(program->instructions);
+      last_element = program->lastInstruction;
       assert(last_element != NULL);
 
       /* retrieve the last instruction */
@@ -359,9 +385,67 @@ void set_end_Program(t_program_infos *program)
    return;
 }
 
+void writeCompilationStats()
+{
+   FILE *fout;
+
+   if (file_infos == NULL)
+      return;
+   if (file_infos->stats_file_name == NULL
+         && file_infos->trace_file_name == NULL)
+      return;
+
+   /* memory used by the intermediate representation */
+   if (program != NULL) {
+      setStatistic("arena.program.allocations"
+            , getArenaAllocations(program->arena));
+      setStatistic("arena.program.bytes"
+            , (long)getArenaBytesAllocated(program->arena));
+   }
+   if (graph != NULL) {
+      setStatistic("arena.cfg.allocations", getArenaAllocations(graph->arena));
+      setStatistic("arena.cfg.bytes"
+            , (long)getArenaBytesAllocated(graph->arena));
+   }
+   if (RA != NULL) {
+      setStatistic("arena.ra.allocations", getArenaAllocations(RA->arena));
+      setStatistic("arena.ra.bytes", (long)getArenaBytesAllocated(RA->arena));
+   }
+
+   if (file_infos->stats_file_name != NULL) {
+      fout = fopen(file_infos->stats_file_name, "w");
+      if (fout == NULL) {
+         fprintf(stderr, "WARNING : Unable to create file: %s.\n"
+               , file_infos->stats_file_name);
+      } else {
+         writeStatsReport(fout, file_infos->input_file_name, TARGET_NAME);
+         fclose(fout);
+      }
+   }
+
+   if (file_infos->trace_file_name != NULL) {
+      fout = fopen(file_infos->trace_file_name, "w");
+      if (fout == NULL) {
+         fprintf(stderr, "WARNING : Unable to create file: %s.\n"
+               , file_infos->trace_file_name);
+      } else {
+         writeStatsTrace(fout);
+         fclose(fout);
+      }
+   }
+}
+
 void shutdownCompiler(int exitStatus)
 {
 #ifndef NDEBUG
+   /* report the memory used by the intermediate representation */
+   if (program != NULL)
+      printArenaStats(program->arena, stdout);
+   if (graph != NULL)
+      printArenaStats(graph->arena, stdout);
+   if (RA != NULL)
+      printArenaStats(RA->arena, stdout);
+
    fprintf(stdout, "Finalizing the compiler data structures.. \n");
 #endif
 
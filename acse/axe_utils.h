@@ -73,6 +73,11 @@ extern int isImmediateArgumentInstrOpcode(int opcode);
  * there is no immediate or non-immediate available. */
 extern int switchOpcodeImmediateForm(int orig);
 
+/* Returns the opcode of the branch which is taken exactly when the branch
+ * `orig' is not taken. For example, BEQ is transformed to BNE, and BT is
+ * transformed to BF. */
+extern int getOppositeBranchOpcode(int orig);
+
 /* Set the list of allowed machine registers for a specific register object
  * to the specified list of register identifiers. The list must be terminated
  * by REG_INVALID or -1. */
@@ -96,6 +101,10 @@ extern int isMoveInstruction(t_axe_instruction *instr, t_axe_register **outDest,
  * from the parser when the parsing process is ended */
 extern void set_end_Program(t_program_infos *program);
 
+/* Write the compilation statistics and the trace of the compilation phases
+ * on the files requested on the command line (if any) */
+extern void writeCompilationStats();
+
 /* Once called, this function destroys all the data structures
  * associated with the compiler (program, RA, etc.). This function
  * is typically automatically called before exiting from the main
@@ -18,6 +18,10 @@
  * R0 always as a LIVE IN temporary register (i.e. variable) */
 #define CFLOW_ALWAYS_LIVEIN_R0 1
 
+/* number of iterations assumed for each loop when estimating the execution
+ * frequency of the basic blocks */
+#define LOOP_FREQUENCY_FACTOR 10.0
+
 /* max number of defs and uses for each cfg node */
 #define CFLOW_MAX_DEFS 2
 #define CFLOW_MAX_USES 3
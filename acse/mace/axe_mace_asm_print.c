@@ -53,7 +53,7 @@ void writeAssembly(t_program_infos *program, char *output_file)
    fprintf(stdout, "\n\n*******************************************\n");
    fprintf(stdout, "INITIALIZING OUTPUT FILE: %s. \n", output_file);
    fprintf(stdout, "CODE SEGMENT has a size of %d instructions \n"
-         , getLength(program->instructions));
+         , program->numInstructions);
    fprintf(stdout, "DATA SEGMENT has a size of %d elements \n"
          , getLength(program->data));
    fprintf(stdout, "NUMBER OF LABELS : %d. \n"
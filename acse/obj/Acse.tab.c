@@ -0,0 +1,2359 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "Acse.y"
+
+/*
+ * Andrea Di Biagio
+ * Politecnico di Milano, 2007
+ * Daniele Cattaneo
+ * Politecnico di Milano, 2020
+ * 
+ * Acse.y
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+/*************************************************************************
+
+                   Compiler for the language LANCE
+
+***************************************************************************/
+
+#include <stdio.h>       
+#include <stdlib.h>
+#include <assert.h>
+#include "axe_struct.h"
+#include "axe_engine.h"
+#include "symbol_table.h"
+#include "axe_target_asm_print.h"
+#include "axe_target_transform.h"
+#include "axe_errors.h"
+#include "collections.h"
+#include "axe_expressions.h"
+#include "axe_gencode.h"
+#include "axe_utils.h"
+#include "axe_array.h"
+#include "axe_cflow_graph.h"
+#include "cflow_constants.h"
+#include "axe_transform.h"
+#include "axe_reg_alloc.h"
+#include "axe_reg_coloring.h"
+#include "axe_spill_opt.h"
+#include "axe_coalesce.h"
+#include "axe_const_prop.h"
+#include "axe_ssa.h"
+#include "axe_cse.h"
+#include "axe_dce.h"
+#include "axe_loop_opt.h"
+#include "reg_alloc_constants.h"
+#include "axe_io_manager.h"
+#include "axe_stats.h"
+#ifndef NDEBUG
+#  include "axe_debug.h"
+#endif
+
+/* global variables */
+int line_num;        /* this variable will keep track of the
+                      * source code line number. Every time that a newline
+                      * is encountered while parsing the input file, this
+                      * value is increased by 1. This value is then used
+                      * for error tracking: if the parser returns an error
+                      * or a warning, this value is used in order to notify
+                      * in which line of code the error has been found */
+int num_error;       /* the number of errors found in the code. This value
+                      * is increased by 1 every time a new error is found
+                      * in the code. */
+int num_warning;     /* As for the `num_error' global variable, this one
+                      * keeps track of all the warning messages displayed */
+
+/* errorcode is defined inside "axe_engine.c" */
+extern int errorcode;   /* this variable is used to test if an error is found
+                         * while parsing the input file. It also is set
+                         * to notify if the compiler internal state is invalid.
+                         * When the parsing process is started, the value
+                         * of `errorcode' is set to the value of the macro
+                         * `AXE_OK' defined in "axe_constants.h".
+                         * As long as everything (the parsed source code and
+                         * the internal state of the compiler) is correct,
+                         * the value of `errorcode' is set to `AXE_OK'.
+                         * When an error occurs (because the input file contains
+                         * one or more syntax errors or because something went
+                         * wrong in the machine internal state), the errorcode
+                         * is set to a value that is different from `AXE_OK'. */
+extern const char *errormsg; /* When errorcode is not equal to AXE_OK,
+                         * this variable may be set to an error message to print
+                         * if desired. */
+
+extern int cflow_errorcode;   /* As for `errorcode' this value is used to
+                        * test if an error occurs during the creation process of
+                        * a control flow graph. More informations can be found
+                        * analyzing the file `axe_cflow_graph.h'. */
+                     
+/* program informations */
+t_program_infos *program;  /* The singleton instance of `program'.
+                            * An instance of `t_program_infos' holds in its
+                            * internal structure, all the useful informations
+                            * about a program. For example: the assembly
+                            * (code and directives); the symbol table;
+                            * the label manager (see axe_labels.h) etc. */
+t_cflow_Graph *graph;      /* An instance of a control flow graph. This instance
+                            * will be generated starting from `program' and will
+                            * be used during the register allocation process */
+
+t_ssa_form *ssa;           /* The SSA form of the temporary registers of
+                            * `graph', used by the optimizations */
+
+t_reg_allocator *RA;       /* Register allocator. It implements the "Linear
+                            * scan" algorithm */
+
+t_io_infos *file_infos;    /* input and output files used by the compiler */
+
+
+extern int yylex(void);
+extern void yyerror(const char*);
+
+
+#line 183 "obj/Acse.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "Acse.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_EOF_TOK = 3,                    /* EOF_TOK  */
+  YYSYMBOL_LBRACE = 4,                     /* LBRACE  */
+  YYSYMBOL_RBRACE = 5,                     /* RBRACE  */
+  YYSYMBOL_LPAR = 6,                       /* LPAR  */
+  YYSYMBOL_RPAR = 7,                       /* RPAR  */
+  YYSYMBOL_LSQUARE = 8,                    /* LSQUARE  */
+  YYSYMBOL_RSQUARE = 9,                    /* RSQUARE  */
+  YYSYMBOL_SEMI = 10,                      /* SEMI  */
+  YYSYMBOL_PLUS = 11,                      /* PLUS  */
+  YYSYMBOL_MINUS = 12,                     /* MINUS  */
+  YYSYMBOL_MUL_OP = 13,                    /* MUL_OP  */
+  YYSYMBOL_DIV_OP = 14,                    /* DIV_OP  */
+  YYSYMBOL_AND_OP = 15,                    /* AND_OP  */
+  YYSYMBOL_OR_OP = 16,                     /* OR_OP  */
+  YYSYMBOL_NOT_OP = 17,                    /* NOT_OP  */
+  YYSYMBOL_ASSIGN = 18,                    /* ASSIGN  */
+  YYSYMBOL_LT = 19,                        /* LT  */
+  YYSYMBOL_GT = 20,                        /* GT  */
+  YYSYMBOL_SHL_OP = 21,                    /* SHL_OP  */
+  YYSYMBOL_SHR_OP = 22,                    /* SHR_OP  */
+  YYSYMBOL_EQ = 23,                        /* EQ  */
+  YYSYMBOL_NOTEQ = 24,                     /* NOTEQ  */
+  YYSYMBOL_LTEQ = 25,                      /* LTEQ  */
+  YYSYMBOL_GTEQ = 26,                      /* GTEQ  */
+  YYSYMBOL_ANDAND = 27,                    /* ANDAND  */
+  YYSYMBOL_OROR = 28,                      /* OROR  */
+  YYSYMBOL_COMMA = 29,                     /* COMMA  */
+  YYSYMBOL_RETURN = 30,                    /* RETURN  */
+  YYSYMBOL_READ = 31,                      /* READ  */
+  YYSYMBOL_WRITE = 32,                     /* WRITE  */
+  YYSYMBOL_DO = 33,                        /* DO  */
+  YYSYMBOL_WHILE = 34,                     /* WHILE  */
+  YYSYMBOL_IF = 35,                        /* IF  */
+  YYSYMBOL_ELSE = 36,                      /* ELSE  */
+  YYSYMBOL_TYPE = 37,                      /* TYPE  */
+  YYSYMBOL_IDENTIFIER = 38,                /* IDENTIFIER  */
+  YYSYMBOL_NUMBER = 39,                    /* NUMBER  */
+  YYSYMBOL_YYACCEPT = 40,                  /* $accept  */
+  YYSYMBOL_program = 41,                   /* program  */
+  YYSYMBOL_var_declarations = 42,          /* var_declarations  */
+  YYSYMBOL_var_declaration = 43,           /* var_declaration  */
+  YYSYMBOL_declaration_list = 44,          /* declaration_list  */
+  YYSYMBOL_declaration = 45,               /* declaration  */
+  YYSYMBOL_code_block = 46,                /* code_block  */
+  YYSYMBOL_statements = 47,                /* statements  */
+  YYSYMBOL_statement = 48,                 /* statement  */
+  YYSYMBOL_control_statement = 49,         /* control_statement  */
+  YYSYMBOL_read_write_statement = 50,      /* read_write_statement  */
+  YYSYMBOL_assign_statement = 51,          /* assign_statement  */
+  YYSYMBOL_if_statement = 52,              /* if_statement  */
+  YYSYMBOL_53_1 = 53,                      /* $@1  */
+  YYSYMBOL_if_stmt = 54,                   /* if_stmt  */
+  YYSYMBOL_55_2 = 55,                      /* $@2  */
+  YYSYMBOL_56_3 = 56,                      /* $@3  */
+  YYSYMBOL_while_statement = 57,           /* while_statement  */
+  YYSYMBOL_58_4 = 58,                      /* $@4  */
+  YYSYMBOL_59_5 = 59,                      /* $@5  */
+  YYSYMBOL_do_while_statement = 60,        /* do_while_statement  */
+  YYSYMBOL_61_6 = 61,                      /* $@6  */
+  YYSYMBOL_return_statement = 62,          /* return_statement  */
+  YYSYMBOL_read_statement = 63,            /* read_statement  */
+  YYSYMBOL_write_statement = 64,           /* write_statement  */
+  YYSYMBOL_exp = 65,                       /* exp  */
+  YYSYMBOL_66_7 = 66,                      /* @7  */
+  YYSYMBOL_67_8 = 67                       /* @8  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   389
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  40
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  28
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  64
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  127
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   294
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   186,   186,   199,   200,   203,   210,   214,   221,   230,
+     239,   252,   253,   257,   258,   263,   264,   265,   266,   269,
+     270,   271,   272,   275,   276,   279,   289,   319,   325,   324,
+     344,   350,   343,   358,   366,   357,   402,   401,   417,   424,
+     441,   459,   460,   471,   481,   482,   483,   484,   485,   486,
+     487,   488,   489,   490,   491,   492,   493,   494,   495,   496,
+     496,   498,   498,   500,   501
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "EOF_TOK", "LBRACE",
+  "RBRACE", "LPAR", "RPAR", "LSQUARE", "RSQUARE", "SEMI", "PLUS", "MINUS",
+  "MUL_OP", "DIV_OP", "AND_OP", "OR_OP", "NOT_OP", "ASSIGN", "LT", "GT",
+  "SHL_OP", "SHR_OP", "EQ", "NOTEQ", "LTEQ", "GTEQ", "ANDAND", "OROR",
+  "COMMA", "RETURN", "READ", "WRITE", "DO", "WHILE", "IF", "ELSE", "TYPE",
+  "IDENTIFIER", "NUMBER", "$accept", "program", "var_declarations",
+  "var_declaration", "declaration_list", "declaration", "code_block",
+  "statements", "statement", "control_statement", "read_write_statement",
+  "assign_statement", "if_statement", "$@1", "if_stmt", "$@2", "$@3",
+  "while_statement", "$@4", "$@5", "do_while_statement", "$@6",
+  "return_statement", "read_statement", "write_statement", "exp", "@7",
+  "@8", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-59)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     -59,     6,    82,   -59,   -59,   -59,     7,    12,   -59,   -59,
+     -59,   -17,    -3,   -59,    21,   -59,   -59,    15,    16,   -59,
+      -8,   -59,    19,    20,   -59,   -59,    23,    10,    56,    27,
+      51,    -1,    -6,   -59,    10,    10,   -59,   -59,   -59,   -59,
+     -59,   -59,   -59,    55,    10,    10,    10,    50,   -59,   122,
+      93,    31,   -59,    10,    10,    28,    34,   -59,   -17,   230,
+     268,    56,   -59,   144,    -5,   -59,    10,   -59,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,   -59,   -59,    67,    68,   166,   188,    70,   -59,
+     -59,    62,   -59,   -59,   250,    -5,    -5,   -59,   -59,   335,
+     319,   367,   367,    57,    57,   351,   351,   367,   367,    10,
+      10,   -59,    10,   -59,   -59,   -59,    10,   -59,   303,   286,
+     210,    56,    56,   268,   -59,   -59,   -59
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       4,     0,     0,     1,    18,    38,     0,     0,    36,    33,
+      30,     0,     0,     3,     0,    14,    16,     0,     0,    19,
+      27,    20,     0,     0,    23,    24,     0,     0,     0,     0,
+       0,    10,     0,     7,     0,     0,     2,    13,    17,    15,
+      28,    21,    22,     0,     0,     0,     0,    42,    41,     0,
+       0,     0,    11,     0,     0,     0,     0,     5,     0,     0,
+      26,     0,    39,     0,    64,    44,     0,    40,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    59,    61,     0,     0,     0,     0,     0,     8,
+       6,     0,    29,    63,     0,    47,    48,    49,    50,    45,
+      46,    51,    52,    57,    58,    53,    54,    55,    56,     0,
+       0,    12,     0,    34,    31,     9,     0,    43,    60,    62,
+       0,     0,     0,    25,    37,    35,    32
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -59,   -59,   -59,   -59,   -59,    25,   -58,    35,     0,   -59,
+     -59,   -59,   -59,   -59,   -59,   -59,   -59,   -59,   -59,   -59,
+     -59,   -59,   -59,   -59,   -59,   -34,   -59,   -59
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     1,     2,    13,    32,    33,    51,    14,    52,    16,
+      17,    18,    19,    61,    20,    30,   122,    21,    29,   121,
+      22,    28,    23,    24,    25,    49,   109,   110
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      59,    60,    15,    92,    57,    34,     3,    55,    70,    71,
+      63,    64,    65,    26,    37,    35,    44,    56,    27,    86,
+      87,    31,    45,    58,    36,    38,    39,    46,    40,    41,
+      42,     4,    94,    53,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,    47,    48,
+      15,     5,     6,     7,     8,     9,    10,    54,    66,    12,
+      50,    43,    62,   125,   126,    85,     4,    88,    68,    69,
+      70,    71,   111,    89,   112,   118,   119,     4,   120,   115,
+     116,     0,   123,    90,    37,    84,     5,     6,     7,     8,
+       9,    10,     4,     0,    12,     0,     0,     5,     6,     7,
+       8,     9,    10,     4,     0,    12,     0,     0,     0,     0,
+       0,     0,     5,     6,     7,     8,     9,    10,     0,    11,
+      12,     0,     0,     5,     6,     7,     8,     9,    10,    67,
+       0,    12,     0,    68,    69,    70,    71,    72,    73,     0,
+       0,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    93,     0,     0,     0,    68,    69,    70,    71,    72,
+      73,     0,     0,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,   113,     0,     0,     0,    68,    69,    70,
+      71,    72,    73,     0,     0,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,   114,     0,     0,     0,    68,
+      69,    70,    71,    72,    73,     0,     0,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,   124,     0,     0,
+       0,    68,    69,    70,    71,    72,    73,     0,     0,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    91,
+       0,    68,    69,    70,    71,    72,    73,     0,     0,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,   117,
+       0,    68,    69,    70,    71,    72,    73,     0,     0,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    68,
+      69,    70,    71,    72,    73,     0,     0,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    68,    69,    70,
+      71,    72,    73,     0,     0,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    68,    69,    70,    71,    72,    73,
+       0,     0,    74,    75,    76,    77,    78,    79,    80,    81,
+      68,    69,    70,    71,    72,     0,     0,     0,    74,    75,
+      76,    77,    78,    79,    80,    81,    68,    69,    70,    71,
+       0,     0,     0,     0,    74,    75,    76,    77,    78,    79,
+      80,    81,    68,    69,    70,    71,     0,     0,     0,     0,
+      74,    75,    76,    77,     0,     0,    80,    81,    68,    69,
+      70,    71,     0,     0,     0,     0,     0,     0,    76,    77
+};
+
+static const yytype_int8 yycheck[] =
+{
+      34,    35,     2,    61,    10,     8,     0,     8,    13,    14,
+      44,    45,    46,     6,    14,    18,     6,    18,     6,    53,
+      54,    38,    12,    29,     3,    10,    10,    17,    36,    10,
+      10,    10,    66,     6,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    38,    39,
+      50,    30,    31,    32,    33,    34,    35,     6,     8,    38,
+       4,    38,     7,   121,   122,    34,    10,    39,    11,    12,
+      13,    14,     5,    39,     6,   109,   110,    10,   112,     9,
+      18,    -1,   116,    58,    84,    50,    30,    31,    32,    33,
+      34,    35,    10,    -1,    38,    -1,    -1,    30,    31,    32,
+      33,    34,    35,    10,    -1,    38,    -1,    -1,    -1,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    -1,    37,
+      38,    -1,    -1,    30,    31,    32,    33,    34,    35,     7,
+      -1,    38,    -1,    11,    12,    13,    14,    15,    16,    -1,
+      -1,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,     7,    -1,    -1,    -1,    11,    12,    13,    14,    15,
+      16,    -1,    -1,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,     7,    -1,    -1,    -1,    11,    12,    13,
+      14,    15,    16,    -1,    -1,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,     7,    -1,    -1,    -1,    11,
+      12,    13,    14,    15,    16,    -1,    -1,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,     7,    -1,    -1,
+      -1,    11,    12,    13,    14,    15,    16,    -1,    -1,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,     9,
+      -1,    11,    12,    13,    14,    15,    16,    -1,    -1,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,     9,
+      -1,    11,    12,    13,    14,    15,    16,    -1,    -1,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    11,
+      12,    13,    14,    15,    16,    -1,    -1,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    11,    12,    13,
+      14,    15,    16,    -1,    -1,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    11,    12,    13,    14,    15,    16,
+      -1,    -1,    19,    20,    21,    22,    23,    24,    25,    26,
+      11,    12,    13,    14,    15,    -1,    -1,    -1,    19,    20,
+      21,    22,    23,    24,    25,    26,    11,    12,    13,    14,
+      -1,    -1,    -1,    -1,    19,    20,    21,    22,    23,    24,
+      25,    26,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      19,    20,    21,    22,    -1,    -1,    25,    26,    11,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    21,    22
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    41,    42,     0,    10,    30,    31,    32,    33,    34,
+      35,    37,    38,    43,    47,    48,    49,    50,    51,    52,
+      54,    57,    60,    62,    63,    64,     6,     6,    61,    58,
+      55,    38,    44,    45,     8,    18,     3,    48,    10,    10,
+      36,    10,    10,    38,     6,    12,    17,    38,    39,    65,
+       4,    46,    48,     6,     6,     8,    18,    10,    29,    65,
+      65,    53,     7,    65,    65,    65,     8,     7,    11,    12,
+      13,    14,    15,    16,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    47,    34,    65,    65,    39,    39,
+      45,     9,    46,     7,    65,    65,    65,    65,    65,    65,
+      65,    65,    65,    65,    65,    65,    65,    65,    65,    66,
+      67,     5,     6,     7,     7,     9,    18,     9,    65,    65,
+      65,    59,    56,    65,     7,    46,    46
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    40,    41,    42,    42,    43,    44,    44,    45,    45,
+      45,    46,    46,    47,    47,    48,    48,    48,    48,    49,
+      49,    49,    49,    50,    50,    51,    51,    52,    53,    52,
+      55,    56,    54,    58,    59,    57,    61,    60,    62,    63,
+      64,    65,    65,    65,    65,    65,    65,    65,    65,    65,
+      65,    65,    65,    65,    65,    65,    65,    65,    65,    66,
+      65,    67,    65,    65,    65
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     3,     2,     0,     3,     3,     1,     3,     4,
+       1,     1,     3,     2,     1,     2,     1,     2,     1,     1,
+       1,     2,     2,     1,     1,     6,     3,     1,     0,     4,
+       0,     0,     7,     0,     0,     7,     0,     7,     1,     4,
+       4,     1,     1,     4,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     0,
+       4,     0,     4,     3,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: var_declarations statements EOF_TOK  */
+#line 187 "Acse.y"
+         {
+            /* Notify the end of the program. Once called
+             * the function `set_end_Program' - if necessary -
+             * introduces a `HALT' instruction into the
+             * list of instructions. */
+            set_end_Program(program);
+
+            /* return from yyparse() */
+            YYACCEPT;
+         }
+#line 1380 "obj/Acse.tab.c"
+    break;
+
+  case 3: /* var_declarations: var_declarations var_declaration  */
+#line 199 "Acse.y"
+                                                      { /* does nothing */ }
+#line 1386 "obj/Acse.tab.c"
+    break;
+
+  case 4: /* var_declarations: %empty  */
+#line 200 "Acse.y"
+                                                      { /* does nothing */ }
+#line 1392 "obj/Acse.tab.c"
+    break;
+
+  case 5: /* var_declaration: TYPE declaration_list SEMI  */
+#line 204 "Acse.y"
+                  {
+                     /* update the program infos by adding new variables */
+                     set_new_variables(program, (yyvsp[-2].intval), (yyvsp[-1].list));
+                  }
+#line 1401 "obj/Acse.tab.c"
+    break;
+
+  case 6: /* declaration_list: declaration_list COMMA declaration  */
+#line 211 "Acse.y"
+                  {  /* add the new declaration to the list of declarations */
+                     (yyval.list) = addElement((yyvsp[-2].list), (yyvsp[0].decl), -1);
+                  }
+#line 1409 "obj/Acse.tab.c"
+    break;
+
+  case 7: /* declaration_list: declaration  */
+#line 215 "Acse.y"
+                  {
+                     /* add the new declaration to the list of declarations */
+                     (yyval.list) = addElement(NULL, (yyvsp[0].decl), -1);
+                  }
+#line 1418 "obj/Acse.tab.c"
+    break;
+
+  case 8: /* declaration: IDENTIFIER ASSIGN NUMBER  */
+#line 222 "Acse.y"
+            {
+               /* create a new instance of t_axe_declaration */
+               (yyval.decl) = alloc_declaration((yyvsp[-2].svalue), 0, 0, (yyvsp[0].intval));
+
+               /* test if an `out of memory' occurred */
+               if ((yyval.decl) == NULL)
+                  notifyError(AXE_OUT_OF_MEMORY);
+            }
+#line 1431 "obj/Acse.tab.c"
+    break;
+
+  case 9: /* declaration: IDENTIFIER LSQUARE NUMBER RSQUARE  */
+#line 231 "Acse.y"
+            {
+               /* create a new instance of t_axe_declaration */
+               (yyval.decl) = alloc_declaration((yyvsp[-3].svalue), 1, (yyvsp[-1].intval), 0);
+
+                  /* test if an `out of memory' occurred */
+               if ((yyval.decl) == NULL)
+                  notifyError(AXE_OUT_OF_MEMORY);
+            }
+#line 1444 "obj/Acse.tab.c"
+    break;
+
+  case 10: /* declaration: IDENTIFIER  */
+#line 240 "Acse.y"
+            {
+               /* create a new instance of t_axe_declaration */
+               (yyval.decl) = alloc_declaration((yyvsp[0].svalue), 0, 0, 0);
+               
+               /* test if an `out of memory' occurred */
+               if ((yyval.decl) == NULL)
+                  notifyError(AXE_OUT_OF_MEMORY);
+            }
+#line 1457 "obj/Acse.tab.c"
+    break;
+
+  case 11: /* code_block: statement  */
+#line 252 "Acse.y"
+                                         { /* does nothing */ }
+#line 1463 "obj/Acse.tab.c"
+    break;
+
+  case 12: /* code_block: LBRACE statements RBRACE  */
+#line 253 "Acse.y"
+                                         { /* does nothing */ }
+#line 1469 "obj/Acse.tab.c"
+    break;
+
+  case 13: /* statements: statements statement  */
+#line 257 "Acse.y"
+                                         { /* does nothing */ }
+#line 1475 "obj/Acse.tab.c"
+    break;
+
+  case 14: /* statements: statement  */
+#line 258 "Acse.y"
+                                         { /* does nothing */ }
+#line 1481 "obj/Acse.tab.c"
+    break;
+
+  case 15: /* statement: assign_statement SEMI  */
+#line 263 "Acse.y"
+                                         { /* does nothing */ }
+#line 1487 "obj/Acse.tab.c"
+    break;
+
+  case 16: /* statement: control_statement  */
+#line 264 "Acse.y"
+                                         { /* does nothing */ }
+#line 1493 "obj/Acse.tab.c"
+    break;
+
+  case 17: /* statement: read_write_statement SEMI  */
+#line 265 "Acse.y"
+                                         { /* does nothing */ }
+#line 1499 "obj/Acse.tab.c"
+    break;
+
+  case 18: /* statement: SEMI  */
+#line 266 "Acse.y"
+                              { gen_nop_instruction(program); }
+#line 1505 "obj/Acse.tab.c"
+    break;
+
+  case 19: /* control_statement: if_statement  */
+#line 269 "Acse.y"
+                                         { /* does nothing */ }
+#line 1511 "obj/Acse.tab.c"
+    break;
+
+  case 20: /* control_statement: while_statement  */
+#line 270 "Acse.y"
+                                         { /* does nothing */ }
+#line 1517 "obj/Acse.tab.c"
+    break;
+
+  case 21: /* control_statement: do_while_statement SEMI  */
+#line 271 "Acse.y"
+                                         { /* does nothing */ }
+#line 1523 "obj/Acse.tab.c"
+    break;
+
+  case 22: /* control_statement: return_statement SEMI  */
+#line 272 "Acse.y"
+                                         { /* does nothing */ }
+#line 1529 "obj/Acse.tab.c"
+    break;
+
+  case 23: /* read_write_statement: read_statement  */
+#line 275 "Acse.y"
+                                       { /* does nothing */ }
+#line 1535 "obj/Acse.tab.c"
+    break;
+
+  case 24: /* read_write_statement: write_statement  */
+#line 276 "Acse.y"
+                                       { /* does nothing */ }
+#line 1541 "obj/Acse.tab.c"
+    break;
+
+  case 25: /* assign_statement: IDENTIFIER LSQUARE exp RSQUARE ASSIGN exp  */
+#line 280 "Acse.y"
+            {
+               /* Notify to `program' that the value $6
+                * have to be assigned to the location
+                * addressed by $1[$3]. Where $1 is obviously
+                * the array/pointer identifier, $3 is an expression
+                * that holds an integer value. That value will be
+                * used as an index for the array $1 */
+               storeArrayElement(program, (yyvsp[-5].svalue), (yyvsp[-3].expr), (yyvsp[0].expr));
+            }
+#line 1555 "obj/Acse.tab.c"
+    break;
+
+  case 26: /* assign_statement: IDENTIFIER ASSIGN exp  */
+#line 290 "Acse.y"
+            {
+               int location;
+
+               /* in order to assign a value to a variable, we have to
+                * know where the variable is located (i.e. in which register).
+                * the function `get_symbol_location' is used in order
+                * to retrieve the register location assigned to
+                * a given identifier.
+                * A symbol table keeps track of the location of every
+                * declared variable.
+                * `get_symbol_location' perform a query on the symbol table
+                * in order to discover the correct location of
+                * the variable with $1 as identifier */
+               
+               /* get the location of the symbol with the given ID. */
+               location = get_symbol_location(program, (yyvsp[-2].svalue), 0);
+
+               /* update the value of location */
+               if ((yyvsp[0].expr).expression_type == IMMEDIATE)
+                  gen_move_immediate(program, location, (yyvsp[0].expr).value);
+               else
+                  gen_add_instruction(program,
+                                      location,
+                                      REG_0,
+                                      (yyvsp[0].expr).value,
+                                      CG_DIRECT_ALL);
+            }
+#line 1587 "obj/Acse.tab.c"
+    break;
+
+  case 27: /* if_statement: if_stmt  */
+#line 320 "Acse.y"
+               {
+                  /* fix the `label_else' */
+                  assignLabel(program, (yyvsp[0].label));
+               }
+#line 1596 "obj/Acse.tab.c"
+    break;
+
+  case 28: /* $@1: %empty  */
+#line 325 "Acse.y"
+               {
+                  /* reserve a new label that points to the address where to
+                   * jump if `exp' is verified */
+                  (yyvsp[0].label) = newLabel(program);
+   
+                  /* exit from the if-else */
+                  gen_bt_instruction (program, (yyvsp[0].label), 0);
+   
+                  /* fix the `label_else' */
+                  assignLabel(program, (yyvsp[-1].label));
+               }
+#line 1612 "obj/Acse.tab.c"
+    break;
+
+  case 29: /* if_statement: if_stmt ELSE $@1 code_block  */
+#line 337 "Acse.y"
+               {
+                  /* fix the `label_else' */
+                  assignLabel(program, (yyvsp[-2].label));
+               }
+#line 1621 "obj/Acse.tab.c"
+    break;
+
+  case 30: /* $@2: %empty  */
+#line 344 "Acse.y"
+               {
+                  /* the label that points to the address where to jump if
+                   * `exp' is not verified */
+                  (yyvsp[0].label) = newLabel(program);
+               }
+#line 1631 "obj/Acse.tab.c"
+    break;
+
+  case 31: /* $@3: %empty  */
+#line 350 "Acse.y"
+               {
+                     /* if `exp' returns FALSE, jump to the label $1 */
+                     gen_condition_branch(program, (yyvsp[-1].expr), 0, (yyvsp[-4].label));
+               }
+#line 1640 "obj/Acse.tab.c"
+    break;
+
+  case 32: /* if_stmt: IF $@2 LPAR exp RPAR $@3 code_block  */
+#line 354 "Acse.y"
+                          { (yyval.label) = (yyvsp[-6].label); }
+#line 1646 "obj/Acse.tab.c"
+    break;
+
+  case 33: /* $@4: %empty  */
+#line 358 "Acse.y"
+                  {
+                     /* initialize the value of the non-terminal */
+                     (yyvsp[0].while_stmt) = create_while_statement();
+
+                     /* remember where the loop condition begins */
+                     (yyvsp[0].while_stmt).condition = getInstrInsertionPoint(program);
+                  }
+#line 1658 "obj/Acse.tab.c"
+    break;
+
+  case 34: /* $@5: %empty  */
+#line 366 "Acse.y"
+                  {
+                     /* reserve a new label. This new label will point
+                      * to the first instruction after the while code
+                      * block */
+                     (yyvsp[-4].while_stmt).label_end = newLabel(program);
+
+                     /* if `exp' returns FALSE, jump to the label 
+                      * $1.label_end */
+                     (yyvsp[-4].while_stmt).branch_end = gen_condition_branch
+                           (program, (yyvsp[-1].expr), 0, (yyvsp[-4].while_stmt).label_end);
+
+                     /* reserve and fix a new label for the loop body */
+                     (yyvsp[-4].while_stmt).label_body = assignNewLabel(program);
+                  }
+#line 1677 "obj/Acse.tab.c"
+    break;
+
+  case 35: /* while_statement: WHILE $@4 LPAR exp RPAR $@5 code_block  */
+#line 381 "Acse.y"
+                  {
+                     t_list *first;
+
+                     /* the condition is evaluated again at the end of the
+                      * loop, and if `exp' returns TRUE jump back to the
+                      * label $1.label_body: each iteration executes a
+                      * single branch. The condition before the loop only
+                      * skips the loop when it is not verified at all. */
+                     if ((yyvsp[-6].while_stmt).condition == NULL)
+                        first = program->instructions;
+                     else
+                        first = LNEXT((yyvsp[-6].while_stmt).condition);
+                     gen_loop_condition_copy(program, LDATA(first),
+                           (yyvsp[-6].while_stmt).branch_end, (yyvsp[-6].while_stmt).label_body);
+
+                     /* fix the label `label_end' */
+                     assignLabel(program, (yyvsp[-6].while_stmt).label_end);
+                  }
+#line 1700 "obj/Acse.tab.c"
+    break;
+
+  case 36: /* $@6: %empty  */
+#line 402 "Acse.y"
+                     {
+                        /* the label that points to the address where to jump if
+                         * `exp' is not verified */
+                        (yyvsp[0].label) = newLabel(program);
+                        
+                        /* fix the label */
+                        assignLabel(program, (yyvsp[0].label));
+                     }
+#line 1713 "obj/Acse.tab.c"
+    break;
+
+  case 37: /* do_while_statement: DO $@6 code_block WHILE LPAR exp RPAR  */
+#line 411 "Acse.y"
+                     {
+                           /* if `exp' returns TRUE, jump to the label $1 */
+                           gen_condition_branch(program, (yyvsp[-1].expr), 1, (yyvsp[-6].label));
+                     }
+#line 1722 "obj/Acse.tab.c"
+    break;
+
+  case 38: /* return_statement: RETURN  */
+#line 418 "Acse.y"
+            {
+               /* insert an HALT instruction */
+               gen_halt_instruction(program);
+            }
+#line 1731 "obj/Acse.tab.c"
+    break;
+
+  case 39: /* read_statement: READ LPAR IDENTIFIER RPAR  */
+#line 425 "Acse.y"
+            {
+               int location;
+               
+               /* read from standard input an integer value and assign
+                * it to a variable associated with the given identifier */
+               /* get the location of the symbol with the given ID */
+               
+               /* lookup the symbol table and fetch the register location
+                * associated with the IDENTIFIER $3. */
+               location = get_symbol_location(program, (yyvsp[-1].svalue), 0);
+
+               /* insert a read instruction */
+               gen_read_instruction (program, location);
+            }
+#line 1750 "obj/Acse.tab.c"
+    break;
+
+  case 40: /* write_statement: WRITE LPAR exp RPAR  */
+#line 442 "Acse.y"
+            {
+               int location;
+
+               if ((yyvsp[-1].expr).expression_type == IMMEDIATE)
+               {
+                  /* load `immediate' into a new register. Returns the new
+                   * register identifier or REG_INVALID if an error occurs */
+                  location = gen_load_immediate(program, (yyvsp[-1].expr).value);
+               }
+               else
+                  location = (yyvsp[-1].expr).value;
+
+               /* write to standard output an integer value */
+               gen_write_instruction (program, location);
+            }
+#line 1770 "obj/Acse.tab.c"
+    break;
+
+  case 41: /* exp: NUMBER  */
+#line 459 "Acse.y"
+                 { (yyval.expr) = create_expression ((yyvsp[0].intval), IMMEDIATE); }
+#line 1776 "obj/Acse.tab.c"
+    break;
+
+  case 42: /* exp: IDENTIFIER  */
+#line 460 "Acse.y"
+                 {
+                     int variableReg, expValReg;
+                     /* get the location of the symbol with the given ID */
+                     variableReg = get_symbol_location(program, (yyvsp[0].svalue), 0);
+                     /* generate code that copies the value of the variable in
+                      * a new register to freeze the expression's value */
+                     expValReg = getNewRegister(program);
+                     gen_addi_instruction(program, expValReg, variableReg, 0);
+                     /* return that register as the expression value */
+                     (yyval.expr) = create_expression(expValReg, REGISTER);
+   }
+#line 1792 "obj/Acse.tab.c"
+    break;
+
+  case 43: /* exp: IDENTIFIER LSQUARE exp RSQUARE  */
+#line 471 "Acse.y"
+                                    {
+                     int reg;
+                     
+                     /* load the value IDENTIFIER[exp]
+                      * into `arrayElement' */
+                     reg = loadArrayElement(program, (yyvsp[-3].svalue), (yyvsp[-1].expr));
+
+                     /* create a new expression */
+                     (yyval.expr) = create_expression (reg, REGISTER);
+   }
+#line 1807 "obj/Acse.tab.c"
+    break;
+
+  case 44: /* exp: NOT_OP exp  */
+#line 481 "Acse.y"
+                { (yyval.expr) = handle_logical_not(program, (yyvsp[0].expr)); }
+#line 1813 "obj/Acse.tab.c"
+    break;
+
+  case 45: /* exp: exp AND_OP exp  */
+#line 482 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), ANDB); }
+#line 1819 "obj/Acse.tab.c"
+    break;
+
+  case 46: /* exp: exp OR_OP exp  */
+#line 483 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), ORB); }
+#line 1825 "obj/Acse.tab.c"
+    break;
+
+  case 47: /* exp: exp PLUS exp  */
+#line 484 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), ADD); }
+#line 1831 "obj/Acse.tab.c"
+    break;
+
+  case 48: /* exp: exp MINUS exp  */
+#line 485 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), SUB); }
+#line 1837 "obj/Acse.tab.c"
+    break;
+
+  case 49: /* exp: exp MUL_OP exp  */
+#line 486 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), MUL); }
+#line 1843 "obj/Acse.tab.c"
+    break;
+
+  case 50: /* exp: exp DIV_OP exp  */
+#line 487 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), DIV); }
+#line 1849 "obj/Acse.tab.c"
+    break;
+
+  case 51: /* exp: exp LT exp  */
+#line 488 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _LT_); }
+#line 1855 "obj/Acse.tab.c"
+    break;
+
+  case 52: /* exp: exp GT exp  */
+#line 489 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _GT_); }
+#line 1861 "obj/Acse.tab.c"
+    break;
+
+  case 53: /* exp: exp EQ exp  */
+#line 490 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _EQ_); }
+#line 1867 "obj/Acse.tab.c"
+    break;
+
+  case 54: /* exp: exp NOTEQ exp  */
+#line 491 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _NOTEQ_); }
+#line 1873 "obj/Acse.tab.c"
+    break;
+
+  case 55: /* exp: exp LTEQ exp  */
+#line 492 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _LTEQ_); }
+#line 1879 "obj/Acse.tab.c"
+    break;
+
+  case 56: /* exp: exp GTEQ exp  */
+#line 493 "Acse.y"
+                    { (yyval.expr) = handle_binary_comparison(program, (yyvsp[-2].expr), (yyvsp[0].expr), _GTEQ_); }
+#line 1885 "obj/Acse.tab.c"
+    break;
+
+  case 57: /* exp: exp SHL_OP exp  */
+#line 494 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), SHL); }
+#line 1891 "obj/Acse.tab.c"
+    break;
+
+  case 58: /* exp: exp SHR_OP exp  */
+#line 495 "Acse.y"
+                    { (yyval.expr) = handle_bin_numeric_op(program, (yyvsp[-2].expr), (yyvsp[0].expr), SHR); }
+#line 1897 "obj/Acse.tab.c"
+    break;
+
+  case 59: /* @7: %empty  */
+#line 496 "Acse.y"
+                { (yyval.list) = getInstrInsertionPoint(program); }
+#line 1903 "obj/Acse.tab.c"
+    break;
+
+  case 60: /* exp: exp ANDAND @7 exp  */
+#line 497 "Acse.y"
+                    { (yyval.expr) = handle_logical_op(program, (yyvsp[-3].expr), (yyvsp[0].expr), (yyvsp[-1].list), ANDL); }
+#line 1909 "obj/Acse.tab.c"
+    break;
+
+  case 61: /* @8: %empty  */
+#line 498 "Acse.y"
+              { (yyval.list) = getInstrInsertionPoint(program); }
+#line 1915 "obj/Acse.tab.c"
+    break;
+
+  case 62: /* exp: exp OROR @8 exp  */
+#line 499 "Acse.y"
+                    { (yyval.expr) = handle_logical_op(program, (yyvsp[-3].expr), (yyvsp[0].expr), (yyvsp[-1].list), ORL); }
+#line 1921 "obj/Acse.tab.c"
+    break;
+
+  case 63: /* exp: LPAR exp RPAR  */
+#line 500 "Acse.y"
+                    { (yyval.expr) = (yyvsp[-1].expr); }
+#line 1927 "obj/Acse.tab.c"
+    break;
+
+  case 64: /* exp: MINUS exp  */
+#line 501 "Acse.y"
+               {
+                  if ((yyvsp[0].expr).expression_type == IMMEDIATE)
+                  {
+                     (yyval.expr) = (yyvsp[0].expr);
+                     (yyval.expr).value = - ((yyval.expr).value);
+                  }
+                  else
+                  {
+                     t_axe_expression exp_r0;
+
+                     /* create an expression for register REG_0 */
+                     exp_r0 = create_expression(REG_0, REGISTER);
+                     
+                     (yyval.expr) = handle_bin_numeric_op
+                           (program, exp_r0, (yyvsp[0].expr), SUB);
+                  }
+               }
+#line 1949 "obj/Acse.tab.c"
+    break;
+
+
+#line 1953 "obj/Acse.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 520 "Acse.y"
+
+/*=========================================================================
+                                  MAIN
+=========================================================================*/
+int main (int argc, char **argv)
+{
+   /* initialize all the compiler data structures and global variables */
+   init_compiler(argc, argv);
+   
+   /* start the parsing procedure */
+   beginPhase("parsing");
+   yyparse();
+   endPhase();
+   setStatistic("instructions.parsed", program->numInstructions);
+   setStatistic("temporaries", program->current_register);
+   
+#ifndef NDEBUG
+   fprintf(stdout, "Parsing process completed. \n");
+   printProgramInfos(program, file_infos->frontend_output);
+#endif
+
+   /* test if the parsing process completed succesfully */
+   checkConsistency();
+
+   /* do not attach a line number to the instructions generated by the
+    * transformations that follow. */
+   line_num = -1;
+
+   /* propagate the constants and remove the code which is never
+    * executed, before the code is specialized for the target */
+   beginPhase("constant propagation");
+   graph = createFlowGraph(program->instructions);
+   checkConsistency();
+   propagateConstants(program, graph);
+   endPhase();
+
+   /* the optimizations of the temporaries work on the SSA form */
+   beginPhase("ssa construction");
+   ssa = buildSSAForm(program, graph);
+   endPhase();
+   setStatistic("ssa.phis", ssa->numPhis);
+   setStatistic("ssa.renamed", ssa->numRenamed);
+
+   /* reuse the values already computed inside each basic block */
+   beginPhase("common subexpressions");
+   eliminateCommonSubexpressions(ssa);
+   endPhase();
+
+   beginPhase("ssa destruction");
+   destroySSAForm(ssa);
+   ssa = NULL;
+   endPhase();
+
+   /* compute the values which do not change inside a loop only once,
+    * before entering it */
+   beginPhase("loop invariants");
+   hoistLoopInvariants(program, graph);
+   endPhase();
+
+   /* advance the addresses of the array elements together with the loop
+    * indices, instead of computing them from scratch */
+   beginPhase("induction variables");
+   reduceInductionVariables(program, graph);
+   endPhase();
+
+   beginPhase("dead code elimination");
+   eliminateDeadCode(graph);
+   updateProgramInfos(program, graph);
+   finalizeGraph(graph);
+   graph = NULL;
+   endPhase();
+   setStatistic("instructions.optimized", program->numInstructions);
+
+   beginPhase("target transformations");
+   doTargetSpecificTransformations(program);
+   endPhase();
+   setStatistic("instructions.transformed", program->numInstructions);
+   
+#ifndef NDEBUG
+   fprintf(stdout, "Creating a control flow graph. \n");
+#endif
+
+   /* create the control flow graph */
+   beginPhase("control flow graph");
+   graph = createFlowGraph(program->instructions);
+   endPhase();
+   checkConsistency();
+   setStatistic("cfg.blocks", getLength(graph->blocks));
+   setStatistic("cfg.variables", graph->numVariables);
+
+   /* remove the instructions made dead by the target transformations */
+   beginPhase("dead code elimination");
+   eliminateDeadCode(graph);
+   endPhase();
+   checkConsistency();
+
+#ifndef NDEBUG
+   assert(program != NULL);
+   assert(program->sy_table != NULL);
+   assert(file_infos != NULL);
+   assert(file_infos->syTable_output != NULL);
+   printSymbolTable(program->sy_table, file_infos->syTable_output);
+   printGraphInfos(graph, file_infos->cfg_1, 0);
+      
+   fprintf(stdout, "Updating the basic blocks. \n");
+#endif
+      
+   /* update the control flow graph by inserting load and stores inside
+   * every basic block */
+   beginPhase("loads and stores");
+   graph = insertLoadAndStoreInstr(program, graph);
+   endPhase();
+
+#ifndef NDEBUG
+   fprintf(stdout, "Executing a liveness analysis on the intermediate code \n");
+#endif
+   beginPhase("liveness");
+   performLivenessAnalysis(graph);
+   endPhase();
+   checkConsistency();
+   setStatistic("liveness.iterations", graph->livenessIterations);
+
+   /* find the loops, to estimate how often each block is executed */
+   beginPhase("loops");
+   computeLoopDepths(graph);
+   endPhase();
+   checkConsistency();
+   setStatistic("cfg.loops", graph->numLoops);
+
+   /* merge the variables related by a copy, and remove the copies */
+   beginPhase("copy coalescing");
+   coalesceCopies(graph);
+   endPhase();
+   checkConsistency();
+
+#ifndef NDEBUG
+   printGraphInfos(graph, file_infos->cfg_2, 1);
+#endif
+      
+#ifndef NDEBUG
+   fprintf(stdout, "Starting the register allocation process. \n");
+#endif
+   /* initialize the register allocator by using the control flow
+    * informations stored into the control flow graph */
+   beginPhase("live intervals");
+   RA = initializeRegAlloc(graph);
+   endPhase();
+   setStatistic("ra.intervals", VSIZE(RA->live_intervals));
+      
+   /* execute the register allocation algorithm */
+   if (file_infos->reg_alloc_algorithm == RA_GRAPH_COLORING) {
+      beginPhase("graph coloring");
+      execute_graph_coloring(RA, graph);
+   } else {
+      beginPhase("linear scan");
+      execute_linear_scan(RA);
+   }
+   endPhase();
+   setStatistic("ra.spills", countSpilledVariables(RA));
+   setStatistic("ra.splits", RA->numSplits);
+   setStatistic("ra.split_variables", VSIZE(RA->splitVariables));
+      
+#ifndef NDEBUG
+   printRegAllocInfos(RA, file_infos->reg_alloc_output);
+#endif
+
+#ifndef NDEBUG
+   fprintf(stdout, "Updating the control flow informations. \n");
+#endif
+   /* apply changes to the program informations by using the informations
+   * of the register allocation process */
+   beginPhase("materialization");
+   materializeRegisterAllocation(program, graph, RA);
+   endPhase();
+
+#ifndef NDEBUG
+   fprintf(stdout, "Optimizing the spill code. \n");
+#endif
+   /* remove the redundant loads and stores of the variables kept in memory */
+   beginPhase("spill code optimization");
+   optimizeSpillCode(program, graph);
+   updateProgramInfos(program, graph);
+   endPhase();
+   setStatistic("instructions.final", program->numInstructions);
+
+#ifndef NDEBUG
+   fprintf(stdout, "Writing the assembly file... \n");
+#endif
+   beginPhase("assembly output");
+   writeAssembly(program, file_infos->output_file_name);
+   endPhase();
+      
+#ifndef NDEBUG
+   fprintf(stdout, "Assembly written on file \"%s\".\n", file_infos->output_file_name);
+#endif
+   
+   /* write the statistics requested on the command line */
+   writeCompilationStats();
+
+   /* shutdown the compiler */
+   shutdownCompiler(0);
+
+   return 0;
+}
+
+/*=========================================================================
+                                 YYERROR
+=========================================================================*/
+void yyerror(const char* msg)
+{
+   errorcode = AXE_SYNTAX_ERROR;
+   free((void *)errormsg);
+   errormsg = strdup(msg);
+}
@@ -0,0 +1,127 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_OBJ_ACSE_TAB_H_INCLUDED
+# define YY_YY_OBJ_ACSE_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    EOF_TOK = 258,                 /* EOF_TOK  */
+    LBRACE = 259,                  /* LBRACE  */
+    RBRACE = 260,                  /* RBRACE  */
+    LPAR = 261,                    /* LPAR  */
+    RPAR = 262,                    /* RPAR  */
+    LSQUARE = 263,                 /* LSQUARE  */
+    RSQUARE = 264,                 /* RSQUARE  */
+    SEMI = 265,                    /* SEMI  */
+    PLUS = 266,                    /* PLUS  */
+    MINUS = 267,                   /* MINUS  */
+    MUL_OP = 268,                  /* MUL_OP  */
+    DIV_OP = 269,                  /* DIV_OP  */
+    AND_OP = 270,                  /* AND_OP  */
+    OR_OP = 271,                   /* OR_OP  */
+    NOT_OP = 272,                  /* NOT_OP  */
+    ASSIGN = 273,                  /* ASSIGN  */
+    LT = 274,                      /* LT  */
+    GT = 275,                      /* GT  */
+    SHL_OP = 276,                  /* SHL_OP  */
+    SHR_OP = 277,                  /* SHR_OP  */
+    EQ = 278,                      /* EQ  */
+    NOTEQ = 279,                   /* NOTEQ  */
+    LTEQ = 280,                    /* LTEQ  */
+    GTEQ = 281,                    /* GTEQ  */
+    ANDAND = 282,                  /* ANDAND  */
+    OROR = 283,                    /* OROR  */
+    COMMA = 284,                   /* COMMA  */
+    RETURN = 285,                  /* RETURN  */
+    READ = 286,                    /* READ  */
+    WRITE = 287,                   /* WRITE  */
+    DO = 288,                      /* DO  */
+    WHILE = 289,                   /* WHILE  */
+    IF = 290,                      /* IF  */
+    ELSE = 291,                    /* ELSE  */
+    TYPE = 292,                    /* TYPE  */
+    IDENTIFIER = 293,              /* IDENTIFIER  */
+    NUMBER = 294                   /* NUMBER  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 118 "Acse.y"
+            
+   int intval;
+   char *svalue;
+   t_axe_expression expr;
+   t_axe_declaration *decl;
+   t_list *list;
+   t_axe_label *label;
+   t_while_statement while_stmt;
+
+#line 113 "obj/Acse.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_OBJ_ACSE_TAB_H_INCLUDED  */
@@ -0,0 +1 @@
+const char *axe_version = "1.2.3-multitarget";
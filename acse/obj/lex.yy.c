@@ -0,0 +1,93 @@
+/* hand-written stand-in for flex output of Acse.lex (local testing only) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "axe_struct.h"
+#include "collections.h"
+#include "Acse.tab.h"
+#include "axe_constants.h"
+#ifdef __has_include
+#if __has_include("axe_strings.h")
+#include "axe_engine.h"
+#define HAVE_INTERN 1
+extern t_program_infos *program;
+#endif
+#endif
+extern int line_num;
+extern int num_error;
+extern void yyerror(const char*);
+FILE *yyin = NULL;
+char yytext[4096];
+static int hget(void) { return fgetc(yyin ? yyin : stdin); }
+static void hunget(int c) { if (c != EOF) ungetc(c, yyin ? yyin : stdin); }
+int yylex(void)
+{
+   int c;
+again:
+   c = hget();
+   if (c == EOF) return EOF_TOK;
+   if (c == '\n') { ++line_num; goto again; }
+   if (c == '\r') { int d = hget(); if (d == '\n') { ++line_num; goto again; } hunget(d); goto bad; }
+   if (c == ' ' || c == '\t' || c == '\f' || c == '\v') goto again;
+   if (c == '/') {
+      int d = hget();
+      if (d == '/') { while ((c = hget()) != EOF && c != '\n'); hunget(c); goto again; }
+      if (d == '*') {
+         int prev = 0;
+         while ((c = hget()) != EOF) {
+            if (c == '\n') ++line_num;
+            if (prev == '*' && c == '/') goto again;
+            prev = c;
+         }
+         return EOF_TOK; /* flex: EOF in comment state -> yyterminate (0) */
+      }
+      hunget(d); return DIV_OP;
+   }
+   if (isalpha(c) || c == '_') {
+      int n = 0;
+      while (isalnum(c) || c == '_') { yytext[n++] = c; c = hget(); }
+      hunget(c); yytext[n] = 0;
+      if (!strcmp(yytext, "do")) return DO;
+      if (!strcmp(yytext, "else")) return ELSE;
+      if (!strcmp(yytext, "if")) return IF;
+      if (!strcmp(yytext, "int")) { yylval.intval = INTEGER_TYPE; return TYPE; }
+      if (!strcmp(yytext, "while")) return WHILE;
+      if (!strcmp(yytext, "return")) return RETURN;
+      if (!strcmp(yytext, "read")) return READ;
+      if (!strcmp(yytext, "write")) return WRITE;
+#ifdef HAVE_INTERN
+      yylval.svalue = internString(program->strings, yytext);
+#else
+      yylval.svalue = strdup(yytext);
+#endif
+      return IDENTIFIER;
+   }
+   if (isdigit(c)) {
+      int n = 0;
+      while (isdigit(c)) { yytext[n++] = c; c = hget(); }
+      hunget(c); yytext[n] = 0;
+      yylval.intval = atoi(yytext);
+      return NUMBER;
+   }
+   {
+      int d;
+      switch (c) {
+      case '{': return LBRACE; case '}': return RBRACE;
+      case '[': return LSQUARE; case ']': return RSQUARE;
+      case '(': return LPAR; case ')': return RPAR;
+      case ';': return SEMI; case '+': return PLUS; case '-': return MINUS;
+      case '*': return MUL_OP; case ',': return COMMA;
+      case '&': d = hget(); if (d == '&') return ANDAND; hunget(d); return AND_OP;
+      case '|': d = hget(); if (d == '|') return OROR; hunget(d); return OR_OP;
+      case '!': d = hget(); if (d == '=') return NOTEQ; hunget(d); return NOT_OP;
+      case '=': d = hget(); if (d == '=') return EQ; hunget(d); return ASSIGN;
+      case '<': d = hget(); if (d == '=') return LTEQ; if (d == '<') return SHL_OP; hunget(d); return LT;
+      case '>': d = hget(); if (d == '=') return GTEQ; if (d == '>') return SHR_OP; hunget(d); return GT;
+      }
+   }
+bad:
+   yyerror("Error: unexpected token");
+   num_error++;
+   return -1;
+}
@@ -15,6 +15,18 @@
 #define RA_REGISTER_INVALID 0
 #define RA_EXCLUDED_VARIABLE 0
 
+/* register sets are bitmasks, thus at most 32 registers can be handled */
+#define RA_MAX_REGISTERS 32
+#define RA_REGISTER_MASK(reg) (1U << (reg))
+
+/* the cost of spilling a variable which can be rematerialized, relative
+ * to the cost of spilling it to memory */
+#define RA_REMAT_COST_FACTOR 0.5
+
+/* register allocation algorithms */
+#define RA_LINEAR_SCAN 0
+#define RA_GRAPH_COLORING 1
+
 /* errorcodes */
 #define RA_OK 0
 #define RA_INVALID_ALLOCATOR 1
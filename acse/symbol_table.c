@@ -8,21 +8,45 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "symbol_table.h"
 #include "axe_debug.h"
-#include "collections.h"
 #include "axe_labels.h"
 
+/* initial number of slots of the hash table. Must be a power of two. */
+#define SY_INITIAL_BUCKETS 64
+
+/* initial number of entries of the reverse location map */
+#define SY_INITIAL_LOCATIONS 32
+
+/* a slot of the open addressing hash table. An empty slot has a NULL
+ * `symbol' field. The hash of the key is cached to avoid calling `strcmp'
+ * on most of the collisions. */
+typedef struct
+{
+   unsigned int hash;
+   t_symbol *symbol;
+}t_symbol_slot;
+
 /* symbol table */
 
 struct t_symbol_table
 {
-   t_list *symbols;
+   t_symbol **symbols;     /* the symbols in order of definition */
+   int numSymbols;         /* number of symbols in the table */
+   int maxSymbols;         /* allocated size of the `symbols' array */
+   t_symbol_slot *buckets; /* hash table keyed on the symbol identifier */
+   int numBuckets;         /* size of `buckets' (a power of two) */
+   t_symbol **locations;   /* reverse map from register locations to symbols */
+   int numLocations;       /* allocated size of the `locations' array */
 };
 
-static int symCompare (void *symA, void *symB);
-static int regCompare (void *symA, void *symB);
+static unsigned int hashID(const char *ID);
+static t_symbol_slot * findSlot(t_symbol_slot *buckets
+      , int numBuckets, const char *ID, unsigned int hash);
+static int growBuckets(t_symbol_table *table);
+static int growLocations(t_symbol_table *table, int location);
 static t_symbol * getSymFromID(t_symbol_table *table, char *ID);
 static t_symbol * getSymFromLocation(t_symbol_table *table, int location);
 
@@ -123,9 +147,26 @@ int setLocation(t_symbol_table *table, char *ID, int reg)
    if (found == NULL)
       return SY_UNDEFINED;
 
+   /* make sure the reverse map can hold the new location */
+   if (reg >= table->numLocations)
+   {
+      if (growLocations(table, reg) != SY_TABLE_OK)
+         return SY_MEMALLOC_ERROR;
+   }
+
+   /* unbind the previous location of the symbol */
+   if (found->reg_location >= 0
+         && table->locations[found->reg_location] == found)
+      table->locations[found->reg_location] = NULL;
+
    /* set the `reg_location' field for the found symbol */
    found->reg_location = reg;
 
+   /* update the reverse map. Each register location is bound to at most
+    * one symbol. */
+   if (reg >= 0)
+      table->locations[reg] = found;
+
    return SY_TABLE_OK;
 }
 
@@ -141,6 +182,22 @@ t_symbol_table * initialize_sy_table()
 
    /* initialize the internal data associated with the symbol table */
    result->symbols = NULL;
+   result->numSymbols = 0;
+   result->maxSymbols = 0;
+   result->buckets = (t_symbol_slot *) calloc(
+         SY_INITIAL_BUCKETS, sizeof(t_symbol_slot));
+   result->numBuckets = SY_INITIAL_BUCKETS;
+   result->locations = (t_symbol **) calloc(
+         SY_INITIAL_LOCATIONS, sizeof(t_symbol *));
+   result->numLocations = SY_INITIAL_LOCATIONS;
+
+   if (result->buckets == NULL || result->locations == NULL)
+   {
+      free(result->buckets);
+      free(result->locations);
+      free(result);
+      return NULL;
+   }
 
    /* return the symbol table */
    return result;
@@ -148,28 +205,19 @@ t_symbol_table * initialize_sy_table()
 
 int finalize_sy_table(t_symbol_table *table)
 {
-   t_list   *current_symbol;
+   int i;
    
    if (table == NULL)
       return SY_TABLE_NOT_INITIALIZED;
 
-   /* initialize the value of current_symbol */
-   current_symbol = table->symbols;
-
-   while (current_symbol != NULL)
-   {
-      /* free the symbol */
-      free(LDATA(current_symbol));
-
-      /* select the new symbol */
-      current_symbol = LNEXT(current_symbol);
-   }
+   /* free the symbols */
+   for (i = 0; i < table->numSymbols; i++)
+      free(table->symbols[i]);
    
    /* deallocate memory for the sy_table */
-   freeList(table->symbols);
-
-   /* update the global variable sy_table */
-   table->symbols = NULL;
+   free(table->symbols);
+   free(table->buckets);
+   free(table->locations);
 
    /* free the memory slot associated with the symbol table */
    free(table);
@@ -177,75 +225,136 @@ int finalize_sy_table(t_symbol_table *table)
    return SY_TABLE_OK;
 }
 
-static int regCompare (void *symA, void *symB)
+/* FNV-1a hash of a symbol identifier */
+static unsigned int hashID(const char *ID)
 {
-   t_symbol *sA;
-   t_symbol *sB;
-         
-   /* preconditions */
-   if (symA == NULL)
+   unsigned int hash = 2166136261u;
+
+   while (*ID != '\0')
    {
-      if (symB == NULL)
-         return 1;
-      return 0;
+      hash ^= (unsigned char) *ID;
+      hash *= 16777619u;
+      ID++;
    }
 
-   if (symB == NULL)
-      return 0;
+   return hash;
+}
+
+/* Returns the slot of `buckets' which contains the symbol with identifier
+ * `ID', or the empty slot where such a symbol would be inserted. Collisions
+ * are resolved by linear probing. `numBuckets' must be a power of two and
+ * the table must contain at least one empty slot. */
+static t_symbol_slot * findSlot(t_symbol_slot *buckets
+      , int numBuckets, const char *ID, unsigned int hash)
+{
+   unsigned int mask = (unsigned int) numBuckets - 1;
+   unsigned int i = hash & mask;
 
-   sA = (t_symbol *) symA;
-   sB = (t_symbol *) symB;
+   while (buckets[i].symbol != NULL)
+   {
+      if (buckets[i].hash == hash
+            && (buckets[i].symbol->ID == ID
+               || !strcmp(buckets[i].symbol->ID, ID)))
+         return &buckets[i];
+      i = (i + 1) & mask;
+   }
 
-   return (sA->reg_location == sB->reg_location);
+   return &buckets[i];
 }
 
-/* Function used when a compare is needed between two labels */
-int symCompare (void *symA, void *symB)
+/* Doubles the size of the hash table, rehashing all the symbols */
+static int growBuckets(t_symbol_table *table)
 {
-   t_symbol *sA;
-   t_symbol *sB;
-         
-   /* preconditions */
-   if (symA == NULL)
+   t_symbol_slot *newBuckets;
+   int newNumBuckets;
+   int i;
+
+   newNumBuckets = table->numBuckets * 2;
+   newBuckets = (t_symbol_slot *) calloc(newNumBuckets, sizeof(t_symbol_slot));
+   if (newBuckets == NULL)
+      return SY_MEMALLOC_ERROR;
+
+   for (i = 0; i < table->numBuckets; i++)
    {
-      if (symB == NULL)
-         return 1;
-      return 0;
+      t_symbol_slot *slot;
+
+      if (table->buckets[i].symbol == NULL)
+         continue;
+      
+      slot = findSlot(newBuckets, newNumBuckets
+            , table->buckets[i].symbol->ID, table->buckets[i].hash);
+      *slot = table->buckets[i];
    }
 
-   if (symB == NULL)
-      return 0;
+   free(table->buckets);
+   table->buckets = newBuckets;
+   table->numBuckets = newNumBuckets;
+   return SY_TABLE_OK;
+}
+
+/* Enlarges the reverse location map so that it contains `location' */
+static int growLocations(t_symbol_table *table, int location)
+{
+   t_symbol **newLocations;
+   int newNumLocations;
 
-   sA = (t_symbol *) symA;
-   sB = (t_symbol *) symB;
+   newNumLocations = table->numLocations;
+   while (newNumLocations <= location)
+      newNumLocations *= 2;
 
-   assert(sA->ID != NULL);
-   assert(sB->ID != NULL);
+   newLocations = (t_symbol **) realloc(table->locations
+         , newNumLocations * sizeof(t_symbol *));
+   if (newLocations == NULL)
+      return SY_MEMALLOC_ERROR;
 
-   return (!strcmp(sA->ID, sB->ID));
+   memset(newLocations + table->numLocations, 0
+         , (newNumLocations - table->numLocations) * sizeof(t_symbol *));
+   table->locations = newLocations;
+   table->numLocations = newNumLocations;
+   return SY_TABLE_OK;
 }
 
 /* put a symbol into the symbol table */
 int putSym(t_symbol_table *table, char *ID, int type)
 {
-   t_symbol pattern;
    t_symbol *new_symbol;
+   t_symbol_slot *slot;
+   unsigned int hash;
    
    if (table == NULL)
       return SY_TABLE_NOT_INITIALIZED;
 
-   if (table->symbols == NULL)
+   if (ID == NULL)
+      return SY_INVALID_REQUEST;
+
+   /* verify if the symbol is valid */
+   hash = hashID(ID);
+   slot = findSlot(table->buckets, table->numBuckets, ID, hash);
+   if (slot->symbol != NULL)
    {
-      /* initialize pattern */
-      pattern.ID = ID;
+      /* symbol already defined */
+      return SY_ALREADY_DEFINED;
+   }
 
-      /* verify if the symbol is valid */
-      if (  CustomfindElement(table->symbols
-                  , &pattern, symCompare) != NULL)
-      {
-         /* symbol already defined */
-         return SY_ALREADY_DEFINED;
-      }
+   /* keep the load factor of the hash table below 1/2 */
+   if ((table->numSymbols + 1) * 2 > table->numBuckets)
+   {
+      if (growBuckets(table) != SY_TABLE_OK)
+         return SY_MEMALLOC_ERROR;
+      slot = findSlot(table->buckets, table->numBuckets, ID, hash);
+   }
+
+   /* make room for the new symbol in the ordered array of symbols */
+   if (table->numSymbols == table->maxSymbols)
+   {
+      int newMaxSymbols = table->maxSymbols ? table->maxSymbols * 2 : 16;
+      t_symbol **newSymbols = (t_symbol **) realloc(table->symbols
+            , newMaxSymbols * sizeof(t_symbol *));
+
+      if (newSymbols == NULL)
+         return SY_MEMALLOC_ERROR;
+      table->symbols = newSymbols;
+      table->maxSymbols = newMaxSymbols;
    }
    
    /* add the new symbol to the symbol table */
@@ -264,64 +373,35 @@ int putSym(t_symbol_table *table, char *ID, int type)
    new_symbol->reg_location = SY_LOCATION_UNSPECIFIED;
 
    /* add the new symbol to the symbol table */
-   table->symbols = addElement(table->symbols, new_symbol, -1);
+   slot->hash = hash;
+   slot->symbol = new_symbol;
+   table->symbols[table->numSymbols++] = new_symbol;
 
    return SY_TABLE_OK;
 }
 
 t_symbol * getSymFromLocation(t_symbol_table *table, int location)
 {
-   t_symbol pattern;
-   t_symbol *symbol_found;
-   t_list   *l_element;
-   
    /* preconditions */
    if (table == NULL)
       return NULL;
 
-   /* initialize pattern */
-   pattern.reg_location = location;
-
-   /* search for a symbol with the given ID */
-   l_element = CustomfindElement(table->symbols, &pattern, regCompare);
-
-   /* postconditions */
-   if (l_element == NULL)
+   if (location < 0 || location >= table->numLocations)
       return NULL;
 
-   /* retrieve the symbol information */
-   symbol_found = (t_symbol *) LDATA(l_element);
-
    /* return the symbol */
-   return symbol_found;
+   return table->locations[location];
 }
 
 /* retrieve informations about a symbol */
 t_symbol * getSymFromID(t_symbol_table *table, char *ID)
 {
-   t_symbol pattern;
-   t_symbol *symbol_found;
-   t_list   *l_element;
-   
    /* preconditions */
    if (table == NULL)
       return NULL;
 
-   /* initialize pattern */
-   pattern.ID = ID;
-
    /* search for a symbol with the given ID */
-   l_element = CustomfindElement(table->symbols, &pattern, symCompare);
-
-   /* postconditions */
-   if (l_element == NULL)
-      return NULL;
-
-   /* retrieve the symbol information */
-   symbol_found = (t_symbol *) LDATA(l_element);
-
-   /* return the symbol */
-   return symbol_found;
+   return findSlot(table->buckets, table->numBuckets, ID, hashID(ID))->symbol;
 }
 
 #ifndef NDEBUG
@@ -330,8 +410,8 @@ t_symbol * getSymFromID(t_symbol_table *table, char *ID)
  * the following way: <ID> -- <TYPE> -- <REGISTER> */
 void printSymbolTable(t_symbol_table *table, FILE *fout)
 {
-   t_list *current_element;
    t_symbol *current_symbol;
+   int i;
    
    /* preconditions */
    if (table == NULL)
@@ -343,16 +423,12 @@ void printSymbolTable(t_symbol_table *table, FILE *fout)
    fprintf(fout, "--------------------------------\n");
    fprintf(fout, "          SYMBOL TABLE\n");
    fprintf(fout, "--------------------------------\n");
-   fprintf(fout, "NUMBER OF SYMBOLS : %d \n"
-            , getLength(table->symbols));
+   fprintf(fout, "NUMBER OF SYMBOLS : %d \n", table->numSymbols);
    fprintf(fout, "--------------------------------\n\n");
 
-   /* initialize the value of current_symbol */
-   current_element = table->symbols;
-
-   while (current_element != NULL)
+   for (i = 0; i < table->numSymbols; i++)
    {
-      current_symbol = (t_symbol *) LDATA(current_element);
+      current_symbol = table->symbols[i];
 
       fprintf(fout, "ID : %s\t;; TYPE : %s\t;;", current_symbol->ID
          , dataTypeToString(current_symbol->type) );
@@ -360,9 +436,6 @@ void printSymbolTable(t_symbol_table *table, FILE *fout)
          fprintf(fout, " LOCATION : [UNSPECIFIED] \n");
       else
          fprintf(fout, " LOCATION : R%d \n", current_symbol->reg_location);
-      
-      /* select the new symbol */
-      current_element = LNEXT(current_element);
    }
 }
 #endif
@@ -15,9 +15,6 @@
 #include "asm_engine.h"
 #include "asm_debug.h"
 
-/* Function used when a compare is needed between two labels */
-static int compareLabels (void *labelA, void *labelB);
-
 /* Function used to produce the header of an object file.
 * This function returns ASM_OK if everything went good*/
 static int print_header_infos(FILE *fp);
@@ -44,80 +41,74 @@ static int getBinaryOpcode(int opcode);
 * that is stored inside the macro block of code plus data  */
 static int getInstructionOrDataIndex(t_translation_infos *infos, void *target);
 
+/* This function computes the index of every instruction and block of data
+* and stores it in `infos->offsets' */
+static void computeOffsets(t_translation_infos *infos);
+
 /* this function is directly called from `finalizeStructures'. The main
  * goal of this function is: free all the memory associated with the
  * labels */
-static void finalizeLabels(t_list *labels);
+static void finalizeLabels(t_hashmap *labels);
 
 
-/* This function returns the index of the given instruction/data
-* that is stored inside the macro block of code plus data  */
-int getInstructionOrDataIndex(t_translation_infos *infos
-      , void *target)
+/* This function computes the index of every instruction and block of data
+* and stores it in `infos->offsets' */
+void computeOffsets(t_translation_infos *infos)
 {
-   t_list   *target_element;
+   t_asm_data *current_data;
+   int counter;
    int position;
 
-   /* the list is empty */
-   if (infos->code == NULL)
-      return ASM_INVALID_MEMORY_OFFSET;
-   
-   /* preconditions: infos and inst MUST NOT be NULL references! */
-   target_element = findElement(infos->code, target);
-   if (target_element == NULL)
-      return ASM_INVALID_MEMORY_OFFSET;
-
-   /* retrieve the position of the statement */
-   position = getPosition(infos->code, target_element);
-
-   /* the code list doesn't hold target_element */
-   if (position == -1)
-      return ASM_INVALID_MEMORY_OFFSET;
+   clearHashMap(infos->offsets);
 
-   /* return the displacement in bytes from the beginning
-    * of the instruction segment */
-   if (position < infos->codesize)
-      return ( ((position * ASM_INSTRUCTION_SIZE) / ASM_ALIGMENT_SIZE)
+   /* the displacement in bytes from the beginning of the instruction
+    * segment of each instruction */
+   for (position = 0; position < VSIZE(infos->code); position++)
+   {
+      counter = ( ((position * ASM_INSTRUCTION_SIZE) / ASM_ALIGMENT_SIZE)
             + ((((position *ASM_INSTRUCTION_SIZE)
                      % ASM_ALIGMENT_SIZE) > 0)? 1:0) );
-   else
-   {
-      t_list *current_elem;
-      t_asm_data *current_data;
-      
-      int counter = 0;
+      putInHashMap(infos->offsets, VDATA(infos->code, position)
+            , INTDATA(counter));
+   }
 
-      current_elem = getElementAt(infos->code, infos->codesize);
-      assert(current_elem != NULL);
+   /* the data segment follows the instruction segment */
+   counter = ( ((VSIZE(infos->code) * ASM_INSTRUCTION_SIZE) / ASM_ALIGMENT_SIZE)
+         + ((((VSIZE(infos->code) * ASM_INSTRUCTION_SIZE)
+                  % ASM_ALIGMENT_SIZE) > 0)? 1:0) );
 
-      counter = ( ((infos->codesize * ASM_INSTRUCTION_SIZE) / ASM_ALIGMENT_SIZE)
-            + ((((infos->codesize * ASM_INSTRUCTION_SIZE)
-                     % ASM_ALIGMENT_SIZE) > 0)? 1:0) );
+   for (position = 0; position < VSIZE(infos->data); position++)
+   {
+      current_data = VDATA(infos->data, position);
+      putInHashMap(infos->offsets, current_data, INTDATA(counter));
 
-      while (current_elem != NULL && LDATA(current_elem) != target)
+      if (current_data->dataType == ASM_WORD)
       {
-         current_data = LDATA(current_elem);
-
-         if (current_data->dataType == ASM_WORD)
-         {
-            counter += (ASM_WORD_SIZE / ASM_ALIGMENT_SIZE)
-                  + (((ASM_WORD_SIZE % ASM_ALIGMENT_SIZE) > 0)? 1 : 0);
-         }
-         else if (current_data->dataType == ASM_SPACE)
-         {
-            /* precondition always verified */
-            assert(current_data->value > 0);
-            counter += (current_data->value * ASM_WORD_SIZE / ASM_ALIGMENT_SIZE)
-                  + ((((current_data->value * ASM_WORD_SIZE) % ASM_ALIGMENT_SIZE) > 0)? 1: 0);
-         }
-
-         current_elem = LNEXT(current_elem);
+         counter += (ASM_WORD_SIZE / ASM_ALIGMENT_SIZE)
+               + (((ASM_WORD_SIZE % ASM_ALIGMENT_SIZE) > 0)? 1 : 0);
+      }
+      else if (current_data->dataType == ASM_SPACE)
+      {
+         /* precondition always verified */
+         assert(current_data->value > 0);
+         counter += (current_data->value * ASM_WORD_SIZE / ASM_ALIGMENT_SIZE)
+               + ((((current_data->value * ASM_WORD_SIZE) % ASM_ALIGMENT_SIZE) > 0)? 1: 0);
       }
-
-      return counter;
    }
+}
+
+/* This function returns the index of the given instruction/data
+* that is stored inside the macro block of code plus data  */
+int getInstructionOrDataIndex(t_translation_infos *infos
+      , void *target)
+{
+   void *offset;
+
+   /* preconditions: the offsets have been computed by `computeOffsets' */
+   if (!getFromHashMap(infos->offsets, target, &offset))
+      return ASM_INVALID_MEMORY_OFFSET;
 
-   return -1;
+   return (int)(intptr_t)offset;
 }
 
 /* this function translates a single block of data found into a
@@ -286,7 +277,7 @@ int translateInstruction(t_translation_infos *infos
             return ASM_INVALID_LABEL_FOUND;
          
          /* postcondition that MUST be always verified */
-         assert(destinationIndex < infos->codesize);
+         assert(destinationIndex < VSIZE(infos->code));
          
          /* update the displacement information */
          instruction = instruction
@@ -308,35 +299,6 @@ int translateInstruction(t_translation_infos *infos
    return ASM_OK;
 }
 
-/* function used when a compare is needed between two labels */
-int compareLabels (void *labelA, void *labelB)
-{
-   t_asm_label *asm_labelA;
-   t_asm_label *asm_labelB;
-   
-   /* preconditions */
-   if (labelA == NULL)
-   {
-      if (labelB == NULL)
-         return 1;
-      return 0;
-   }
-   
-   if (labelB == NULL)
-      return 0;
-   
-   /* initialize labels */
-   asm_labelA = (t_asm_label *) labelA;
-   asm_labelB = (t_asm_label *) labelB;
-   
-   /* verify the consistency of this operation */
-   assert(asm_labelA->ID != NULL);
-   assert(asm_labelB->ID != NULL);
-
-   /* postcondition */
-   return (!strcmp(asm_labelA->ID, asm_labelB->ID));
-}
-
 /* create an instance of `t_translation_info' initializing the internal data
 * of every field of the structure */
 t_translation_infos * initStructures(int *errorcode)
@@ -358,9 +320,10 @@ t_translation_infos * initStructures(int *errorcode)
    (*errorcode) = ASM_OK;
    
    /* initialize the content of `result' */
-   result->code = NULL;
-   result->labels = NULL;
-   result->codesize = 0;
+   result->code = allocVector(0);
+   result->data = allocVector(0);
+   result->labels = allocHashMap(hashString, compareStrings);
+   result->offsets = allocHashMap(NULL, NULL);
    
    /* return a new instance of `t_translation_infos' */
    return result;
@@ -378,10 +341,7 @@ int addInstruction(t_translation_infos *infos
       return ASM_UNDEFINED_INSTRUCTION;
 
    /* update the list of instructions */
-   infos->code = addElement(infos->code, instruction, infos->codesize);
-   
-   /* update the codesize */
-   infos->codesize++;
+   addToVector(infos->code, instruction);
 
    /* notify that everything went correctly */
    return ASM_OK;
@@ -397,8 +357,8 @@ int insertLabel(t_translation_infos *infos, t_asm_label *label)
    if (label == NULL)
       return ASM_INVALID_LABEL_FOUND;
    
-   /* update the list of labels */
-   infos->labels = addFirst(infos->labels, label);
+   /* update the set of labels */
+   putInHashMap(infos->labels, label->ID, label);
    
    /* notify that everything went correctly */
    return ASM_OK;
@@ -407,8 +367,7 @@ int insertLabel(t_translation_infos *infos, t_asm_label *label)
 /* find a label with a given `ID' */
 t_asm_label * findLabel(t_translation_infos *infos, char *ID, int *asm_errorcode)
 {
-   t_asm_label pattern;
-   t_list *label_element;
+   t_asm_label *label;
    
    /* preconditions */
    if (infos == NULL) {
@@ -426,19 +385,11 @@ t_asm_label * findLabel(t_translation_infos *infos, char *ID, int *asm_errorcode
    /* initialize the value of `asm_errorcode' */
    (*asm_errorcode) = ASM_OK;
    
-   /* initialize `pattern' */
-   pattern.ID = ID;
-   pattern.data = NULL;
-
-   /* search the label */
-   label_element = CustomfindElement(infos->labels, &pattern, compareLabels);
-
-   /* if not found return a NULL pointer */
-   if (label_element == NULL)
-      return NULL;
+   /* search the label (if not found return a NULL pointer) */
+   label = (t_asm_label *) lookupHashMap(infos->labels, ID);
 
    /* return the label found */
-   return (t_asm_label *) LDATA(label_element);
+   return label;
 }
 
 /* remove a label */
@@ -457,8 +408,8 @@ int removeLabel(t_translation_infos *infos, char *ID)
    if (result == NULL)
       return asm_errorcode;
    
-   /* remove the label from the list */
-   infos->labels = removeElement(infos->labels, result);
+   /* remove the label from the set */
+   removeFromHashMap(infos->labels, result->ID, NULL);
    
    return asm_errorcode;
 }
@@ -473,8 +424,8 @@ int addData(t_translation_infos *infos, t_asm_data *data)
    if (data == NULL)
       return ASM_UNDEFINED_DATA;
    
-   /* update the list of instructions */
-   infos->code = addElement(infos->code, data, -1);
+   /* update the data segment */
+   addToVector(infos->data, data);
 
    return ASM_OK;
 }
@@ -482,41 +433,23 @@ int addData(t_translation_infos *infos, t_asm_data *data)
 /* finalization of the `infos' structure */
 int finalizeStructures(t_translation_infos *infos)
 {
+   int counter;
+
    if (infos == NULL)
       return ASM_NOT_INITIALIZED_INFO;
-   
-   if (infos->code != NULL)
-   {
-      t_list *current_element;
-      t_asm_instruction *current_instr;
 
-      /* initialize `data' */
-      current_element = infos->code;
-      
-      while ((current_element != NULL) && (infos->codesize > 0) )
-      {
-         current_instr = (t_asm_instruction *) LDATA(current_element);
-         
-         /* free memory associated with the current instruction */
-         freeInstruction(current_instr);
+   /* free memory associated with the instructions */
+   for (counter = 0; counter < VSIZE(infos->code); counter++)
+      freeInstruction((t_asm_instruction *) VDATA(infos->code, counter));
 
-         /* update the value of `current_element' */
-         current_element = LNEXT(current_element);
-         infos->codesize --;
-      }
+   /* free memory associated with the data infos. */
+   for (counter = 0; counter < VSIZE(infos->data); counter++)
+      freeData((t_asm_data *) VDATA(infos->data, counter));
 
-      while (current_element != NULL)
-      {
-         /* free memory associated with the current data info. */
-         freeData((t_asm_data *) LDATA(current_element));
-         
-         /* update the value of `current_element' */
-         current_element = LNEXT(current_element);
-      }
-
-      /* free the code and data segment infos */
-      freeList(infos->code);
-   }
+   /* free the code and data segment infos */
+   freeVector(infos->code);
+   freeVector(infos->data);
+   freeHashMap(infos->offsets);
    
    /* remove labels */
    finalizeLabels(infos->labels);
@@ -542,10 +475,10 @@ int asm_writeObjectFile(t_translation_infos *infos, char *output_file)
 #ifndef NDEBUG
    fprintf(stdout, "\n\n*******************************************\n");
    fprintf(stdout, "INITIALIZE OUTPUT FILE: %s. \n", output_file);
-   fprintf(stdout, "CODE SEGMENT has a size of %d instructions \n", infos->codesize);
+   fprintf(stdout, "CODE SEGMENT has a size of %d instructions \n", VSIZE(infos->code));
    fprintf(stdout, "DATA SEGMENT has a size of %d elements \n"
-         , (getLength(infos->code) - infos->codesize) );
-   fprintf(stdout, "NUMBER OF LABELS : %d. \n", getLength(infos->labels));
+         , VSIZE(infos->data) );
+   fprintf(stdout, "NUMBER OF LABELS : %d. \n", HMSIZE(infos->labels));
    fprintf(stdout, "*******************************************\n\n");
 #endif
    
@@ -588,25 +521,23 @@ int asm_writeObjectFile(t_translation_infos *infos, char *output_file)
 * This function returns ASM_OK if everything went good */
 int translateCode(t_translation_infos *infos, FILE *fp)
 {
-   int instruction_counter;
-   t_list *current_instruction;
+   int counter;
    void *instruction_or_data;
    int errorcode;
    
    /* unchecked preconditions: pf and infos are different from NULL */
    
-   if (infos->code == NULL)
+   if (VSIZE(infos->code) == 0 && VSIZE(infos->data) == 0)
       return ASM_CODE_NOT_PRESENT;
    
-   /* initialize the instruction_counter */
-   instruction_counter = 0;
-   current_instruction = infos->code;
+   /* compute the offsets referenced by the labels */
+   computeOffsets(infos);
    errorcode = ASM_OK;
    
    /* translate the instruction segment */
-   while (instruction_counter < infos->codesize)
+   for (counter = 0; counter < VSIZE(infos->code); counter++)
    {
-      instruction_or_data = LDATA(current_instruction);
+      instruction_or_data = VDATA(infos->code, counter);
       assert(instruction_or_data != NULL);
       
       /* translate every single instruction */
@@ -616,10 +547,6 @@ int translateCode(t_translation_infos *infos, FILE *fp)
       /* verify the errorcode */
       if (errorcode != ASM_OK)
          return errorcode;
-      
-      /* update the instruction counter and the current instruction data */
-      instruction_counter++;
-      current_instruction = LNEXT(current_instruction);
    }
 
 #ifndef NDEBUG
@@ -627,9 +554,9 @@ int translateCode(t_translation_infos *infos, FILE *fp)
 #endif
    
    /* translate the data segment */
-   while (current_instruction != NULL)
+   for (counter = 0; counter < VSIZE(infos->data); counter++)
    {
-      instruction_or_data = LDATA(current_instruction);
+      instruction_or_data = VDATA(infos->data, counter);
       assert(instruction_or_data != NULL);
       
       /* translate every single element of data */
@@ -645,8 +572,6 @@ int translateCode(t_translation_infos *infos, FILE *fp)
       /* verify the errorcode */
       if (errorcode != ASM_OK)
          return errorcode;
-      
-      current_instruction = LNEXT(current_instruction);
    }
    
 #ifndef NDEBUG
@@ -757,27 +682,24 @@ int getBinaryOpcode(int opcode)
    }
 }
 
-void finalizeLabels(t_list *labels)
+void finalizeLabels(t_hashmap *labels)
 {
-   t_list *current_element;
    t_asm_label *current_label;
+   int i;
    
    if (labels == NULL)
       return;
 
-   current_element = labels;
-   while(current_element != NULL)
+   for (i = nextInHashMap(labels, 0); i >= 0; i = nextInHashMap(labels, i + 1))
    {
-      current_label = (t_asm_label *) LDATA(current_element);
+      current_label = (t_asm_label *) HMVALUE(labels, i);
       if (current_label != NULL)
       {
          if (current_label->ID != NULL)
             free(current_label->ID);
          free(current_label);
       }
-      
-      current_element = LNEXT(current_element);
    }
 
-   freeList(labels);
+   freeHashMap(labels);
 }
@@ -15,16 +15,18 @@
 
 typedef struct
 {
-   t_list *code; /* the instruction+data segment */
-   t_list *labels; /* a set of asm_labels */
-   int codesize; /* the size of the instruction segment */
+   t_vector *code; /* the instruction segment */
+   t_vector *data; /* the data segment */
+   t_hashmap *labels; /* the asm_labels, indexed by identifier */
+   t_hashmap *offsets; /* the offset of every instruction and block of
+                        * data, computed before the translation */
 }t_translation_infos;
 
 /* create an instance of `t_translation_info' initializing the internal data
  * of every field of the structure */
 extern t_translation_infos *initStructures(int *errorcode);
 
-/* Insert an instruction inside the `code' list of `infos' */
+/* Insert an instruction inside the `code' segment of `infos' */
 extern int addInstruction(
       t_translation_infos *infos, t_asm_instruction *instruction);
 
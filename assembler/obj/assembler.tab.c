@@ -0,0 +1,2026 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "assembler.y"
+
+/*
+ * Andrea Di Biagio
+ * Politecnico di Milano, 2007
+ * 
+ * assembler.y
+ * Formal Languages & Compilers Machine, 2007/2008
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "asm_struct.h"
+#include "asm_engine.h"
+
+/* Variables declared for error tracking */
+int line_num;
+int num_error;
+
+/* other global variables */
+t_translation_infos *infos;
+
+/* functions declared into assembler.y */
+char * AsmErrorToString(int errorcode);
+
+int yylex(void);
+int yyerror(const char* errmsg);
+
+
+#line 101 "obj/assembler.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "assembler.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_OPCODE3 = 3,                    /* OPCODE3  */
+  YYSYMBOL_OPCODE2 = 4,                    /* OPCODE2  */
+  YYSYMBOL_OPCODEI = 5,                    /* OPCODEI  */
+  YYSYMBOL_CCODE = 6,                      /* CCODE  */
+  YYSYMBOL_HALT = 7,                       /* HALT  */
+  YYSYMBOL_NOP = 8,                        /* NOP  */
+  YYSYMBOL__DATA = 9,                      /* _DATA  */
+  YYSYMBOL__TEXT = 10,                     /* _TEXT  */
+  YYSYMBOL__WORD = 11,                     /* _WORD  */
+  YYSYMBOL__SPACE = 12,                    /* _SPACE  */
+  YYSYMBOL_REG = 13,                       /* REG  */
+  YYSYMBOL_LPAR = 14,                      /* LPAR  */
+  YYSYMBOL_RPAR = 15,                      /* RPAR  */
+  YYSYMBOL_LSQUARE = 16,                   /* LSQUARE  */
+  YYSYMBOL_RSQUARE = 17,                   /* RSQUARE  */
+  YYSYMBOL_COLON = 18,                     /* COLON  */
+  YYSYMBOL_BEGIN_IMMEDIATE = 19,           /* BEGIN_IMMEDIATE  */
+  YYSYMBOL_ETI = 20,                       /* ETI  */
+  YYSYMBOL_IMM = 21,                       /* IMM  */
+  YYSYMBOL_YYACCEPT = 22,                  /* $accept  */
+  YYSYMBOL_asm = 23,                       /* asm  */
+  YYSYMBOL_instruction_segm = 24,          /* instruction_segm  */
+  YYSYMBOL_instruction = 25,               /* instruction  */
+  YYSYMBOL_instr = 26,                     /* instr  */
+  YYSYMBOL_data_segm = 27,                 /* data_segm  */
+  YYSYMBOL_data_def = 28,                  /* data_def  */
+  YYSYMBOL_label_decl = 29,                /* label_decl  */
+  YYSYMBOL_data_value = 30,                /* data_value  */
+  YYSYMBOL_data_value_words = 31,          /* data_value_words  */
+  YYSYMBOL_register = 32,                  /* register  */
+  YYSYMBOL_immediate = 33,                 /* immediate  */
+  YYSYMBOL_address = 34                    /* address  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  21
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   66
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  22
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  13
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  28
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  54
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   276
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    75,    75,    76,    77,    80,    81,    84,    85,    93,
+     131,   171,   209,   233,   257,   283,   284,   287,   293,   296,
+     339,   343,   370,   393,   418,   432,   448,   451,   499
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "OPCODE3", "OPCODE2",
+  "OPCODEI", "CCODE", "HALT", "NOP", "_DATA", "_TEXT", "_WORD", "_SPACE",
+  "REG", "LPAR", "RPAR", "LSQUARE", "RSQUARE", "COLON", "BEGIN_IMMEDIATE",
+  "ETI", "IMM", "$accept", "asm", "instruction_segm", "instruction",
+  "instr", "data_segm", "data_def", "label_decl", "data_value",
+  "data_value_words", "register", "immediate", "address", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-25)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+      20,    -7,     4,    22,     6,    13,    -4,     5,   -25,    21,
+     -25,    24,    35,    36,    26,   -25,   -25,     4,   -25,   -25,
+      37,   -25,    -7,   -25,    29,   -25,   -25,     4,   -25,   -25,
+     -25,    38,    39,    40,    26,   -25,   -25,   -25,   -25,   -25,
+       8,   -25,     4,    41,    24,    42,   -25,     4,   -25,   -25,
+      33,   -25,     4,   -25
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,    16,     0,
+      18,     0,     0,     0,     0,    13,    14,     4,     6,     7,
+       0,     1,     0,    23,    20,    21,    19,     0,    15,    17,
+      24,     0,     0,     0,     0,    27,    28,    12,     5,     8,
+       0,    22,     3,     0,     0,     0,    11,     0,    25,     9,
+       0,    10,     2,    26
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -25,   -25,   -24,   -16,    43,    44,    -5,    -1,    46,   -25,
+      14,   -25,    23
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     3,    17,    18,    19,     7,     8,    20,    10,    24,
+      32,    51,    37
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+       9,    38,    28,    42,     4,     5,     9,    11,    12,    13,
+      14,    15,    16,     6,    26,    27,     4,     5,    47,     4,
+       5,     9,    21,    52,     6,     6,    38,    23,     6,     1,
+       2,    22,     4,     5,    25,    28,    38,    30,    31,     9,
+      11,    12,    13,    14,    15,    16,    35,    36,    33,    34,
+      41,    43,    44,    45,    53,    29,    48,    46,    49,     0,
+       0,    50,     0,    39,     0,     0,    40
+};
+
+static const yytype_int8 yycheck[] =
+{
+       1,    17,     7,    27,    11,    12,     7,     3,     4,     5,
+       6,     7,     8,    20,    18,    10,    11,    12,    10,    11,
+      12,    22,     0,    47,    20,    20,    42,    21,    20,     9,
+      10,     9,    11,    12,    21,    40,    52,    13,    14,    40,
+       3,     4,     5,     6,     7,     8,    20,    21,    13,    13,
+      21,    13,    13,    13,    21,     9,    15,    34,    44,    -1,
+      -1,    19,    -1,    20,    -1,    -1,    22
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     9,    10,    23,    11,    12,    20,    27,    28,    29,
+      30,     3,     4,     5,     6,     7,     8,    24,    25,    26,
+      29,     0,     9,    21,    31,    21,    18,    10,    28,    30,
+      13,    14,    32,    13,    13,    20,    21,    34,    25,    26,
+      27,    21,    24,    13,    13,    13,    34,    10,    15,    32,
+      19,    33,    24,    21
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    22,    23,    23,    23,    24,    24,    25,    25,    26,
+      26,    26,    26,    26,    26,    27,    27,    28,    28,    29,
+      30,    30,    31,    31,    32,    32,    33,    34,    34
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     5,     4,     2,     2,     1,     1,     2,     4,
+       4,     3,     2,     1,     1,     2,     1,     2,     1,     2,
+       2,     2,     2,     1,     1,     3,     2,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* asm: asm _DATA data_segm _TEXT instruction_segm  */
+#line 75 "assembler.y"
+                                                       { /* DOES NOTHING */}
+#line 1149 "obj/assembler.tab.c"
+    break;
+
+  case 3: /* asm: _DATA data_segm _TEXT instruction_segm  */
+#line 76 "assembler.y"
+                                                       { /* DOES NOTHING */}
+#line 1155 "obj/assembler.tab.c"
+    break;
+
+  case 4: /* asm: _TEXT instruction_segm  */
+#line 77 "assembler.y"
+                                                       { /* DOES NOTHING */}
+#line 1161 "obj/assembler.tab.c"
+    break;
+
+  case 5: /* instruction_segm: instruction_segm instruction  */
+#line 80 "assembler.y"
+                                                    { }
+#line 1167 "obj/assembler.tab.c"
+    break;
+
+  case 6: /* instruction_segm: instruction  */
+#line 81 "assembler.y"
+                                                    { }
+#line 1173 "obj/assembler.tab.c"
+    break;
+
+  case 7: /* instruction: instr  */
+#line 84 "assembler.y"
+                               { /* DOES NOTHING */}
+#line 1179 "obj/assembler.tab.c"
+    break;
+
+  case 8: /* instruction: label_decl instr  */
+#line 85 "assembler.y"
+                               {
+               if ((yyvsp[-1].label)->data != NULL)
+                  yyerror(AsmErrorToString(ASM_LABEL_ALREADY_PRESENT));
+               /* assign the label to the current instruction */
+               (yyvsp[-1].label)->data = (void *) (yyvsp[0].instr);
+            }
+#line 1190 "obj/assembler.tab.c"
+    break;
+
+  case 9: /* instr: OPCODE3 register REG register  */
+#line 93 "assembler.y"
+                                       {
+         t_asm_register *reg;
+         int asm_errorcode;
+         
+         /* alloc memory for a register info. */
+         reg = allocRegister((yyvsp[-1].immediate), 0);
+   
+         /* register shouldn't be a NULL pointer */
+         if (reg == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* initialize an instruction with three operands' */
+         (yyval.instr) = init_opcode3((yyvsp[-3].opcode), (yyvsp[-2].reg), reg, (yyvsp[0].reg));
+         
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1233 "obj/assembler.tab.c"
+    break;
+
+  case 10: /* instr: OPCODE2 REG REG immediate  */
+#line 131 "assembler.y"
+                                  {
+         t_asm_register *register_1;
+         t_asm_register *register_2;
+         int asm_errorcode;
+         
+         /* alloc memory for a register info. */
+         register_1 = allocRegister((yyvsp[-2].immediate), 0);
+         register_2 = allocRegister((yyvsp[-1].immediate), 0);
+   
+         /* registers shouldn't be a NULL pointer */
+         if (register_1 == NULL || register_2 == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* initialize an instruction with two operands' */
+         (yyval.instr) = init_opcode2((yyvsp[-3].opcode), register_1, register_2, (yyvsp[0].immediate));
+         
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1278 "obj/assembler.tab.c"
+    break;
+
+  case 11: /* instr: OPCODEI REG address  */
+#line 171 "assembler.y"
+                            {
+         t_asm_register *reg;
+         int asm_errorcode;
+         
+         /* alloc memory for a register info. */
+         reg = allocRegister((yyvsp[-1].immediate), 0);
+   
+         /* register shouldn't be a NULL pointer */
+         if (reg == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* initialize an instruction with a single operand' */
+         (yyval.instr) = init_opcodeI((yyvsp[-2].opcode), reg, (yyvsp[0].address));
+         
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1321 "obj/assembler.tab.c"
+    break;
+
+  case 12: /* instr: CCODE address  */
+#line 209 "assembler.y"
+                      {
+         int asm_errorcode;
+         
+         /* initialize a branch instruction */
+         (yyval.instr) = init_ccode((yyvsp[-1].opcode), (yyvsp[0].address));
+         
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1350 "obj/assembler.tab.c"
+    break;
+
+  case 13: /* instr: HALT  */
+#line 233 "assembler.y"
+             {
+         int asm_errorcode;
+         
+         /* initialize a HALT instruction */
+         (yyval.instr) = init_halt();
+
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1379 "obj/assembler.tab.c"
+    break;
+
+  case 14: /* instr: NOP  */
+#line 257 "assembler.y"
+            {
+         int asm_errorcode;
+         
+         /* initialize a NOP instruction */
+         (yyval.instr) = init_nop();
+
+         /* $$ shouldn't be a NULL pointer */
+         if ((yyval.instr) == NULL)
+         {
+            /* an out of memory occurred */
+            yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+            /* stop the parser */
+            YYABORT;
+         }
+
+         /* add the newly created instruction to the code segment */
+         asm_errorcode = addInstruction(infos, (yyval.instr));
+         if (asm_errorcode != ASM_OK)
+         {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+      }
+#line 1408 "obj/assembler.tab.c"
+    break;
+
+  case 15: /* data_segm: data_segm data_def  */
+#line 283 "assembler.y"
+                                 { }
+#line 1414 "obj/assembler.tab.c"
+    break;
+
+  case 16: /* data_segm: data_def  */
+#line 284 "assembler.y"
+                                 { }
+#line 1420 "obj/assembler.tab.c"
+    break;
+
+  case 17: /* data_def: label_decl data_value  */
+#line 287 "assembler.y"
+                                 {
+                  if ((yyvsp[-1].label)->data != NULL)
+                     yyerror(AsmErrorToString(ASM_LABEL_ALREADY_PRESENT));
+                  /* assign the label to the current block of data */
+                  (yyvsp[-1].label)->data = (void *) (yyvsp[0].dataVal);
+         }
+#line 1431 "obj/assembler.tab.c"
+    break;
+
+  case 18: /* data_def: data_value  */
+#line 293 "assembler.y"
+                      { }
+#line 1437 "obj/assembler.tab.c"
+    break;
+
+  case 19: /* label_decl: ETI COLON  */
+#line 296 "assembler.y"
+                       {
+            int asm_errorcode;
+            
+            /* look for the requested label */
+            (yyval.label) = findLabel(infos, (yyvsp[-1].svalue), &asm_errorcode);
+            if (asm_errorcode != ASM_OK)
+            {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+            }
+            
+            if ((yyval.label) == NULL)
+            {
+               t_asm_label *label;
+            
+               /* label was never defined before */
+               label = allocLabel((yyvsp[-1].svalue), NULL);
+
+               /* label shouldn't be a NULL pointer */
+               if (label == NULL)
+               {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+               }
+
+               /* insert the new label */
+               asm_errorcode = insertLabel(infos, label);
+
+               /* set the $$ value */
+               (yyval.label) = label;
+            }
+            else
+               free((yyvsp[-1].svalue));
+
+            /* notify if an error occurred */
+            if (asm_errorcode != ASM_OK)
+               yyerror(AsmErrorToString(asm_errorcode));
+         }
+#line 1483 "obj/assembler.tab.c"
+    break;
+
+  case 20: /* data_value: _WORD data_value_words  */
+#line 339 "assembler.y"
+                                   {
+               /* propagate the location of the first word */
+               (yyval.dataVal) = (yyvsp[0].dataVal);
+            }
+#line 1492 "obj/assembler.tab.c"
+    break;
+
+  case 21: /* data_value: _SPACE IMM  */
+#line 343 "assembler.y"
+                         {
+               int asm_errorcode;
+
+               /* create an instance of `t_asm_data' */
+               (yyval.dataVal) = allocData(ASM_SPACE, (yyvsp[0].immediate));
+
+               /* $$ shouldn't be a NULL pointer */
+               if ((yyval.dataVal) == NULL)
+               {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+               }
+
+               /* insert data into the data segment */
+               asm_errorcode = addData(infos, (yyval.dataVal));
+               if (asm_errorcode != ASM_OK)
+               {
+                  /* an error occurred */
+                  yyerror(AsmErrorToString(asm_errorcode));
+               }
+            }
+#line 1521 "obj/assembler.tab.c"
+    break;
+
+  case 22: /* data_value_words: data_value_words IMM  */
+#line 371 "assembler.y"
+   {
+      int asm_errorcode;
+      /* create an instance of `t_asm_data' */
+      t_asm_data *data = allocData(ASM_WORD, (yyvsp[0].immediate));
+      if (!data)
+      {
+         /* an out of memory occurred */
+         yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+      
+         /* stop the parser */
+         YYABORT;
+      }
+      /* insert data into the data segment */
+      asm_errorcode = addData(infos, data);
+      if (asm_errorcode != ASM_OK)
+      {
+         /* an error occurred */
+         yyerror(AsmErrorToString(asm_errorcode));
+      }
+      /* propagate the location of the first word */
+      (yyval.dataVal) = (yyvsp[-1].dataVal);
+   }
+#line 1548 "obj/assembler.tab.c"
+    break;
+
+  case 23: /* data_value_words: IMM  */
+#line 394 "assembler.y"
+   {
+      int asm_errorcode;
+      /* create an instance of `t_asm_data' */
+      t_asm_data *data = allocData(ASM_WORD, (yyvsp[0].immediate));
+      if (!data)
+      {
+         /* an out of memory occurred */
+         yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+      
+         /* stop the parser */
+         YYABORT;
+      }
+      /* insert data into the data segment */
+      asm_errorcode = addData(infos, data);
+      if (asm_errorcode != ASM_OK)
+      {
+         /* an error occurred */
+         yyerror(AsmErrorToString(asm_errorcode));
+      }
+      /* propagate the location of the first word */
+      (yyval.dataVal) = data;
+   }
+#line 1575 "obj/assembler.tab.c"
+    break;
+
+  case 24: /* register: REG  */
+#line 418 "assembler.y"
+               {
+               /* alloc memory for a register info. */
+               (yyval.reg) = allocRegister((yyvsp[0].immediate), 0);
+   
+               /* $$ shouldn't be a NULL pointer */
+               if ((yyval.reg) == NULL)
+               {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+               }
+         }
+#line 1594 "obj/assembler.tab.c"
+    break;
+
+  case 25: /* register: LPAR REG RPAR  */
+#line 432 "assembler.y"
+                         {
+               /* alloc memory for a register info. */
+               (yyval.reg) = allocRegister((yyvsp[-1].immediate), 1);
+   
+               /* label shouldn't be a NULL pointer */
+               if ((yyval.reg) == NULL)
+               {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+               }
+         }
+#line 1613 "obj/assembler.tab.c"
+    break;
+
+  case 26: /* immediate: BEGIN_IMMEDIATE IMM  */
+#line 448 "assembler.y"
+                                { (yyval.immediate) = (yyvsp[0].immediate); }
+#line 1619 "obj/assembler.tab.c"
+    break;
+
+  case 27: /* address: ETI  */
+#line 451 "assembler.y"
+               {
+            int asm_errorcode;
+            t_asm_label *label_found;
+            
+            /* look for the requested label */
+            label_found = findLabel(infos, (yyvsp[0].svalue), &asm_errorcode);
+            if (asm_errorcode != ASM_OK)
+            {
+               /* an error occurred */
+               yyerror(AsmErrorToString(asm_errorcode));
+            }
+            
+            if (label_found == NULL)
+            {
+               /* label was never defined before */
+               label_found = allocLabel((yyvsp[0].svalue), NULL);
+
+               /* label shouldn't be a NULL pointer */
+               if (label_found == NULL)
+               {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+               }
+
+               /* insert the new label */
+               asm_errorcode = insertLabel(infos, label_found);
+
+               /* notify if an error occurred */
+               if (asm_errorcode != ASM_OK)
+                  yyerror(AsmErrorToString(asm_errorcode));
+            }
+            else
+               free((yyvsp[0].svalue));
+
+            /* set the $$ value */
+            (yyval.address) = allocAddress(0, label_found);
+            if ((yyval.address) == NULL)
+            {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+            }
+         }
+#line 1672 "obj/assembler.tab.c"
+    break;
+
+  case 28: /* address: IMM  */
+#line 499 "assembler.y"
+               {
+            (yyval.address) = allocAddress((yyvsp[0].immediate), NULL);
+            if ((yyval.address) == NULL)
+            {
+                  /* an out of memory occurred */
+                  yyerror(AsmErrorToString(ASM_OUT_OF_MEMORY));
+               
+                  /* stop the parser */
+                  YYABORT;
+            }
+         }
+#line 1688 "obj/assembler.tab.c"
+    break;
+
+
+#line 1692 "obj/assembler.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 512 "assembler.y"
+
+       
+int yyerror(const char* errmsg)
+{
+   fprintf(stdout, "line %d , error: %s \n", line_num, errmsg);
+   num_error++;
+   return 0;
+}
+
+int main (int argc, char **argv)
+{
+   int errorcode;
+   char *filename;
+   FILE *input_file;
+   extern FILE *yyin;
+   int retval;
+
+   retval = 0;
+
+   argc--;
+   argv++;
+   
+   if (argc > 0)
+   {
+      input_file = fopen(argv[0], "r");
+      if (input_file == NULL)
+      {
+         fprintf( stdout, "File not found : %s.\n", argv[0]);
+         exit(-1);
+      }
+      yyin = input_file;
+   }
+   else
+      yyin = stdin;
+   
+   if (argc <= 1)
+      filename = "output.o";
+   else
+      filename = argv[1];
+   
+#ifndef NDEBUG
+   fprintf(stdout, "Initializing the assembler data structures.\n");
+#endif
+   /* initialize the translation infos */
+   infos = initStructures(&errorcode);
+
+   /* test if an error occurred */
+   if (errorcode != ASM_OK)
+   {
+         fprintf( stdout, "An error occurred while initializing the assembler.\n"
+                  "%s. \n", AsmErrorToString(errorcode));
+
+         /* we can't start the parsing procedure since a critical error occurred */
+         abort();
+   }
+
+   /* initialize the global variables */
+   line_num = 1;
+   num_error = 0;
+   
+#ifndef NDEBUG
+   if (argc > 0)
+      fprintf(stdout, "Starting the parsing process. "
+                        "Input file : %s.\n", argv[0]);
+   else
+      fprintf(stdout, "Starting the parsing process. "
+                        "Input file : standard input.\n");
+#endif
+   /* start the parsing procedure */
+   yyparse();
+
+#ifndef NDEBUG
+   fprintf(stdout, "Parsing complete. \n");
+#endif
+   
+   /* test if the parsing job found some errors */
+   if (num_error == 0)
+   {
+#ifndef NDEBUG
+      fprintf(stdout, "Output will be written on file : %s. \n", filename);
+#endif
+      errorcode = asm_writeObjectFile(infos, filename);
+      if (errorcode != ASM_OK)
+      {
+         fprintf( stdout, "An error occurred while writing the object file.\n"
+                  "%s. \n", AsmErrorToString(errorcode));
+         retval = 2;
+      }
+#ifndef NDEBUG
+      else
+         fprintf(stdout, "Output written on file \"%s\".\n", filename);
+#endif
+   }
+   else {
+      fprintf(stdout, "\nInput file contains some error(s). No object file written\n");
+      fprintf(stdout, "**%d errors found \n\n", num_error);
+      retval = 1;
+   }
+
+#ifndef NDEBUG
+   fprintf(stdout, "Finalizing the data structures. \n");
+#endif
+
+   /* shutdown the asm engine */
+   if (infos != NULL)
+   {
+         errorcode = finalizeStructures(infos);
+         if (errorcode != ASM_OK)
+         {
+            fprintf(stdout, "SHUTDOWN:: error while finalizing "
+                  "the data structures. \n%s. \n", AsmErrorToString(errorcode));
+         }
+   }
+
+#ifndef NDEBUG
+   fprintf(stdout, "Done. \n");
+#endif
+   
+   return retval;
+}
+
+char * AsmErrorToString(int errorcode)
+{
+   switch(errorcode)
+   {
+      case ASM_NOT_INITIALIZED_INFO : return "global infos not initialized";
+      case ASM_UNDEFINED_INSTRUCTION : return "invalid instruction found";
+      case ASM_INVALID_LABEL_FOUND : return "invalid label found";
+      case ASM_LABEL_ALREADY_PRESENT : return "label already defined";
+      case ASM_UNDEFINED_DATA : return "invalid data found";
+      case ASM_INVALID_DATA_FORMAT : return "invalid data format";
+      case ASM_FOPEN_ERROR : return "fopen failed";
+      case ASM_INVALID_INPUT_FILE : return "invalid file pointer";
+      case ASM_FWRITE_ERROR : return "fwrite failed";
+      case ASM_FCLOSE_ERROR : return "fclose failed";
+      case ASM_CODE_NOT_PRESENT : return "code segment is empty";
+      case ASM_OUT_OF_MEMORY : return "out of memory";
+      case ASM_INVALID_OPCODE : return "invalid opcode found";
+      case ASM_UNKNOWN_ERROR : return "unknown error found";
+      default : return "<invalid errorcode>";
+   }
+}
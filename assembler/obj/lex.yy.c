@@ -0,0 +1,89 @@
+/* hand-written stand-in for flex output of assembler.lex (local testing only) */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "asm_struct.h"
+#include "collections.h"
+#include "assembler.tab.h"
+extern int line_num;
+extern int num_error;
+FILE *yyin = NULL;
+static char yytext[4096];
+struct kw { const char *name; int op; int tok; };
+#define K(s, o, t) { s, o, t }
+static const struct kw kws[] = {
+ K("add",ADD_OP,OPCODE3),K("sub",SUB_OP,OPCODE3),K("andl",ANDL_OP,OPCODE3),K("orl",ORL_OP,OPCODE3),
+ K("eorl",EORL_OP,OPCODE3),K("andb",ANDB_OP,OPCODE3),K("orb",ORB_OP,OPCODE3),K("eorb",EORB_OP,OPCODE3),
+ K("mul",MUL_OP,OPCODE3),K("div",DIV_OP,OPCODE3),K("shl",SHL_OP,OPCODE3),K("shr",SHR_OP,OPCODE3),
+ K("rotl",ROTL_OP,OPCODE3),K("rotr",ROTR_OP,OPCODE3),K("neg",NEG_OP,OPCODE3),K("spcl",SPCL_OP,OPCODE3),
+ K("addi",ADDI_OP,OPCODE2),K("subi",SUBI_OP,OPCODE2),K("andli",ANDLI_OP,OPCODE2),K("orli",ORLI_OP,OPCODE2),
+ K("eorli",EORLI_OP,OPCODE2),K("andbi",ANDBI_OP,OPCODE2),K("orbi",ORBI_OP,OPCODE2),K("eorbi",EORBI_OP,OPCODE2),
+ K("muli",MULI_OP,OPCODE2),K("divi",DIVI_OP,OPCODE2),K("shli",SHLI_OP,OPCODE2),K("shri",SHRI_OP,OPCODE2),
+ K("rotli",ROTLI_OP,OPCODE2),K("rotri",ROTRI_OP,OPCODE2),K("notl",NOTL_OP,OPCODE2),K("notb",NOTB_OP,OPCODE2),
+ K("nop",NOP_OP,NOP),K("mova",MOVA_OP,OPCODEI),K("load",LOAD_OP,OPCODEI),K("store",STORE_OP,OPCODEI),
+ K("jsr",JSR_OP,OPCODEI),K("ret",RET_OP,OPCODEI),K("seq",SEQ_OP,OPCODEI),K("sge",SGE_OP,OPCODEI),
+ K("sgt",SGT_OP,OPCODEI),K("sle",SLE_OP,OPCODEI),K("slt",SLT_OP,OPCODEI),K("sne",SNE_OP,OPCODEI),
+ K("read",READ_OP,OPCODEI),K("write",WRITE_OP,OPCODEI),K("xpsw",XPSW_OP,OPCODEI),K("halt",HALT_OP,HALT),
+ K("bt",BT_OP,CCODE),K("bf",BF_OP,CCODE),K("bhi",BHI_OP,CCODE),K("bls",BLS_OP,CCODE),K("bcc",BCC_OP,CCODE),
+ K("bcs",BCS_OP,CCODE),K("bne",BNE_OP,CCODE),K("beq",BEQ_OP,CCODE),K("bvc",BVC_OP,CCODE),K("bvs",BVS_OP,CCODE),
+ K("bpl",BPL_OP,CCODE),K("bmi",BMI_OP,CCODE),K("bge",BGE_OP,CCODE),K("blt",BLT_OP,CCODE),K("bgt",BGT_OP,CCODE),
+ K("ble",BLE_OP,CCODE),
+};
+static int hget(void) { return fgetc(yyin ? yyin : stdin); }
+static void hunget(int c) { if (c != EOF) ungetc(c, yyin ? yyin : stdin); }
+int yylex(void)
+{
+   int c;
+again:
+   c = hget();
+   if (c == EOF) return 0;
+   if (c == '\n') { line_num++; goto again; }
+   if (c == ' ' || c == '\t' || c == '\f' || c == '\v') goto again;
+   if (c == '/') {
+      int d = hget();
+      if (d == '*') { int prev = 0; while ((c = hget()) != EOF) { if (c == '\n') ++line_num; if (prev == '*' && c == '/') goto again; prev = c; } return 0; }
+      hunget(d); return '/';
+   }
+   switch (c) {
+   case '(': return LPAR; case ')': return RPAR; case '[': return LSQUARE;
+   case ']': return RSQUARE; case ':': return COLON; case '#': return BEGIN_IMMEDIATE;
+   }
+   if (c == '.') {
+      int n = 0; yytext[n++] = c; c = hget();
+      while (isalpha(c)) { yytext[n++] = c; c = hget(); }
+      hunget(c); yytext[n] = 0;
+      if (!strcasecmp(yytext, ".data")) return _DATA;
+      if (!strcasecmp(yytext, ".text")) return _TEXT;
+      if (!strcasecmp(yytext, ".word")) return _WORD;
+      if (!strcasecmp(yytext, ".space")) return _SPACE;
+      return '.';
+   }
+   if (isdigit(c) || c == '-') {
+      int n = 0; yytext[n++] = c; c = hget();
+      while (isalnum(c)) { yytext[n++] = c; c = hget(); }
+      hunget(c); yytext[n] = 0;
+      yylval.immediate = strtol(yytext, NULL, 0);
+      return IMM;
+   }
+   if (isalpha(c) || c == '_') {
+      int n = 0, i;
+      while (isalnum(c) || c == '_') { yytext[n++] = c; c = hget(); }
+      hunget(c); yytext[n] = 0;
+      for (i = 0; i < (int)(sizeof(kws)/sizeof(kws[0])); i++) {
+         char up[16]; int j;
+         for (j = 0; kws[i].name[j]; j++) up[j] = toupper(kws[i].name[j]);
+         up[j] = 0;
+         if (!strcmp(yytext, kws[i].name) || !strcmp(yytext, up)) {
+            yylval.opcode = kws[i].op; return kws[i].tok;
+         }
+      }
+      if ((yytext[0] == 'R' || yytext[0] == 'r') && n > 1) {
+         for (i = 1; i < n && isdigit(yytext[i]); i++);
+         if (i == n) { yylval.immediate = atoi(&yytext[1]); return REG; }
+      }
+      yylval.svalue = strdup(yytext);
+      return ETI;
+   }
+   return c;
+}
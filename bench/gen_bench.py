@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+
+#
+# Synthetic LANCE program generator for the compile-time benchmarks
+# 2020 Politecnico di Milano
+#
+# usage: gen_bench.py SHAPE STATEMENTS [SEED]
+#
+# Writes on the standard output a LANCE program of roughly STATEMENTS
+# statements (loop and branch headers included) with the given shape:
+#
+#   straight  one basic block of arithmetic over many variables which are
+#             all live at the same time
+#   nested    if/else and while statements nested many levels deep
+#   chain     a long sequence of small while loops
+#   arrays    loads and stores to large arrays with computed indices
+#
+# The output only depends on the arguments, so that results from different
+# runs can be compared.
+#
+
+import random
+import sys
+
+
+OPERATORS = ['+', '-', '*', '&', '|', '<<', '>>']
+COMPARISONS = ['<', '>', '<=', '>=', '==', '!=']
+
+
+class Generator:
+    def __init__(self, statements, seed):
+        self.rnd = random.Random(seed)
+        self.statements = statements
+        self.emitted = 0
+        self.lines = []
+        self.indent = 0
+
+    def emit(self, line, count=1):
+        self.lines.append('   ' * self.indent + line)
+        self.emitted += count
+
+    def remaining(self):
+        return self.statements - self.emitted
+
+    def declare(self, names, size=None):
+        # a declaration per line keeps the lines short
+        for i in range(0, len(names), 16):
+            chunk = names[i:i + 16]
+            if size is None:
+                self.lines.insert(0, 'int ' + ', '.join(chunk) + ';')
+            else:
+                decls = ['%s[%d]' % (n, size) for n in chunk]
+                self.lines.insert(0, 'int ' + ', '.join(decls) + ';')
+
+    def var(self, names):
+        return self.rnd.choice(names)
+
+    def arith(self, names):
+        op = self.rnd.choice(OPERATORS)
+        a, b = self.var(names), self.var(names)
+        if op in ('<<', '>>'):
+            return '%s = %s %s %d;' % (a, b, op, self.rnd.randint(1, 7))
+        return '%s = %s %s %s + %d;' % (a, b, op, self.var(names),
+                                       self.rnd.randint(1, 100))
+
+    def cond(self, names):
+        return '%s %s %s' % (self.var(names), self.rnd.choice(COMPARISONS),
+                             self.var(names))
+
+    def text(self):
+        return '\n'.join(self.lines) + '\n'
+
+
+def num_variables(statements):
+    # enough variables to exceed the registers of every target by far
+    return max(64, min(statements // 8, 4096))
+
+
+def gen_straight(gen):
+    names = ['v%d' % i for i in range(num_variables(gen.statements))]
+    for n in names[:32]:
+        gen.emit('read(%s);' % n)
+    while gen.remaining() > len(names) // 16:
+        gen.emit(gen.arith(names))
+    # keep every variable alive until the end
+    for i in range(0, len(names), 16):
+        gen.emit('write(%s);' % ' + '.join(names[i:i + 16]))
+    gen.declare(names)
+
+
+def gen_nested(gen):
+    names = ['v%d' % i for i in range(num_variables(gen.statements) // 4)]
+    counters = ['i%d' % i for i in range(48)]
+
+    def nest(depth, target):
+        if depth == target or gen.remaining() <= 0:
+            for _ in range(gen.rnd.randint(1, 3)):
+                gen.emit(gen.arith(names))
+            return
+        if gen.rnd.random() < 0.5:
+            gen.emit('if (%s) {' % gen.cond(names))
+            gen.indent += 1
+            nest(depth + 1, target)
+            gen.indent -= 1
+            gen.emit('} else {', 0)
+            gen.indent += 1
+            gen.emit(gen.arith(names))
+            gen.indent -= 1
+            gen.emit('}', 0)
+        else:
+            # every level has its own counter, so that the loops do not
+            # interfere with each other
+            counter = counters[depth]
+            gen.emit('%s = 0;' % counter)
+            gen.emit('while (%s < %d) {' % (counter, gen.rnd.randint(2, 5)))
+            gen.indent += 1
+            nest(depth + 1, target)
+            gen.emit('%s = %s + 1;' % (counter, counter))
+            gen.indent -= 1
+            gen.emit('}', 0)
+        gen.emit(gen.arith(names))
+
+    gen.emit('read(%s);' % names[0])
+    while gen.remaining() > 0:
+        nest(0, gen.rnd.randint(8, len(counters)))
+    gen.emit('write(%s);' % names[0])
+    gen.declare(counters)
+    gen.declare(names)
+
+
+def gen_chain(gen):
+    names = ['v%d' % i for i in range(num_variables(gen.statements) // 4)]
+    gen.emit('read(%s);' % names[0])
+    while gen.remaining() > 0:
+        gen.emit('i = 0;')
+        gen.emit('while (i < %d) {' % gen.rnd.randint(2, 10))
+        gen.indent += 1
+        for _ in range(gen.rnd.randint(1, 4)):
+            gen.emit(gen.arith(names))
+        gen.emit('i = i + 1;')
+        gen.indent -= 1
+        gen.emit('}', 0)
+    gen.emit('write(%s);' % names[0])
+    gen.declare(['i'])
+    gen.declare(names)
+
+
+def gen_arrays(gen):
+    array_size = max(16, min(gen.statements, 100000))
+    arrays = ['a%d' % i for i in range(8)]
+    names = ['v%d' % i for i in range(64)]
+
+    def index():
+        return '(%s & %d)' % (gen.rnd.choice(names), 15)
+
+    gen.emit('read(%s);' % names[0])
+    while gen.remaining() > 0:
+        choice = gen.rnd.random()
+        if choice < 0.4:
+            gen.emit('%s[%s] = %s + %s;' % (gen.rnd.choice(arrays), index(),
+                                            gen.rnd.choice(names),
+                                            gen.rnd.choice(names)))
+        elif choice < 0.8:
+            gen.emit('%s = %s[%s] + %s[%d];' % (
+                gen.rnd.choice(names), gen.rnd.choice(arrays), index(),
+                gen.rnd.choice(arrays), gen.rnd.randrange(array_size)))
+        else:
+            gen.emit(gen.arith(names))
+    gen.emit('write(%s);' % names[0])
+    gen.declare(names)
+    gen.declare(arrays, array_size)
+
+
+SHAPES = {
+    'straight': gen_straight,
+    'nested': gen_nested,
+    'chain': gen_chain,
+    'arrays': gen_arrays,
+}
+
+
+def main():
+    if len(sys.argv) not in (3, 4) or sys.argv[1] not in SHAPES:
+        sys.stderr.write('usage: %s {%s} STATEMENTS [SEED]\n'
+                         % (sys.argv[0], '|'.join(SHAPES)))
+        sys.exit(1)
+    statements = int(sys.argv[2])
+    seed = int(sys.argv[3]) if len(sys.argv) == 4 else 1
+    gen = Generator(statements, seed)
+    SHAPES[sys.argv[1]](gen)
+    sys.stdout.write(gen.text())
+
+
+if __name__ == '__main__':
+    main()
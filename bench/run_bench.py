@@ -0,0 +1,521 @@
+#!/usr/bin/env python3
+
+#
+# Compiler benchmark driver
+# 2020 Politecnico di Milano
+#
+# usage: run_bench.py {compile|runtime} [options]
+#
+# compile  compiles the synthetic programs produced by gen_bench.py with
+#          the ACSE builds of every target, collecting the statistics
+#          written by `acse --stats'
+# runtime  compiles the kernels in the `kernels' directory and runs them,
+#          on MACE (counting the executed instructions) and natively on
+#          amd64 (measuring the wall time)
+#
+# The results of each run are saved in the results directory and compared
+# with the stored baseline, if any. Run `run_bench.py KIND --help' for the
+# list of options.
+#
+
+import argparse
+import datetime
+import glob
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+
+import gen_bench
+
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(BENCH_DIR)
+
+
+def git_revision():
+    try:
+        rev = subprocess.check_output(
+            ['git', 'describe', '--always', '--dirty'], cwd=BENCH_DIR,
+            stderr=subprocess.DEVNULL)
+        return rev.decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+
+
+def run_header(kind):
+    return {
+        'kind': kind,
+        'timestamp': datetime.datetime.now().isoformat(timespec='seconds'),
+        'revision': git_revision(),
+        'host': platform.node(),
+        'machine': platform.machine(),
+    }
+
+
+def save_results(results, results_dir, kind):
+    # the latest run is kept in full, the history has one line per run
+    os.makedirs(results_dir, exist_ok=True)
+    latest = os.path.join(results_dir, kind + '-latest.json')
+    with open(latest, 'w') as f:
+        json.dump(results, f, indent=1)
+        f.write('\n')
+    with open(os.path.join(results_dir, kind + '-history.jsonl'), 'a') as f:
+        json.dump(results, f, separators=(',', ':'))
+        f.write('\n')
+    print('results saved in %s' % latest)
+
+
+def load_baseline(path):
+    if not path or not os.path.exists(path):
+        return None
+    with open(path) as f:
+        return json.load(f)
+
+
+def entry_key(entry):
+    return (entry['program'], entry['target'])
+
+
+def format_change(old, new):
+    if old is None or new is None:
+        return ''
+    if old == 0:
+        return 'n/a' if new != 0 else '='
+    return '%+.1f%%' % ((new - old) * 100.0 / old)
+
+
+#
+# compile-time benchmarks
+#
+
+def generate_programs(shapes, sizes, programs_dir):
+    os.makedirs(programs_dir, exist_ok=True)
+    programs = []
+    for shape in shapes:
+        for size in sizes:
+            name = '%s-%d' % (shape, size)
+            path = os.path.join(programs_dir, name + '.src')
+            if not os.path.exists(path):
+                gen = gen_bench.Generator(size, 1)
+                gen_bench.SHAPES[shape](gen)
+                with open(path, 'w') as f:
+                    f.write(gen.text())
+            programs.append((name, shape, size, path))
+    return programs
+
+
+def compile_once(acse, src, out_dir, name, timeout, options):
+    stats = os.path.join(out_dir, name + '.json')
+    asm = os.path.join(out_dir, name + '.asm')
+    if os.path.exists(stats):
+        os.remove(stats)
+    try:
+        proc = subprocess.run([acse] + options + ['--stats', stats, src, asm],
+                              stdout=subprocess.DEVNULL,
+                              stderr=subprocess.PIPE, timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return 'timeout', None
+    if proc.returncode != 0 or not os.path.exists(stats):
+        sys.stderr.write(proc.stderr.decode(errors='replace'))
+        return 'error', None
+    with open(stats) as f:
+        return 'ok', json.load(f)
+
+
+def compile_program(acse, program, target, out_dir, repeat, timeout,
+                    options):
+    name, shape, size, src = program
+    entry = {'program': name, 'shape': shape, 'size': size,
+             'target': target}
+    best = None
+    phases = {}
+    for _ in range(repeat):
+        status, stats = compile_once(acse, src, out_dir,
+                                     '%s-%s' % (name, target), timeout,
+                                     options)
+        entry['status'] = status
+        if status == 'timeout':
+            # kept in the results, so that the history shows the sizes
+            # which the compiler cannot handle
+            entry['timeout_s'] = timeout
+        if status != 'ok':
+            return entry
+        # the minimum is the least noisy estimate of each measure
+        for phase in stats['phases']:
+            old = phases.get(phase['name'])
+            if old is None or phase['time_ms'] < old:
+                phases[phase['name']] = phase['time_ms']
+        if best is None or stats['total_time_ms'] < best['total_time_ms']:
+            best = stats
+    entry['total_time_ms'] = best['total_time_ms']
+    entry['peak_rss_kb'] = best['peak_rss_kb']
+    entry['allocations'] = best['allocations']
+    entry['phases'] = phases
+    entry['counters'] = best['counters']
+    return entry
+
+
+def print_compile_table(entries, baseline, threshold):
+    base = {}
+    if baseline is not None:
+        base = dict((entry_key(e), e) for e in baseline['results'])
+
+    print('%-20s %-6s %12s %9s %11s  %s' % ('program', 'target', 'time (ms)',
+                                            'change', 'rss (KB)',
+                                            'slowest phase'))
+    regressions = []
+    for entry in entries:
+        old = base.get(entry_key(entry))
+        if entry['status'] != 'ok':
+            status = entry['status']
+            if status == 'timeout':
+                status = 'timeout (%g s)' % entry['timeout_s']
+            print('%-20s %-6s %12s' % (entry['program'], entry['target'],
+                                       status))
+            # a program compiled by the baseline must still be compiled
+            if old is not None and old['status'] == 'ok':
+                regressions.append('%s/%s: %s, was %.1f ms' % (
+                    entry['program'], entry['target'], status,
+                    old['total_time_ms']))
+            continue
+        old_total = None
+        if old is not None and old['status'] == 'ok':
+            old_total = old['total_time_ms']
+        slowest = max(entry['phases'].items(), key=lambda p: p[1])
+        print('%-20s %-6s %12.1f %9s %11d  %s (%.1f ms)' % (
+            entry['program'], entry['target'], entry['total_time_ms'],
+            format_change(old_total, entry['total_time_ms']),
+            entry['peak_rss_kb'], slowest[0], slowest[1]))
+
+        if old_total is None:
+            continue
+        # very short phases are dominated by noise
+        for phase, time_ms in entry['phases'].items():
+            old_time = old['phases'].get(phase)
+            if old_time is None or time_ms < 1.0:
+                continue
+            if time_ms > old_time * (1.0 + threshold):
+                regressions.append('%s/%s: %s %.1f -> %.1f ms' % (
+                    entry['program'], entry['target'], phase, old_time,
+                    time_ms))
+
+    if baseline is None:
+        print('no baseline to compare with (see `make bench-baseline\')')
+    elif regressions:
+        print('\nworse than the baseline (%s): phases slower by more than '
+              '%d%%, programs which are no longer compiled:'
+              % (baseline['revision'], threshold * 100))
+        for line in regressions:
+            print('   ' + line)
+    else:
+        print('\nno phase slower than the baseline (%s) by more than %d%%'
+              % (baseline['revision'], threshold * 100))
+    return regressions
+
+
+def bench_compile(args):
+    programs = generate_programs(args.shapes, args.sizes,
+                                 os.path.join(args.objdir, 'programs'))
+    out_dir = os.path.join(args.objdir, 'compile')
+    os.makedirs(out_dir, exist_ok=True)
+
+    results = run_header('compile')
+    results['repeat'] = args.repeat
+    results['acse_args'] = args.acse_args
+    results['results'] = []
+    for program in programs:
+        for target in args.targets:
+            acse = os.path.join(args.objdir, target, 'acse')
+            start = time.time()
+            entry = compile_program(acse, program, target, out_dir,
+                                    args.repeat, args.timeout,
+                                    args.acse_args)
+            sys.stderr.write('%s (%s): %s, %.1f s\n' % (
+                program[0], target, entry['status'], time.time() - start))
+            results['results'].append(entry)
+
+    save_results(results, args.results, 'compile')
+    print()
+    regressions = print_compile_table(results['results'],
+                                      load_baseline(args.baseline),
+                                      args.threshold)
+    return 1 if regressions and args.strict else 0
+
+
+#
+# runtime benchmarks
+#
+
+def run_program(cmd, timeout):
+    try:
+        proc = subprocess.run(cmd, stdout=subprocess.PIPE,
+                              stderr=subprocess.PIPE, timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return 'timeout', None
+    except OSError:
+        return 'error', None
+    return 'ok', proc
+
+
+# compile `src', returning the status, the acse statistics and the output
+def compile_kernel(acse, src, out_dir, name, options):
+    stats = os.path.join(out_dir, name + '.json')
+    asm = os.path.join(out_dir, name + '.asm')
+    status, proc = run_program([acse] + options + ['--stats', stats, src, asm],
+                               None)
+    if status != 'ok' or proc.returncode != 0:
+        if proc is not None:
+            sys.stderr.write(proc.stderr.decode(errors='replace'))
+        return 'compile error', None, asm
+    with open(stats) as f:
+        return 'ok', json.load(f), asm
+
+
+def fill_static_stats(entry, stats):
+    counters = stats['counters']
+    entry['static_size'] = counters.get('instructions.final')
+    entry['spills'] = counters.get('ra.spills')
+
+
+def check_output(entry, output, expected):
+    if output.decode(errors='replace') != expected:
+        entry['status'] = 'wrong output'
+        return False
+    return True
+
+
+def bench_kernel_mace(args, name, src, expected, out_dir):
+    entry = {'status': 'ok'}
+    acse = os.path.join(args.objdir, 'mace', 'acse')
+    status, stats, asm = compile_kernel(acse, src, out_dir, name + '-mace',
+                                       args.acse_args)
+    if status != 'ok':
+        entry['status'] = status
+        return entry
+    fill_static_stats(entry, stats)
+
+    obj = os.path.join(out_dir, name + '-mace.o')
+    status, proc = run_program([args.asm, asm, obj], None)
+    if status != 'ok' or proc.returncode != 0:
+        entry['status'] = 'assembler error'
+        return entry
+
+    status, proc = run_program([args.mace, 'count', obj], args.timeout)
+    if status != 'ok' or proc.returncode != 0:
+        entry['status'] = status if status != 'ok' else 'runtime error'
+        return entry
+    if not check_output(entry, proc.stdout, expected):
+        return entry
+    for line in proc.stderr.decode(errors='replace').splitlines():
+        if line.startswith('Executed instructions:'):
+            entry['instructions'] = int(line.split(':')[1])
+        elif line.startswith('Executed loads:'):
+            entry['loads'] = int(line.split(':')[1])
+        elif line.startswith('Executed stores:'):
+            entry['stores'] = int(line.split(':')[1])
+    return entry
+
+
+def bench_kernel_amd64(args, name, src, expected, out_dir):
+    entry = {'status': 'ok'}
+    acse = os.path.join(args.objdir, 'amd64', 'acse')
+    status, stats, asm = compile_kernel(acse, src, out_dir, name + '-amd64',
+                                       args.acse_args)
+    if status != 'ok':
+        entry['status'] = status
+        return entry
+    fill_static_stats(entry, stats)
+
+    # the native toolchain is optional
+    fmt = 'macho64' if platform.system() == 'Darwin' else 'elf64'
+    obj = os.path.join(out_dir, name + '-amd64.o')
+    exe = os.path.join(out_dir, name + '-amd64')
+    runtime = os.path.join(ROOT_DIR, 'acse', 'amd64', 'runtime', 'lance_rt.c')
+    status, proc = run_program([args.nasm, '-f', fmt, asm, '-o', obj], None)
+    if status == 'ok' and proc.returncode == 0:
+        status, proc = run_program([args.cc, '-O2', obj, runtime, '-o', exe],
+                                   None)
+    if status != 'ok' or proc.returncode != 0:
+        entry['status'] = 'no native toolchain'
+        return entry
+
+    best = None
+    for _ in range(args.repeat):
+        start = time.perf_counter()
+        status, proc = run_program([exe], args.timeout)
+        elapsed = (time.perf_counter() - start) * 1e3
+        if status != 'ok' or proc.returncode != 0:
+            entry['status'] = status if status != 'ok' else 'runtime error'
+            return entry
+        if not check_output(entry, proc.stdout, expected):
+            return entry
+        best = elapsed if best is None else min(best, elapsed)
+    entry['time_ms'] = best
+    return entry
+
+
+def print_runtime_table(entries, baseline, threshold):
+    base = {}
+    if baseline is not None:
+        base = dict((e['program'], e) for e in baseline['results'])
+
+    # the static measures are available even if the program was not run
+    def measure(entry, target, key):
+        if entry is None:
+            return None
+        return entry[target].get(key)
+
+    def column(entry, old, target, key, fmt):
+        new_value = measure(entry, target, key)
+        if new_value is None:
+            return ('%-22s' % entry[target]['status'])[:22]
+        return '%-22s' % ((fmt % new_value) + ' ' + format_change(
+            measure(old, target, key), new_value))
+
+    print('%-14s %-22s %-22s %-22s %-22s %-22s' % (
+        'program', 'mace instructions', 'mace loads/stores', 'mace size/spills',
+        'amd64 time (ms)', 'amd64 size/spills'))
+    regressions = []
+    for entry in entries:
+        old = base.get(entry['program'])
+        sizes = []
+        for target in ('mace', 'amd64'):
+            if 'static_size' in entry[target]:
+                sizes.append('%-22s' % ('%d/%d' % (
+                    entry[target]['static_size'], entry[target]['spills'])))
+            else:
+                sizes.append('%-22s' % '-')
+        if 'loads' in entry['mace']:
+            memory = '%-22s' % ('%d/%d' % (
+                entry['mace']['loads'], entry['mace']['stores']))
+        else:
+            memory = '%-22s' % '-'
+        print('%-14s %s %s %s %s %s' % (
+            entry['program'],
+            column(entry, old, 'mace', 'instructions', '%d'), memory, sizes[0],
+            column(entry, old, 'amd64', 'time_ms', '%.2f'), sizes[1]))
+
+        if old is None:
+            continue
+        # the counts are exact, the times are compared with a tolerance
+        checks = [('mace', 'instructions', 0), ('mace', 'loads', 0),
+                  ('mace', 'stores', 0), ('mace', 'static_size', 0),
+                  ('mace', 'spills', 0), ('amd64', 'static_size', 0),
+                  ('amd64', 'spills', 0), ('amd64', 'time_ms', threshold)]
+        for target, key, tolerance in checks:
+            old_value = measure(old, target, key)
+            new_value = measure(entry, target, key)
+            if old_value is None or new_value is None:
+                continue
+            if new_value > old_value * (1.0 + tolerance):
+                regressions.append('%s/%s: %s %s -> %s' % (
+                    entry['program'], target, key, old_value, new_value))
+
+    if baseline is None:
+        print('no baseline to compare with (see `make bench-baseline\')')
+    elif regressions:
+        print('\nworse than the baseline (%s):' % baseline['revision'])
+        for line in regressions:
+            print('   ' + line)
+    else:
+        print('\nnothing worse than the baseline (%s)' % baseline['revision'])
+    return regressions
+
+
+def bench_runtime(args):
+    out_dir = os.path.join(args.objdir, 'runtime')
+    os.makedirs(out_dir, exist_ok=True)
+
+    results = run_header('runtime')
+    results['repeat'] = args.repeat
+    results['acse_args'] = args.acse_args
+    results['results'] = []
+    failed = False
+    kernels = sorted(glob.glob(os.path.join(args.kernels, '*.src')))
+    for src in kernels:
+        name = os.path.splitext(os.path.basename(src))[0]
+        with open(os.path.splitext(src)[0] + '.out') as f:
+            expected = f.read()
+        entry = {'program': name}
+        entry['mace'] = bench_kernel_mace(args, name, src, expected, out_dir)
+        entry['amd64'] = bench_kernel_amd64(args, name, src, expected,
+                                            out_dir)
+        for target in ('mace', 'amd64'):
+            status = entry[target]['status']
+            sys.stderr.write('%s (%s): %s\n' % (name, target, status))
+            failed = failed or status not in ('ok', 'no native toolchain')
+        results['results'].append(entry)
+
+    save_results(results, args.results, 'runtime')
+    print()
+    regressions = print_runtime_table(results['results'],
+                                      load_baseline(args.baseline),
+                                      args.threshold)
+    if failed:
+        return 1
+    return 1 if regressions and args.strict else 0
+
+
+def add_common_options(parser, repeat, threshold):
+    parser.add_argument('--objdir', default=os.path.join(BENCH_DIR, 'obj'),
+                        help='directory containing TARGET/acse, also used '
+                             'for the generated files')
+    parser.add_argument('--results',
+                        default=os.path.join(BENCH_DIR, 'results'),
+                        help='directory where the results are saved')
+    parser.add_argument('--baseline', default=None,
+                        help='results to compare with (default: '
+                             'RESULTS/KIND-baseline.json)')
+    parser.add_argument('--repeat', type=int, default=repeat,
+                        help='runs of each measure; the fastest one is kept')
+    parser.add_argument('--timeout', type=float, default=600,
+                        help='seconds after which a run is stopped and '
+                             'recorded as timed out')
+    parser.add_argument('--threshold', type=float, default=threshold,
+                        help='relative slowdown reported as a regression')
+    parser.add_argument('--strict', action='store_true',
+                        help='fail if there are regressions')
+    parser.add_argument('--acse-args', default='', type=str.split,
+                        help='additional options of acse, for instance '
+                             '"--regalloc coloring"')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='ACSE benchmark driver')
+    sub = parser.add_subparsers(dest='kind')
+
+    comp = sub.add_parser('compile', help='compile-time benchmarks')
+    add_common_options(comp, 3, 0.10)
+    comp.add_argument('--targets', nargs='+', default=['mace', 'amd64'])
+    comp.add_argument('--shapes', nargs='+', default=list(gen_bench.SHAPES),
+                      choices=list(gen_bench.SHAPES))
+    comp.add_argument('--sizes', nargs='+', type=int,
+                      default=[1000, 10000, 100000],
+                      help='number of statements of each program')
+
+    run = sub.add_parser('runtime', help='runtime benchmarks')
+    add_common_options(run, 5, 0.10)
+    run.add_argument('--kernels', default=os.path.join(BENCH_DIR, 'kernels'),
+                     help='directory of the programs (NAME.src) and of '
+                          'their expected output (NAME.out)')
+    run.add_argument('--asm', default=os.path.join(ROOT_DIR, 'bin', 'asm'))
+    run.add_argument('--mace', default=os.path.join(ROOT_DIR, 'bin', 'mace'))
+    run.add_argument('--nasm', default=os.environ.get('NASM', 'nasm'))
+    run.add_argument('--cc', default=os.environ.get('CC', 'cc'))
+
+    args = parser.parse_args()
+    if args.kind is None:
+        parser.print_help()
+        return 1
+    if args.baseline is None:
+        args.baseline = os.path.join(args.results, args.kind + '-baseline.json')
+    if args.kind == 'compile':
+        return bench_compile(args)
+    return bench_runtime(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,1121 @@
+/*
+ * Andrea Di Biagio
+ * Politecnico di Milano, 2007
+ * Daniele Cattaneo
+ * Politecnico di Milano, 2020
+ * 
+ * collections.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "collections.h"
+
+/* function prototypes */
+static t_list * newElement(void *data);
+static unsigned long lastWordMask(t_bitset *set);
+static void *checkedAlloc(void *ptr);
+static void **smallVectorItems(t_small_vector *svec);
+static int findSlot(t_hashmap *map, void *key, unsigned int hash);
+static void rehashMap(t_hashmap *map, int capacity);
+
+
+/* remove the first element of the list. Returns the new
+ * head of the list */
+t_list * removeFirst(t_list *list)
+{
+   t_list *first_elem;
+   
+   if (list == NULL)
+      return NULL;
+
+   first_elem = list;
+   list = LNEXT(list);
+   if (list != NULL)
+      SET_PREV(list, NULL);
+   
+   free(first_elem);
+
+   /* postconditions: return the new head of the list */
+   return list;
+}
+
+/* add an element `data' to the list `list' at position `pos'. If pos is negative
+ * , or is larger than the number of elements in the list, the new element is
+ * added on to the end of the list. Function `addElement' returns a pointer
+ * to the new head of the list */
+t_list * addElement(t_list *list, void * data, int pos)
+{
+   t_list *result;
+   t_list *current_elem;
+   t_list *last_elem;
+   int   current_pos;
+   
+   /* initialize the value of `result' */
+   result = newElement(data);
+
+   if (list == NULL)
+      return result;
+   
+   if (pos == 0)
+   {
+      /* update the control informations */
+      SET_NEXT(result, list);
+      SET_PREV(list, result);
+      
+      /* return the new head of the list */
+      return result;
+   }
+   
+   /* retrieve the last element of the list */
+   last_elem = getLastElement(list);
+   assert(last_elem != NULL);
+   
+   if (pos < 0)
+   {
+      /* update the control informations */
+      SET_NEXT(last_elem, result);
+      SET_PREV(result, last_elem);
+      
+      /* update the value of result */
+      return list;
+   }
+   
+   /* `pos' is a positive integer */
+   current_pos = 0;
+   current_elem = list;
+   
+   while(current_pos < pos)
+   {
+      if (current_elem == last_elem)
+      {
+         /* update the control informations */
+         SET_NEXT(last_elem, result);
+         SET_PREV(result, last_elem);
+         
+         /* update the value of result */
+         return list;
+      }
+      
+      /* update the loop informations */
+      current_elem = LNEXT(current_elem);
+      current_pos++;
+   }
+
+   /* assertions */
+   assert(current_elem != NULL);
+   
+   /* update the control informations */
+   SET_NEXT(result, current_elem);
+   SET_PREV(result, LPREV(current_elem));
+   SET_NEXT(LPREV(current_elem), result);
+   SET_PREV(current_elem, result);
+   
+   /* return the new head of the list */
+   return list;
+}
+
+/* add an element at the beginning of the list */
+t_list * addFirst(t_list *list, void * data)
+{
+   t_list *result;
+   
+   /* initialize the value of `result' */
+   result = newElement(data);
+   
+   if (list == NULL)
+      return result;
+   
+   /* postconditions */
+   SET_PREV(list, result);
+   SET_NEXT(result, list);
+   
+   /* return the new head of the list */
+   return result;
+}
+
+/* add an element to the end of the list */
+t_list * addLast(t_list *list, void * data)
+{
+   /* call the `addElement' */
+   return addElement(list, data, -1);
+}
+
+t_list *addBefore(t_list *listPos, void *data)
+{
+   t_list *elem = newElement(data);
+   if (!listPos)
+      return elem;
+   SET_NEXT(elem, listPos);
+   SET_PREV(elem, LPREV(listPos));
+   SET_PREV(listPos, elem);
+   if (LPREV(elem))
+      SET_NEXT(LPREV(elem), elem);
+   return elem;
+}
+
+t_list *addAfter(t_list *listPos, void *data)
+{
+   t_list *elem = newElement(data);
+   if (!listPos)
+      return elem;
+   SET_NEXT(elem, LNEXT(listPos));
+   SET_PREV(elem, listPos);
+   SET_NEXT(listPos, elem);
+   if (LNEXT(elem))
+      SET_PREV(LNEXT(elem), elem);
+   return elem;
+}
+
+/* remove an element from the list */
+t_list * removeElement(t_list *list, void * data)
+{
+   t_list *current_elem;
+   
+   /* preconditions: the list shouldn't be empty */
+   if (list == NULL)
+      return NULL;
+   
+   /* intialize the value of `current_elem' */
+   current_elem = list;
+   while (  (current_elem != NULL)
+            && (LDATA(current_elem) != data))
+   {
+      current_elem = LNEXT(current_elem);
+   }
+   
+   return removeElementLink(list, current_elem);
+}
+
+/* remove all the elements of a list */
+void freeList(t_list *list)
+{
+   /* verify the preconditions */
+   if (list == NULL)
+      return;
+
+   /* recursively call the freeList */
+   freeList(LNEXT(list));
+   
+   /* deallocate memory for the current element of the list */
+   free(list);
+}
+
+t_list * newElement(void *data)
+{
+   t_list * result;
+   
+   /* create an instance of t_list in memory */
+   result = (t_list *)malloc(sizeof(t_list));
+
+   /* verify the out of memory condition */
+   if (result == NULL)
+   {
+      fprintf(stderr, "COLLECTIONS.C:: _ALLOC_FUNCTION returned a NULL pointer \n");
+      abort();
+   }
+
+   /* set the internal value of the just created t_list element */
+   SET_DATA(result, data);
+   SET_PREV(result, NULL);
+   SET_NEXT(result, NULL);
+   
+   /* postconditions : return the element */
+   return result;
+}
+
+t_list * getLastElement(t_list *list)
+{
+   /* preconditions */
+   if (list == NULL)
+      return NULL;
+   
+   /* test if the current element is the last element of the list */
+   if (LNEXT(list) == NULL)
+      return list;
+   
+   /* recursively call the getLastElement on the next item of the list */
+   return getLastElement(LNEXT(list));
+}
+
+/* remove a link from the list `list' */
+extern t_list * removeElementLink(t_list *list, t_list *element)
+{  
+   /* preconditions */
+   if (list == NULL || element == NULL)
+      return list;
+   assert(LPREV(list) == NULL && "prev link of head of list not NULL");
+   if ((LPREV(element) == NULL) && (element != list))
+      return list;
+
+   /* the value is found */
+   if (LPREV(element) != NULL)
+   {
+      SET_NEXT(LPREV(element), LNEXT(element));
+      if (LNEXT(element) != NULL)
+         SET_PREV(LNEXT(element), LPREV(element));
+      
+      free(element);
+   }
+   else
+   {
+      /* check the preconditions */
+      assert(list == element);
+      
+      if (LNEXT(element) != NULL)
+      {
+         SET_PREV(LNEXT(element), NULL);
+         
+         /* update the new head of the list */
+         list = LNEXT(element);
+      }
+      else
+         list = NULL;
+      
+      free(element);
+   }
+   
+   /* return the new top of the list */
+   return list;
+}
+
+/* find an element inside the list `list'. The current implementation calls the
+ * CustomfindElement' passing a NULL reference as `func' */
+t_list * findElement(t_list *list, void *data)
+{
+   t_list *current_elem;
+   
+   /* if the list is empty returns a NULL pointer */
+   if (list == NULL)
+      return NULL;
+
+   /* intialize the value of `current_elem' */
+   current_elem = list;
+   while (  (current_elem != NULL)
+         && (  LDATA(current_elem) != data) )
+   {
+      current_elem = LNEXT(current_elem);
+   }
+   
+   /* postconditions */
+   return current_elem;
+}
+
+/* find an element inside the list `list'. */
+t_list * CustomfindElement(t_list *list, void *data
+      , int (*compareFunc)(void *a, void *b))
+{
+   t_list *current_elem;   
+   
+   /* preconditions */
+   if (compareFunc == NULL)
+      return findElement(list, data);
+   
+   if (list == NULL)
+      return NULL;
+   
+   /* intialize the value of `current_elem' */
+   current_elem = list;
+   while (current_elem != NULL)
+   {
+      void *other_Data;
+
+      other_Data = LDATA(current_elem);
+
+      if (compareFunc(other_Data, data))
+         break;
+      
+      current_elem = LNEXT(current_elem);
+   }  
+
+   /* postconditions */
+   return current_elem;
+}
+
+int getPosition(t_list *list, t_list *element)
+{
+   int counter;
+   
+   /* preconditions */
+   if (list == NULL || element == NULL)
+      return -1;
+   
+   /* initialize the local variable `counter' */
+   counter = 0;
+   
+   if (list == element)
+      return counter;
+   
+   /* update values */
+   counter++;
+   list = LNEXT(list);
+   
+   while (list != NULL)
+   {
+      if (list == element)
+         return counter;
+      
+      counter++;
+      list = LNEXT(list);
+   }
+   
+   return -1;
+}
+
+int getLength(t_list *list)
+{
+   int counter;
+   
+   /* initialize the local variable `counter' */
+   counter = 0;
+
+   /* precondition */
+   if (list == NULL)
+      return counter;
+   
+   while (list != NULL)
+   {
+      counter++;
+      list = LNEXT(list);
+   }
+   
+   /* postconditions: return the length of the list */
+   return counter;
+}
+
+t_list * cloneList(t_list *list)
+{
+   t_list *result;
+   t_list *current_element;
+
+   /* initialize the local variables */
+   result = NULL;
+   current_element = list;
+
+   /* preconditions */
+   if (current_element == NULL)
+      return result;
+
+   while(current_element != NULL)
+   {
+      /* add an element to the new list */
+      result = addElement(result, LDATA(current_element), -1);
+
+      /* retrieve the next element of the list */
+      current_element = LNEXT(current_element);
+   }
+
+   /* return the new list */
+   return result;
+}
+
+t_list * getElementAt(t_list *list, unsigned int position)
+{
+   t_list *current_element;
+   unsigned int current_pos;
+   
+   if (list == NULL)
+      return NULL;
+
+   /* initialize the local variables */
+   current_element = list;
+   current_pos = 0;
+   while((current_element != NULL) && (current_pos < position))
+   {
+      current_element = LNEXT(current_element);
+      current_pos++;
+   }
+
+   /* return the element at the requested position */
+   return current_element;
+}
+
+t_list * addList(t_list *list, t_list *elements)
+{
+   t_list *current_element;
+   t_list *last_element;
+   void *current_data;
+
+   /* if the list of elements is null, this function
+    * will return `list' unmodified */
+   if (elements == NULL)
+      return list;
+
+   /* look for the end of the list only once */
+   last_element = getLastElement(list);
+
+   /* initialize the value of `current_element' */
+   current_element = elements;
+   while (current_element != NULL)
+   {
+      /* retrieve the data associated with the current element */
+      current_data = LDATA(current_element);
+      if (last_element == NULL)
+      {
+         list = addFirst(list, current_data);
+         last_element = list;
+      }
+      else
+         last_element = addAfter(last_element, current_data);
+
+      /* retrieve the next element in the list */
+      current_element = LNEXT(current_element);
+   }
+
+   /* return the new list */
+   return list;
+}
+
+t_list * addListToSet(t_list *list, t_list *elements
+      , int (*compareFunc)(void *a, void *b), int *modified)
+{
+   t_list *current_element;
+   void *current_data;
+
+   /* if the list of elements is NULL returns the current list */
+   if (elements == NULL)
+      return list;
+
+   /* initialize the value of `current_element' */
+   current_element = elements;
+   while (current_element != NULL)
+   {
+      /* retrieve the data associated with the current element */
+      current_data = LDATA(current_element);
+
+      /* Test if the element was already inserted. */
+      if (CustomfindElement(list, current_data, compareFunc) == NULL)
+      {
+         list = addElement(list, current_data, -1);
+         if (modified != NULL)
+            (* modified) = 1;
+      }
+
+      /* retrieve the next element in the list */
+      current_element = LNEXT(current_element);
+   }
+
+   /* return the new list */
+   return list;
+}
+
+/* add sorted */
+t_list * addSorted(t_list *list, void * data
+            , int (*compareFunc)(void *a, void *b))
+{
+   t_list *current_element;
+   void *current_data;
+   int counter;
+   
+   /* preconditions */
+   if (list == NULL)
+      return addFirst(list, data);
+
+   counter = 0;
+   current_element = list;
+   while(current_element != NULL)
+   {
+      /* get the current interval informations */
+      current_data = LDATA(current_element);
+      assert(current_data != NULL);
+
+      if (compareFunc(current_data, data) >= 0)
+      {
+         list = addElement(list, data, counter);
+         return list;
+      }
+         
+      /* retrieve the next element */
+      current_element = LNEXT(current_element);
+
+      /* update the value of counter */
+      counter++;
+   }
+
+   return addElement(list, data, -1);
+}
+
+#define BITS_PER_WORD ((int)(sizeof(unsigned long) * 8))
+
+t_bitset * allocBitset(int size)
+{
+   t_bitset *result;
+
+   if (size < 0)
+      size = 0;
+
+   result = (t_bitset *)malloc(sizeof(t_bitset));
+   if (result == NULL)
+   {
+      fprintf(stderr, "COLLECTIONS.C:: _ALLOC_FUNCTION returned a NULL pointer \n");
+      abort();
+   }
+
+   result->size = size;
+   result->numWords = (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+   result->words = (unsigned long *)calloc(
+         result->numWords ? result->numWords : 1, sizeof(unsigned long));
+   if (result->words == NULL)
+   {
+      fprintf(stderr, "COLLECTIONS.C:: _ALLOC_FUNCTION returned a NULL pointer \n");
+      abort();
+   }
+
+   return result;
+}
+
+void freeBitset(t_bitset *set)
+{
+   if (set == NULL)
+      return;
+   free(set->words);
+   free(set);
+}
+
+void clearBitset(t_bitset *set)
+{
+   memset(set->words, 0, set->numWords * sizeof(unsigned long));
+}
+
+void addToBitset(t_bitset *set, int elem)
+{
+   assert(elem >= 0 && elem < set->size);
+   set->words[elem / BITS_PER_WORD] |= 1UL << (elem % BITS_PER_WORD);
+}
+
+void removeFromBitset(t_bitset *set, int elem)
+{
+   if (elem < 0 || elem >= set->size)
+      return;
+   set->words[elem / BITS_PER_WORD] &= ~(1UL << (elem % BITS_PER_WORD));
+}
+
+int isInBitset(t_bitset *set, int elem)
+{
+   if (elem < 0 || elem >= set->size)
+      return 0;
+   return (set->words[elem / BITS_PER_WORD] >> (elem % BITS_PER_WORD)) & 1;
+}
+
+/* mask of the bits of the last word of `set' which are in range */
+static unsigned long lastWordMask(t_bitset *set)
+{
+   if (set->size % BITS_PER_WORD == 0)
+      return ~0UL;
+   return (1UL << (set->size % BITS_PER_WORD)) - 1;
+}
+
+int unionBitsets(t_bitset *dest, t_bitset *src)
+{
+   unsigned long modified = 0;
+   int numWords;
+   int i;
+
+   numWords = dest->numWords < src->numWords ? dest->numWords : src->numWords;
+   for (i = 0; i < numWords; i++)
+   {
+      unsigned long newWord = dest->words[i] | src->words[i];
+      if (i == dest->numWords - 1)
+         newWord &= lastWordMask(dest);
+      modified |= newWord ^ dest->words[i];
+      dest->words[i] = newWord;
+   }
+
+   return modified != 0;
+}
+
+void subtractBitsets(t_bitset *dest, t_bitset *src)
+{
+   int numWords;
+   int i;
+
+   numWords = dest->numWords < src->numWords ? dest->numWords : src->numWords;
+   for (i = 0; i < numWords; i++)
+      dest->words[i] &= ~src->words[i];
+}
+
+void copyBitset(t_bitset *dest, t_bitset *src)
+{
+   int numWords;
+
+   numWords = dest->numWords < src->numWords ? dest->numWords : src->numWords;
+   memcpy(dest->words, src->words, numWords * sizeof(unsigned long));
+   memset(dest->words + numWords, 0
+         , (dest->numWords - numWords) * sizeof(unsigned long));
+   if (dest->numWords > 0)
+      dest->words[dest->numWords - 1] &= lastWordMask(dest);
+}
+
+int nextInBitset(t_bitset *set, int elem)
+{
+   int i;
+   unsigned long word;
+
+   if (elem < 0)
+      elem = 0;
+   if (elem >= set->size)
+      return -1;
+
+   i = elem / BITS_PER_WORD;
+   word = set->words[i] & (~0UL << (elem % BITS_PER_WORD));
+   while (word == 0)
+   {
+      i++;
+      if (i >= set->numWords)
+         return -1;
+      word = set->words[i];
+   }
+
+   return i * BITS_PER_WORD + __builtin_ctzl(word);
+}
+
+int countBitset(t_bitset *set)
+{
+   int result = 0;
+   int i;
+
+   for (i = 0; i < set->numWords; i++)
+      result += __builtin_popcountl(set->words[i]);
+   return result;
+}
+
+int intersectBitsets(t_bitset *dest, t_bitset *src)
+{
+   unsigned long modified = 0;
+   int numWords;
+   int i;
+
+   numWords = dest->numWords < src->numWords ? dest->numWords : src->numWords;
+   for (i = 0; i < numWords; i++)
+   {
+      unsigned long newWord = dest->words[i] & src->words[i];
+      modified |= newWord ^ dest->words[i];
+      dest->words[i] = newWord;
+   }
+   for (; i < dest->numWords; i++)
+   {
+      modified |= dest->words[i];
+      dest->words[i] = 0;
+   }
+
+   return modified != 0;
+}
+
+int equalBitsets(t_bitset *a, t_bitset *b)
+{
+   t_bitset *longest;
+   int numWords;
+   int i;
+
+   numWords = a->numWords < b->numWords ? a->numWords : b->numWords;
+   if (memcmp(a->words, b->words, numWords * sizeof(unsigned long)) != 0)
+      return 0;
+
+   longest = a->numWords > b->numWords ? a : b;
+   for (i = numWords; i < longest->numWords; i++)
+   {
+      if (longest->words[i] != 0)
+         return 0;
+   }
+   return 1;
+}
+
+/* abort the program if an allocation failed */
+void *checkedAlloc(void *ptr)
+{
+   if (ptr == NULL)
+   {
+      fprintf(stderr, "COLLECTIONS.C:: _ALLOC_FUNCTION returned a NULL pointer \n");
+      abort();
+   }
+   return ptr;
+}
+
+t_vector * allocVector(int capacity)
+{
+   t_vector *result;
+
+   result = (t_vector *)checkedAlloc(malloc(sizeof(t_vector)));
+   result->size = 0;
+   result->capacity = 0;
+   result->items = NULL;
+   reserveVector(result, capacity);
+
+   return result;
+}
+
+void freeVector(t_vector *vec)
+{
+   if (vec == NULL)
+      return;
+   free(vec->items);
+   free(vec);
+}
+
+void reserveVector(t_vector *vec, int capacity)
+{
+   int newCapacity;
+
+   if (capacity <= vec->capacity)
+      return;
+
+   /* grow geometrically, so that adding an element costs O(1) amortized */
+   newCapacity = vec->capacity ? vec->capacity : 8;
+   while (newCapacity < capacity)
+      newCapacity *= 2;
+
+   vec->items = (void **)checkedAlloc(
+         realloc(vec->items, newCapacity * sizeof(void *)));
+   vec->capacity = newCapacity;
+}
+
+void resizeVector(t_vector *vec, int size)
+{
+   if (size < 0)
+      size = 0;
+   reserveVector(vec, size);
+   if (size > vec->size)
+      memset(vec->items + vec->size, 0, (size - vec->size) * sizeof(void *));
+   vec->size = size;
+}
+
+int addToVector(t_vector *vec, void *data)
+{
+   if (vec->size == vec->capacity)
+      reserveVector(vec, vec->size + 1);
+   vec->items[vec->size] = data;
+   return vec->size++;
+}
+
+void *removeLastFromVector(t_vector *vec)
+{
+   assert(vec->size > 0);
+   return vec->items[--vec->size];
+}
+
+void removeFromVectorAt(t_vector *vec, int pos)
+{
+   assert(pos >= 0 && pos < vec->size);
+   memmove(vec->items + pos, vec->items + pos + 1
+         , (vec->size - pos - 1) * sizeof(void *));
+   vec->size--;
+}
+
+void insertInVectorAt(t_vector *vec, int pos, void *data)
+{
+   assert(pos >= 0 && pos <= vec->size);
+   if (vec->size == vec->capacity)
+      reserveVector(vec, vec->size + 1);
+   memmove(vec->items + pos + 1, vec->items + pos
+         , (vec->size - pos) * sizeof(void *));
+   vec->items[pos] = data;
+   vec->size++;
+}
+
+void clearVector(t_vector *vec)
+{
+   vec->size = 0;
+}
+
+int findInVector(t_vector *vec, void *data)
+{
+   int i;
+
+   for (i = 0; i < vec->size; i++)
+   {
+      if (vec->items[i] == data)
+         return i;
+   }
+   return -1;
+}
+
+void sortVector(t_vector *vec
+      , int (*compareFunc)(const void *a, const void *b))
+{
+   if (vec->size > 1)
+      qsort(vec->items, vec->size, sizeof(void *), compareFunc);
+}
+
+/* returns the array holding the elements of a small vector */
+void **smallVectorItems(t_small_vector *svec)
+{
+   return svec->heapItems ? svec->heapItems : svec->inlineItems;
+}
+
+void initSmallVector(t_small_vector *svec)
+{
+   svec->size = 0;
+   svec->capacity = SMALL_VECTOR_INLINE;
+   svec->heapItems = NULL;
+}
+
+void finalizeSmallVector(t_small_vector *svec)
+{
+   free(svec->heapItems);
+   initSmallVector(svec);
+}
+
+void addToSmallVector(t_small_vector *svec, void *data)
+{
+   if (svec->size == svec->capacity)
+   {
+      int newCapacity = svec->capacity * 2;
+
+      if (svec->heapItems == NULL)
+      {
+         svec->heapItems = (void **)checkedAlloc(
+               malloc(newCapacity * sizeof(void *)));
+         memcpy(svec->heapItems, svec->inlineItems
+               , svec->size * sizeof(void *));
+      }
+      else
+      {
+         svec->heapItems = (void **)checkedAlloc(
+               realloc(svec->heapItems, newCapacity * sizeof(void *)));
+      }
+      svec->capacity = newCapacity;
+   }
+
+   smallVectorItems(svec)[svec->size++] = data;
+}
+
+void removeFromSmallVectorAt(t_small_vector *svec, int pos)
+{
+   void **items = smallVectorItems(svec);
+
+   assert(pos >= 0 && pos < svec->size);
+   items[pos] = items[--svec->size];
+}
+
+int findInSmallVector(t_small_vector *svec, void *data)
+{
+   void **items = smallVectorItems(svec);
+   int i;
+
+   for (i = 0; i < svec->size; i++)
+   {
+      if (items[i] == data)
+         return i;
+   }
+   return -1;
+}
+
+void copySmallVector(t_small_vector *dest, t_small_vector *src)
+{
+   void **items = smallVectorItems(src);
+   int i;
+
+   dest->size = 0;
+   for (i = 0; i < src->size; i++)
+      addToSmallVector(dest, items[i]);
+}
+
+/* states of the slots of a hash map */
+#define HASHMAP_EMPTY      0
+#define HASHMAP_USED       1
+#define HASHMAP_DELETED    2
+
+/* the map is grown when more than 3/4 of the slots are not empty */
+#define HASHMAP_MIN_CAPACITY 16
+#define HASHMAP_IS_FULL(map, n) ((n) * 4 > (map)->capacity * 3)
+
+unsigned int hashPointer(void *key)
+{
+   uint64_t value = (uint64_t)(uintptr_t)key;
+
+   /* a 64-bit mix function, so that the low bits depend on all the bits
+    * of the key (pointers are aligned, integers are often sequential) */
+   value ^= value >> 33;
+   value *= 0xff51afd7ed558ccdULL;
+   value ^= value >> 33;
+   return (unsigned int)value;
+}
+
+int comparePointers(void *keyA, void *keyB)
+{
+   return keyA == keyB;
+}
+
+unsigned int hashString(void *key)
+{
+   const unsigned char *str = (const unsigned char *)key;
+   unsigned int hash = 2166136261U;
+
+   /* FNV-1a */
+   for (; *str; str++)
+   {
+      hash ^= *str;
+      hash *= 16777619U;
+   }
+   return hash;
+}
+
+int compareStrings(void *keyA, void *keyB)
+{
+   return strcmp((const char *)keyA, (const char *)keyB) == 0;
+}
+
+t_hashmap * allocHashMap(unsigned int (*hashFunc)(void *key)
+      , int (*compareFunc)(void *keyA, void *keyB))
+{
+   t_hashmap *result;
+
+   result = (t_hashmap *)checkedAlloc(malloc(sizeof(t_hashmap)));
+   result->hashFunc = hashFunc ? hashFunc : hashPointer;
+   result->compareFunc = compareFunc ? compareFunc : comparePointers;
+   result->size = 0;
+   result->numDeleted = 0;
+   result->capacity = HASHMAP_MIN_CAPACITY;
+   result->slots = (t_hashmap_slot *)checkedAlloc(
+         calloc(result->capacity, sizeof(t_hashmap_slot)));
+
+   return result;
+}
+
+void freeHashMap(t_hashmap *map)
+{
+   if (map == NULL)
+      return;
+   free(map->slots);
+   free(map);
+}
+
+/* returns the slot which holds `key', or -1 if the key is not in the map */
+int findSlot(t_hashmap *map, void *key, unsigned int hash)
+{
+   unsigned int mask = map->capacity - 1;
+   unsigned int i;
+
+   for (i = hash & mask; map->slots[i].state != HASHMAP_EMPTY
+         ; i = (i + 1) & mask)
+   {
+      t_hashmap_slot *slot = &map->slots[i];
+      if (slot->state == HASHMAP_USED && slot->hash == hash
+            && map->compareFunc(slot->key, key))
+         return i;
+   }
+   return -1;
+}
+
+/* move all the keys to a new array of slots with the given capacity */
+void rehashMap(t_hashmap *map, int capacity)
+{
+   t_hashmap_slot *oldSlots = map->slots;
+   int oldCapacity = map->capacity;
+   unsigned int mask;
+   int i;
+
+   map->slots = (t_hashmap_slot *)checkedAlloc(
+         calloc(capacity, sizeof(t_hashmap_slot)));
+   map->capacity = capacity;
+   map->numDeleted = 0;
+   mask = capacity - 1;
+
+   for (i = 0; i < oldCapacity; i++)
+   {
+      unsigned int j;
+
+      if (oldSlots[i].state != HASHMAP_USED)
+         continue;
+      for (j = oldSlots[i].hash & mask; map->slots[j].state != HASHMAP_EMPTY
+            ; j = (j + 1) & mask);
+      map->slots[j] = oldSlots[i];
+   }
+
+   free(oldSlots);
+}
+
+void putInHashMap(t_hashmap *map, void *key, void *value)
+{
+   unsigned int hash = map->hashFunc(key);
+   unsigned int mask;
+   unsigned int i;
+   int pos;
+
+   pos = findSlot(map, key, hash);
+   if (pos >= 0)
+   {
+      map->slots[pos].key = key;
+      map->slots[pos].value = value;
+      return;
+   }
+
+   if (HASHMAP_IS_FULL(map, map->size + map->numDeleted + 1))
+   {
+      /* double the capacity only if the map is actually full of keys;
+       * otherwise rehashing is enough to get rid of the deleted slots */
+      if (HASHMAP_IS_FULL(map, (map->size + 1) * 2))
+         rehashMap(map, map->capacity * 2);
+      else
+         rehashMap(map, map->capacity);
+   }
+
+   /* reuse the first empty or deleted slot */
+   mask = map->capacity - 1;
+   for (i = hash & mask; map->slots[i].state == HASHMAP_USED
+         ; i = (i + 1) & mask);
+   if (map->slots[i].state == HASHMAP_DELETED)
+      map->numDeleted--;
+
+   map->slots[i].key = key;
+   map->slots[i].value = value;
+   map->slots[i].hash = hash;
+   map->slots[i].state = HASHMAP_USED;
+   map->size++;
+}
+
+int getFromHashMap(t_hashmap *map, void *key, void **value)
+{
+   int pos;
+
+   pos = findSlot(map, key, map->hashFunc(key));
+   if (pos < 0)
+      return 0;
+   if (value != NULL)
+      *value = map->slots[pos].value;
+   return 1;
+}
+
+void *lookupHashMap(t_hashmap *map, void *key)
+{
+   void *result = NULL;
+
+   getFromHashMap(map, key, &result);
+   return result;
+}
+
+int removeFromHashMap(t_hashmap *map, void *key, void **storedKey)
+{
+   int pos;
+
+   pos = findSlot(map, key, map->hashFunc(key));
+   if (pos < 0)
+      return 0;
+
+   if (storedKey != NULL)
+      *storedKey = map->slots[pos].key;
+   map->slots[pos].state = HASHMAP_DELETED;
+   map->size--;
+   map->numDeleted++;
+   return 1;
+}
+
+void clearHashMap(t_hashmap *map)
+{
+   memset(map->slots, 0, map->capacity * sizeof(t_hashmap_slot));
+   map->size = 0;
+   map->numDeleted = 0;
+}
+
+int nextInHashMap(t_hashmap *map, int pos)
+{
+   if (pos < 0)
+      pos = 0;
+   for (; pos < map->capacity; pos++)
+   {
+      if (map->slots[pos].state == HASHMAP_USED)
+         return pos;
+   }
+   return -1;
+}
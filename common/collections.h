@@ -0,0 +1,367 @@
+/*
+ * Andrea Di Biagio
+ * Politecnico di Milano, 2007
+ * Daniele Cattaneo
+ * Politecnico di Milano, 2020
+ * 
+ * collections.h
+ * Formal Languages & Compilers Machine, 2007-2020
+ * 
+ * Container library shared by the compiler and the assembler:
+ *  - a double-linked list. `prev' pointer of first element and `next'
+ *    pointer of last element are NULL;
+ *  - a dense set of small integers (bit set);
+ *  - a growable array of pointers (vector);
+ *  - a vector which keeps its first few elements inline (small vector);
+ *  - an open-addressing hash map, and a hash set built on top of it.
+ * Unless stated otherwise, the functions abort the program when the system
+ * runs out of memory.
+ */
+
+#ifndef _COLLECTIONS_H
+#define _COLLECTIONS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+
+/* create a list data item from an integer value */
+#define INTDATA(data)               ((void *)((intptr_t)(data)))
+
+/* get the next list item. NULL if item is the last item in the list. */
+#define LNEXT(item)                 ((item)->next)
+/* get the previous list item. NULL if item is the first item in the list. */
+#define LPREV(item)                 ((item)->prev)
+/* get the data associated to this list item. */
+#define LDATA(item)                 ((item)->data)
+/* get the integer value data associated to this list item. */
+#define LINTDATA(item)              ((int)((intptr_t)LDATA(item)))
+
+/* set the next list item. */
+#define SET_NEXT(item, _next)       ((item)->next = (_next))
+/* set the previous list item. */
+#define SET_PREV(item, _prev)       ((item)->prev = (_prev))
+/* set the data associated to this list item. */
+#define SET_DATA(item, _data)       ((item)->data = (_data))
+/* set an integer value as the data associated to this list item. */
+#define SET_INTDATA(item, _data)    ((item)->data = INTDATA(_data))
+
+
+/* a list element */
+typedef struct t_list
+{
+   void  *data;
+   struct t_list *next;
+   struct t_list *prev;
+}t_list;
+
+
+/* add an element `data' to the list `list' at position `pos'. If pos is
+ * negative, or is larger than the number of elements in the list, the new
+ * element is added on to the end of the list. Function `addElement' returns a
+ * pointer to the new head of the list */
+extern t_list *addElement(t_list *list, void *data, int pos);
+
+/* add sorted */
+extern t_list *addSorted(
+      t_list *list, void *data, int (*compareFunc)(void *a, void *b));
+
+/* add an element to the end of the list */
+extern t_list *addLast(t_list *list, void *data);
+
+/* add an element at the beginning of the list */
+extern t_list *addFirst(t_list *list, void *data);
+
+/* Add an element before a given element already in the list.
+ * Returns the newly added element. */
+extern t_list *addBefore(t_list *listPos, void *data);
+
+/* Add an element after a given element already in the list.
+ * Returns the newly added element. */
+extern t_list *addAfter(t_list *listPos, void *data);
+
+/* remove an element at the beginning of the list */
+extern t_list *removeFirst(t_list *list);
+
+/* remove an element from the list */
+extern t_list *removeElement(t_list *list, void *data);
+
+/* remove a link from the list `list' */
+extern t_list *removeElementLink(t_list *list, t_list *element);
+
+/* find an element inside the list `list'. The current implementation calls the
+ * CustomfindElement' passing a NULL reference as `func' */
+extern t_list *findElement(t_list *list, void *data);
+
+/* find an element inside the list `list'. */
+extern t_list *CustomfindElement(
+      t_list *list, void *data, int (*compareFunc)(void *a, void *b));
+
+/* find the position of an `element' inside the `list'. -1 if not found */
+extern int getPosition(t_list *list, t_list *element);
+
+/* find the length of `list' */
+extern int getLength(t_list *list);
+
+/* remove all the elements of a list */
+extern void freeList(t_list *list);
+
+/* get the last element of the list. Returns NULL if the list is empty
+ * or list is a NULL pointer */
+extern t_list *getLastElement(t_list *list);
+
+/* retrieve the list element at position `position' inside the `list'.
+ * Returns NULL if: the list is empty, the list is a NULL pointer or
+ * the list holds less than `position' elements. */
+extern t_list *getElementAt(t_list *list, unsigned int position);
+
+/* create a new list with the same elements */
+extern t_list *cloneList(t_list *list);
+
+/* add a list of elements to another list */
+extern t_list *addList(t_list *list, t_list *elements);
+
+/* add a list of elements to a set */
+extern t_list *addListToSet(t_list *list, t_list *elements,
+      int (*compareFunc)(void *a, void *b), int *modified);
+
+
+/* a dense set of non-negative integers, smaller than `size' */
+typedef struct t_bitset
+{
+   int size;            /* number of elements which can be in the set */
+   int numWords;        /* number of words in `words' */
+   unsigned long *words;
+}t_bitset;
+
+/* create an empty bit set which can contain the integers in [0, size) */
+extern t_bitset *allocBitset(int size);
+
+/* free the memory associated with a bit set */
+extern void freeBitset(t_bitset *set);
+
+/* remove all the elements of the set */
+extern void clearBitset(t_bitset *set);
+
+/* add `elem' to the set. `elem' must be smaller than the size of the set. */
+extern void addToBitset(t_bitset *set, int elem);
+
+/* remove `elem' from the set. Elements out of range are ignored. */
+extern void removeFromBitset(t_bitset *set, int elem);
+
+/* returns non-zero if `elem' is in the set. Elements out of range are never
+ * in the set. */
+extern int isInBitset(t_bitset *set, int elem);
+
+/* set `dest' to the union of `dest' and `src'. Elements of `src' which are
+ * out of the range of `dest' are ignored. Returns non-zero if `dest' has been
+ * modified. */
+extern int unionBitsets(t_bitset *dest, t_bitset *src);
+
+/* remove from `dest' all the elements in `src' */
+extern void subtractBitsets(t_bitset *dest, t_bitset *src);
+
+/* make `dest' contain the same elements of `src' (within the range of
+ * `dest') */
+extern void copyBitset(t_bitset *dest, t_bitset *src);
+
+/* returns the smallest element of the set which is greater or equal
+ * than `elem', or -1 if there is none. Use it for iterating on the set:
+ *    for (i = nextInBitset(set, 0); i >= 0; i = nextInBitset(set, i+1)) */
+extern int nextInBitset(t_bitset *set, int elem);
+
+/* returns the number of elements in the set */
+extern int countBitset(t_bitset *set);
+
+/* set `dest' to the intersection of `dest' and `src'. Returns non-zero if
+ * `dest' has been modified. */
+extern int intersectBitsets(t_bitset *dest, t_bitset *src);
+
+/* returns non-zero if the two sets contain the same elements */
+extern int equalBitsets(t_bitset *a, t_bitset *b);
+
+
+/* get the number of elements in the vector */
+#define VSIZE(vec)                  ((vec)->size)
+/* get the element at position `i' of the vector. No bounds checking. */
+#define VDATA(vec, i)               ((vec)->items[i])
+/* get the integer value of the element at position `i' of the vector */
+#define VINTDATA(vec, i)            ((int)((intptr_t)VDATA(vec, i)))
+
+/* a growable array of pointers */
+typedef struct t_vector
+{
+   int size;            /* number of elements in the vector */
+   int capacity;        /* number of elements which fit in `items' */
+   void **items;
+}t_vector;
+
+/* create an empty vector with room for `capacity' elements */
+extern t_vector *allocVector(int capacity);
+
+/* free the memory associated with a vector. The elements are not freed. */
+extern void freeVector(t_vector *vec);
+
+/* make room for at least `capacity' elements */
+extern void reserveVector(t_vector *vec, int capacity);
+
+/* change the number of elements of the vector. New elements are NULL. */
+extern void resizeVector(t_vector *vec, int size);
+
+/* add an element to the end of the vector. Returns its position. */
+extern int addToVector(t_vector *vec, void *data);
+
+/* remove the last element of the vector and return it. The vector must not
+ * be empty. */
+extern void *removeLastFromVector(t_vector *vec);
+
+/* remove the element at position `pos', shifting the following ones */
+extern void removeFromVectorAt(t_vector *vec, int pos);
+
+/* insert an element at position `pos', shifting the following ones */
+extern void insertInVectorAt(t_vector *vec, int pos, void *data);
+
+/* remove all the elements of the vector */
+extern void clearVector(t_vector *vec);
+
+/* returns the position of the first occurrence of `data', or -1 */
+extern int findInVector(t_vector *vec, void *data);
+
+/* sort the vector with a `qsort' comparison function. Note that the
+ * function receives pointers to the elements, not the elements. */
+extern void sortVector(t_vector *vec, int (*compareFunc)(const void *a
+      , const void *b));
+
+
+/* number of elements which a small vector keeps inline */
+#define SMALL_VECTOR_INLINE         4
+
+/* get the number of elements in the small vector */
+#define SVSIZE(svec)                ((svec)->size)
+/* get the element at position `i' of the small vector */
+#define SVDATA(svec, i) \
+      (((svec)->heapItems ? (svec)->heapItems : (svec)->inlineItems)[i])
+
+/* A vector meant to be embedded in other structures or allocated on the
+ * stack. Up to SMALL_VECTOR_INLINE elements no heap memory is used. */
+typedef struct t_small_vector
+{
+   int size;                  /* number of elements */
+   int capacity;              /* capacity of `heapItems' */
+   void **heapItems;          /* NULL while the elements fit inline */
+   void *inlineItems[SMALL_VECTOR_INLINE];
+}t_small_vector;
+
+/* initialize an empty small vector */
+extern void initSmallVector(t_small_vector *svec);
+
+/* free the heap memory of a small vector (if any), and make it empty */
+extern void finalizeSmallVector(t_small_vector *svec);
+
+/* add an element to the end of the small vector */
+extern void addToSmallVector(t_small_vector *svec, void *data);
+
+/* remove the element at position `pos'. The last element takes its place,
+ * thus the order of the elements is not preserved. */
+extern void removeFromSmallVectorAt(t_small_vector *svec, int pos);
+
+/* returns the position of the first occurrence of `data', or -1 */
+extern int findInSmallVector(t_small_vector *svec, void *data);
+
+/* make `dest' (already initialized) a copy of `src' */
+extern void copySmallVector(t_small_vector *dest, t_small_vector *src);
+
+
+/* a slot of a hash map */
+typedef struct t_hashmap_slot
+{
+   void *key;
+   void *value;
+   unsigned int hash;
+   int state;           /* empty, used or deleted */
+}t_hashmap_slot;
+
+/* A hash map with open addressing and linear probing. Keys and values are
+ * pointers (or integers, see INTDATA). Keys are compared with a
+ * `compareFunc' which follows the conventions of `CustomfindElement':
+ * non-zero means equal. */
+typedef struct t_hashmap
+{
+   unsigned int (*hashFunc)(void *key);
+   int (*compareFunc)(void *keyA, void *keyB);
+   int size;            /* number of keys in the map */
+   int numDeleted;      /* number of slots holding a removed key */
+   int capacity;        /* number of slots. Always a power of two. */
+   t_hashmap_slot *slots;
+}t_hashmap;
+
+/* a set is a map whose keys have no associated value */
+typedef t_hashmap t_hashset;
+
+/* iterate over the keys of a map or set:
+ *    for (i = nextInHashMap(map, 0); i >= 0; i = nextInHashMap(map, i+1))
+ *       ... HMKEY(map, i), HMVALUE(map, i) ...
+ * The map must not be modified while iterating. The order of the iteration
+ * is not specified. */
+#define HMKEY(map, i)               ((map)->slots[i].key)
+#define HMVALUE(map, i)             ((map)->slots[i].value)
+/* get the number of keys in a map or set */
+#define HMSIZE(map)                 ((map)->size)
+
+/* create an empty hash map. If `hashFunc' and `compareFunc' are NULL,
+ * the keys are compared by identity (pointers and INTDATA values). */
+extern t_hashmap *allocHashMap(unsigned int (*hashFunc)(void *key)
+      , int (*compareFunc)(void *keyA, void *keyB));
+
+/* free the memory associated with a hash map. Keys and values are not
+ * freed. */
+extern void freeHashMap(t_hashmap *map);
+
+/* associate `value' to `key', replacing the previous value of `key' (the
+ * stored key is replaced as well) */
+extern void putInHashMap(t_hashmap *map, void *key, void *value);
+
+/* get the value associated to `key'. Returns non-zero if the key is in the
+ * map; if so, and `value' is not NULL, stores the value in `*value'. */
+extern int getFromHashMap(t_hashmap *map, void *key, void **value);
+
+/* returns the value associated to `key', or NULL if there is none */
+extern void *lookupHashMap(t_hashmap *map, void *key);
+
+/* remove `key' from the map. Returns non-zero if the key was in the map;
+ * if so, and `storedKey' is not NULL, stores in `*storedKey' the key which
+ * was in the map (useful when the map owns its keys). */
+extern int removeFromHashMap(t_hashmap *map, void *key, void **storedKey);
+
+/* remove all the keys from the map */
+extern void clearHashMap(t_hashmap *map);
+
+/* returns the first used slot at or after `pos', or -1 if there is none */
+extern int nextInHashMap(t_hashmap *map, int pos);
+
+/* create an empty hash set. See `allocHashMap'. */
+#define allocHashSet(hashFunc, compareFunc) \
+      allocHashMap((hashFunc), (compareFunc))
+/* free a hash set */
+#define freeHashSet(set)            freeHashMap(set)
+/* add `key' to a hash set */
+#define addToHashSet(set, key)      putInHashMap((set), (key), NULL)
+/* returns non-zero if `key' is in a hash set */
+#define isInHashSet(set, key)       getFromHashMap((set), (key), NULL)
+/* remove `key' from a hash set. Returns non-zero if it was in the set. */
+#define removeFromHashSet(set, key) removeFromHashMap((set), (key), NULL)
+/* iterate over a hash set, see `nextInHashMap' */
+#define nextInHashSet(set, pos)     nextInHashMap((set), (pos))
+
+/* hash and compare functions for pointer and integer keys */
+extern unsigned int hashPointer(void *key);
+extern int comparePointers(void *keyA, void *keyB);
+
+/* hash and compare functions for NUL-terminated string keys */
+extern unsigned int hashString(void *key);
+extern int compareStrings(void *keyA, void *keyB);
+
+
+#endif
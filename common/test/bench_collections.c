@@ -0,0 +1,190 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * bench_collections.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Microbenchmarks of the container library, comparing the list based
+ * idioms with the other containers. Run with `make bench'.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "collections.h"
+
+/* a value the compiler cannot optimize away */
+static volatile long sink;
+
+static double elapsedMs(clock_t start)
+{
+   return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, int n, double ms)
+{
+   fprintf(stdout, "%-40s n=%-7d %10.3f ms %10.1f ns/op\n"
+         , name, n, ms, ms * 1e6 / n);
+}
+
+/* append `n' elements at the end */
+static void benchAppend(int n)
+{
+   clock_t start;
+   t_list *list = NULL;
+   t_vector *vec;
+   int i;
+
+   start = clock();
+   for (i = 0; i < n; i++)
+      list = addElement(list, INTDATA(i), -1);
+   report("list append (addElement, -1)", n, elapsedMs(start));
+   freeList(list);
+
+   start = clock();
+   vec = allocVector(0);
+   for (i = 0; i < n; i++)
+      addToVector(vec, INTDATA(i));
+   report("vector append", n, elapsedMs(start));
+   freeVector(vec);
+}
+
+/* look up `n' keys, half of which are present */
+static void benchLookup(int n)
+{
+   clock_t start;
+   t_list *list = NULL;
+   t_hashset *set;
+   long found;
+   int i;
+
+   for (i = 0; i < n; i++)
+      list = addFirst(list, INTDATA(i * 2));
+   start = clock();
+   found = 0;
+   for (i = 0; i < n; i++)
+      found += findElement(list, INTDATA(i)) != NULL;
+   report("list lookup (findElement)", n, elapsedMs(start));
+   sink = found;
+   freeList(list);
+
+   start = clock();
+   set = allocHashSet(NULL, NULL);
+   for (i = 0; i < n; i++)
+      addToHashSet(set, INTDATA(i * 2));
+   found = 0;
+   for (i = 0; i < n; i++)
+      found += isInHashSet(set, INTDATA(i));
+   report("hash set insert + lookup", n, elapsedMs(start));
+   sink = found;
+   freeHashSet(set);
+}
+
+/* look up `n' string keys */
+static void benchStringLookup(int n)
+{
+   clock_t start;
+   t_hashmap *map;
+   char (*keys)[16];
+   long found;
+   int i;
+
+   keys = malloc(sizeof(*keys) * n);
+   for (i = 0; i < n; i++)
+      snprintf(keys[i], sizeof(keys[i]), "_label_%d", i);
+
+   start = clock();
+   map = allocHashMap(hashString, compareStrings);
+   for (i = 0; i < n; i++)
+      putInHashMap(map, keys[i], INTDATA(i));
+   found = 0;
+   for (i = 0; i < n; i++)
+      found += lookupHashMap(map, keys[n - 1 - i]) != NULL;
+   report("string hash map insert + lookup", n, elapsedMs(start));
+   sink = found;
+
+   freeHashMap(map);
+   free(keys);
+}
+
+/* compute the union of two sets of `n' elements over a universe of 2n */
+static void benchUnion(int n)
+{
+   clock_t start;
+   t_list *listA = NULL;
+   t_list *listB = NULL;
+   t_bitset *setA;
+   t_bitset *setB;
+   int modified;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      listA = addFirst(listA, INTDATA(i));
+      listB = addFirst(listB, INTDATA(i + n / 2));
+   }
+   start = clock();
+   listA = addListToSet(listA, listB, NULL, &modified);
+   report("list set union (addListToSet)", n, elapsedMs(start));
+   sink = getLength(listA);
+   freeList(listA);
+   freeList(listB);
+
+   setA = allocBitset(2 * n);
+   setB = allocBitset(2 * n);
+   for (i = 0; i < n; i++) {
+      addToBitset(setA, i);
+      addToBitset(setB, i + n / 2);
+   }
+   start = clock();
+   for (i = 0; i < 1000; i++) {
+      modified = unionBitsets(setA, setB);
+      subtractBitsets(setA, setB);
+   }
+   report("bitset union + subtract (x1000)", n, elapsedMs(start) / 1000);
+   sink = modified;
+   freeBitset(setA);
+   freeBitset(setB);
+}
+
+/* build `n' sets of at most three elements, as done for the operands of
+ * an instruction */
+static void benchSmallSets(int n)
+{
+   clock_t start;
+   t_small_vector svec;
+   long total;
+   int i, j;
+
+   start = clock();
+   total = 0;
+   for (i = 0; i < n; i++) {
+      t_list *list = NULL;
+      for (j = 0; j < 3; j++)
+         list = addElement(list, INTDATA(i + j), 0);
+      total += getLength(list);
+      freeList(list);
+   }
+   report("3-element list", n, elapsedMs(start));
+   sink = total;
+
+   start = clock();
+   total = 0;
+   for (i = 0; i < n; i++) {
+      initSmallVector(&svec);
+      for (j = 0; j < 3; j++)
+         addToSmallVector(&svec, INTDATA(i + j));
+      total += SVSIZE(&svec);
+      finalizeSmallVector(&svec);
+   }
+   report("3-element small vector", n, elapsedMs(start));
+   sink = total;
+}
+
+int main(void)
+{
+   benchAppend(20000);
+   benchLookup(20000);
+   benchStringLookup(200000);
+   benchUnion(20000);
+   benchSmallSets(1000000);
+   return 0;
+}
@@ -0,0 +1,271 @@
+/*
+ * Politecnico di Milano, 2020
+ *
+ * test_collections.c
+ * Formal Languages & Compilers Machine, 2007-2020
+ *
+ * Unit tests of the container library. Run with `make test'.
+ */
+
+#include <stdio.h>
+#include "collections.h"
+
+static int numChecks = 0;
+static int numFailures = 0;
+
+#define CHECK(cond) \
+   do { \
+      numChecks++; \
+      if (!(cond)) { \
+         numFailures++; \
+         fprintf(stderr, "%s:%d: check failed: %s\n" \
+               , __FILE__, __LINE__, #cond); \
+      } \
+   } while (0)
+
+static int compareInts(const void *a, const void *b)
+{
+   int intA = (int)(intptr_t)*(void * const *)a;
+   int intB = (int)(intptr_t)*(void * const *)b;
+   return (intA > intB) - (intA < intB);
+}
+
+static void testList(void)
+{
+   t_list *list = NULL;
+   t_list *elem;
+   int i;
+
+   for (i = 0; i < 10; i++)
+      list = addLast(list, INTDATA(i));
+   CHECK(getLength(list) == 10);
+   CHECK(LINTDATA(getElementAt(list, 3)) == 3);
+
+   elem = findElement(list, INTDATA(7));
+   CHECK(elem != NULL && getPosition(list, elem) == 7);
+
+   list = removeElement(list, INTDATA(0));
+   CHECK(LINTDATA(list) == 1);
+   CHECK(LINTDATA(getLastElement(list)) == 9);
+   CHECK(findElement(list, INTDATA(0)) == NULL);
+
+   freeList(list);
+}
+
+static void testBitset(void)
+{
+   t_bitset *a = allocBitset(130);
+   t_bitset *b = allocBitset(130);
+   int i, count;
+
+   CHECK(nextInBitset(a, 0) == -1);
+   addToBitset(a, 0);
+   addToBitset(a, 64);
+   addToBitset(a, 129);
+   CHECK(isInBitset(a, 64) && !isInBitset(a, 63) && !isInBitset(a, 130));
+   CHECK(countBitset(a) == 3);
+
+   count = 0;
+   for (i = nextInBitset(a, 0); i >= 0; i = nextInBitset(a, i + 1))
+      count++;
+   CHECK(count == 3);
+   CHECK(nextInBitset(a, 65) == 129);
+
+   addToBitset(b, 64);
+   addToBitset(b, 100);
+   CHECK(unionBitsets(b, a));
+   CHECK(!unionBitsets(b, a));
+   CHECK(countBitset(b) == 4);
+
+   CHECK(intersectBitsets(b, a));
+   CHECK(equalBitsets(a, b));
+
+   subtractBitsets(b, a);
+   CHECK(countBitset(b) == 0);
+
+   copyBitset(b, a);
+   CHECK(equalBitsets(a, b));
+   removeFromBitset(b, 129);
+   CHECK(!equalBitsets(a, b));
+
+   clearBitset(a);
+   CHECK(countBitset(a) == 0);
+
+   freeBitset(a);
+   freeBitset(b);
+}
+
+static void testVector(void)
+{
+   t_vector *vec = allocVector(0);
+   int i, ok;
+
+   for (i = 0; i < 1000; i++)
+      CHECK(addToVector(vec, INTDATA(999 - i)) == i);
+   CHECK(VSIZE(vec) == 1000);
+   CHECK(VINTDATA(vec, 10) == 989);
+   CHECK(findInVector(vec, INTDATA(0)) == 999);
+   CHECK(findInVector(vec, INTDATA(1000)) == -1);
+
+   sortVector(vec, compareInts);
+   ok = 1;
+   for (i = 0; i < 1000; i++)
+      ok = ok && VINTDATA(vec, i) == i;
+   CHECK(ok);
+
+   removeFromVectorAt(vec, 0);
+   CHECK(VSIZE(vec) == 999 && VINTDATA(vec, 0) == 1);
+   insertInVectorAt(vec, 0, INTDATA(0));
+   CHECK(VSIZE(vec) == 1000 && VINTDATA(vec, 0) == 0 && VINTDATA(vec, 1) == 1);
+   CHECK(VINTDATA(vec, 999) == 999);
+   CHECK((int)(intptr_t)removeLastFromVector(vec) == 999);
+
+   resizeVector(vec, 2000);
+   CHECK(VSIZE(vec) == 2000 && VDATA(vec, 1999) == NULL);
+
+   clearVector(vec);
+   CHECK(VSIZE(vec) == 0);
+
+   freeVector(vec);
+}
+
+static void testSmallVector(void)
+{
+   t_small_vector svec, copy;
+   int i;
+
+   initSmallVector(&svec);
+   initSmallVector(&copy);
+   for (i = 0; i < SMALL_VECTOR_INLINE; i++)
+      addToSmallVector(&svec, INTDATA(i));
+   CHECK(svec.heapItems == NULL);
+
+   /* spill to the heap */
+   for (; i < 3 * SMALL_VECTOR_INLINE; i++)
+      addToSmallVector(&svec, INTDATA(i));
+   CHECK(svec.heapItems != NULL);
+   CHECK(SVSIZE(&svec) == 3 * SMALL_VECTOR_INLINE);
+   CHECK(SVDATA(&svec, 5) == INTDATA(5));
+   CHECK(findInSmallVector(&svec, INTDATA(7)) == 7);
+
+   copySmallVector(&copy, &svec);
+   CHECK(SVSIZE(&copy) == SVSIZE(&svec));
+
+   /* removal moves the last element in the hole */
+   removeFromSmallVectorAt(&svec, 0);
+   CHECK(SVDATA(&svec, 0) == INTDATA(3 * SMALL_VECTOR_INLINE - 1));
+   CHECK(findInSmallVector(&svec, INTDATA(0)) == -1);
+   CHECK(findInSmallVector(&copy, INTDATA(0)) == 0);
+
+   finalizeSmallVector(&svec);
+   finalizeSmallVector(&copy);
+   CHECK(SVSIZE(&svec) == 0 && svec.heapItems == NULL);
+}
+
+static void testHashMap(void)
+{
+   t_hashmap *map = allocHashMap(NULL, NULL);
+   void *value;
+   int i, ok, count;
+
+   for (i = 0; i < 10000; i++)
+      putInHashMap(map, INTDATA(i), INTDATA(i * 2));
+   CHECK(HMSIZE(map) == 10000);
+
+   ok = 1;
+   for (i = 0; i < 10000; i++)
+      ok = ok && getFromHashMap(map, INTDATA(i), &value)
+            && value == INTDATA(i * 2);
+   CHECK(ok);
+   CHECK(!getFromHashMap(map, INTDATA(10000), &value));
+
+   /* zero is a valid key, and replacing keeps the size */
+   putInHashMap(map, INTDATA(0), INTDATA(42));
+   CHECK(lookupHashMap(map, INTDATA(0)) == INTDATA(42));
+   CHECK(HMSIZE(map) == 10000);
+
+   /* remove the odd keys; the even ones must still be reachable */
+   for (i = 1; i < 10000; i += 2)
+      CHECK(removeFromHashMap(map, INTDATA(i), NULL));
+   CHECK(!removeFromHashMap(map, INTDATA(1), NULL));
+   CHECK(HMSIZE(map) == 5000);
+   ok = 1;
+   for (i = 2; i < 10000; i += 2)
+      ok = ok && lookupHashMap(map, INTDATA(i)) == INTDATA(i * 2);
+   CHECK(ok);
+
+   /* many insertions and removals must not fill the map with deleted
+    * slots */
+   for (i = 0; i < 100000; i++) {
+      putInHashMap(map, INTDATA(20000 + i), NULL);
+      removeFromHashMap(map, INTDATA(20000 + i), NULL);
+   }
+   CHECK(HMSIZE(map) == 5000);
+   CHECK(map->capacity <= 16384);
+
+   count = 0;
+   for (i = nextInHashMap(map, 0); i >= 0; i = nextInHashMap(map, i + 1)) {
+      CHECK(((intptr_t)HMKEY(map, i) % 2) == 0);
+      count++;
+   }
+   CHECK(count == 5000);
+
+   clearHashMap(map);
+   CHECK(HMSIZE(map) == 0 && nextInHashMap(map, 0) == -1);
+
+   freeHashMap(map);
+}
+
+static void testStringKeys(void)
+{
+   t_hashmap *map = allocHashMap(hashString, compareStrings);
+   char key[] = "label";
+   void *storedKey;
+
+   putInHashMap(map, "label", INTDATA(1));
+   putInHashMap(map, "_label_0", INTDATA(2));
+
+   /* lookups compare the content, not the pointer */
+   CHECK(lookupHashMap(map, key) == INTDATA(1));
+   CHECK(removeFromHashMap(map, key, &storedKey));
+   CHECK(storedKey != key && compareStrings(storedKey, key));
+   CHECK(!getFromHashMap(map, "label", NULL));
+   CHECK(lookupHashMap(map, "_label_0") == INTDATA(2));
+
+   freeHashMap(map);
+}
+
+static void testHashSet(void)
+{
+   t_hashset *set = allocHashSet(NULL, NULL);
+   int values[3];
+
+   addToHashSet(set, &values[0]);
+   addToHashSet(set, &values[1]);
+   addToHashSet(set, &values[1]);
+   CHECK(HMSIZE(set) == 2);
+   CHECK(isInHashSet(set, &values[1]) && !isInHashSet(set, &values[2]));
+   CHECK(removeFromHashSet(set, &values[0]));
+   CHECK(!isInHashSet(set, &values[0]));
+   CHECK(nextInHashSet(set, 0) >= 0);
+
+   freeHashSet(set);
+}
+
+int main(void)
+{
+   testList();
+   testBitset();
+   testVector();
+   testSmallVector();
+   testHashMap();
+   testStringKeys();
+   testHashSet();
+
+   if (numFailures > 0) {
+      fprintf(stderr, "%d of %d checks failed\n", numFailures, numChecks);
+      return 1;
+   }
+   fprintf(stdout, "all %d checks passed\n", numChecks);
+   return 0;
+}
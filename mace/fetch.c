@@ -224,8 +224,8 @@ int executeUNR(decoded_instr *instr)
       case MOVA:
          *dest = src; /* Move a 20-bit constant to a register */
          break;
-      case LOAD: *dest = mem[src]; break;
-      case STORE: mem[src] = *dest; break;
+      case LOAD: *dest = mem[src]; load_count++; break;
+      case STORE: mem[src] = *dest; store_count++; break;
       case JSR:
          mem[--(*dest)] = pc; /* push next PC to the stack */
          pc = src;            /* jump to the address */
@@ -13,6 +13,8 @@ int reg[NREGS];
 int mem[MEMSIZE];
 unsigned int pc;
 int psw;
+int load_count;
+int store_count;
 
 /* Debug printf, print the value of the status word */
 void print_psw(FILE *file)
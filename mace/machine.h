@@ -120,6 +120,10 @@ void print_Memory_Dump(FILE *file, int begin);
 extern unsigned int pc; /* the program counter */
 extern int psw;         /* the four condition flags */
 
+/* number of executed LOAD and STORE instructions */
+extern int load_count;
+extern int store_count;
+
 enum flags { CARRY, OVERFLOW, ZERO, NEGATIVE };
 
 /* Get flag from processor status word */
@@ -16,6 +16,10 @@
 /*Returns 0 if is ok, other number if an error occured */
 static int check_signature(FILE *fp);
 
+/* Prints the number of executed instructions if requested, and returns
+ * the exit status unchanged */
+static int report_count(int status, int count, int printcount);
+
 int main(int argc, char **argv)
 {
    FILE *fp;                  /* pointer to the object file    */
@@ -24,6 +28,7 @@ int main(int argc, char **argv)
    int i;
    int breakat = -1; /* break execution at instruction # */
    int count = 0;    /* iterations counter    */
+   int printcount = 0; /* print the iterations counter at exit */
    pc = 0;           /* PC register is set at zero in the beginning */
 #ifdef DEBUG
    decoded_instr *current_instr;
@@ -35,7 +40,11 @@ int main(int argc, char **argv)
        * execution terminates */
       fprintf(stdout,
             "Formal Languages & Compilers Machine, 2007/2008.\n"
-            "\n\nSyntax:\n\tmace [options] objectfile\n");
+            "\n\nSyntax:\n\tmace [options] objectfile\n"
+            "\nOptions:\n"
+            "\tbreak N\tstop after N instructions\n"
+            "\tcount\tprint the number of executed instructions, loads "
+            "and stores on stderr\n");
       return NOARGS;
    }
 
@@ -67,6 +76,8 @@ int main(int argc, char **argv)
             return WRONG_ARGS;
          }
          i++; /* skip the argument we have just read */
+      } else if (strcmp(argv[i], "count") == 0) {
+         printcount = 1;
       }
    }
 
@@ -136,12 +147,12 @@ int main(int argc, char **argv)
 #ifdef DEBUG
          fprintf(stderr, "Break after %d instructions.\n", count);
 #endif
-         return BREAK;
+         return report_count(BREAK, count, printcount);
       }
 
       /* Check the HALT condition */
       if (pc == _HALT)
-         return OK;
+         return report_count(OK, count, printcount);
 
 #ifdef DEBUG
       current_instr = decode(mem[pc]);
@@ -156,7 +167,17 @@ int main(int argc, char **argv)
    fprintf(stderr, "Memory access error.\n");
 #endif
 
-   return pc;
+   return report_count(pc, count, printcount);
+}
+
+static int report_count(int status, int count, int printcount)
+{
+   if (printcount) {
+      fprintf(stderr, "Executed instructions: %d\n", count);
+      fprintf(stderr, "Executed loads: %d\n", load_count);
+      fprintf(stderr, "Executed stores: %d\n", store_count);
+   }
+   return status;
 }
 
 static int check_signature(FILE *fp)
@@ -0,0 +1,146 @@
+      .data
+_b:   .WORD 0
+_d:   .WORD 0
+_a:   .SPACE 21
+_c:   .WORD 0
+      .text
+      MOVA R1 _a           /* line 8 */
+      ADDI R2 R0 #0
+      ADD (R1) R0 R2
+      ADDI R3 R1 #1        /* line 9 */
+      ADDI R4 R0 #1
+      ADD (R3) R0 R4
+      ADDI R5 R1 #2        /* line 10 */
+      ADDI R6 R0 #2
+      ADD (R5) R0 R6
+      ADDI R7 R1 #3        /* line 11 */
+      ADDI R8 R0 #3
+      ADD (R7) R0 R8
+      ADDI R9 R1 #4        /* line 12 */
+      ADDI R10 R0 #4
+      ADD (R9) R0 R10
+      ADDI R11 R1 #5       /* line 13 */
+      ADDI R12 R0 #5
+      ADD (R11) R0 R12
+      ADDI R13 R1 #6       /* line 14 */
+      ADDI R14 R0 #6
+      ADD (R13) R0 R14
+      ADDI R15 R1 #7       /* line 15 */
+      ADDI R16 R0 #7
+      ADD (R15) R0 R16
+      ADDI R17 R1 #8       /* line 16 */
+      ADDI R18 R0 #8
+      ADD (R17) R0 R18
+      ADDI R19 R1 #9       /* line 17 */
+      ADDI R20 R0 #9
+      ADD (R19) R0 R20
+      ADDI R21 R1 #10      /* line 18 */
+      ADDI R22 R0 #10
+      ADD (R21) R0 R22
+      ADDI R23 R1 #11      /* line 19 */
+      ADDI R24 R0 #11
+      ADD (R23) R0 R24
+      ADDI R25 R1 #12      /* line 20 */
+      ADDI R26 R0 #12
+      ADD (R25) R0 R26
+      ADDI R27 R1 #13      /* line 21 */
+      ADDI R28 R0 #13
+      ADD (R27) R0 R28
+      ADDI R2 R1 #14       /* line 22 */
+      ADDI R4 R0 #14
+      ADD (R2) R0 R4
+      ADDI R6 R1 #15       /* line 23 */
+      ADDI R8 R0 #15
+      ADD (R6) R0 R8
+      ADDI R10 R1 #16      /* line 24 */
+      ADDI R12 R0 #16
+      ADD (R10) R0 R12
+      ADDI R14 R1 #17      /* line 25 */
+      ADDI R16 R0 #17
+      ADD (R14) R0 R16
+      ADDI R18 R1 #18      /* line 26 */
+      ADDI R20 R0 #18
+      ADD (R18) R0 R20
+      ADDI R22 R1 #19      /* line 27 */
+      ADDI R24 R0 #19
+      ADD (R22) R0 R24
+      ADDI R26 R1 #20      /* line 28 */
+      ADDI R28 R0 #20
+      ADD (R26) R0 R28
+      ADD R1 R0 (R1)       /* line 31 */
+      WRITE R1 0           /* line 33 */
+      ADD R1 R0 (R3)       /* line 34 */
+      WRITE R1 0           /* line 36 */
+      ADD R1 R0 (R5)       /* line 37 */
+      WRITE R1 0           /* line 39 */
+      ADD R7 R0 (R7)       /* line 40 */
+      ADD R1 R0 R7
+      WRITE R1 0           /* line 42 */
+      ADD R9 R0 (R9)       /* line 43 */
+      ADD R1 R0 R9
+      WRITE R1 0           /* line 45 */
+      ADD R1 R0 (R11)      /* line 46 */
+      WRITE R1 0           /* line 48 */
+      ADD R1 R0 (R13)      /* line 49 */
+      WRITE R1 0           /* line 51 */
+      ADD R1 R0 (R15)      /* line 52 */
+      WRITE R1 0           /* line 54 */
+      ADD R1 R0 (R17)      /* line 55 */
+      WRITE R1 0           /* line 57 */
+      ADD R1 R0 (R19)      /* line 58 */
+      WRITE R1 0           /* line 60 */
+      ADD R1 R0 (R21)      /* line 61 */
+      WRITE R1 0           /* line 63 */
+      ADD R1 R0 (R23)      /* line 64 */
+      WRITE R1 0           /* line 66 */
+      ADD R1 R0 (R25)      /* line 67 */
+      WRITE R1 0           /* line 69 */
+      ADD R1 R0 (R27)      /* line 70 */
+      WRITE R1 0           /* line 72 */
+      ADD R1 R0 (R2)       /* line 73 */
+      WRITE R1 0           /* line 75 */
+      ADD R6 R0 (R6)       /* line 76 */
+      ADD R1 R0 R6
+      WRITE R1 0           /* line 78 */
+      ADD R1 R0 (R10)      /* line 79 */
+      WRITE R1 0           /* line 81 */
+      ADD R14 R0 (R14)     /* line 82 */
+      ADD R1 R0 R14
+      WRITE R1 0           /* line 84 */
+      ADD R1 R0 (R18)      /* line 85 */
+      WRITE R1 0           /* line 87 */
+      ADD R1 R0 (R22)      /* line 88 */
+      WRITE R1 0           /* line 90 */
+      ADD R26 R0 (R26)     /* line 92 */
+      ADD R1 R0 R26
+      WRITE R1 0           /* line 93 */
+      ADDI R4 R0 #0        /* line 94 */
+      WRITE R4 0
+      ADD R8 R0 R26        /* line 95 */
+      WRITE R8 0           /* line 96 */
+      ADDI R8 R1 #0        /* line 97 */
+      WRITE R8 0           /* line 98 */
+      ADD R12 R1 R26       /* line 99 */
+      ADD R8 R0 R12
+      WRITE R8 0           /* line 100 */
+      ADDI R16 R12 #5      /* line 101 */
+      ADD R8 R16 R14
+      WRITE R8 0           /* line 102 */
+      STORE R8 _c          /* line 104 */
+      ADD R20 R8 R6
+      ADDI R24 R20 #12
+      WRITE R24 0          /* line 105 */
+      WRITE R24 0          /* line 107 */
+      WRITE R1 0           /* line 108 */
+      WRITE R24 0          /* line 109 */
+      WRITE R24 0          /* line 110 */
+      ADD R1 R0 R7         /* line 111 */
+      WRITE R24 0          /* line 112 */
+      WRITE R1 0           /* line 113 */
+      WRITE R24 0          /* line 114 */
+      ADD R1 R0 R9         /* line 115 */
+      STORE R1 _b          /* line 116 */
+      WRITE R1 0
+      STORE R24 _d         /* line 117 */
+      WRITE R24 0
+      HALT                 /* line 122 */
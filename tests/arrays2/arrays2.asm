@@ -0,0 +1,50 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .SPACE 5
+_d:   .SPACE 6
+_e:   .WORD 0
+_f:   .WORD 0
+_g:   .WORD 0
+      .text
+      READ R1 0            /* line 5 */
+      READ R2 0            /* line 6 */
+      STORE R2 _b
+      STORE R1 _a          /* line 8 */
+      SUBI R3 R1 #0
+      BLE L7
+      MOVA R4 _c           /* line 10 */
+      ADDI R5 R0 #1
+      ADD (R4) R0 R5
+      MOVA R6 _d           /* line 11 */
+      ADD (R6) R0 R1
+      ADD R7 R0 (R4)       /* line 12 */
+      ADD R6 R0 (R6)
+      ADD R8 R7 R6
+      ADD R9 R8 R2
+      ADDI R10 R4 #1
+      ADD (R10) R0 R9
+      BT L8                /* line 14 */
+L7:   MOVA R11 _c          /* line 16 */
+      ADD (R11) R0 R1
+      ADD R12 R1 R2        /* line 17 */
+      MOVA R13 _d
+      ADD (R13) R0 R12
+      ADD R14 R0 (R11)     /* line 18 */
+      ADD R13 R0 (R13)
+      SUB R15 R14 R13
+      ADDI R16 R11 #1
+      ADD (R16) R0 R15
+L8:   MOVA R17 _c          /* line 21 */
+      ADD R18 R0 (R17)
+      ADDI R19 R17 #1      /* line 22 */
+      ADD R19 R0 (R19)
+      MOVA R20 _d          /* line 23 */
+      ADD R20 R0 (R20)
+      STORE R18 _e         /* line 24 */
+      WRITE R18 0
+      STORE R19 _f         /* line 25 */
+      WRITE R19 0
+      STORE R20 _g         /* line 26 */
+      WRITE R20 0
+      HALT                 /* line 28 */
@@ -0,0 +1,17 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+_result: .WORD 0
+      .text
+      READ R1 0            /* line 4 */
+      READ R2 0            /* line 5 */
+      READ R3 0            /* line 6 */
+      STORE R1 _a          /* line 8 */
+      STORE R2 _b
+      ADD R4 R1 R2
+      STORE R3 _c          /* line 10 */
+      ADD R4 R4 R3
+      STORE R4 _result     /* line 12 */
+      WRITE R4 0
+      HALT                 /* line 14 */
@@ -0,0 +1,111 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+      .text
+      READ R1 0            /* line 5 */
+      READ R2 0            /* line 6 */
+      ADDI R3 R0 #8        /* line 8 */
+      SHLI R3 R3 #16
+      ADDI R3 R3 #25713
+      WRITE R3 0
+      ADD R4 R1 R2         /* line 10 */
+      WRITE R4 0
+      SUB R5 R1 R2         /* line 11 */
+      WRITE R5 0
+      DIV R6 R1 R2         /* line 12 */
+      WRITE R6 0
+      MUL R7 R1 R2         /* line 13 */
+      WRITE R7 0
+      ANDB R8 R1 R2        /* line 14 */
+      WRITE R8 0
+      ORB R9 R1 R2         /* line 15 */
+      WRITE R9 0
+      ANDL R10 R1 R2       /* line 16 */
+      WRITE R10 0
+      ORL R11 R1 R2        /* line 17 */
+      WRITE R11 0
+      ADDI R12 R0 #8       /* line 19 */
+      SHLI R12 R12 #16
+      ADDI R12 R12 #25714
+      WRITE R12 0
+      ADDI R13 R1 #5       /* line 21 */
+      WRITE R13 0
+      SUBI R14 R1 #5       /* line 22 */
+      WRITE R14 0
+      DIVI R15 R1 #5       /* line 23 */
+      WRITE R15 0
+      MULI R16 R1 #5       /* line 24 */
+      WRITE R16 0
+      ANDBI R17 R1 #21930  /* line 25 */
+      WRITE R17 0
+      ORBI R18 R1 #21930   /* line 26 */
+      WRITE R18 0
+      ADDI R19 R0 #0       /* line 27 */
+      WRITE R19 0
+      ORLI R20 R1 #0       /* line 28 */
+      WRITE R20 0
+      STORE R1 _a          /* line 29 */
+      ANDLI R21 R1 #100
+      WRITE R21 0
+      ADDI R22 R0 #1       /* line 30 */
+      WRITE R22 0
+      ADDI R23 R0 #8       /* line 32 */
+      SHLI R23 R23 #16
+      ADDI R23 R23 #25715
+      WRITE R23 0
+      ADDI R24 R2 #5       /* line 34 */
+      WRITE R24 0
+      SUBI R25 R2 #5       /* line 35 */
+      NEG R26 R0 R25
+      WRITE R26 0
+      ADDI R27 R0 #5       /* line 36 */
+      DIV R28 R27 R2
+      WRITE R28 0
+      MULI R3 R2 #5        /* line 37 */
+      WRITE R3 0
+      ANDBI R4 R2 #21930   /* line 38 */
+      WRITE R4 0
+      ORBI R5 R2 #21930    /* line 39 */
+      WRITE R5 0
+      ADDI R6 R0 #0        /* line 40 */
+      WRITE R6 0
+      ORLI R7 R2 #0        /* line 41 */
+      WRITE R7 0
+      STORE R2 _b          /* line 42 */
+      ANDLI R8 R2 #100
+      WRITE R8 0
+      ADDI R9 R0 #1        /* line 43 */
+      WRITE R9 0
+      ADDI R10 R0 #8       /* line 45 */
+      SHLI R10 R10 #16
+      ADDI R10 R10 #25716
+      WRITE R10 0
+      ADDI R11 R0 #15      /* line 47 */
+      WRITE R11 0
+      ADDI R12 R0 #5       /* line 48 */
+      WRITE R12 0
+      ADDI R13 R0 #2       /* line 49 */
+      WRITE R13 0
+      ADDI R14 R0 #50      /* line 50 */
+      WRITE R14 0
+      ADDI R15 R0 #20490   /* line 51 */
+      WRITE R15 0
+      ADDI R16 R0 #24570   /* line 52 */
+      WRITE R16 0
+      ADDI R17 R0 #0       /* line 53 */
+      WRITE R17 0
+      ADDI R18 R0 #0       /* line 54 */
+      WRITE R18 0
+      ADDI R19 R0 #0       /* line 55 */
+      WRITE R19 0
+      ADDI R20 R0 #1       /* line 56 */
+      WRITE R20 0
+      ADDI R1 R0 #0        /* line 57 */
+      WRITE R1 0
+      ADDI R21 R0 #1       /* line 58 */
+      WRITE R21 0
+      ADDI R22 R0 #1       /* line 59 */
+      WRITE R22 0
+      ADDI R23 R0 #1       /* line 60 */
+      WRITE R23 0
+      HALT                 /* line 61 */
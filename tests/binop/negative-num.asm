@@ -0,0 +1,67 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+_d:   .WORD 0
+      .text
+      ADDI R1 R0 #-20      /* line 9 */
+      WRITE R1 0
+      ADDI R2 R0 #-20      /* line 10 */
+      WRITE R2 0
+      ADDI R3 R0 #-20      /* line 11 */
+      WRITE R3 0
+      ADDI R4 R0 #-20      /* line 12 */
+      WRITE R4 0
+      ADDI R5 R0 #-20      /* line 14 */
+      WRITE R5 0
+      ADDI R6 R0 #-20      /* line 15 */
+      WRITE R6 0
+      ADDI R7 R0 #-20      /* line 16 */
+      WRITE R7 0
+      ADDI R8 R0 #-20      /* line 17 */
+      WRITE R8 0
+      ADDI R9 R0 #-4       /* line 20 */
+      WRITE R9 0
+      ADDI R10 R0 #-4      /* line 21 */
+      WRITE R10 0
+      ADDI R11 R0 #-4      /* line 22 */
+      WRITE R11 0
+      ADDI R12 R0 #-4      /* line 23 */
+      WRITE R12 0
+      ADDI R13 R0 #-2      /* line 27 */
+      WRITE R13 0
+      ADDI R14 R0 #-2      /* line 28 */
+      WRITE R14 0
+      ADDI R15 R0 #-2      /* line 29 */
+      WRITE R15 0
+      ADDI R16 R0 #-2      /* line 30 */
+      WRITE R16 0
+      ADDI R17 R0 #-1      /* line 34 */
+      WRITE R17 0
+      ADDI R18 R0 #-1      /* line 35 */
+      WRITE R18 0
+      ADDI R19 R0 #-1      /* line 36 */
+      WRITE R19 0
+      ADDI R20 R0 #-1      /* line 37 */
+      WRITE R20 0
+      ADDI R21 R0 #-1      /* line 40 */
+      WRITE R21 0
+      ADDI R22 R0 #32      /* line 41 */
+      ADDI R23 R0 #-100
+      SHR R24 R23 R22
+      WRITE R24 0
+      ADDI R25 R0 #-100    /* line 42 */
+      SHRI R26 R25 #32
+      WRITE R26 0
+      WRITE R24 0          /* line 43 */
+      ADDI R27 R0 #-1      /* line 46 */
+      WRITE R27 0
+      ADDI R28 R0 #33      /* line 47 */
+      ADDI R1 R0 #-100
+      SHR R2 R1 R28
+      WRITE R2 0
+      ADDI R3 R0 #-100     /* line 48 */
+      SHRI R4 R3 #33
+      WRITE R4 0
+      WRITE R2 0           /* line 49 */
+      HALT                 /* line 50 */
@@ -0,0 +1,140 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_r:   .WORD 0
+_i:   .WORD 0
+_k:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      STORE R1 _k          /* line 9 */
+      SUBI R2 R1 #0
+      BLE L5
+L6:   READ R3 0            /* line 11 */
+      READ R4 0            /* line 12 */
+      ADDI R5 R0 #0        /* line 14 */
+      STORE R5 _r
+      STORE R3 _a          /* line 15 */
+      STORE R4 _b
+      SUB R6 R3 R4
+      BGE L7
+      ADDI R5 R0 #1
+      STORE R5 _r
+L7:   SUB R7 R3 R4         /* line 16 */
+      BGT L8
+      ADDI R5 R5 #2
+      STORE R5 _r
+L8:   SUB R8 R3 R4         /* line 17 */
+      BLE L9
+      ADDI R5 R5 #4
+      STORE R5 _r
+L9:   SUB R9 R3 R4         /* line 18 */
+      BLT L10
+      ADDI R5 R5 #8
+      STORE R5 _r
+L10:  SUB R10 R3 R4        /* line 19 */
+      BNE L11
+      ADDI R5 R5 #16
+      STORE R5 _r
+L11:  SUB R11 R3 R4        /* line 20 */
+      BEQ L12
+      ADDI R5 R5 #32
+      STORE R5 _r
+L12:  SUB R12 R3 R4        /* line 21 */
+      BLT L13
+      ADDI R5 R5 #64
+      STORE R5 _r
+L13:  SUB R13 R3 R4        /* line 22 */
+      BGT L14
+      ADDI R5 R5 #128
+      STORE R5 _r
+L14:  WRITE R5 0           /* line 23 */
+      SUB R14 R3 R4        /* line 26 */
+      SLT R15 0
+      SUB R16 R3 R4
+      SLE R17 0
+      MULI R18 R17 #2
+      ADD R19 R15 R18
+      SUB R20 R3 R4
+      SGT R21 0
+      MULI R22 R21 #4
+      ADD R23 R19 R22
+      SUB R24 R3 R4
+      SGE R25 0
+      MULI R26 R25 #8
+      ADD R27 R23 R26      /* line 27 */
+      SUB R28 R3 R4
+      SEQ R2 0
+      MULI R6 R2 #16
+      ADD R7 R27 R6
+      SUB R8 R3 R4
+      SNE R9 0
+      MULI R10 R9 #32
+      ADD R11 R7 R10
+      WRITE R11 0
+      ADDI R5 R0 #0        /* line 30 */
+      STORE R5 _r
+      SUBI R12 R3 #0       /* line 31 */
+      BGE L15
+      ADDI R5 R0 #1
+      STORE R5 _r
+L15:  SUBI R13 R3 #0       /* line 32 */
+      BLE L16
+      ADDI R5 R5 #2
+      STORE R5 _r
+L16:  ADDI R14 R0 #-32768  /* line 33 */
+      SHLI R14 R14 #16
+      ADDI R14 R14 #-1
+      SUB R16 R3 R14
+      BLT L17
+      ADDI R5 R5 #4
+      STORE R5 _r
+L17:  SUBI R17 R3 #-100    /* line 34 */
+      BGE L18
+      ADDI R5 R5 #8
+      STORE R5 _r
+L18:  SUBI R15 R3 #-5      /* line 35 */
+      BNE L19
+      ADDI R5 R5 #16
+      STORE R5 _r
+L19:  WRITE R5 0           /* line 36 */
+      SUB R18 R3 R4        /* line 39 */
+      BGE L20
+      ADDI R5 R0 #1        /* line 40 */
+      STORE R5 _r
+      BT L23               /* line 41 */
+L20:  SUB R20 R3 R4
+      BNE L22
+      ADDI R5 R0 #2        /* line 42 */
+      STORE R5 _r
+      BT L23               /* line 43 */
+L22:  ADDI R5 R0 #3        /* line 44 */
+      STORE R5 _r
+L23:  WRITE R5 0           /* line 45 */
+      ADDI R21 R0 #0       /* line 48 */
+      STORE R21 _i
+      SUB R19 R3 R4        /* line 49 */
+      BGE L24              /* line 49 */
+      NOP
+L25:  ADDI R21 R21 #1      /* line 50 */
+      STORE R21 _i
+      ADD R22 R3 R21
+      SUB R24 R22 R4
+      BGE L24
+      SUBI R25 R21 #5
+      BLT L25
+L24:  WRITE R21 0          /* line 51 */
+      ADDI R21 R0 #0       /* line 52 */
+      STORE R21 _i
+L26:  ADDI R21 R21 #1      /* line 54 */
+      STORE R21 _i         /* line 55 */
+      SUB R23 R4 R21
+      SUB R26 R3 R23
+      BLE L27              /* line 55 */
+      SUBI R28 R21 #5
+      BLT L26              /* line 55 */
+L27:  WRITE R21 0          /* line 56 */
+      SUBI R1 R1 #1        /* line 58 */
+      STORE R1 _k          /* line 59 */
+      SUBI R2 R1 #0
+      BGT L6
+L5:   HALT                 /* line 60 */
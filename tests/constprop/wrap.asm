@@ -0,0 +1,114 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+_d:   .WORD 0
+_i:   .WORD 0
+_t:   .WORD 0
+_x:   .WORD 0
+_y:   .WORD 0
+      .text
+      ADDI R1 R0 #-32768   /* line 10 */
+      SHLI R1 R1 #16
+      WRITE R1 0
+      ADDI R2 R0 #-32768   /* line 12 */
+      SHLI R2 R2 #16
+      ADDI R2 R2 #-1
+      WRITE R2 0
+      ADDI R3 R0 #-32768   /* line 13 */
+      SHLI R3 R3 #16
+      WRITE R3 0
+      ADDI R4 R0 #-2       /* line 14 */
+      WRITE R4 0
+      ADDI R5 R0 #0        /* line 15 */
+      WRITE R5 0
+      ADDI R6 R0 #-32768   /* line 16 */
+      SHLI R6 R6 #16
+      ADDI R6 R6 #-1
+      WRITE R6 0
+      ADDI R7 R0 #-16384   /* line 17 */
+      SHLI R7 R7 #16
+      WRITE R7 0
+      ADDI R8 R0 #-3       /* line 18 */
+      WRITE R8 0
+      ADDI R9 R0 #-1       /* line 19 */
+      WRITE R9 0
+      ADDI R10 R0 #-32768  /* line 20 */
+      SHLI R10 R10 #16
+      WRITE R10 0
+      ADDI R11 R0 #1
+      WRITE R11 0
+L9:   NOP                  /* line 23 */
+L10:  ADDI R12 R0 #0
+      WRITE R12 0
+L11:  NOP                  /* line 24 */
+      ADDI R13 R0 #1
+      WRITE R13 0
+L13:  NOP                  /* line 25 */
+L14:  ADDI R14 R0 #0
+      WRITE R14 0
+L15:  NOP                  /* line 26 */
+      ADDI R15 R0 #1
+      WRITE R15 0
+L17:  NOP                  /* line 27 */
+L18:  ADDI R16 R0 #0
+      WRITE R16 0
+L19:  NOP                  /* line 28 */
+      ADDI R17 R0 #1
+      WRITE R17 0
+L21:  NOP                  /* line 29 */
+L22:  ADDI R18 R0 #0
+      WRITE R18 0
+L23:  NOP                  /* line 30 */
+      ADDI R19 R0 #1
+      WRITE R19 0
+L25:  READ R20 0           /* line 32 */
+      STORE R20 _x
+L26:  ADDI R21 R0 #0
+      WRITE R21 0
+L27:  NOP                  /* line 35 */
+      ADDI R22 R0 #1
+      WRITE R22 0
+L29:  NOP                  /* line 36 */
+      ADDI R23 R0 #1
+      WRITE R23 0
+L31:  ADDI R24 R20 #0      /* line 38 */
+      SUB R25 R24 R20
+      STORE R25 _y         /* line 39 */
+      ANDB R26 R25 R25
+      BEQ L32
+      ADDI R27 R0 #1
+      WRITE R27 0
+      BT L33
+L32:  ADDI R28 R0 #0
+      WRITE R28 0
+L33:  ADDI R1 R0 #0        /* line 41 */
+      WRITE R1 0
+      ADDI R20 R0 #0       /* line 43 */
+      STORE R20 _x
+L35:  ADDI R2 R0 #-32768   /* line 46 */
+      SHLI R2 R2 #16
+      ADDI R2 R2 #-1
+      ADD R3 R20 R2
+      STORE R3 _c
+      ADDI R20 R20 #1      /* line 47 */
+      STORE R20 _x         /* line 48 */
+      SUBI R4 R20 #3
+      BLT L35
+L34:  WRITE R3 0           /* line 49 */
+      WRITE R20 0          /* line 50 */
+      NOP
+L37:  ADDI R5 R0 #1        /* line 56 */
+      WRITE R5 0
+L38:  ADDI R6 R0 #2
+      WRITE R6 0
+L39:  ADDI R7 R0 #0        /* line 62 */
+      STORE R7 _i
+L41:  NOP                  /* line 65 */
+L42:  ADDI R7 R7 #1        /* line 67 */
+      STORE R7 _i          /* line 68 */
+      SUBI R8 R7 #3
+      BLT L41
+L40:  ADDI R9 R0 #1        /* line 69 */
+      WRITE R9 0
+      HALT                 /* line 70 */
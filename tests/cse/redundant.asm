@@ -0,0 +1,99 @@
+      .data
+_v:   .SPACE 8
+_a:   .WORD 0
+_b:   .WORD 0
+_i:   .WORD 0
+_j:   .WORD 0
+_x:   .WORD 0
+_y:   .WORD 0
+_z:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      READ R2 0            /* line 9 */
+      ADD R3 R1 R2         /* line 11 */
+      ADD R4 R0 R3
+      ADD R5 R4 R3         /* line 13 */
+      WRITE R5 0
+      SUB R6 R1 R2         /* line 14 */
+      WRITE R6 0
+      SUB R7 R2 R1         /* line 15 */
+      WRITE R7 0
+      SUB R8 R1 R2         /* line 16 */
+      SLT R9 0
+      SUB R10 R2 R1
+      SLT R11 0
+      ADD R12 R9 R11
+      ADD R13 R12 R9
+      WRITE R13 0
+      MUL R14 R1 R2        /* line 17 */
+      SUB R15 R14 R14
+      WRITE R15 0
+      ADDI R1 R1 #1        /* line 19 */
+      ADD R3 R1 R2         /* line 20 */
+      WRITE R3 0           /* line 21 */
+      MOVA R16 _v          /* line 24 */
+      ADD (R16) R0 R1
+      ADD R4 R0 (R16)      /* line 25 */
+      ADD (R16) R0 R2      /* line 26 */
+      ADD R3 R0 (R16)      /* line 27 */
+      WRITE R4 0           /* line 28 */
+      WRITE R3 0           /* line 29 */
+      ANDBI R17 R2 #7      /* line 32 */
+      ANDBI R18 R2 #1      /* line 33 */
+      ADDI R19 R16 #1      /* line 34 */
+      ADDI R20 R0 #11
+      ADD (R19) R0 R20
+      ADD R4 R0 (R19)      /* line 35 */
+      ADD R21 R16 R17      /* line 36 */
+      ADDI R22 R0 #22
+      ADD (R21) R0 R22
+      ADD R23 R0 (R19)     /* line 37 */
+      ADD R3 R0 R23
+      MULI R24 R4 #100     /* line 38 */
+      ADD R25 R24 R3
+      WRITE R25 0
+      ADD R4 R0 R23        /* line 39 */
+      STORE R18 _j         /* line 40 */
+      ADD R26 R16 R18
+      ADDI R27 R0 #33
+      ADD (R26) R0 R27
+      ADD R3 R0 (R19)      /* line 41 */
+      STORE R4 _x          /* line 42 */
+      MULI R28 R4 #100
+      STORE R3 _y
+      ADD R5 R28 R3
+      WRITE R5 0
+      ADD R6 R0 (R21)      /* line 45 */
+      MUL R7 R6 R6
+      ADD R8 R6 R7
+      ADD (R21) R0 R8
+      ADD R10 R0 (R21)     /* line 46 */
+      WRITE R10 0
+      STORE R17 _i         /* line 47 */
+      ADDI R11 R17 #1
+      SUBI R9 R11 #1
+      SUBI R12 R10 #1
+      ADD R13 R16 R9
+      ADD (R13) R0 R12
+      ADD R21 R0 (R21)     /* line 48 */
+      WRITE R21 0
+      ADDI R14 R0 #0       /* line 51 */
+      STORE R14 _z
+      STORE R1 _a          /* line 52 */
+      STORE R2 _b
+      SUB R15 R1 R2
+      BLE L8
+      ADDI R14 R0 #1
+      STORE R14 _z
+L8:   SUB R20 R1 R2        /* line 53 */
+      BLE L9
+      ADDI R14 R14 #2
+      STORE R14 _z
+L9:   ADDI R2 R1 #0        /* line 54 */
+      STORE R2 _b          /* line 55 */
+      SUB R22 R1 R2
+      BLE L10
+      ADDI R14 R14 #4
+      STORE R14 _z
+L10:  WRITE R14 0          /* line 56 */
+      HALT                 /* line 57 */
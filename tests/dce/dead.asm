@@ -0,0 +1,70 @@
+      .data
+_v:   .SPACE 4
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+_d:   .WORD 0
+_i:   .WORD 0
+_s:   .WORD 0
+_t:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      READ R2 0            /* line 9 */
+      READ R3 0            /* line 12 */
+      READ R4 0            /* line 13 */
+      STORE R4 _c          /* line 14 */
+      WRITE R4 0
+      ADD R3 R1 R2         /* line 18 */
+      STORE R3 _t          /* line 19 */
+      WRITE R3 0
+      STORE R1 _a          /* line 23 */
+      STORE R2 _b
+      SUB R5 R1 R2
+      BGE L8
+      ADDI R6 R0 #1
+      WRITE R6 0
+      BT L9
+L8:   ADDI R7 R0 #0
+      WRITE R7 0
+L9:   SUB R8 R1 R2         /* line 24 */
+      ANDB R9 R8 R8
+      BEQ L10
+      ADDI R10 R0 #1
+      WRITE R10 0
+      BT L11
+L10:  ADDI R11 R0 #0
+      WRITE R11 0
+L11:  ADDI R12 R0 #0       /* line 27 */
+      STORE R12 _i
+      ADDI R13 R0 #0       /* line 28 */
+      STORE R13 _s
+L13:  ADD R13 R13 R12      /* line 33 */
+      STORE R13 _s
+      ADDI R12 R12 #1      /* line 34 */
+      STORE R12 _i         /* line 35 */
+      SUBI R14 R12 #10
+      BLT L13
+L12:  WRITE R13 0          /* line 36 */
+      ANDBI R15 R1 #3      /* line 39 */
+      MOVA R16 _v
+      ADD R17 R16 R15
+      ADDI R18 R0 #9
+      ADD (R17) R0 R18
+      ANDBI R19 R2 #3      /* line 40 */
+      ADD R20 R16 R19
+      ADD R21 R0 (R20)
+      ADDI R22 R21 #1
+      ADD (R20) R0 R22
+      ADD R23 R0 (R16)     /* line 41 */
+      ADDI R24 R16 #1
+      ADD R24 R0 (R24)
+      ADD R25 R23 R24
+      ADDI R26 R16 #2
+      ADD R26 R0 (R26)
+      ADD R27 R25 R26
+      ADDI R28 R16 #3
+      ADD R28 R0 (R28)
+      ADD R4 R27 R28
+      WRITE R4 0
+L14:  NOP                  /* line 45 */
+L15:  HALT                 /* line 47 */
@@ -0,0 +1,16 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+      .text
+      ADDI R1 R0 #0        /* line 3 */
+      STORE R1 _a
+      READ R2 0            /* line 4 */
+      STORE R2 _b
+L2:   ADDI R1 R1 #1        /* line 8 */
+      STORE R1 _a
+      SUBI R2 R2 #1        /* line 9 */
+      STORE R2 _b          /* line 10 */
+      SUBI R3 R2 #0
+      BGT L2
+      WRITE R1 0           /* line 12 */
+      HALT                 /* line 13 */
@@ -0,0 +1,23 @@
+      .data
+_value: .WORD 0
+_fact: .WORD 0
+      .text
+      READ R1 0            /* line 3 */
+      STORE R1 _value      /* line 5 */
+      SUBI R2 R1 #0
+      BGE L2
+      ADDI R3 R0 #-1       /* line 7 */
+      WRITE R3 0
+      HALT                 /* line 8 */
+L2:   ADDI R4 R0 #1        /* line 11 */
+      STORE R4 _fact
+      SUBI R5 R1 #0        /* line 13 */
+      BLE L3
+L4:   MUL R4 R1 R4         /* line 15 */
+      STORE R4 _fact
+      SUBI R1 R1 #1        /* line 16 */
+      STORE R1 _value      /* line 17 */
+      SUBI R6 R1 #0
+      BGT L4
+L3:   WRITE R4 0           /* line 19 */
+      HALT                 /* line 21 */
@@ -0,0 +1,16 @@
+      .data
+_a:   .WORD 10
+_b:   .WORD 20
+      .text
+      NOP                  /* line 3 */
+      ADDI R1 R0 #1001     /* line 4 */
+      WRITE R1 0
+L3:   ADDI R2 R0 #10       /* line 9 */
+      WRITE R2 0
+      ADDI R3 R0 #20       /* line 10 */
+      WRITE R3 0
+      ADDI R4 R0 #9        /* line 12 */
+      WRITE R4 0
+      ADDI R5 R0 #20       /* line 13 */
+      WRITE R5 0
+      HALT                 /* line 14 */
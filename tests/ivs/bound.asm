@@ -0,0 +1,32 @@
+      .data
+_a:   .SPACE 16
+_i:   .WORD 0
+_n:   .WORD 0
+_c:   .WORD 0
+_f:   .WORD 0
+      .text
+      READ R1 0            /* line 2 */
+      READ R2 0
+      READ R3 0
+      STORE R3 _f
+      STORE R1 _i          /* line 3 */
+      STORE R2 _n
+      SUB R4 R1 R2
+      BGE L5
+      MOVA R5 _a
+      ADDI R6 R0 #1
+      ADD R7 R5 R1
+L6:   ANDB R8 R3 R3
+      BEQ L7
+      ADD (R7) R0 R6
+L7:   LOAD R9 _c
+      ADDI R9 R9 #1
+      STORE R9 _c
+      ADDI R1 R1 #1
+      ADDI R7 R7 #1
+      STORE R1 _i
+      SUB R10 R1 R2
+      BLT L6
+L5:   LOAD R9 _c
+      WRITE R9 0           /* line 4 */
+      HALT                 /* line 5 */
@@ -0,0 +1,42 @@
+      .data
+_a:   .SPACE 16
+_i:   .WORD 0
+_n:   .WORD 0
+_c:   .WORD 0
+_f:   .WORD 0
+_k:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      STORE R1 _k          /* line 9 */
+      SUBI R2 R1 #0
+      BLE L6
+      MOVA R3 _a
+      ADDI R4 R0 #1
+L7:   READ R5 0            /* line 11 */
+      READ R6 0            /* line 12 */
+      READ R7 0            /* line 13 */
+      STORE R7 _f
+      ADDI R8 R0 #0        /* line 14 */
+      STORE R8 _c
+      STORE R5 _i          /* line 15 */
+      STORE R6 _n
+      SUB R9 R5 R6
+      BGE L8
+      NOP
+      ADD R10 R3 R5
+L9:   ANDB R11 R7 R7       /* line 17 */
+      BEQ L10
+      ADD (R10) R0 R4      /* line 18 */
+L10:  ADDI R8 R8 #1        /* line 19 */
+      STORE R8 _c
+      ADDI R5 R5 #1        /* line 20 */
+      ADDI R10 R10 #1
+      STORE R5 _i          /* line 21 */
+      SUB R12 R5 R6
+      BLT L9
+L8:   WRITE R8 0           /* line 22 */
+      SUBI R1 R1 #1        /* line 23 */
+      STORE R1 _k          /* line 24 */
+      SUBI R13 R1 #0
+      BGT L7
+L6:   HALT                 /* line 25 */
@@ -0,0 +1,41 @@
+      .data
+_a:   .SPACE 16
+_i:   .WORD 0
+_n:   .WORD 0
+_c:   .WORD 0
+_f:   .WORD 0
+_k:   .WORD 0
+      .text
+      READ R1 0            /* line 7 */
+      STORE R1 _k          /* line 8 */
+      SUBI R2 R1 #0
+      BLE L6
+      MOVA R3 _a
+      ADDI R4 R0 #1
+L7:   READ R5 0            /* line 10 */
+      READ R6 0            /* line 11 */
+      READ R7 0            /* line 12 */
+      STORE R7 _f
+      ADDI R8 R0 #0        /* line 13 */
+      STORE R8 _c
+      STORE R5 _i          /* line 14 */
+      STORE R6 _n
+      SUB R9 R5 R6
+      BEQ L8
+      NOP
+      ADD R10 R3 R5
+      ADD R11 R3 R6
+L9:   ANDB R12 R7 R7       /* line 16 */
+      BEQ L10
+      ADD (R10) R0 R4      /* line 17 */
+L10:  ADDI R8 R8 #1        /* line 18 */
+      STORE R8 _c
+      ADDI R10 R10 #1      /* line 19 */
+      SUB R13 R10 R11      /* line 20 */
+      BNE L9
+L8:   WRITE R8 0           /* line 21 */
+      SUBI R1 R1 #1        /* line 22 */
+      STORE R1 _k          /* line 23 */
+      SUBI R14 R1 #0
+      BGT L7
+L6:   HALT                 /* line 24 */
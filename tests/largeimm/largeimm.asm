@@ -0,0 +1,75 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+      .text
+      ADDI R1 R0 #0        /* line 4 */
+      WRITE R1 0
+      ADDI R2 R0 #100      /* line 5 */
+      WRITE R2 0
+      ADDI R3 R0 #1000     /* line 6 */
+      WRITE R3 0
+      ADDI R4 R0 #32767    /* line 7 */
+      WRITE R4 0
+      ADDI R5 R0 #1        /* line 8 */
+      SHLI R5 R5 #16
+      ADDI R5 R5 #-32768
+      WRITE R5 0
+      ADDI R6 R0 #1        /* line 9 */
+      SHLI R6 R6 #16
+      ADDI R6 R6 #-15536
+      WRITE R6 0
+      ADDI R7 R0 #763      /* line 10 */
+      SHLI R7 R7 #16
+      ADDI R7 R7 #-3968
+      WRITE R7 0
+      ADDI R8 R0 #-32768   /* line 11 */
+      SHLI R8 R8 #16
+      ADDI R8 R8 #-1
+      WRITE R8 0
+      ADDI R9 R0 #-100     /* line 12 */
+      WRITE R9 0
+      ADDI R10 R0 #-1000   /* line 13 */
+      WRITE R10 0
+      ADDI R11 R0 #-32768  /* line 14 */
+      WRITE R11 0
+      ADDI R12 R0 #-1      /* line 15 */
+      SHLI R12 R12 #16
+      ADDI R12 R12 #32767
+      WRITE R12 0
+      ADDI R13 R0 #-1      /* line 16 */
+      SHLI R13 R13 #16
+      ADDI R13 R13 #15536
+      WRITE R13 0
+      ADDI R14 R0 #-763    /* line 17 */
+      SHLI R14 R14 #16
+      ADDI R14 R14 #3968
+      WRITE R14 0
+      ADDI R15 R0 #-32768  /* line 18 */
+      SHLI R15 R15 #16
+      WRITE R15 0
+      ADDI R16 R0 #-32768  /* line 24 */
+      SHLI R16 R16 #16
+      ADDI R16 R16 #-1
+      WRITE R16 0
+      ADDI R17 R0 #-32768  /* line 25 */
+      SHLI R17 R17 #16
+      ADDI R17 R17 #1
+      WRITE R17 0
+      ADDI R18 R0 #-32768  /* line 26 */
+      SHLI R18 R18 #16
+      ADDI R18 R18 #-1
+      WRITE R18 0
+      ADDI R19 R0 #1       /* line 27 */
+      WRITE R19 0
+      ADDI R20 R0 #1       /* line 28 */
+      WRITE R20 0
+      ADDI R21 R0 #763     /* line 30 */
+      SHLI R21 R21 #16
+      ADDI R21 R21 #-3968
+      WRITE R21 0
+      ADDI R22 R0 #-32768  /* line 31 */
+      SHLI R22 R22 #16
+      ADDI R22 R22 #-1
+      WRITE R22 0
+      HALT                 /* line 32 */
@@ -0,0 +1,188 @@
+      .data
+_v:   .SPACE 8
+_i:   .WORD 0
+_n:   .WORD 0
+_d:   .WORD 0
+_s:   .WORD 0
+_x:   .WORD 0
+_k:   .WORD 0
+      .text
+      ADDI R1 R0 #0        /* line 9 */
+      MOVA R2 _v
+      ADD R3 R2 R1
+      STORE R1 _i
+L8:   ADDI R4 R1 #0        /* line 12 */
+      MUL R5 R4 R1
+      ADD (R3) R0 R5
+      ADDI R1 R1 #1        /* line 13 */
+      ADDI R3 R3 #1
+      STORE R1 _i          /* line 14 */
+      SUBI R6 R1 #8
+      BLT L8
+L7:   READ R7 0            /* line 16 */
+      STORE R7 _k          /* line 17 */
+      SUBI R8 R7 #0
+      BLE L9
+      ADDI R9 R0 #0        /* line 24 */
+      ADDI R10 R0 #1000
+      ADDI R11 R0 #0       /* line 37 */
+      ADDI R12 R0 #1000
+      ADDI R13 R0 #3       /* line 48 */
+      ADDI R14 R0 #1000
+      ADDI R15 R0 #0       /* line 57 */
+      MOVA R16 _v
+      MOVA R17 _v          /* line 67 */
+      ADDI R18 R0 #1
+      ADDI R19 R0 #0       /* line 70 */
+      MOVA R20 _v
+      MOVA R21 _v          /* line 77 */
+      ADDI R22 R0 #0
+      ADDI R23 R0 #0       /* line 82 */
+      ADDI R24 R0 #0       /* line 93 */
+      ADDI R25 R0 #0       /* line 105 */
+L10:  READ R26 0           /* line 19 */
+      READ R27 0           /* line 20 */
+      STORE R27 _d
+      ADDI R1 R0 #0        /* line 22 */
+      STORE R1 _i
+      ADDI R28 R0 #0       /* line 23 */
+      STORE R28 _s
+      STORE R26 _n
+      SUB R2 R9 R26
+      BGE L11
+      NOP
+L12:  SUBI R4 R27 #0       /* line 26 */
+      BEQ L13
+      DIV R5 R10 R27       /* line 27 */
+      ADD R28 R28 R5
+      STORE R28 _s
+      BT L14               /* line 28 */
+L13:  ADDI R28 R28 #1      /* line 29 */
+      STORE R28 _s
+L14:  ADDI R1 R1 #1        /* line 30 */
+      STORE R1 _i          /* line 31 */
+      SUB R6 R1 R26
+      BLT L12
+L11:  WRITE R28 0          /* line 32 */
+      ADDI R1 R0 #0        /* line 35 */
+      STORE R1 _i
+      ADDI R28 R0 #0       /* line 36 */
+      STORE R28 _s
+      SUB R3 R11 R26
+      BGE L15
+      NOP
+L16:  SUBI R8 R1 #2        /* line 39 */
+      BLE L17
+      DIV R2 R12 R27       /* line 40 */
+      ADD R28 R28 R2
+      STORE R28 _s
+L17:  ADDI R1 R1 #1        /* line 41 */
+      STORE R1 _i          /* line 42 */
+      SUB R4 R1 R26
+      BLT L16
+L15:  WRITE R28 0          /* line 43 */
+      ADDI R1 R0 #3        /* line 46 */
+      STORE R1 _i
+      ADDI R28 R0 #0       /* line 47 */
+      STORE R28 _s
+      SUB R5 R13 R26
+      BGE L18
+      NOP
+L19:  DIV R6 R14 R27       /* line 50 */
+      ADD R28 R28 R6
+      STORE R28 _s
+      ADDI R1 R1 #1        /* line 51 */
+      STORE R1 _i          /* line 52 */
+      SUB R3 R1 R26
+      BLT L19
+L18:  WRITE R28 0          /* line 53 */
+      ADDI R1 R0 #0        /* line 55 */
+      STORE R1 _i
+      ADDI R28 R0 #0       /* line 56 */
+      STORE R28 _s
+      SUB R8 R15 R26
+      BGE L20
+      ADD R2 R16 R27
+L21:  SUBI R4 R27 #0       /* line 59 */
+      BLT L23
+      SUBI R5 R27 #8       /* line 60 */
+      BGE L23
+      ADD R6 R0 (R2)       /* line 61 */
+      ADD R28 R28 R6
+      STORE R28 _s
+L23:  ADDI R1 R1 #1        /* line 62 */
+      STORE R1 _i          /* line 63 */
+      SUB R3 R1 R26
+      BLT L21
+L20:  WRITE R28 0          /* line 64 */
+      ADD (R17) R0 R18
+      ADDI R1 R0 #0        /* line 68 */
+      STORE R1 _i
+      ADDI R28 R0 #0       /* line 69 */
+      STORE R28 _s
+      SUB R8 R19 R26
+      BGE L24
+      NOP
+L25:  ADD R4 R0 (R20)      /* line 72 */
+      ADD R28 R28 R4
+      STORE R28 _s
+      ADDI R5 R4 #1        /* line 73 */
+      ADD (R20) R0 R5
+      ADDI R1 R1 #1        /* line 74 */
+      STORE R1 _i          /* line 75 */
+      SUB R6 R1 R26
+      BLT L25
+L24:  WRITE R28 0          /* line 76 */
+      ADD (R21) R0 R22
+      ADDI R3 R0 #-1       /* line 80 */
+      STORE R3 _x
+      ADDI R1 R0 #0        /* line 81 */
+      STORE R1 _i
+      SUB R2 R23 R26
+      BGE L26
+      MULI R3 R27 #3
+L27:  STORE R3 _x          /* line 84 */
+      ADDI R1 R1 #1        /* line 85 */
+      STORE R1 _i          /* line 86 */
+      SUB R8 R1 R26
+      BLT L27
+L26:  WRITE R3 0           /* line 87 */
+      ADDI R3 R0 #-1       /* line 91 */
+      STORE R3 _x
+      ADDI R1 R0 #0        /* line 92 */
+      STORE R1 _i
+      SUB R4 R24 R26
+      BGE L28
+      MULI R3 R27 #5
+L29:  SUBI R5 R1 #2        /* line 95 */
+      BNE L30
+      STORE R3 _x          /* line 96 */
+L30:  ADDI R1 R1 #1        /* line 97 */
+      STORE R1 _i          /* line 98 */
+      SUB R6 R1 R26
+      BLT L29
+L28:  LOAD R3 _x
+      WRITE R3 0           /* line 99 */
+      ADDI R3 R0 #5        /* line 102 */
+      STORE R3 _x
+      ADDI R28 R0 #0       /* line 103 */
+      STORE R28 _s
+      ADDI R1 R0 #0        /* line 104 */
+      STORE R1 _i
+      SUB R2 R25 R26
+      BGE L31
+      MULI R8 R27 #3
+L32:  ADD R28 R28 R3       /* line 107 */
+      STORE R28 _s
+      ADD R3 R0 R8         /* line 108 */
+      STORE R3 _x
+      ADDI R1 R1 #1        /* line 109 */
+      STORE R1 _i          /* line 110 */
+      SUB R4 R1 R26
+      BLT L32
+L31:  WRITE R28 0          /* line 111 */
+      SUBI R7 R7 #1        /* line 113 */
+      STORE R7 _k          /* line 114 */
+      SUBI R5 R7 #0
+      BGT L10
+L9:   HALT                 /* line 115 */
@@ -0,0 +1,169 @@
+      .data
+_v:   .SPACE 4
+_a:   .WORD 0
+_b:   .WORD 0
+_d:   .WORD 0
+_x:   .WORD 0
+_i:   .WORD 0
+_k:   .WORD 0
+      .text
+      MOVA R1 _v           /* line 9 */
+      ADDI R2 R1 #2
+      ADDI R3 R0 #7
+      ADD (R2) R0 R3
+      READ R4 0            /* line 11 */
+      STORE R4 _k          /* line 12 */
+      SUBI R5 R4 #0
+      BLE L7
+      ADDI R6 R0 #100
+      ADDI R7 R0 #1
+      ADDI R8 R0 #0
+      ADDI R9 R0 #100
+      ADDI R10 R0 #0
+      ADDI R11 R0 #1
+      MOVA R12 _v
+      ADDI R13 R0 #1
+      ADDI R14 R0 #0
+      MOVA R15 _v
+      ADDI R16 R0 #1
+      ADDI R17 R0 #0
+      ADDI R18 R0 #1       /* line 23 */
+      ADDI R19 R0 #0
+      ADDI R20 R0 #12
+      ADDI R21 R0 #1
+      ADDI R22 R0 #0
+      ADDI R23 R0 #60
+      ADDI R24 R0 #0
+      ADDI R25 R0 #1       /* line 25 */
+      MOVA R26 _v
+      ADD R26 R0 (R26)
+      MOVA R27 _v
+L8:   ADDI R6 R0 #100
+      READ R28 0           /* line 14 */
+      STORE R28 _a
+      READ R1 0            /* line 15 */
+      STORE R1 _b
+      READ R2 0            /* line 16 */
+      STORE R2 _d          /* line 18 */
+      SUBI R3 R2 #0
+      BEQ L9               /* line 18 */
+      DIV R5 R6 R2
+      SUBI R3 R5 #10
+      BLE L9               /* line 18 */
+      WRITE R7 0
+      BT L10
+L9:   WRITE R8 0
+L10:  SUBI R3 R2 #0        /* line 19 */
+      BEQ L12              /* line 19 */
+      DIV R5 R9 R2
+      SUBI R3 R5 #10
+      BGE L11              /* line 19 */
+L12:  WRITE R11 0
+      BT L13
+L11:  WRITE R10 0
+L13:  SUBI R3 R2 #0        /* line 20 */
+      BLT L14              /* line 20 */
+      SUBI R5 R2 #4
+      BGE L14              /* line 20 */
+      ADD R3 R12 R2
+      ADD R3 R0 (R3)
+      SUBI R5 R3 #7
+      BNE L14              /* line 20 */
+      WRITE R13 0
+      BT L15
+L14:  WRITE R14 0
+L15:  SUBI R3 R2 #0        /* line 21 */
+      BLT L16              /* line 21 */
+      SUBI R5 R2 #3
+      BGT L16              /* line 21 */
+      ADD R3 R15 R2
+      ADD R3 R0 (R3)
+      SUBI R5 R3 #7
+      BEQ L16              /* line 21 */
+      WRITE R16 0
+      BT L17
+L16:  WRITE R17 0
+L17:  ANDB R3 R28 R28      /* line 23 */
+      BEQ L20
+      ANDB R5 R1 R1        /* line 23 */
+      BNE L19
+L20:  ANDB R3 R28 R28      /* line 23 */
+      BNE L18
+      ANDB R5 R1 R1        /* line 23 */
+      BNE L18
+L19:  WRITE R18 0
+      BT L21
+L18:  WRITE R19 0
+L21:  SUBI R3 R28 #0       /* line 24 */
+      BLE L22              /* line 24 */
+      SUBI R5 R1 #0
+      BGT L23              /* line 24 */
+      SUBI R3 R2 #0
+      BEQ L22              /* line 24 */
+      DIV R5 R20 R2
+      SUBI R3 R5 #3
+      BNE L22              /* line 24 */
+L23:  WRITE R21 0
+      BT L24
+L22:  WRITE R22 0
+L24:  ANDB R3 R28 R28      /* line 25 */
+      BNE L27
+      ANDB R5 R1 R1        /* line 25 */
+      BEQ L26
+L27:  SUBI R3 R2 #0
+      BEQ L26              /* line 25 */
+      DIV R5 R23 R2
+      SUB R3 R5 R28
+      BGT L25              /* line 25 */
+L26:  WRITE R25 0
+      BT L28
+L25:  WRITE R24 0
+L28:  ANDL R3 R28 R1       /* line 28 */
+      ORL R5 R3 R2
+      WRITE R5 0           /* line 29 */
+      NOTL R3 R28 #0       /* line 30 */
+      NOTL R2 R2 #0
+      ORL R6 R1 R2
+      ANDL R5 R3 R6
+      STORE R5 _x          /* line 31 */
+      WRITE R5 0
+      SUB R3 R28 R1        /* line 32 */
+      SLT R6 0
+      NOTL R5 R6 #0
+      NOTL R1 R2 #0
+      ADD R3 R5 R1
+      WRITE R3 0
+      ADDI R6 R0 #0        /* line 34 */
+      STORE R6 _i
+      SUBI R2 R26 #7
+      BNE L36              /* line 35 */
+L31:  NOP
+L36:  NOP
+      ADD R1 R27 R6
+L30:  ADDI R6 R6 #1        /* line 36 */
+      ADDI R1 R1 #1
+      STORE R6 _i
+      SUBI R5 R6 #4
+      BGE L33
+      ADD R3 R0 (R1)
+      SUBI R2 R3 #7
+      BNE L30
+L33:  SUBI R5 R6 #0
+      BEQ L30
+L29:  WRITE R6 0           /* line 37 */
+      ADDI R6 R0 #0        /* line 39 */
+      STORE R6 _i
+L34:  ADDI R6 R6 #1        /* line 41 */
+      STORE R6 _i          /* line 42 */
+      SUBI R2 R6 #3
+      BGE L35              /* line 42 */
+      SUB R3 R6 R28
+      BEQ L35              /* line 42 */
+      SUBI R5 R6 #10
+      BLT L34              /* line 42 */
+L35:  WRITE R6 0           /* line 43 */
+      SUBI R4 R4 #1        /* line 45 */
+      STORE R4 _k          /* line 46 */
+      SUBI R1 R4 #0
+      BGT L8
+L7:   HALT                 /* line 47 */
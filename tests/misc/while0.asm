@@ -0,0 +1,7 @@
+      .data
+_x:   .WORD 0
+      .text
+      READ R1 0            /* line 3 */
+      STORE R1 _x
+L1:   WRITE R1 0           /* line 9 */
+      HALT                 /* line 10 */
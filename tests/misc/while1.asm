@@ -0,0 +1,34 @@
+      .data
+_a:   .SPACE 10
+_x:   .WORD 0
+_k:   .WORD 0
+      .text
+      NOP                  /* line 5 */
+      MOVA R1 _a
+      LOAD R2 _k
+      ADD R3 R1 R2
+L4:   READ R4 0            /* line 6 */
+      STORE R4 _x          /* line 7 */
+      ADD (R3) R0 R4
+      ADDI R2 R2 #1        /* line 8 */
+      ADDI R3 R3 #1
+      STORE R2 _k          /* line 9 */
+      SUBI R5 R2 #10
+      BLT L4
+L3:   MOVA R6 _a           /* line 10 */
+      ADDI R7 R6 #9
+      ADD R4 R0 (R7)
+      STORE R4 _x
+      ADDI R2 R0 #0        /* line 13 */
+      MOVA R8 _a
+      ADD R9 R8 R2
+      STORE R2 _k
+L6:   ADD R10 R0 (R9)      /* line 17 */
+      SUB R11 R4 R10
+      BNE L7
+      WRITE R2 0           /* line 18 */
+      HALT                 /* line 19 */
+L7:   ADDI R2 R2 #1        /* line 21 */
+      ADDI R9 R9 #1
+      STORE R2 _k
+      BT L6                /* line 22 */
@@ -0,0 +1,23 @@
+      .data
+_s:   .WORD 0
+_x:   .WORD 0
+      .text
+      READ R1 0            /* line 4 */
+      STORE R1 _x          /* line 6 */
+      SUBI R2 R1 #0
+      BLT L2
+      ANDB R3 R1 R1        /* line 7 */
+      BEQ L3
+L4:   LOAD R4 _s
+      ADD R4 R4 R1         /* line 8 */
+      STORE R4 _s
+      SUBI R1 R1 #1        /* line 9 */
+      STORE R1 _x          /* line 10 */
+      ANDB R5 R1 R1
+      BNE L4
+L3:   LOAD R4 _s
+      WRITE R4 0           /* line 11 */
+      BT L5                /* line 12 */
+L2:   ADDI R6 R0 #1        /* line 13 */
+      WRITE R6 0
+L5:   HALT                 /* line 15 */
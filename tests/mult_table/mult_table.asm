@@ -0,0 +1,15 @@
+      .data
+_value: .WORD 0
+_counter: .WORD 0
+      .text
+      READ R1 0            /* line 3 */
+      STORE R1 _value
+      ADDI R2 R0 #1        /* line 5 */
+      STORE R2 _counter
+L3:   MUL R3 R1 R2         /* line 9 */
+      WRITE R3 0
+      ADDI R2 R2 #1        /* line 10 */
+      STORE R2 _counter    /* line 11 */
+      SUBI R4 R2 #10
+      BLE L3
+L2:   HALT                 /* line 13 */
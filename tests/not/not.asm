@@ -0,0 +1,31 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+      .text
+      ADDI R1 R0 #1        /* line 4 */
+      WRITE R1 0
+      ADDI R2 R0 #0        /* line 6 */
+      WRITE R2 0
+      ADDI R3 R0 #1        /* line 8 */
+      WRITE R3 0
+      ADDI R4 R0 #0        /* line 10 */
+      WRITE R4 0
+      ADDI R5 R0 #0        /* line 12 */
+      WRITE R5 0
+      ADDI R6 R0 #1        /* line 14 */
+      WRITE R6 0
+      ADDI R7 R0 #-1       /* line 16 */
+      WRITE R7 0
+      ADDI R8 R0 #5        /* line 18 */
+      WRITE R8 0
+      ADDI R9 R0 #5        /* line 20 */
+      WRITE R9 0
+      READ R10 0           /* line 22 */
+      STORE R10 _b         /* line 24 */
+      NOTL R11 R10 #0
+      ADD R12 R0 R11
+      WRITE R12 0          /* line 25 */
+      NOTL R12 R11 #0      /* line 26 */
+      STORE R12 _a         /* line 27 */
+      WRITE R12 0
+      HALT                 /* line 28 */
@@ -0,0 +1,41 @@
+      .data
+_value: .WORD 0
+_result: .WORD 0
+_power: .WORD 0
+_negative: .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      STORE R1 _value
+      READ R2 0            /* line 9 */
+      STORE R2 _power      /* line 11 */
+      SUBI R3 R2 #0
+      BNE L4
+      ADDI R4 R0 #0        /* line 13 */
+      WRITE R4 0
+      HALT                 /* line 14 */
+L4:   SUBI R5 R2 #0        /* line 17 */
+      BGE L5
+      ADDI R6 R0 #1        /* line 19 */
+      STORE R6 _negative
+      SUB R2 R0 R2         /* line 20 */
+      STORE R2 _power
+      BT L6                /* line 22 */
+L5:   ADDI R6 R0 #0        /* line 23 */
+      STORE R6 _negative
+L6:   ADDI R7 R1 #0        /* line 25 */
+      STORE R7 _result
+      SUBI R8 R2 #1        /* line 26 */
+      BLE L7
+L8:   MUL R7 R7 R1         /* line 28 */
+      STORE R7 _result
+      SUBI R2 R2 #1        /* line 29 */
+      STORE R2 _power      /* line 30 */
+      SUBI R9 R2 #1
+      BGT L8
+L7:   SUBI R10 R6 #1       /* line 32 */
+      BNE L9
+      ADDI R11 R0 #1       /* line 33 */
+      DIV R7 R11 R7
+      STORE R7 _result
+L9:   WRITE R7 0           /* line 35 */
+      HALT                 /* line 37 */
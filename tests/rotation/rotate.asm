@@ -0,0 +1,115 @@
+      .data
+_v:   .SPACE 8
+_i:   .WORD 0
+_j:   .WORD 0
+_n:   .WORD 0
+_s:   .WORD 0
+_k:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      STORE R1 _k          /* line 9 */
+      SUBI R2 R1 #0
+      BLE L6
+      ADDI R3 R0 #0        /* line 15 */
+      MOVA R4 _v
+      MOVA R5 _v           /* line 31 */
+      MOVA R6 _v
+      ADDI R7 R0 #0
+      MOVA R8 _v
+      ADDI R9 R0 #0        /* line 43 */
+      ADDI R10 R0 #0       /* line 57 */
+L7:   READ R11 0           /* line 11 */
+      ADDI R12 R0 #0       /* line 13 */
+      STORE R12 _i
+      ADDI R13 R0 #0       /* line 14 */
+      STORE R13 _s
+      STORE R11 _n
+      SUB R14 R3 R11
+      BGE L8
+L9:   ADD R13 R13 R12      /* line 17 */
+      STORE R13 _s
+      ADDI R12 R12 #1      /* line 18 */
+      STORE R12 _i         /* line 19 */
+      SUB R15 R12 R11
+      BLT L9
+L8:   WRITE R13 0          /* line 20 */
+      WRITE R12 0          /* line 21 */
+      ADDI R12 R0 #0       /* line 24 */
+      ADD R16 R4 R12
+      STORE R12 _i
+L11:  SUB R17 R11 R12      /* line 27 */
+      ADD (R16) R0 R17
+      ADDI R12 R12 #1      /* line 28 */
+      ADDI R16 R16 #1
+      STORE R12 _i         /* line 29 */
+      SUBI R18 R12 #8
+      BLT L11
+L10:  ADDI R12 R0 #0       /* line 30 */
+      STORE R12 _i
+      ADD R19 R0 (R5)
+      SUBI R20 R19 #0
+      BLE L12
+      NOP
+L13:  ADD R21 R6 R12       /* line 33 */
+      ADD (R21) R0 R7
+      ADDI R12 R12 #1      /* line 34 */
+      STORE R12 _i         /* line 35 */
+      SUBI R22 R12 #8
+      BNE L14
+      ADDI R12 R0 #0       /* line 36 */
+      STORE R12 _i
+L14:  ADD R23 R8 R12       /* line 37 */
+      ADD R23 R0 (R23)
+      SUBI R24 R23 #0
+      BGT L13
+L12:  WRITE R12 0          /* line 38 */
+      ADDI R12 R0 #0       /* line 41 */
+      STORE R12 _i
+      ADDI R13 R0 #0       /* line 42 */
+      STORE R13 _s
+      SUB R25 R9 R11
+      BGE L15
+L16:  STORE R12 _j         /* line 46 */
+      SUBI R26 R12 #3
+      BGE L17
+L18:  ADDI R13 R13 #1      /* line 48 */
+      STORE R13 _s
+      ADDI R12 R12 #1      /* line 49 */
+      STORE R12 _j         /* line 50 */
+      SUBI R27 R12 #3
+      BLT L18
+L17:  LOAD R12 _i
+      ADDI R12 R12 #1      /* line 51 */
+      STORE R12 _i         /* line 52 */
+      SUB R28 R12 R11
+      BLT L16
+L15:  WRITE R13 0          /* line 53 */
+      ADDI R12 R0 #0       /* line 56 */
+      STORE R12 _i
+      SUB R2 R10 R11
+      BGE L21              /* line 57 */
+      BT L20               /* line 57 */
+L21:  BT L19               /* line 57 */
+L20:  ADDI R12 R12 #1      /* line 58 */
+      STORE R12 _i
+      SUB R14 R12 R11
+      BGE L23
+      ADDI R15 R12 #0
+      MUL R17 R15 R12
+      SUBI R18 R17 #20
+      BLT L20
+L23:  SUBI R16 R12 #1
+      BEQ L20
+L19:  WRITE R12 0          /* line 59 */
+      SUBI R19 R11 #0      /* line 62 */
+      BGE L24
+L25:  ADDI R11 R11 #1      /* line 63 */
+      STORE R11 _n
+      SUBI R20 R11 #0
+      BLT L25
+L24:  WRITE R11 0          /* line 64 */
+      SUBI R1 R1 #1        /* line 66 */
+      STORE R1 _k          /* line 67 */
+      SUBI R21 R1 #0
+      BGT L7
+L6:   HALT                 /* line 68 */
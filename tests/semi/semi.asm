@@ -0,0 +1,15 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+      .text
+      NOP                  /* line 4 */
+      READ R1 0            /* line 6 */
+      READ R2 0            /* line 7 */
+      STORE R1 _a          /* line 9 */
+      STORE R2 _b
+      ADD R3 R1 R2
+      NOP                  /* line 11 */
+      STORE R3 _c          /* line 13 */
+      WRITE R3 0
+      HALT                 /* line 14 */
@@ -0,0 +1,129 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+      .text
+      ADDI R1 R0 #-1       /* line 6 */
+      WRITE R1 0
+      ADDI R2 R0 #-1       /* line 7 */
+      WRITE R2 0
+      ADDI R3 R0 #-1       /* line 8 */
+      WRITE R3 0
+      ADDI R4 R0 #-1       /* line 9 */
+      WRITE R4 0
+      ADDI R5 R0 #-1       /* line 12 */
+      WRITE R5 0
+      ADDI R6 R0 #32       /* line 13 */
+      ADDI R7 R0 #-1
+      SHR R8 R7 R6
+      WRITE R8 0
+      ADDI R9 R0 #-1       /* line 14 */
+      SHRI R10 R9 #32
+      WRITE R10 0
+      WRITE R8 0           /* line 15 */
+      ADDI R11 R0 #-1      /* line 18 */
+      WRITE R11 0
+      ADDI R12 R0 #33      /* line 19 */
+      ADDI R13 R0 #-1
+      SHR R14 R13 R12
+      WRITE R14 0
+      ADDI R15 R0 #-1      /* line 20 */
+      SHRI R16 R15 #33
+      WRITE R16 0
+      WRITE R14 0          /* line 21 */
+      ADDI R17 R0 #0       /* line 26 */
+      WRITE R17 0
+      ADDI R18 R0 #0       /* line 27 */
+      WRITE R18 0
+      ADDI R19 R0 #0       /* line 28 */
+      WRITE R19 0
+      ADDI R20 R0 #0       /* line 29 */
+      WRITE R20 0
+      ADDI R21 R0 #0       /* line 32 */
+      WRITE R21 0
+      ADDI R22 R0 #32      /* line 33 */
+      ADDI R23 R0 #16384
+      SHLI R23 R23 #16
+      SHR R24 R23 R22
+      WRITE R24 0
+      ADDI R25 R0 #16384   /* line 34 */
+      SHLI R25 R25 #16
+      SHRI R26 R25 #32
+      WRITE R26 0
+      WRITE R24 0          /* line 35 */
+      ADDI R27 R0 #0       /* line 38 */
+      WRITE R27 0
+      ADDI R28 R0 #33      /* line 39 */
+      ADDI R1 R0 #16384
+      SHLI R1 R1 #16
+      SHR R2 R1 R28
+      WRITE R2 0
+      ADDI R3 R0 #16384    /* line 40 */
+      SHLI R3 R3 #16
+      SHRI R4 R3 #33
+      WRITE R4 0
+      WRITE R2 0           /* line 41 */
+      ADDI R5 R0 #-32768   /* line 46 */
+      SHLI R5 R5 #16
+      WRITE R5 0
+      ADDI R6 R0 #-32768   /* line 47 */
+      SHLI R6 R6 #16
+      WRITE R6 0
+      ADDI R7 R0 #-32768   /* line 48 */
+      SHLI R7 R7 #16
+      WRITE R7 0
+      ADDI R9 R0 #-32768   /* line 49 */
+      SHLI R9 R9 #16
+      WRITE R9 0
+      ADDI R10 R0 #0       /* line 53 */
+      WRITE R10 0
+      ADDI R8 R0 #32       /* line 54 */
+      ADDI R11 R0 #-1
+      SHL R12 R11 R8
+      WRITE R12 0
+      ADDI R13 R0 #-1      /* line 55 */
+      SHLI R15 R13 #32
+      WRITE R15 0
+      WRITE R12 0          /* line 56 */
+      ADDI R16 R0 #0       /* line 59 */
+      WRITE R16 0
+      ADDI R14 R0 #33      /* line 60 */
+      ADDI R17 R0 #-1
+      SHL R18 R17 R14
+      WRITE R18 0
+      ADDI R19 R0 #-1      /* line 61 */
+      SHLI R20 R19 #33
+      WRITE R20 0
+      WRITE R18 0          /* line 62 */
+      ADDI R21 R0 #-32768  /* line 67 */
+      SHLI R21 R21 #16
+      WRITE R21 0
+      ADDI R22 R0 #-32768  /* line 68 */
+      SHLI R22 R22 #16
+      WRITE R22 0
+      ADDI R23 R0 #-32768  /* line 69 */
+      SHLI R23 R23 #16
+      WRITE R23 0
+      ADDI R25 R0 #-32768  /* line 70 */
+      SHLI R25 R25 #16
+      WRITE R25 0
+      ADDI R26 R0 #0       /* line 74 */
+      WRITE R26 0
+      ADDI R24 R0 #32      /* line 75 */
+      ADDI R27 R0 #1
+      SHL R1 R27 R24
+      WRITE R1 0
+      ADDI R28 R0 #1       /* line 76 */
+      SHLI R3 R28 #32
+      WRITE R3 0
+      WRITE R1 0           /* line 77 */
+      ADDI R4 R0 #0        /* line 80 */
+      WRITE R4 0
+      ADDI R2 R0 #33       /* line 81 */
+      ADDI R5 R0 #1
+      SHL R6 R5 R2
+      WRITE R6 0
+      ADDI R7 R0 #1        /* line 82 */
+      SHLI R9 R7 #33
+      WRITE R9 0
+      WRITE R6 0           /* line 83 */
+      HALT                 /* line 84 */
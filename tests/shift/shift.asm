@@ -0,0 +1,17 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_shl: .WORD 0
+_shr: .WORD 0
+      .text
+      READ R1 0            /* line 3 */
+      READ R2 0            /* line 4 */
+      SHL R3 R1 R2         /* line 6 */
+      STORE R1 _a          /* line 7 */
+      STORE R2 _b
+      SHR R4 R1 R2
+      STORE R3 _shl        /* line 9 */
+      WRITE R3 0
+      STORE R4 _shr        /* line 10 */
+      WRITE R4 0
+      HALT                 /* line 11 */
@@ -0,0 +1,253 @@
+      .data
+_v00: .WORD 0
+_v01: .WORD 0
+_v02: .WORD 0
+_v03: .WORD 0
+_v04: .WORD 0
+_v05: .WORD 0
+_v06: .WORD 0
+_v07: .WORD 0
+_v08: .WORD 0
+_v09: .WORD 0
+_v0A: .WORD 0
+_v0B: .WORD 0
+_v0C: .WORD 0
+_v0D: .WORD 0
+_v0E: .WORD 0
+_v0F: .WORD 0
+_v10: .WORD 0
+_v11: .WORD 0
+_v12: .WORD 0
+_v13: .WORD 0
+_v14: .WORD 0
+_v15: .WORD 0
+_v16: .WORD 0
+_v17: .WORD 0
+_v18: .WORD 0
+_v19: .WORD 0
+_v1A: .WORD 0
+_v1B: .WORD 0
+_v1C: .WORD 0
+_v1D: .WORD 0
+_v1E: .WORD 0
+_v1F: .WORD 0
+_v20: .WORD 0
+_v21: .WORD 0
+_v22: .WORD 0
+_v23: .WORD 0
+_v24: .WORD 0
+_v25: .WORD 0
+_v26: .WORD 0
+_v27: .WORD 0
+_v28: .WORD 0
+_v29: .WORD 0
+_v2A: .WORD 0
+_v2B: .WORD 0
+_v2C: .WORD 0
+_v2D: .WORD 0
+_v2E: .WORD 0
+_v2F: .WORD 0
+L48:  .WORD 0
+L49:  .WORD 0
+L50:  .WORD 0
+L51:  .WORD 0
+L52:  .WORD 0
+L53:  .WORD 0
+L54:  .WORD 0
+L55:  .WORD 0
+L56:  .WORD 0
+L57:  .WORD 0
+L58:  .WORD 0
+L59:  .WORD 0
+L60:  .WORD 0
+L61:  .WORD 0
+L62:  .WORD 0
+L63:  .WORD 0
+L64:  .WORD 0
+L65:  .WORD 0
+L66:  .WORD 0
+L67:  .WORD 0
+      .text
+      READ R29 0           /* line 5 */
+      STORE R29 L48
+      READ R29 0           /* line 6 */
+      STORE R29 L49
+      READ R29 0           /* line 7 */
+      STORE R29 L50
+      READ R29 0           /* line 8 */
+      STORE R29 L51
+      READ R29 0           /* line 9 */
+      STORE R29 L52
+      READ R29 0           /* line 10 */
+      STORE R29 L53
+      READ R29 0           /* line 11 */
+      STORE R29 L54
+      READ R29 0           /* line 12 */
+      STORE R29 L55
+      READ R29 0           /* line 13 */
+      STORE R29 L56
+      READ R29 0           /* line 14 */
+      STORE R29 L57
+      READ R29 0           /* line 15 */
+      STORE R29 L58
+      READ R29 0           /* line 16 */
+      STORE R29 L59
+      READ R29 0           /* line 17 */
+      STORE R29 L60
+      READ R29 0           /* line 18 */
+      STORE R29 L61
+      READ R29 0           /* line 19 */
+      STORE R29 L62
+      READ R29 0           /* line 20 */
+      STORE R29 L63
+      READ R29 0           /* line 21 */
+      STORE R29 L64
+      READ R29 0           /* line 22 */
+      STORE R29 L65
+      READ R29 0           /* line 23 */
+      STORE R29 L66
+      READ R29 0           /* line 24 */
+      READ R21 0           /* line 25 */
+      READ R22 0           /* line 26 */
+      READ R23 0           /* line 27 */
+      READ R24 0           /* line 28 */
+      READ R25 0           /* line 29 */
+      READ R26 0           /* line 30 */
+      READ R27 0           /* line 31 */
+      READ R28 0           /* line 32 */
+      READ R1 0            /* line 33 */
+      READ R2 0            /* line 34 */
+      READ R3 0            /* line 35 */
+      READ R4 0            /* line 36 */
+      READ R5 0            /* line 37 */
+      READ R6 0            /* line 38 */
+      READ R7 0            /* line 39 */
+      READ R8 0            /* line 40 */
+      READ R9 0            /* line 41 */
+      READ R10 0           /* line 42 */
+      READ R11 0           /* line 43 */
+      READ R12 0           /* line 44 */
+      READ R13 0           /* line 45 */
+      READ R14 0           /* line 46 */
+      READ R15 0           /* line 47 */
+      READ R16 0           /* line 48 */
+      READ R17 0           /* line 49 */
+      READ R18 0           /* line 50 */
+      READ R19 0           /* line 51 */
+      READ R20 0           /* line 52 */
+      STORE R20 _v2F       /* line 53 */
+      WRITE R20 0
+      STORE R19 _v2E       /* line 54 */
+      WRITE R19 0
+      STORE R18 _v2D       /* line 55 */
+      WRITE R18 0
+      STORE R17 _v2C       /* line 56 */
+      WRITE R17 0
+      STORE R16 _v2B       /* line 57 */
+      WRITE R16 0
+      STORE R15 _v2A       /* line 58 */
+      WRITE R15 0
+      STORE R14 _v29       /* line 59 */
+      WRITE R14 0
+      STORE R13 _v28       /* line 60 */
+      WRITE R13 0
+      STORE R12 _v27       /* line 61 */
+      WRITE R12 0
+      STORE R11 _v26       /* line 62 */
+      WRITE R11 0
+      STORE R10 _v25       /* line 63 */
+      WRITE R10 0
+      STORE R9 _v24        /* line 64 */
+      WRITE R9 0
+      STORE R8 _v23        /* line 65 */
+      WRITE R8 0
+      STORE R7 _v22        /* line 66 */
+      WRITE R7 0
+      STORE R6 _v21        /* line 67 */
+      WRITE R6 0
+      STORE R5 _v20        /* line 68 */
+      WRITE R5 0
+      STORE R4 _v1F        /* line 69 */
+      WRITE R4 0
+      STORE R3 _v1E        /* line 70 */
+      WRITE R3 0
+      STORE R2 _v1D        /* line 71 */
+      WRITE R2 0
+      STORE R1 _v1C        /* line 72 */
+      WRITE R1 0
+      STORE R28 _v1B       /* line 73 */
+      WRITE R28 0
+      STORE R27 _v1A       /* line 74 */
+      WRITE R27 0
+      STORE R26 _v19       /* line 75 */
+      WRITE R26 0
+      STORE R25 _v18       /* line 76 */
+      WRITE R25 0
+      STORE R24 _v17       /* line 77 */
+      WRITE R24 0
+      STORE R23 _v16       /* line 78 */
+      WRITE R23 0
+      STORE R22 _v15       /* line 79 */
+      WRITE R22 0
+      STORE R21 _v14       /* line 80 */
+      WRITE R21 0
+      STORE R29 _v13       /* line 81 */
+      WRITE R29 0
+      LOAD R29 L66
+      STORE R29 _v12       /* line 82 */
+      WRITE R29 0
+      LOAD R29 L65
+      STORE R29 _v11       /* line 83 */
+      WRITE R29 0
+      LOAD R29 L64
+      STORE R29 _v10       /* line 84 */
+      WRITE R29 0
+      LOAD R29 L63
+      STORE R29 _v0F       /* line 85 */
+      WRITE R29 0
+      LOAD R29 L62
+      STORE R29 _v0E       /* line 86 */
+      WRITE R29 0
+      LOAD R29 L61
+      STORE R29 _v0D       /* line 87 */
+      WRITE R29 0
+      LOAD R29 L60
+      STORE R29 _v0C       /* line 88 */
+      WRITE R29 0
+      LOAD R29 L59
+      STORE R29 _v0B       /* line 89 */
+      WRITE R29 0
+      LOAD R29 L58
+      STORE R29 _v0A       /* line 90 */
+      WRITE R29 0
+      LOAD R29 L57
+      STORE R29 _v09       /* line 91 */
+      WRITE R29 0
+      LOAD R29 L56
+      STORE R29 _v08       /* line 92 */
+      WRITE R29 0
+      LOAD R29 L55
+      STORE R29 _v07       /* line 93 */
+      WRITE R29 0
+      LOAD R29 L54
+      STORE R29 _v06       /* line 94 */
+      WRITE R29 0
+      LOAD R29 L53
+      STORE R29 _v05       /* line 95 */
+      WRITE R29 0
+      LOAD R29 L52
+      STORE R29 _v04       /* line 96 */
+      WRITE R29 0
+      LOAD R29 L51
+      STORE R29 _v03       /* line 97 */
+      WRITE R29 0
+      LOAD R29 L50
+      STORE R29 _v02       /* line 98 */
+      WRITE R29 0
+      LOAD R29 L49
+      STORE R29 _v01       /* line 99 */
+      WRITE R29 0
+      LOAD R29 L48
+      STORE R29 _v00       /* line 100 */
+      WRITE R29 0
+      HALT                 /* line 101 */
@@ -0,0 +1,155 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_c:   .WORD 0
+_t:   .WORD 0
+_i:   .WORD 0
+_n:   .WORD 0
+_s:   .WORD 0
+_k:   .WORD 0
+      .text
+      READ R1 0            /* line 8 */
+      STORE R1 _k          /* line 9 */
+      SUBI R2 R1 #0
+      BLE L8
+      ADDI R3 R0 #0        /* line 17 */
+      ADDI R4 R0 #0        /* line 30 */
+      ADDI R5 R0 #0        /* line 76 */
+L9:   READ R6 0            /* line 11 */
+      ADDI R7 R0 #0        /* line 14 */
+      STORE R7 _a
+      ADDI R7 R0 #1        /* line 15 */
+      STORE R7 _b
+      ADDI R8 R0 #0        /* line 16 */
+      STORE R8 _i
+      STORE R6 _n
+      SUB R9 R3 R6
+      BGE L10
+L11:  LOAD R7 _a
+      ADDI R10 R7 #0       /* line 19 */
+      LOAD R7 _b
+      ADD R11 R10 R7
+      STORE R7 _a          /* line 20 */
+      ADDI R7 R11 #0       /* line 21 */
+      STORE R11 _t
+      STORE R7 _b
+      ADDI R8 R8 #1        /* line 22 */
+      STORE R8 _i          /* line 23 */
+      SUB R12 R8 R6
+      BLT L11
+L10:  LOAD R7 _a
+      WRITE R7 0           /* line 24 */
+      ADDI R7 R0 #1        /* line 27 */
+      STORE R7 _a
+      ADDI R7 R0 #2        /* line 28 */
+      STORE R7 _b
+      ADDI R8 R0 #0        /* line 29 */
+      STORE R8 _i
+      SUB R13 R4 R6
+      BGE L12
+L13:  LOAD R7 _a
+      ADDI R11 R7 #0       /* line 32 */
+      LOAD R7 _b
+      STORE R7 _a          /* line 33 */
+      ADDI R7 R11 #0       /* line 34 */
+      STORE R11 _t
+      STORE R7 _b
+      ADDI R8 R8 #1        /* line 35 */
+      STORE R8 _i          /* line 36 */
+      SUB R14 R8 R6
+      BLT L13
+L12:  LOAD R7 _a
+      MULI R15 R7 #10      /* line 37 */
+      LOAD R7 _b
+      ADD R16 R15 R7
+      WRITE R16 0
+      ADDI R7 R0 #1        /* line 40 */
+      STORE R7 _a
+      ADDI R7 R0 #2        /* line 41 */
+      STORE R7 _b
+      ADDI R7 R0 #3        /* line 42 */
+      STORE R7 _c
+      ADDI R8 R0 #0        /* line 43 */
+      STORE R8 _i
+L14:  LOAD R7 _a
+      ADDI R11 R7 #0       /* line 45 */
+      LOAD R7 _b
+      STORE R7 _a          /* line 46 */
+      LOAD R7 _c
+      STORE R7 _b          /* line 47 */
+      ADDI R7 R11 #0       /* line 48 */
+      STORE R11 _t
+      STORE R7 _c
+      ADDI R8 R8 #1        /* line 49 */
+      STORE R8 _i          /* line 50 */
+      SUB R17 R8 R6
+      BLT L14
+      LOAD R7 _a
+      MULI R18 R7 #100     /* line 51 */
+      LOAD R7 _b
+      MULI R19 R7 #10
+      ADD R20 R18 R19
+      LOAD R7 _c
+      ADD R21 R20 R7
+      WRITE R21 0
+      ADDI R8 R0 #0        /* line 55 */
+      STORE R8 _i
+L15:  ADDI R22 R8 #0       /* line 57 */
+      STORE R22 _s
+      ADDI R8 R8 #1        /* line 58 */
+      STORE R8 _i          /* line 59 */
+      SUB R23 R8 R6
+      BLT L15
+      WRITE R22 0          /* line 60 */
+      WRITE R8 0           /* line 61 */
+      SUBI R24 R6 #5       /* line 63 */
+      BLE L16
+      ADDI R7 R0 #10       /* line 64 */
+      STORE R7 _a
+      BT L19               /* line 65 */
+L16:  SUBI R25 R6 #2
+      BLE L18
+      ADDI R7 R0 #20       /* line 66 */
+      STORE R7 _a
+      BT L19               /* line 67 */
+L18:  ADDI R7 R0 #30       /* line 68 */
+      STORE R7 _a
+L19:  WRITE R7 0           /* line 69 */
+      SUBI R26 R6 #4       /* line 73 */
+      SLT R7 0
+      STORE R7 _a
+      SUBI R27 R6 #4       /* line 74 */
+      SEQ R28 0
+      SUBI R2 R6 #4
+      SGT R9 0
+      MULI R10 R9 #2
+      ADD R7 R28 R10
+      STORE R7 _b
+      ADDI R8 R0 #0        /* line 75 */
+      STORE R8 _i
+      SUB R12 R5 R6
+      BGE L20
+L21:  LOAD R7 _a
+      SUBI R13 R8 #2       /* line 78 */
+      SGE R14 0
+      ADD R7 R7 R14
+      STORE R7 _a
+      ADDI R8 R8 #1        /* line 79 */
+      STORE R8 _i          /* line 80 */
+      SUB R15 R8 R6
+      BLT L21
+L20:  LOAD R7 _a
+      MULI R16 R7 #10      /* line 81 */
+      LOAD R7 _b
+      ADD R17 R16 R7
+      WRITE R17 0
+      SUBI R18 R6 #4       /* line 84 */
+      BNE L22
+      ADDI R11 R0 #99      /* line 85 */
+      STORE R11 _t
+L22:  WRITE R11 0          /* line 86 */
+      SUBI R1 R1 #1        /* line 88 */
+      STORE R1 _k          /* line 89 */
+      SUBI R19 R1 #0
+      BGT L9
+L8:   HALT                 /* line 90 */
@@ -0,0 +1,13 @@
+      .data
+_a:   .WORD 0
+_b:   .WORD 0
+_somma: .WORD 0
+      .text
+      READ R1 0            /* line 3 */
+      READ R2 0            /* line 4 */
+      STORE R1 _a          /* line 6 */
+      STORE R2 _b
+      ADD R3 R1 R2
+      STORE R3 _somma      /* line 8 */
+      WRITE R3 0
+      HALT                 /* line 9 */